@@ -0,0 +1,101 @@
+#include "allocation_counter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+thread_local std::size_t heap_allocations = 0;
+
+void* counted_malloc(std::size_t size)
+{
+    ++heap_allocations;
+    return std::malloc(size ? size : 1);
+}
+
+} // namespace
+
+// replacements of global allocation functions, see [replacement.functions]
+void* operator new(std::size_t size)
+{
+    void* ptr = counted_malloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+AllocationCounter::AllocationCounter() :
+    m_allocator { &allocate, &reallocate, &deallocate, this },
+    m_previous(asn_allocator_swap(&m_allocator)),
+    m_asn1(0), m_start(heap_allocations)
+{
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    asn_allocator_swap(m_previous);
+}
+
+std::size_t AllocationCounter::allocations() const
+{
+    return heap_allocations - m_start + m_asn1;
+}
+
+void AllocationCounter::reset()
+{
+    m_asn1 = 0;
+    m_start = heap_allocations;
+}
+
+void* AllocationCounter::allocate(void* context, std::size_t size)
+{
+    ++static_cast<AllocationCounter*>(context)->m_asn1;
+    return std::calloc(1, size);
+}
+
+void* AllocationCounter::reallocate(void* context, void* ptr, std::size_t size)
+{
+    ++static_cast<AllocationCounter*>(context)->m_asn1;
+    return std::realloc(ptr, size);
+}
+
+void AllocationCounter::deallocate(void*, void* ptr)
+{
+    std::free(ptr);
+}
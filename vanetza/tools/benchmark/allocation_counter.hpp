@@ -0,0 +1,40 @@
+#ifndef BENCHMARK_ALLOCATION_COUNTER_HPP
+#define BENCHMARK_ALLOCATION_COUNTER_HPP
+
+#include <vanetza/asn1/support/asn_allocator.h>
+#include <cstddef>
+
+/**
+ * AllocationCounter counts heap allocations of the calling thread.
+ *
+ * Both the global operator new and the allocator of asn1c's support code are covered.
+ * Only one counter should be active per thread at a time.
+ */
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    /**
+     * Get number of allocations since construction or last reset
+     */
+    std::size_t allocations() const;
+
+    void reset();
+
+private:
+    static void* allocate(void* context, std::size_t size);
+    static void* reallocate(void* context, void* ptr, std::size_t size);
+    static void deallocate(void* context, void* ptr);
+
+    asn_allocator_t m_allocator;
+    const asn_allocator_t* m_previous;
+    std::size_t m_asn1;
+    std::size_t m_start;
+};
+
+#endif /* BENCHMARK_ALLOCATION_COUNTER_HPP */
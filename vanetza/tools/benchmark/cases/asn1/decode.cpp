@@ -0,0 +1,184 @@
+#include "decode.hpp"
+#include "messages.hpp"
+#include <vanetza/asn1/arena.hpp>
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/mapem.hpp>
+#include <vanetza/asn1/support/asn_allocator.h>
+#include <vanetza/common/byte_buffer_pool.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+namespace
+{
+
+// forwards to C library but counts allocations
+struct CountingAllocator
+{
+    CountingAllocator() :
+        allocator { &allocate, &reallocate, &deallocate, this }, allocations(0)
+    {
+    }
+
+    static void* allocate(void* context, std::size_t size)
+    {
+        ++static_cast<CountingAllocator*>(context)->allocations;
+        return std::calloc(1, size);
+    }
+
+    static void* reallocate(void* context, void* ptr, std::size_t size)
+    {
+        ++static_cast<CountingAllocator*>(context)->allocations;
+        return std::realloc(ptr, size);
+    }
+
+    static void deallocate(void*, void* ptr)
+    {
+        std::free(ptr);
+    }
+
+    asn_allocator_t allocator;
+    std::size_t allocations;
+};
+
+} // namespace
+
+bool Asn1DecodeCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("objects", po::value<unsigned>(&objects)->default_value(50), "Number of perceived objects in CPM.")
+        ("lanes", po::value<unsigned>(&lanes)->default_value(16), "Number of lanes in MAPEM.")
+        ("rounds", po::value<unsigned>(&rounds)->default_value(10000), "Number of decodings per message.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (objects > 128) {
+            throw std::runtime_error("CPM carries at most 128 perceived objects.");
+        } else if (lanes < 1 || lanes > 255) {
+            throw std::runtime_error("MAPEM lanes have to be within 1 and 255.");
+        } else if (rounds == 0) {
+            throw std::runtime_error("At least one round is required.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void Asn1DecodeCase::prepare()
+{
+    cam = build_cam();
+    cpm = build_cpm(objects);
+    mapem = build_mapem(lanes);
+}
+
+int Asn1DecodeCase::execute()
+{
+    std::cout << std::left << std::setw(8) << "message" << std::right
+        << std::setw(8) << "bytes" << std::setw(10) << "mode"
+        << std::setw(14) << "ns/op" << std::setw(14) << "allocs/op" << std::endl;
+
+    bool success = true;
+    success &= measure<asn1::Cam>("CAM", cam);
+    success &= measure<asn1::Cpm>("CPM", cpm);
+    success &= measure<asn1::Mapem>("MAPEM", mapem);
+    return success ? 0 : 1;
+}
+
+template<typename MESSAGE>
+bool Asn1DecodeCase::measure(const char* name, const ByteBuffer& buffer)
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    CountingAllocator counter;
+    const asn_allocator_t* previous = asn_allocator_swap(&counter.allocator);
+    bool success = true;
+
+    // reference: every node of decoded message is allocated separately on heap
+    auto start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        MESSAGE message;
+        success &= message.decode(buffer);
+    }
+    const nanoseconds heap_time = duration_cast<nanoseconds>(clock::now() - start);
+    const std::size_t heap_allocations = counter.allocations;
+
+    // message and its nodes are placed in one arena per message, its blocks count as allocations
+    counter.allocations = 0;
+    std::size_t arena_blocks = 0;
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        MESSAGE message;
+        auto arena = std::make_shared<asn1::Arena>();
+        success &= message.decode(buffer, arena);
+        arena_blocks += arena->blocks();
+    }
+    const nanoseconds arena_time = duration_cast<nanoseconds>(clock::now() - start);
+    const std::size_t arena_allocations = counter.allocations + arena_blocks;
+
+    // encoding into fresh buffers versus recycled buffers
+    MESSAGE message;
+    success &= message.decode(buffer);
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        success &= message.encode() == buffer;
+    }
+    const nanoseconds encode_time = duration_cast<nanoseconds>(clock::now() - start);
+
+    ByteBufferPool pool(buffer.size(), 4);
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        ByteBuffer encoded = message.encode(pool);
+        success &= encoded == buffer;
+        pool.release(std::move(encoded));
+    }
+    const nanoseconds pool_time = duration_cast<nanoseconds>(clock::now() - start);
+
+    asn_allocator_swap(previous);
+
+    const double count = rounds;
+    auto report = [&](const char* mode, nanoseconds time, double allocations) {
+        std::cout << std::left << std::setw(8) << name << std::right << std::setw(8) << buffer.size()
+            << std::setw(10) << mode << std::fixed << std::setprecision(1)
+            << std::setw(14) << time.count() / count;
+        if (allocations >= 0.0) {
+            std::cout << std::setw(14) << allocations / count;
+        }
+        std::cout << std::endl;
+    };
+    report("heap", heap_time, heap_allocations);
+    report("arena", arena_time, arena_allocations);
+    report("encode", encode_time, -1.0);
+    report("pool", pool_time, -1.0);
+
+    if (!success) {
+        std::cerr << name << " decoding or encoding failed" << std::endl;
+    }
+    return success;
+}
@@ -0,0 +1,26 @@
+#ifndef BENCHMARK_CASES_ASN1_DECODE_HPP
+#define BENCHMARK_CASES_ASN1_DECODE_HPP
+
+#include "case.hpp"
+#include <vanetza/common/byte_buffer.hpp>
+
+class Asn1DecodeCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    template<typename MESSAGE>
+    bool measure(const char* name, const vanetza::ByteBuffer&);
+
+    unsigned objects;
+    unsigned lanes;
+    unsigned rounds;
+    vanetza::ByteBuffer cam;
+    vanetza::ByteBuffer cpm;
+    vanetza::ByteBuffer mapem;
+};
+
+#endif /* BENCHMARK_CASES_ASN1_DECODE_HPP */
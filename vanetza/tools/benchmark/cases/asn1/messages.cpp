@@ -0,0 +1,167 @@
+#include "messages.hpp"
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/mapem.hpp>
+#include <vanetza/asn1/its/NodeXY.h>
+#include <stdexcept>
+#include <string>
+
+using namespace vanetza;
+
+namespace
+{
+
+void set_bits(BIT_STRING_t& bits, std::size_t size, unsigned unused)
+{
+    bits.buf = static_cast<uint8_t*>(asn1::allocate(size));
+    bits.size = size;
+    bits.bits_unused = unused;
+}
+
+} // namespace
+
+ByteBuffer build_cam()
+{
+    asn1::Cam message;
+    message->header.protocolVersion = 2;
+    message->header.messageID = ItsPduHeader__messageID_cam;
+    message->header.stationID = 1337;
+    message->cam.generationDeltaTime = 4711;
+
+    BasicContainer_t& basic = message->cam.camParameters.basicContainer;
+    basic.stationType = StationType_passengerCar;
+    basic.referencePosition.latitude = 487671400;
+    basic.referencePosition.longitude = 114326300;
+    basic.referencePosition.positionConfidenceEllipse.semiMajorConfidence = SemiAxisLength_unavailable;
+    basic.referencePosition.positionConfidenceEllipse.semiMinorConfidence = SemiAxisLength_unavailable;
+    basic.referencePosition.positionConfidenceEllipse.semiMajorOrientation = HeadingValue_unavailable;
+    basic.referencePosition.altitude.altitudeValue = AltitudeValue_unavailable;
+    basic.referencePosition.altitude.altitudeConfidence = AltitudeConfidence_unavailable;
+
+    message->cam.camParameters.highFrequencyContainer.present = HighFrequencyContainer_PR_basicVehicleContainerHighFrequency;
+    BasicVehicleContainerHighFrequency& bvc = message->cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
+    bvc.heading.headingValue = 900;
+    bvc.heading.headingConfidence = HeadingConfidence_unavailable;
+    bvc.speed.speedValue = 1389;
+    bvc.speed.speedConfidence = SpeedConfidence_unavailable;
+    bvc.driveDirection = DriveDirection_forward;
+    bvc.vehicleLength.vehicleLengthValue = 45;
+    bvc.vehicleLength.vehicleLengthConfidenceIndication = VehicleLengthConfidenceIndication_noTrailerPresent;
+    bvc.vehicleWidth = 18;
+    bvc.longitudinalAcceleration.longitudinalAccelerationValue = LongitudinalAccelerationValue_unavailable;
+    bvc.longitudinalAcceleration.longitudinalAccelerationConfidence = AccelerationConfidence_unavailable;
+    bvc.curvature.curvatureValue = CurvatureValue_unavailable;
+    bvc.curvature.curvatureConfidence = CurvatureConfidence_unavailable;
+    bvc.curvatureCalculationMode = CurvatureCalculationMode_yawRateUsed;
+    bvc.yawRate.yawRateValue = YawRateValue_unavailable;
+    bvc.yawRate.yawRateConfidence = YawRateConfidence_unavailable;
+
+    // low frequency container with a path history, as sent every 500 ms
+    auto lfc = asn1::allocate<LowFrequencyContainer_t>();
+    lfc->present = LowFrequencyContainer_PR_basicVehicleContainerLowFrequency;
+    BasicVehicleContainerLowFrequency& low = lfc->choice.basicVehicleContainerLowFrequency;
+    low.vehicleRole = VehicleRole_default;
+    set_bits(low.exteriorLights, 1, 0);
+    for (long i = 0; i < 20; ++i) {
+        auto point = asn1::allocate<PathPoint_t>();
+        point->pathPosition.deltaLatitude = -10 * i;
+        point->pathPosition.deltaLongitude = 5 * i;
+        point->pathPosition.deltaAltitude = DeltaAltitude_unavailable;
+        ASN_SEQUENCE_ADD(&low.pathHistory, point);
+    }
+    message->cam.camParameters.lowFrequencyContainer = lfc;
+
+    std::string error;
+    if (!message.validate(error)) {
+        throw std::runtime_error("Invalid CAM: " + error);
+    }
+    return message.encode();
+}
+
+ByteBuffer build_cpm(unsigned objects)
+{
+    // minimal CPM of Cpm.decode_plain test (without perceived objects)
+    static const ByteBuffer cpm_uper = {
+        0x01, 0xff, 0x00, 0x00, 0x05, 0x39, 0x00, 0x2a, 0x00, 0x03, 0x49, 0x04,
+        0x84, 0x01, 0xc7, 0x61, 0x26, 0x00, 0x7d, 0x03, 0xe8, 0xe1, 0x36, 0xee,
+        0x87, 0xc0, 0xc0
+    };
+
+    asn1::Cpm message;
+    if (!message.decode(cpm_uper)) {
+        throw std::runtime_error("Decoding of CPM template failed");
+    }
+
+    if (objects > 0) {
+        message->cpm.cpmParameters.numberOfPerceivedObjects = objects;
+        message->cpm.cpmParameters.perceivedObjectContainer = asn1::allocate<PerceivedObjectContainer_t>();
+        for (unsigned i = 0; i < objects; ++i) {
+            auto object = asn1::allocate<PerceivedObject_t>();
+            object->objectID = i;
+            object->timeOfMeasurement = TimeOfMeasurement_oneMilliSecond;
+            object->objectAge = asn1::allocate<ObjectAge_t>();
+            *object->objectAge = 500;
+            object->objectConfidence = 20;
+            const long offset = i;
+            object->xDistance.value = DistanceValue_oneMeter * (offset % 100);
+            object->xDistance.confidence = DistanceConfidence_unavailable;
+            object->yDistance.value = -DistanceValue_oneMeter * (offset % 50);
+            object->yDistance.confidence = DistanceConfidence_unavailable;
+            object->xSpeed.value = SpeedValueExtended_unavailable;
+            object->xSpeed.confidence = SpeedConfidence_unavailable;
+            object->ySpeed.value = SpeedValueExtended_unavailable;
+            object->ySpeed.confidence = SpeedConfidence_unavailable;
+            ASN_SEQUENCE_ADD(message->cpm.cpmParameters.perceivedObjectContainer, object);
+        }
+    }
+
+    std::string error;
+    if (!message.validate(error)) {
+        throw std::runtime_error("Invalid CPM: " + error);
+    }
+    return message.encode();
+}
+
+ByteBuffer build_mapem(unsigned lanes)
+{
+    asn1::Mapem message;
+    message->header.protocolVersion = 2;
+    message->header.messageID = ItsPduHeader__messageID_mapem;
+    message->header.stationID = 1337;
+    message->map.msgIssueRevision = 1;
+
+    auto intersection = asn1::allocate<IntersectionGeometry_t>();
+    intersection->id.id = 42;
+    intersection->revision = 1;
+    intersection->refPoint.lat = 487671400;
+    intersection->refPoint.Long = 114326300;
+
+    for (unsigned i = 0; i < lanes; ++i) {
+        auto lane = asn1::allocate<GenericLane_t>();
+        lane->laneID = i;
+        set_bits(lane->laneAttributes.directionalUse, 1, 6);
+        lane->laneAttributes.directionalUse.buf[0] = 0x80;
+        set_bits(lane->laneAttributes.sharedWith, 2, 6);
+        lane->laneAttributes.laneType.present = LaneTypeAttributes_PR_vehicle;
+        set_bits(lane->laneAttributes.laneType.choice.vehicle, 1, 0);
+
+        lane->nodeList.present = NodeListXY_PR_nodes;
+        for (long n = 0; n < 4; ++n) {
+            auto node = asn1::allocate<NodeXY_t>();
+            node->delta.present = NodeOffsetPointXY_PR_node_XY1;
+            node->delta.choice.node_XY1.x = 100 * n + 10 * static_cast<long>(i % 10);
+            node->delta.choice.node_XY1.y = -50 * n;
+            ASN_SEQUENCE_ADD(&lane->nodeList.choice.nodes, node);
+        }
+        ASN_SEQUENCE_ADD(&intersection->laneSet, lane);
+    }
+
+    message->map.intersections = asn1::allocate<IntersectionGeometryList_t>();
+    ASN_SEQUENCE_ADD(message->map.intersections, intersection);
+
+    std::string error;
+    if (!message.validate(error)) {
+        throw std::runtime_error("Invalid MAPEM: " + error);
+    }
+    return message.encode();
+}
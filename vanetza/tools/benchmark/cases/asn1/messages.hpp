@@ -0,0 +1,23 @@
+#ifndef BENCHMARK_CASES_ASN1_MESSAGES_HPP
+#define BENCHMARK_CASES_ASN1_MESSAGES_HPP
+
+#include <vanetza/common/byte_buffer.hpp>
+
+/**
+ * Build UPER encoded CAM with a path history of 20 points
+ */
+vanetza::ByteBuffer build_cam();
+
+/**
+ * Build UPER encoded CPM
+ * \param objects number of perceived objects (at most 128)
+ */
+vanetza::ByteBuffer build_cpm(unsigned objects);
+
+/**
+ * Build UPER encoded MAPEM with a single intersection
+ * \param lanes number of lanes (1 to 255)
+ */
+vanetza::ByteBuffer build_mapem(unsigned lanes);
+
+#endif /* BENCHMARK_CASES_ASN1_MESSAGES_HPP */
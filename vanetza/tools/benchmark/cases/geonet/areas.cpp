@@ -0,0 +1,146 @@
+#include "areas.hpp"
+#include <vanetza/geonet/areas.hpp>
+#include <vanetza/geonet/local_tangent_plane.hpp>
+#include <GeographicLib/Geocentric.hpp>
+#include <GeographicLib/LocalCartesian.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+namespace
+{
+
+const double origin_latitude = 48.76714;
+const double origin_longitude = 11.43263;
+
+} // namespace
+
+bool GeonetAreasCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("positions", po::value<unsigned>(&positions)->default_value(10000), "Number of positions checked per round.")
+        ("rounds", po::value<unsigned>(&rounds)->default_value(100), "Number of rounds.")
+        ("spread", po::value<double>(&spread)->default_value(0.02), "Maximum offset of positions from area center in degrees.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (positions == 0) {
+            throw std::runtime_error("At least one position is required.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void GeonetAreasCase::prepare()
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> offset(-spread, spread);
+    latitudes.resize(positions);
+    longitudes.resize(positions);
+    for (unsigned i = 0; i < positions; ++i) {
+        latitudes[i] = origin_latitude + offset(rng);
+        longitudes[i] = origin_longitude + offset(rng);
+    }
+}
+
+int GeonetAreasCase::execute()
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    using units::degree;
+
+    geonet::Area area;
+    geonet::Ellipse ellipse;
+    ellipse.a = 1000.0 * units::si::meter;
+    ellipse.b = 400.0 * units::si::meter;
+    area.shape = ellipse;
+    area.angle = units::Angle(30.0 * degree);
+    area.position = geonet::GeodeticPosition(origin_latitude * degree, origin_longitude * degree);
+
+    // reference: LocalCartesian set up for every check, as areas.cpp did before
+    unsigned inside_reference = 0;
+    auto start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (unsigned i = 0; i < positions; ++i) {
+            GeographicLib::LocalCartesian proj { origin_latitude, origin_longitude, 0.0, GeographicLib::Geocentric::WGS84() };
+            double x, y, z = 0.0;
+            proj.Forward(latitudes[i], longitudes[i], 0.0, x, y, z);
+            const geonet::CartesianPosition local(x * units::si::meter, y * units::si::meter);
+            const geonet::CartesianPosition canonical = geonet::canonicalize(local, area.angle);
+            inside_reference += geonet::outside_shape(area.shape, canonical) ? 0 : 1;
+        }
+    }
+    const nanoseconds reference_time = duration_cast<nanoseconds>(clock::now() - start);
+
+    unsigned inside_scalar = 0;
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (unsigned i = 0; i < positions; ++i) {
+            const geonet::GeodeticPosition position(latitudes[i] * degree, longitudes[i] * degree);
+            inside_scalar += geonet::inside_or_at_border(area, position) ? 1 : 0;
+        }
+    }
+    const nanoseconds scalar_time = duration_cast<nanoseconds>(clock::now() - start);
+
+    // neighbour distances on a plane cached at the ego position (CBF contention)
+    const geonet::LocalTangentPlane plane(area.position);
+    double distance_sum = 0.0;
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (unsigned i = 0; i < positions; ++i) {
+            const geonet::GeodeticPosition position(latitudes[i] * degree, longitudes[i] * degree);
+            distance_sum += plane.distance(area.position, position) / units::si::meter;
+        }
+    }
+    const nanoseconds plane_distance_time = duration_cast<nanoseconds>(clock::now() - start);
+
+    double geodesic_sum = 0.0;
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (unsigned i = 0; i < positions; ++i) {
+            const geonet::GeodeticPosition position(latitudes[i] * degree, longitudes[i] * degree);
+            geodesic_sum += geonet::distance(area.position, position) / units::si::meter;
+        }
+    }
+    const nanoseconds geodesic_distance_time = duration_cast<nanoseconds>(clock::now() - start);
+
+    const double checks = static_cast<double>(positions) * rounds;
+    auto report = [checks](const char* name, nanoseconds time, const char* unit) {
+        std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(10) << time.count() / checks << " ns/" << unit << std::endl;
+    };
+    report("local-cartesian", reference_time, "check");
+    report("tangent-plane", scalar_time, "check");
+    report("plane-distance", plane_distance_time, "distance");
+    report("geodesic-distance", geodesic_distance_time, "distance");
+
+    std::cout << "inside: " << inside_reference << " (reference), " << inside_scalar << " (tangent plane)" << std::endl;
+    std::cout << "mean distance deviation: " << std::setprecision(6)
+        << (distance_sum - geodesic_sum) / checks << " m" << std::endl;
+
+    return inside_reference == inside_scalar ? 0 : 1;
+}
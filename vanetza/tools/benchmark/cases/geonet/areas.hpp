@@ -0,0 +1,21 @@
+#ifndef BENCHMARK_CASES_GEONET_AREAS_HPP
+#define BENCHMARK_CASES_GEONET_AREAS_HPP
+
+#include "case.hpp"
+
+class GeonetAreasCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    unsigned positions;
+    unsigned rounds;
+    double spread;
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+};
+
+#endif /* BENCHMARK_CASES_GEONET_AREAS_HPP */
@@ -0,0 +1,189 @@
+#include "headers.hpp"
+#include <vanetza/common/byte_buffer_sink.hpp>
+#include <vanetza/common/byte_buffer_source.hpp>
+#include <vanetza/geonet/basic_header.hpp>
+#include <vanetza/geonet/common_header.hpp>
+#include <vanetza/geonet/gbc_header.hpp>
+#include <vanetza/geonet/mib.hpp>
+#include <boost/iostreams/stream_buffer.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+namespace
+{
+
+struct Headers
+{
+    geonet::BasicHeader basic;
+    geonet::CommonHeader common;
+    geonet::GeoBroadcastHeader gbc;
+};
+
+constexpr std::size_t headers_length =
+    geonet::BasicHeader::length_bytes + geonet::CommonHeader::length_bytes + geonet::GeoBroadcastHeader::length_bytes;
+
+void serialize(const Headers& headers, OutputArchive& ar)
+{
+    geonet::serialize(headers.basic, ar);
+    geonet::serialize(headers.common, ar);
+    geonet::serialize(headers.gbc, ar);
+}
+
+void deserialize(Headers& headers, InputArchive& ar)
+{
+    geonet::deserialize(headers.basic, ar);
+    geonet::deserialize(headers.common, ar);
+    geonet::deserialize(headers.gbc, ar);
+}
+
+Headers create_headers()
+{
+    const geonet::MIB mib;
+    Headers headers { geonet::BasicHeader(mib), geonet::CommonHeader(mib), geonet::GeoBroadcastHeader() };
+    headers.common.header_type = geonet::HeaderType::GeoBroadcast_Circle;
+    headers.common.payload = 300;
+    headers.gbc.sequence_number = geonet::SequenceNumber(4711);
+    headers.gbc.source_position.latitude = geonet::geo_angle_i32t::from_value(487671400);
+    headers.gbc.source_position.longitude = geonet::geo_angle_i32t::from_value(114326300);
+    headers.gbc.geo_area_pos_latitude = headers.gbc.source_position.latitude;
+    headers.gbc.geo_area_pos_longitude = headers.gbc.source_position.longitude;
+    headers.gbc.distance_a = geonet::distance_u16t::from_value(1000);
+    headers.gbc.distance_b = geonet::distance_u16t::from_value(1000);
+    return headers;
+}
+
+void print(const char* name, std::chrono::nanoseconds time, double count)
+{
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(10) << time.count() / count << " ns/packet" << std::endl;
+}
+
+} // namespace
+
+bool GeonetHeadersCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("packets", po::value<unsigned>(&packets)->default_value(10000), "Number of packets per round.")
+        ("rounds", po::value<unsigned>(&rounds)->default_value(100), "Number of rounds.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (packets == 0) {
+            throw std::runtime_error("At least one packet is required.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void GeonetHeadersCase::prepare()
+{
+}
+
+int GeonetHeadersCase::execute()
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    const Headers headers = create_headers();
+    std::vector<ByteBuffer> buffers(packets);
+    for (ByteBuffer& buffer : buffers) {
+        buffer.reserve(headers_length);
+    }
+
+    // reference: archives on top of boost iostreams devices, as used by all codecs before
+    auto start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (ByteBuffer& buffer : buffers) {
+            buffer.clear();
+            byte_buffer_sink sink(buffer);
+            boost::iostreams::stream_buffer<byte_buffer_sink> stream(sink);
+            OutputArchive ar(stream);
+            serialize(headers, ar);
+        }
+    }
+    const nanoseconds stream_serialize = duration_cast<nanoseconds>(clock::now() - start);
+
+    unsigned stream_hops = 0;
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (const ByteBuffer& buffer : buffers) {
+            Headers parsed;
+            byte_buffer_source source(buffer);
+            boost::iostreams::stream_buffer<byte_buffer_source> stream(source);
+            InputArchive ar(stream);
+            deserialize(parsed, ar);
+            stream_hops += parsed.basic.hop_limit;
+        }
+    }
+    const nanoseconds stream_parse = duration_cast<nanoseconds>(clock::now() - start);
+
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (ByteBuffer& buffer : buffers) {
+            buffer.clear();
+            OutputArchive ar(buffer);
+            serialize(headers, ar);
+        }
+    }
+    const nanoseconds memory_serialize = duration_cast<nanoseconds>(clock::now() - start);
+
+    std::vector<uint8_t> fixed(headers_length);
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (unsigned i = 0; i < packets; ++i) {
+            OutputArchive ar(fixed.data(), fixed.data() + fixed.size());
+            serialize(headers, ar);
+        }
+    }
+    const nanoseconds span_serialize = duration_cast<nanoseconds>(clock::now() - start);
+
+    unsigned memory_hops = 0;
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (const ByteBuffer& buffer : buffers) {
+            Headers parsed;
+            InputArchive ar(buffer);
+            deserialize(parsed, ar);
+            memory_hops += parsed.basic.hop_limit;
+        }
+    }
+    const nanoseconds memory_parse = duration_cast<nanoseconds>(clock::now() - start);
+
+    if (stream_hops != memory_hops || buffers.front() != fixed) {
+        std::cerr << "Error: archives yield different results" << std::endl;
+        return 1;
+    }
+
+    const double count = static_cast<double>(packets) * rounds;
+    print("stream-serialize", stream_serialize, count);
+    print("buffer-serialize", memory_serialize, count);
+    print("span-serialize", span_serialize, count);
+    print("stream-parse", stream_parse, count);
+    print("memory-parse", memory_parse, count);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#ifndef BENCHMARK_CASES_GEONET_HEADERS_HPP
+#define BENCHMARK_CASES_GEONET_HEADERS_HPP
+
+#include "case.hpp"
+
+class GeonetHeadersCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    unsigned packets;
+    unsigned rounds;
+};
+
+#endif /* BENCHMARK_CASES_GEONET_HEADERS_HPP */
@@ -0,0 +1,252 @@
+#include "router_rx.hpp"
+#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/common/object_container.hpp>
+#include <vanetza/common/position_fix.hpp>
+#include <vanetza/dcc/interface.hpp>
+#include <vanetza/geonet/data_confirm.hpp>
+#include <vanetza/geonet/duplicate_packet_list.hpp>
+#include <vanetza/geonet/location_table.hpp>
+#include <vanetza/geonet/loctex_g5.hpp>
+#include <vanetza/geonet/mib.hpp>
+#include <vanetza/geonet/router.hpp>
+#include <vanetza/geonet/transport_interface.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+namespace
+{
+
+const double center_latitude = 48.76714;
+const double center_longitude = 11.43263;
+
+class CaptureRequestInterface : public dcc::RequestInterface
+{
+public:
+    void request(const dcc::DataRequest&, std::unique_ptr<ChunkPacket> packet) override
+    {
+        ByteBuffer buffer;
+        for (auto layer : osi_layer_range<OsiLayer::Network, OsiLayer::Application>()) {
+            ByteBuffer tmp;
+            packet->layer(layer).convert(tmp);
+            buffer.insert(buffer.end(), tmp.begin(), tmp.end());
+        }
+        captured.push_back(std::move(buffer));
+    }
+
+    std::vector<ByteBuffer> captured;
+};
+
+class CountingTransportInterface : public geonet::TransportInterface
+{
+public:
+    void indicate(const geonet::DataIndication&, std::unique_ptr<geonet::UpPacket>) override
+    {
+        ++indications;
+    }
+
+    unsigned indications = 0;
+};
+
+PositionFix position_fix(Clock::time_point now, double latitude, double longitude)
+{
+    PositionFix fix;
+    fix.timestamp = now;
+    fix.latitude = latitude * units::degree;
+    fix.longitude = longitude * units::degree;
+    fix.confidence.semi_major = 5.0 * units::si::meter;
+    fix.confidence.semi_minor = 5.0 * units::si::meter;
+    fix.speed.assign(10.0 * units::si::meter_per_second, 1.0 * units::si::meter_per_second);
+    fix.course.assign(units::TrueNorth::from_value(90.0), units::TrueNorth::from_value(1.0));
+    return fix;
+}
+
+geonet::MIB create_mib()
+{
+    geonet::MIB mib;
+    // simple forwarding executes duplicate packet detection for every GBC packet within its area
+    mib.itsGnAreaForwardingAlgorithm = geonet::BroadcastForwarding::SIMPLE;
+    return mib;
+}
+
+} // namespace
+
+bool GeonetRouterRxCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("sources", po::value<unsigned>(&sources)->default_value(200), "Number of originating stations.")
+        ("packets", po::value<unsigned>(&packets)->default_value(50), "Number of GBC packets per source.")
+        ("duplicates", po::value<unsigned>(&duplicates)->default_value(2), "Number of received copies per packet.")
+        ("rounds", po::value<unsigned>(&rounds)->default_value(10), "Number of rounds.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (sources == 0 || packets == 0 || duplicates == 0) {
+            throw std::runtime_error("Sources, packets and duplicates have to be positive.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void GeonetRouterRxCase::prepare()
+{
+    ManualRuntime runtime(Clock::at("2020-01-01 12:00"));
+    const geonet::MIB mib = create_mib();
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> offset(-0.005, 0.005);
+
+    geonet::Area destination;
+    geonet::Circle circle;
+    circle.r = 1000.0 * units::si::meter;
+    destination.shape = circle;
+    destination.position.latitude = center_latitude * units::degree;
+    destination.position.longitude = center_longitude * units::degree;
+
+    // packets of each source are generated by a router of its own
+    std::vector<std::vector<ByteBuffer>> generated(sources);
+    for (unsigned s = 0; s < sources; ++s) {
+        CaptureRequestInterface capture;
+        geonet::Router router(runtime, mib);
+        geonet::Address address;
+        address.mid(create_mac_address(s + 1));
+        router.set_address(address);
+        router.set_access_interface(&capture);
+        router.update_position(position_fix(runtime.now(), center_latitude + offset(rng), center_longitude + offset(rng)));
+
+        for (unsigned p = 0; p < packets; ++p) {
+            geonet::GbcDataRequest request(mib);
+            request.upper_protocol = geonet::UpperProtocol::IPv6;
+            request.destination = destination;
+            request.max_hop_limit = 1;
+            std::unique_ptr<DownPacket> payload { new DownPacket() };
+            payload->layer(OsiLayer::Transport) = ByteBuffer(100, 0xab);
+            router.request(request, std::move(payload));
+        }
+        generated[s] = std::move(capture.captured);
+    }
+
+    // every copy of a packet is received after all sources have sent their original packet
+    frames.clear();
+    for (unsigned p = 0; p < packets; ++p) {
+        for (unsigned d = 0; d < duplicates; ++d) {
+            for (unsigned s = 0; s < sources; ++s) {
+                if (p < generated[s].size()) {
+                    frames.push_back(Frame { create_mac_address(s + 1), generated[s][p] });
+                }
+            }
+        }
+    }
+}
+
+int GeonetRouterRxCase::execute()
+{
+    run_router();
+    run_extensions<ObjectContainer>("object-container");
+    run_extensions<geonet::LocationTableExtensions>("slot-container");
+    return 0;
+}
+
+void GeonetRouterRxCase::run_router()
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    nanoseconds rx_time { 0 };
+    unsigned indications = 0;
+    for (unsigned round = 0; round < rounds; ++round) {
+        ManualRuntime runtime(Clock::at("2020-01-01 12:00"));
+        const geonet::MIB mib = create_mib();
+        CaptureRequestInterface requests;
+        CountingTransportInterface transport;
+        geonet::Router router(runtime, mib);
+        geonet::Address address;
+        address.mid(create_mac_address(0));
+        router.set_address(address);
+        router.set_access_interface(&requests);
+        router.set_transport_handler(geonet::UpperProtocol::IPv6, &transport);
+        router.update_position(position_fix(runtime.now(), center_latitude, center_longitude));
+
+        // copying received frames is excluded from measurement
+        std::vector<std::unique_ptr<geonet::UpPacket>> received;
+        received.reserve(frames.size());
+        for (const Frame& frame : frames) {
+            received.emplace_back(new geonet::UpPacket(CohesivePacket(frame.buffer, OsiLayer::Network)));
+        }
+
+        auto start = clock::now();
+        for (std::size_t i = 0; i < received.size(); ++i) {
+            router.indicate(std::move(received[i]), frames[i].sender, cBroadcastMacAddress);
+        }
+        rx_time += duration_cast<nanoseconds>(clock::now() - start);
+        indications += transport.indications;
+    }
+
+    const double received = static_cast<double>(frames.size()) * rounds;
+    std::cout << std::left << std::setw(18) << "router-rx" << std::right << std::fixed << std::setprecision(1)
+        << std::setw(10) << rx_time.count() / received << " ns/packet"
+        << "  (" << indications / rounds << " of " << frames.size() << " passed up per round)" << std::endl;
+}
+
+template<typename CONTAINER>
+void GeonetRouterRxCase::run_extensions(const std::string& name)
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    // mimic Router::detect_duplicate_packet on entries carrying LocTEX_G5 as well
+    std::vector<CONTAINER> extensions(sources);
+    for (auto& container : extensions) {
+        container.insert(std::unique_ptr<geonet::LocTEX_G5> { new geonet::LocTEX_G5() });
+    }
+
+    unsigned duplicate_packets = 0;
+    auto start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (unsigned p = 0; p < packets * duplicates; ++p) {
+            const geonet::SequenceNumber sn(p / duplicates);
+            for (auto& container : extensions) {
+                geonet::DuplicatePacketList* dpl = container.template find<geonet::DuplicatePacketList>();
+                if (!dpl) {
+                    std::unique_ptr<geonet::DuplicatePacketList> created { new geonet::DuplicatePacketList(8) };
+                    dpl = created.get();
+                    container.insert(std::move(created));
+                }
+                duplicate_packets += dpl->check(sn) ? 1 : 0;
+            }
+        }
+        for (auto& container : extensions) {
+            container.template erase<geonet::DuplicatePacketList>();
+        }
+    }
+    const nanoseconds time = duration_cast<nanoseconds>(clock::now() - start);
+
+    const double lookups = static_cast<double>(sources) * packets * duplicates * rounds;
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(10) << time.count() / lookups << " ns/lookup"
+        << "  (" << duplicate_packets / rounds << " duplicates per round)" << std::endl;
+}
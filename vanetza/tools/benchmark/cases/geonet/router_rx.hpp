@@ -0,0 +1,33 @@
+#ifndef BENCHMARK_CASES_GEONET_ROUTER_RX_HPP
+#define BENCHMARK_CASES_GEONET_ROUTER_RX_HPP
+
+#include "case.hpp"
+#include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/net/mac_address.hpp>
+
+class GeonetRouterRxCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    struct Frame
+    {
+        vanetza::MacAddress sender;
+        vanetza::ByteBuffer buffer;
+    };
+
+    void run_router();
+    template<typename CONTAINER>
+    void run_extensions(const std::string& name);
+
+    unsigned sources;
+    unsigned packets;
+    unsigned duplicates;
+    unsigned rounds;
+    std::vector<Frame> frames;
+};
+
+#endif /* BENCHMARK_CASES_GEONET_ROUTER_RX_HPP */
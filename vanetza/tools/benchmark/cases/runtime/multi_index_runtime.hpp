@@ -0,0 +1,88 @@
+#ifndef BENCHMARK_CASES_RUNTIME_MULTI_INDEX_RUNTIME_HPP
+#define BENCHMARK_CASES_RUNTIME_MULTI_INDEX_RUNTIME_HPP
+
+#include <vanetza/common/runtime.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+
+/**
+ * Former ManualRuntime queue based on boost::multi_index, kept as benchmark baseline
+ */
+class MultiIndexRuntime : public vanetza::Runtime
+{
+public:
+    using Clock = vanetza::Clock;
+
+    void trigger(Clock::time_point tp)
+    {
+        m_now = tp;
+        while (!m_queue.empty()) {
+            auto top = m_queue.get<by_deadline>().begin();
+            const auto deadline = top->deadline;
+            if (deadline <= m_now) {
+                Callback cb = top->callback;
+                m_queue.get<by_deadline>().erase(top);
+                cb(deadline);
+            } else {
+                break;
+            }
+        }
+    }
+
+    Clock::time_point next() const
+    {
+        return m_queue.empty() ? Clock::time_point::max() : m_queue.get<by_deadline>().begin()->deadline;
+    }
+
+    void schedule(Clock::time_point tp, const Callback& cb, const void* scope = nullptr) override
+    {
+        m_queue.emplace(ScheduledCallback { tp, cb, scope });
+    }
+
+    void schedule(Clock::duration d, const Callback& cb, const void* scope = nullptr) override
+    {
+        schedule(m_now + d, cb, scope);
+    }
+
+    void cancel(const void* scope) override
+    {
+        if (scope) {
+            auto range = m_queue.get<by_scope>().equal_range(scope);
+            m_queue.get<by_scope>().erase(range.first, range.second);
+        }
+    }
+
+    Clock::time_point now() const override
+    {
+        return m_now;
+    }
+
+private:
+    struct ScheduledCallback
+    {
+        ScheduledCallback(Clock::time_point tp, const Callback& cb, const void* scope) :
+            deadline(tp), callback(cb), scope(scope) {}
+
+        Clock::time_point deadline;
+        Callback callback;
+        const void* scope;
+    };
+
+    struct by_deadline {};
+    using time_index = boost::multi_index::ordered_non_unique<
+        boost::multi_index::tag<by_deadline>,
+        boost::multi_index::member<ScheduledCallback, Clock::time_point, &ScheduledCallback::deadline>>;
+    struct by_scope {};
+    using scope_index = boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<by_scope>,
+        boost::multi_index::member<ScheduledCallback, const void*, &ScheduledCallback::scope>>;
+    using queue_type = boost::multi_index_container<ScheduledCallback,
+          boost::multi_index::indexed_by<time_index, scope_index>>;
+
+    Clock::time_point m_now;
+    queue_type m_queue;
+};
+
+#endif /* BENCHMARK_CASES_RUNTIME_MULTI_INDEX_RUNTIME_HPP */
@@ -0,0 +1,122 @@
+#include "scheduler.hpp"
+#include "multi_index_runtime.hpp"
+#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/common/timing_wheel_runtime.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+bool RuntimeSchedulerCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("timers", po::value<unsigned>(&timers)->default_value(100000), "Number of timers scheduled per round.")
+        ("scopes", po::value<unsigned>(&scopes)->default_value(1000), "Number of distinct cancellation scopes.")
+        ("rounds", po::value<unsigned>(&rounds)->default_value(10), "Number of rounds.")
+        ("runtime", po::value<std::string>(&runtime)->default_value("all"), "Runtime implementation, may be 'manual', 'timing-wheel', 'multi-index' or 'all'.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (runtime != "manual" && runtime != "timing-wheel" && runtime != "multi-index" && runtime != "all") {
+            throw std::runtime_error("Invalid runtime implementation.");
+        }
+        if (scopes < 2) {
+            throw std::runtime_error("At least two scopes are required.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void RuntimeSchedulerCase::prepare()
+{
+}
+
+int RuntimeSchedulerCase::execute()
+{
+    if (runtime == "manual" || runtime == "all") {
+        run<ManualRuntime>("manual");
+    }
+    if (runtime == "timing-wheel" || runtime == "all") {
+        run<TimingWheelRuntime>("timing-wheel");
+    }
+    if (runtime == "multi-index" || runtime == "all") {
+        run<MultiIndexRuntime>("multi-index");
+    }
+
+    return 0;
+}
+
+template<typename RUNTIME>
+void RuntimeSchedulerCase::run(const std::string& name)
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    std::mt19937 rng(42);
+    // deadlines typical for GeoNetworking timers (CBF, packet buffers, beacons)
+    std::uniform_int_distribution<unsigned> delay(1, 3000);
+    std::vector<char> scope_objects(scopes);
+    unsigned calls = 0;
+    auto callback = [&calls](Clock::time_point) { ++calls; };
+
+    nanoseconds schedule_time { 0 };
+    nanoseconds cancel_time { 0 };
+    nanoseconds trigger_time { 0 };
+    unsigned cancelled_scopes = 0;
+
+    RUNTIME rt;
+    for (unsigned round = 0; round < rounds; ++round) {
+        const auto base = rt.now();
+
+        auto start = clock::now();
+        for (unsigned i = 0; i < timers; ++i) {
+            rt.schedule(base + std::chrono::milliseconds(delay(rng)), callback, &scope_objects[i % scopes]);
+        }
+        schedule_time += duration_cast<nanoseconds>(clock::now() - start);
+
+        // cancel every other scope
+        start = clock::now();
+        for (unsigned i = 0; i < scopes; i += 2) {
+            rt.cancel(&scope_objects[i]);
+            ++cancelled_scopes;
+        }
+        cancel_time += duration_cast<nanoseconds>(clock::now() - start);
+
+        // advance time in steps of one millisecond
+        start = clock::now();
+        for (unsigned step = 1; step <= 3000; ++step) {
+            rt.trigger(base + std::chrono::milliseconds(step));
+        }
+        trigger_time += duration_cast<nanoseconds>(clock::now() - start);
+    }
+
+    const double scheduled = static_cast<double>(timers) * rounds;
+    std::cout << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+        << " schedule: " << std::setw(8) << schedule_time.count() / scheduled << " ns/timer"
+        << "  cancel: " << std::setw(10) << cancel_time.count() / static_cast<double>(cancelled_scopes) << " ns/scope"
+        << "  trigger: " << std::setw(8) << trigger_time.count() / static_cast<double>(calls) << " ns/callback"
+        << "  (" << calls << " callbacks)" << std::endl;
+}
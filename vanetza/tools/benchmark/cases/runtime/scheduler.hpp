@@ -0,0 +1,23 @@
+#ifndef BENCHMARK_CASES_RUNTIME_SCHEDULER_HPP
+#define BENCHMARK_CASES_RUNTIME_SCHEDULER_HPP
+
+#include "case.hpp"
+
+class RuntimeSchedulerCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    template<typename RUNTIME>
+    void run(const std::string& name);
+
+    unsigned timers;
+    unsigned scopes;
+    unsigned rounds;
+    std::string runtime;
+};
+
+#endif /* BENCHMARK_CASES_RUNTIME_SCHEDULER_HPP */
@@ -1,7 +1,11 @@
 #include "signing.hpp"
+#include <vanetza/security/nonce_pool.hpp>
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <random>
+#include <thread>
 
 using namespace vanetza;
 using namespace vanetza::security;
@@ -14,6 +18,8 @@ bool SecuritySigningCase::parse(const std::vector<std::string>& opts)
         ("help", "Print out available options.")
         ("messages", po::value<unsigned>(&messages)->default_value(10000), "Number of messages.")
         ("signer", po::value<std::string>(&signer_info_type)->default_value("certificate"), "Signer embedded into the messages, may be 'certificate', 'hash' or 'chain'.")
+        ("precompute", po::value<unsigned>(&precompute_workers)->default_value(0), "Worker threads precomputing signature nonces, 0 disables precomputation.")
+        ("nonces", po::value<std::size_t>(&precompute_nonces)->default_value(1000), "Number of nonces precomputed before signing starts.")
     ;
 
     po::variables_map vm;
@@ -42,6 +48,27 @@ bool SecuritySigningCase::parse(const std::vector<std::string>& opts)
 
 int SecuritySigningCase::execute()
 {
+    std::unique_ptr<NoncePool> nonce_pool;
+    std::unique_ptr<DelegatingSecurityEntity> precomputed_entity;
+    SecurityEntity* entity = &security_entity;
+    if (precompute_workers > 0) {
+        nonce_pool.reset(new NoncePool(precompute_workers, precompute_nonces));
+        precomputed_entity.reset(new DelegatingSecurityEntity(
+                precomputed_sign_service(certificate_provider, *crypto_backend, sign_header_policy, *nonce_pool),
+                verify_service));
+        entity = precomputed_entity.get();
+
+        // fill stock completely, i.e. measure signing on demand
+        const auto& private_key = certificate_provider.own_private_key();
+        nonce_pool->take(private_key);
+        while (nonce_pool->supported() && nonce_pool->available(private_key) < precompute_nonces) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (!nonce_pool->supported()) {
+            std::cerr << "Crypto backend does not support precomputation" << std::endl;
+        }
+    }
+
     if (signer_info_type == "hash") {
         // Sign one message with CAM profile, so the next message only includes the certificate hash
         DownPacket packet;
@@ -50,7 +77,7 @@ int SecuritySigningCase::execute()
         EncapRequest initial_encap_request;
         initial_encap_request.plaintext_payload = packet;
         initial_encap_request.its_aid = aid::CA;
-        security_entity.encapsulate_packet(std::move(initial_encap_request));
+        entity->encapsulate_packet(std::move(initial_encap_request));
     }
 
     if (signer_info_type == "certificate") {
@@ -60,6 +87,7 @@ int SecuritySigningCase::execute()
     }
 
     std::cout << "Starting benchmark for messages ... ";
+    const auto start = std::chrono::steady_clock::now();
 
     for (unsigned i = 0; i < messages; i++) {
         DownPacket packet;
@@ -69,10 +97,11 @@ int SecuritySigningCase::execute()
         encap_request.plaintext_payload = packet;
         encap_request.its_aid = aid::CA;
 
-        EncapConfirm encap_confirm = security_entity.encapsulate_packet(std::move(encap_request));
+        EncapConfirm encap_confirm = entity->encapsulate_packet(std::move(encap_request));
     }
 
-    std::cout << "[Done]" << std::endl;
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "[Done] " << std::fixed << std::setprecision(1) << elapsed.count() / messages << " us/message" << std::endl;
 
     return 0;
 }
@@ -12,6 +12,8 @@ public:
 private:
     unsigned messages;
     std::string signer_info_type;
+    unsigned precompute_workers;
+    std::size_t precompute_nonces;
 };
 
 #endif /* BENCHMARK_CASES_SECURITY_SIGNING_HPP */
@@ -1,6 +1,8 @@
 #include "validation.hpp"
 #include <vanetza/security/delegating_security_entity.hpp>
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <random>
 
@@ -99,6 +101,7 @@ int SecurityValidationCase::execute()
     std::uniform_int_distribution<> dis(0, identities - 1);
 
     std::cout << "Starting benchmark for messages ... ";
+    const auto start = std::chrono::steady_clock::now();
 
     for (unsigned i = 0; i < messages; i++) {
         auto copy = secured_messages[dis(gen)];
@@ -106,7 +109,8 @@ int SecurityValidationCase::execute()
         assert(decap_confirm.report == DecapReport::Success);
     }
 
-    std::cout << "[Done]" << std::endl;
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "[Done] " << std::fixed << std::setprecision(1) << elapsed.count() / messages << " us/message" << std::endl;
 
     return 0;
 }
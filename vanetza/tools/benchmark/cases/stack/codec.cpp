@@ -0,0 +1,154 @@
+#include "codec.hpp"
+#include "allocation_counter.hpp"
+#include "cases/stack/loopback.hpp"
+#include "socktap/asn1json_reader.hpp"
+#include "socktap/asn1json_writer.hpp"
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/denm.hpp>
+#include <vanetza/asn1/mapem.hpp>
+#include <vanetza/asn1/spatem.hpp>
+#include <vanetza/asn1/vam.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#ifndef BENCHMARK_EXAMPLES_DIR
+#define BENCHMARK_EXAMPLES_DIR "examples"
+#endif
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+bool StackCodecCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("examples", po::value<std::string>(&examples)->default_value(BENCHMARK_EXAMPLES_DIR), "Directory of JSON messages as accepted by socktap.")
+        ("rounds", po::value<unsigned>(&rounds)->default_value(10000), "Number of conversions per message.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (rounds == 0) {
+            throw std::runtime_error("At least one round is required.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void StackCodecCase::prepare()
+{
+}
+
+int StackCodecCase::execute()
+{
+    print_throughput_header();
+
+    bool success = true;
+    success &= measure<asn1::Cam>("cam", "in_cam_full.json", &CAM_t::cam, ItsPduHeader__messageID_cam, 2);
+    success &= measure<asn1::Denm>("denm", "in_denm.json", &DENM_t::denm, ItsPduHeader__messageID_denm, 2);
+    success &= measure<asn1::Cpm>("cpm", "in_cpm.json", &CPM_t::cpm, ItsPduHeader__messageID_cpm, 1);
+    success &= measure<asn1::Vam>("vam", "in_vam.json", &VAM_t::vam, ItsPduHeader__messageID_vam, 1);
+    success &= measure<asn1::Spatem>("spatem", "in_spatem.json", &SPATEM_t::spat, ItsPduHeader__messageID_spatem, 2);
+    success &= measure<asn1::Mapem>("mapem", "in_mapem.json", &MAPEM_t::map, ItsPduHeader__messageID_mapem, 2);
+    return success ? 0 : 1;
+}
+
+template<typename MESSAGE, typename CONTENT>
+bool StackCodecCase::measure(const char* name, const char* file, CONTENT MESSAGE::asn1c_type::* content, long message_id, long version)
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    std::ifstream input(examples + "/" + file);
+    if (!input) {
+        std::cout << name << ": skipped, " << file << " is not available" << std::endl;
+        return true;
+    }
+    const std::string json { std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+    const std::string prefix = std::string(name) + " ";
+
+    // header is filled in like socktap does for messages received via MQTT
+    auto read = [&](MESSAGE& message) {
+        JsonReader reader(json);
+        read_json(reader, (*message).*content);
+        reader.finish();
+        message->header.protocolVersion = version;
+        message->header.messageID = message_id;
+        message->header.stationID = 1337;
+    };
+
+    MESSAGE message;
+    try {
+        read(message);
+    } catch (const JsonReadError& e) {
+        std::cerr << name << ": reading " << file << " failed: " << e.what() << std::endl;
+        return false;
+    }
+    const ByteBuffer encoded = message.encode();
+
+    bool success = true;
+    AllocationCounter counter;
+    auto start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        MESSAGE parsed;
+        read(parsed);
+    }
+    nanoseconds time = duration_cast<nanoseconds>(clock::now() - start);
+    print_throughput(prefix + "json-read", rounds, time, counter.allocations());
+
+    counter.reset();
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        success &= message.encode().size() == encoded.size();
+    }
+    time = duration_cast<nanoseconds>(clock::now() - start);
+    print_throughput(prefix + "uper-encode", rounds, time, counter.allocations());
+
+    counter.reset();
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        MESSAGE decoded;
+        success &= decoded.decode(encoded);
+    }
+    time = duration_cast<nanoseconds>(clock::now() - start);
+    print_throughput(prefix + "uper-decode", rounds, time, counter.allocations());
+
+    // output buffer is reused across messages like socktap's applications do
+    std::string output;
+    counter.reset();
+    start = clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        output.clear();
+        JsonWriter writer(output);
+        write_json(writer, *message);
+    }
+    time = duration_cast<nanoseconds>(clock::now() - start);
+    print_throughput(prefix + "json-write", rounds, time, counter.allocations());
+
+    if (!success) {
+        std::cerr << name << " encoding or decoding failed" << std::endl;
+    }
+    return success;
+}
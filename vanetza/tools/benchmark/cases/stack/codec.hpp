@@ -0,0 +1,21 @@
+#ifndef BENCHMARK_CASES_STACK_CODEC_HPP
+#define BENCHMARK_CASES_STACK_CODEC_HPP
+
+#include "case.hpp"
+
+class StackCodecCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    template<typename MESSAGE, typename CONTENT>
+    bool measure(const char* name, const char* file, CONTENT MESSAGE::asn1c_type::* content, long message_id, long version);
+
+    std::string examples;
+    unsigned rounds;
+};
+
+#endif /* BENCHMARK_CASES_STACK_CODEC_HPP */
@@ -0,0 +1,214 @@
+#include "gbc.hpp"
+#include "allocation_counter.hpp"
+#include "cases/stack/loopback.hpp"
+#include <vanetza/btp/data_indication.hpp>
+#include <vanetza/btp/header.hpp>
+#include <vanetza/btp/header_conversion.hpp>
+#include <vanetza/btp/port_dispatcher.hpp>
+#include <vanetza/btp/ports.hpp>
+#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/geonet/data_confirm.hpp>
+#include <vanetza/geonet/mib.hpp>
+#include <vanetza/geonet/router.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+namespace
+{
+
+const double origin_latitude = 48.76714;
+const double origin_longitude = 11.43263;
+const double meters_per_degree = 111320.0;
+
+class CountingIndication : public btp::IndicationInterface
+{
+public:
+    void indicate(const btp::DataIndication&, std::unique_ptr<UpPacket>) override
+    {
+        ++indications;
+    }
+
+    std::size_t indications = 0;
+};
+
+// station along a straight road heading east
+struct Station
+{
+    Station(Runtime& rt, const geonet::MIB& mib, std::deque<LoopbackFrame>& frames, std::size_t index) :
+        access(frames, index), router(rt, mib)
+    {
+        geonet::Address address;
+        address.mid(create_mac_address(index + 1));
+        router.set_address(address);
+        router.set_random_seed(index);
+        router.set_access_interface(&access);
+        router.set_transport_handler(geonet::UpperProtocol::BTP_B, &dispatcher);
+        dispatcher.set_non_interactive_handler(btp::ports::DENM, &counter);
+    }
+
+    LoopbackAccessInterface access;
+    geonet::Router router;
+    btp::PortDispatcher dispatcher;
+    CountingIndication counter;
+};
+
+double longitude_at(double meters)
+{
+    const double pi = std::acos(-1.0);
+    return origin_longitude + meters / (meters_per_degree * std::cos(origin_latitude * pi / 180.0));
+}
+
+} // namespace
+
+bool StackGbcCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("neighbours", po::value<unsigned>(&neighbours)->default_value(20), "Number of stations besides the originator.")
+        ("packets", po::value<unsigned>(&packets)->default_value(1000), "Number of originated GBC packets.")
+        ("spacing", po::value<double>(&spacing)->default_value(100.0), "Distance between adjacent stations in meters.")
+        ("range", po::value<double>(&range)->default_value(250.0), "Radio range in meters.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (neighbours == 0 || packets == 0) {
+            throw std::runtime_error("Neighbours and packets have to be positive.");
+        } else if (spacing <= 0.0 || range < spacing) {
+            throw std::runtime_error("Range has to cover at least the spacing between stations.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void StackGbcCase::prepare()
+{
+}
+
+int StackGbcCase::execute()
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    ManualRuntime runtime(Clock::at("2020-01-01 12:00"));
+    geonet::MIB mib;
+    // simple area forwarding rebroadcasts immediately, i.e. no CBF timers are pending
+    mib.itsGnAreaForwardingAlgorithm = geonet::BroadcastForwarding::SIMPLE;
+    std::deque<LoopbackFrame> frames;
+
+    std::vector<std::unique_ptr<Station>> stations;
+    for (std::size_t i = 0; i <= neighbours; ++i) {
+        stations.emplace_back(new Station(runtime, mib, frames, i));
+        stations.back()->router.update_position(stack_position_fix(runtime.now(), origin_latitude, longitude_at(i * spacing)));
+    }
+
+    // frames are received by all stations within radio range, unicast frames only by their addressee
+    std::size_t receptions = 0;
+    auto deliver = [&]() {
+        while (!frames.empty()) {
+            LoopbackFrame frame = std::move(frames.front());
+            frames.pop_front();
+            for (std::size_t i = 0; i < stations.size(); ++i) {
+                const double distance = std::abs(static_cast<double>(i) - static_cast<double>(frame.station)) * spacing;
+                const MacAddress mac = create_mac_address(i + 1);
+                if (i == frame.station || distance > range) {
+                    continue;
+                } else if (frame.destination != cBroadcastMacAddress && frame.destination != mac) {
+                    continue;
+                }
+                std::unique_ptr<geonet::UpPacket> packet { new geonet::UpPacket(CohesivePacket(frame.buffer, OsiLayer::Network)) };
+                stations[i]->router.indicate(std::move(packet), frame.source, frame.destination);
+                ++receptions;
+            }
+        }
+    };
+
+    // beacons fill location tables with neighbours required for greedy forwarding
+    for (unsigned step = 0; step < 50; ++step) {
+        runtime.trigger(std::chrono::milliseconds(100));
+        deliver();
+    }
+
+    // destination area covers the stations at the far end of the road
+    geonet::GbcDataRequest request(mib);
+    request.upper_protocol = geonet::UpperProtocol::BTP_B;
+    request.communication_profile = geonet::CommunicationProfile::ITS_G5;
+    request.max_hop_limit = std::min(255u, neighbours + 1);
+    geonet::Circle circle;
+    circle.r = range * units::si::meter;
+    request.destination.shape = circle;
+    request.destination.position.latitude = origin_latitude * units::degree;
+    request.destination.position.longitude = longitude_at(neighbours * spacing) * units::degree;
+
+    btp::HeaderB btp_header;
+    btp_header.destination_port = btp::ports::DENM;
+    btp_header.destination_port_info = host_cast<uint16_t>(0);
+
+    auto count_transmissions = [&stations]() {
+        std::size_t transmissions = 0;
+        for (const auto& station : stations) {
+            transmissions += station->access.transmissions();
+        }
+        return transmissions;
+    };
+    const std::size_t beacons = count_transmissions();
+    receptions = 0;
+
+    bool success = true;
+    AllocationCounter counter;
+    auto start = clock::now();
+    for (unsigned p = 0; p < packets; ++p) {
+        std::unique_ptr<DownPacket> packet { new DownPacket() };
+        packet->layer(OsiLayer::Transport) = btp_header;
+        packet->layer(OsiLayer::Application) = ByteBuffer(200, 0xde);
+        success &= stations.front()->router.request(request, std::move(packet)).accepted();
+        deliver();
+    }
+    const nanoseconds time = duration_cast<nanoseconds>(clock::now() - start);
+    const std::size_t allocations = counter.allocations();
+
+    const std::size_t transmissions = count_transmissions() - beacons;
+
+    std::size_t delivered = 0;
+    for (const auto& station : stations) {
+        delivered += station->counter.indications;
+    }
+
+    print_throughput_header();
+    print_throughput("gbc-forwarding", packets, time, allocations);
+    print_throughput("gbc-reception", receptions, time, allocations);
+    std::cout << "(" << static_cast<double>(transmissions) / packets << " transmissions and "
+        << static_cast<double>(delivered) / packets << " deliveries per packet)" << std::endl;
+
+    success &= delivered > 0;
+    if (!success) {
+        std::cerr << "GBC packets have not reached their destination area" << std::endl;
+    }
+    return success ? 0 : 1;
+}
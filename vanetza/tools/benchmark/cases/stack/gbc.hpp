@@ -0,0 +1,20 @@
+#ifndef BENCHMARK_CASES_STACK_GBC_HPP
+#define BENCHMARK_CASES_STACK_GBC_HPP
+
+#include "case.hpp"
+
+class StackGbcCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    unsigned neighbours;
+    unsigned packets;
+    double spacing;
+    double range;
+};
+
+#endif /* BENCHMARK_CASES_STACK_GBC_HPP */
@@ -0,0 +1,53 @@
+#include "loopback.hpp"
+#include <vanetza/dcc/data_request.hpp>
+#include <vanetza/net/chunk_packet.hpp>
+#include <iomanip>
+#include <iostream>
+
+using namespace vanetza;
+
+LoopbackAccessInterface::LoopbackAccessInterface(std::deque<LoopbackFrame>& frames, std::size_t station) :
+    m_frames(frames), m_station(station), m_transmissions(0)
+{
+}
+
+void LoopbackAccessInterface::request(const dcc::DataRequest& request, std::unique_ptr<ChunkPacket> packet)
+{
+    LoopbackFrame frame;
+    frame.station = m_station;
+    frame.source = request.source;
+    frame.destination = request.destination;
+    packet->serialize(frame.buffer, OsiLayer::Network, OsiLayer::Application);
+    m_frames.push_back(std::move(frame));
+    ++m_transmissions;
+}
+
+PositionFix stack_position_fix(Clock::time_point now, double latitude, double longitude)
+{
+    PositionFix fix;
+    fix.timestamp = now;
+    fix.latitude = latitude * units::degree;
+    fix.longitude = longitude * units::degree;
+    fix.confidence.semi_major = 5.0 * units::si::meter;
+    fix.confidence.semi_minor = 5.0 * units::si::meter;
+    fix.speed.assign(10.0 * units::si::meter_per_second, 1.0 * units::si::meter_per_second);
+    fix.course.assign(units::TrueNorth::from_value(90.0), units::TrueNorth::from_value(1.0));
+    return fix;
+}
+
+void print_throughput_header()
+{
+    std::cout << std::left << std::setw(18) << "operation" << std::right
+        << std::setw(10) << "packets" << std::setw(14) << "packets/s"
+        << std::setw(14) << "ns/packet" << std::setw(16) << "allocs/packet" << std::endl;
+}
+
+void print_throughput(const std::string& name, std::size_t packets, std::chrono::nanoseconds time, std::size_t allocations)
+{
+    const double count = packets > 0 ? packets : 1;
+    const double seconds = time.count() * 1e-9;
+    std::cout << std::left << std::setw(18) << name << std::right << std::setw(10) << packets
+        << std::fixed << std::setprecision(0) << std::setw(14) << (seconds > 0.0 ? packets / seconds : 0.0)
+        << std::setprecision(1) << std::setw(14) << time.count() / count
+        << std::setw(16) << allocations / count << std::endl;
+}
@@ -0,0 +1,70 @@
+#ifndef BENCHMARK_CASES_STACK_LOOPBACK_HPP
+#define BENCHMARK_CASES_STACK_LOOPBACK_HPP
+
+#include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/common/clock.hpp>
+#include <vanetza/common/position_fix.hpp>
+#include <vanetza/dcc/interface.hpp>
+#include <vanetza/net/mac_address.hpp>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <string>
+
+/**
+ * Frame transmitted by a loopback access interface
+ */
+struct LoopbackFrame
+{
+    std::size_t station;
+    vanetza::MacAddress source;
+    vanetza::MacAddress destination;
+    vanetza::ByteBuffer buffer;
+};
+
+/**
+ * LoopbackAccessInterface serializes requested packets like a link layer
+ * and queues them for delivery to other routers.
+ */
+class LoopbackAccessInterface : public vanetza::dcc::RequestInterface
+{
+public:
+    /**
+     * \param frames queue shared by all stations
+     * \param station index of station owning this interface
+     */
+    LoopbackAccessInterface(std::deque<LoopbackFrame>& frames, std::size_t station);
+
+    void request(const vanetza::dcc::DataRequest&, std::unique_ptr<vanetza::ChunkPacket>) override;
+
+    std::size_t transmissions() const { return m_transmissions; }
+
+private:
+    std::deque<LoopbackFrame>& m_frames;
+    std::size_t m_station;
+    std::size_t m_transmissions;
+};
+
+/**
+ * Create position fix of a station driving eastwards
+ * \param now time stamp of fix
+ * \param latitude latitude in degrees
+ * \param longitude longitude in degrees
+ */
+vanetza::PositionFix stack_position_fix(vanetza::Clock::time_point now, double latitude, double longitude);
+
+/**
+ * Print throughput of a measured operation
+ * \param name name of operation
+ * \param packets number of processed packets
+ * \param time total processing time
+ * \param allocations total number of heap allocations
+ */
+void print_throughput(const std::string& name, std::size_t packets, std::chrono::nanoseconds time, std::size_t allocations);
+
+/**
+ * Print header line matching print_throughput's columns
+ */
+void print_throughput_header();
+
+#endif /* BENCHMARK_CASES_STACK_LOOPBACK_HPP */
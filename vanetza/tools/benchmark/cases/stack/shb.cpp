@@ -0,0 +1,198 @@
+#include "shb.hpp"
+#include "allocation_counter.hpp"
+#include "cases/asn1/messages.hpp"
+#include "cases/stack/loopback.hpp"
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/packet_visitor.hpp>
+#include <vanetza/btp/data_indication.hpp>
+#include <vanetza/btp/header.hpp>
+#include <vanetza/btp/header_conversion.hpp>
+#include <vanetza/btp/port_dispatcher.hpp>
+#include <vanetza/btp/ports.hpp>
+#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/geonet/data_confirm.hpp>
+#include <vanetza/geonet/mib.hpp>
+#include <vanetza/geonet/router.hpp>
+#include <boost/program_options.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace vanetza;
+namespace po = boost::program_options;
+
+namespace
+{
+
+const double center_latitude = 48.76714;
+const double center_longitude = 11.43263;
+const Clock::duration cam_interval = std::chrono::milliseconds(100);
+
+// decodes CAMs like socktap's CAM application
+class CamReceiver : public btp::IndicationInterface
+{
+public:
+    void indicate(const btp::DataIndication&, std::unique_ptr<UpPacket> packet) override
+    {
+        asn1::PacketVisitor<asn1::Cam> visitor;
+        std::shared_ptr<const asn1::Cam> cam = boost::apply_visitor(visitor, *packet);
+        ++(cam ? decoded : broken);
+    }
+
+    std::size_t decoded = 0;
+    std::size_t broken = 0;
+};
+
+} // namespace
+
+bool StackShbCase::parse(const std::vector<std::string>& opts)
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help", "Print out available options.")
+        ("stations", po::value<unsigned>(&stations)->default_value(100), "Number of stations sending CAMs.")
+        ("packets", po::value<unsigned>(&packets)->default_value(100), "Number of CAMs per station.")
+    ;
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(opts).options(desc).run(), vm);
+
+    if (vm.count("help")) {
+        std::cerr << desc << std::endl;
+
+        return false;
+    }
+
+    try {
+        po::notify(vm);
+
+        if (stations == 0 || packets == 0) {
+            throw std::runtime_error("Stations and packets have to be positive.");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl << std::endl << desc << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void StackShbCase::prepare()
+{
+    cam = build_cam();
+}
+
+int StackShbCase::execute()
+{
+    using clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    ManualRuntime runtime(Clock::at("2020-01-01 12:00"));
+    const geonet::MIB mib;
+    std::deque<LoopbackFrame> frames;
+
+    asn1::Cam message;
+    if (!message.decode(cam)) {
+        throw std::runtime_error("Decoding of CAM template failed");
+    }
+
+    // every station sends its CAMs through a router of its own
+    std::vector<std::unique_ptr<LoopbackAccessInterface>> access;
+    std::vector<std::unique_ptr<geonet::Router>> routers;
+    for (unsigned s = 0; s < stations; ++s) {
+        access.emplace_back(new LoopbackAccessInterface(frames, s));
+        routers.emplace_back(new geonet::Router(runtime, mib));
+        geonet::Address address;
+        address.mid(create_mac_address(s + 1));
+        routers.back()->set_address(address);
+        routers.back()->set_access_interface(access.back().get());
+        routers.back()->update_position(stack_position_fix(runtime.now(),
+            center_latitude + 1e-5 * (s % 100), center_longitude + 1e-5 * (s / 100)));
+    }
+
+    geonet::ShbDataRequest request(mib);
+    request.upper_protocol = geonet::UpperProtocol::BTP_B;
+    request.communication_profile = geonet::CommunicationProfile::ITS_G5;
+
+    btp::HeaderB btp_header;
+    btp_header.destination_port = btp::ports::CAM;
+    btp_header.destination_port_info = host_cast<uint16_t>(0);
+
+    // transmission: application layer is encoded for each packet as done by socktap
+    bool success = true;
+    std::vector<std::size_t> frames_per_round;
+    nanoseconds tx_time { 0 };
+    std::size_t tx_allocations = 0;
+    AllocationCounter counter;
+    for (unsigned p = 0; p < packets; ++p) {
+        const std::size_t queued = frames.size();
+        // allocations are counted for the same span as time, i.e. without timers triggered in between
+        const std::size_t allocated = counter.allocations();
+        auto start = clock::now();
+        for (auto& router : routers) {
+            std::unique_ptr<DownPacket> packet { new DownPacket() };
+            packet->layer(OsiLayer::Transport) = btp_header;
+            packet->layer(OsiLayer::Application) = message.encode();
+            success &= router->request(request, std::move(packet)).accepted();
+        }
+        tx_time += duration_cast<nanoseconds>(clock::now() - start);
+        tx_allocations += counter.allocations() - allocated;
+        frames_per_round.push_back(frames.size() - queued);
+        runtime.trigger(cam_interval);
+    }
+
+    // reception: all frames are passed through a single router up to the CAM decoder
+    ManualRuntime rx_runtime(Clock::at("2020-01-01 12:00"));
+    geonet::Router receiver(rx_runtime, mib);
+    btp::PortDispatcher dispatcher;
+    CamReceiver cams;
+    LoopbackAccessInterface forwarding(frames, stations);
+    geonet::Address address;
+    address.mid(create_mac_address(0));
+    receiver.set_address(address);
+    receiver.set_access_interface(&forwarding);
+    receiver.set_transport_handler(geonet::UpperProtocol::BTP_B, &dispatcher);
+    dispatcher.set_non_interactive_handler(btp::ports::CAM, &cams);
+    receiver.update_position(stack_position_fix(rx_runtime.now(), center_latitude, center_longitude));
+
+    // copying received frames is excluded from measurement
+    std::vector<std::unique_ptr<geonet::UpPacket>> received;
+    std::vector<MacAddress> senders;
+    received.reserve(frames.size());
+    for (const LoopbackFrame& frame : frames) {
+        received.emplace_back(new geonet::UpPacket(CohesivePacket(frame.buffer, OsiLayer::Network)));
+        senders.push_back(frame.source);
+    }
+    frames.clear();
+
+    nanoseconds rx_time { 0 };
+    std::size_t rx_allocations = 0;
+    std::size_t next = 0;
+    for (std::size_t round_frames : frames_per_round) {
+        const std::size_t allocated = counter.allocations();
+        auto start = clock::now();
+        for (std::size_t i = next; i < next + round_frames; ++i) {
+            receiver.indicate(std::move(received[i]), senders[i], cBroadcastMacAddress);
+        }
+        rx_time += duration_cast<nanoseconds>(clock::now() - start);
+        rx_allocations += counter.allocations() - allocated;
+        next += round_frames;
+        rx_runtime.trigger(cam_interval);
+    }
+
+    print_throughput_header();
+    print_throughput("shb-cam-tx", stations * packets, tx_time, tx_allocations);
+    print_throughput("shb-cam-rx", received.size(), rx_time, rx_allocations);
+    std::cout << "(" << cams.decoded << " CAMs decoded, " << cams.broken << " broken)" << std::endl;
+
+    success &= cams.broken == 0 && cams.decoded == stations * packets;
+    if (!success) {
+        std::cerr << "Not all CAMs have been transmitted and decoded" << std::endl;
+    }
+    return success ? 0 : 1;
+}
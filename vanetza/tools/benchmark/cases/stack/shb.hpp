@@ -0,0 +1,20 @@
+#ifndef BENCHMARK_CASES_STACK_SHB_HPP
+#define BENCHMARK_CASES_STACK_SHB_HPP
+
+#include "case.hpp"
+#include <vanetza/common/byte_buffer.hpp>
+
+class StackShbCase : public Case
+{
+public:
+    bool parse(const std::vector<std::string>&) override;
+    void prepare() override;
+    int execute() override;
+
+private:
+    unsigned stations;
+    unsigned packets;
+    vanetza::ByteBuffer cam;
+};
+
+#endif /* BENCHMARK_CASES_STACK_SHB_HPP */
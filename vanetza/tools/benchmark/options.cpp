@@ -1,5 +1,13 @@
+#include "cases/asn1/decode.hpp"
+#include "cases/geonet/areas.hpp"
+#include "cases/geonet/headers.hpp"
+#include "cases/geonet/router_rx.hpp"
+#include "cases/runtime/scheduler.hpp"
 #include "cases/security/signing.hpp"
 #include "cases/security/validation.hpp"
+#include "cases/stack/codec.hpp"
+#include "cases/stack/gbc.hpp"
+#include "cases/stack/shb.hpp"
 #include "options.hpp"
 #include <boost/program_options.hpp>
 #include <iostream>
@@ -29,7 +37,7 @@ std::unique_ptr<Case> parse_options(int argc, const char *argv[])
     po::store(parsed, vm);
     po::notify(vm);
 
-    std::string available_commands = "Available cases: security-validation, security-signing";
+    std::string available_commands = "Available cases: asn1-decode, geonet-areas, geonet-headers, geonet-router-rx, runtime-scheduler, security-validation, security-signing, stack-codec, stack-gbc, stack-shb";
 
     if (!vm.count("case")) {
         std::cerr << global << std::endl;
@@ -44,10 +52,26 @@ std::unique_ptr<Case> parse_options(int argc, const char *argv[])
     if (name == "--help") {
         std::cerr << global << std::endl;
         std::cerr << available_commands << std::endl;
+    } else if (name == "asn1-decode") {
+        instance.reset(new Asn1DecodeCase());
+    } else if (name == "geonet-areas") {
+        instance.reset(new GeonetAreasCase());
+    } else if (name == "geonet-headers") {
+        instance.reset(new GeonetHeadersCase());
+    } else if (name == "geonet-router-rx") {
+        instance.reset(new GeonetRouterRxCase());
+    } else if (name == "runtime-scheduler") {
+        instance.reset(new RuntimeSchedulerCase());
     } else if (name == "security-signing") {
         instance.reset(new SecuritySigningCase());
     } else if (name == "security-validation") {
         instance.reset(new SecurityValidationCase());
+    } else if (name == "stack-codec") {
+        instance.reset(new StackCodecCase());
+    } else if (name == "stack-gbc") {
+        instance.reset(new StackGbcCase());
+    } else if (name == "stack-shb") {
+        instance.reset(new StackShbCase());
     } else {
         throw std::runtime_error("Unknown benchmark case.");
     }
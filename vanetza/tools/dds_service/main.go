@@ -5,10 +5,9 @@ import (
 	"log"
 	"net"
 	"os"
-	"strings"
 	"sync"
 
-	"github.com/Shopify/sysv_mq"
+	"dds-adapter/shmring"
 	xml "github.com/antchfx/xmlquery"
 	rti "github.com/rticommunity/rticonnextdds-connector-go"
 	"gopkg.in/ini.v1"
@@ -25,27 +24,28 @@ var inputs []tuple
 var server_socket *net.UDPConn
 var client_socket *net.UDPConn
 
-func vanetza_to_dds(wg *sync.WaitGroup, mq *sysv_mq.MessageQueue) {
+func vanetza_to_dds(wg *sync.WaitGroup, ring *shmring.Ring) {
 	defer wg.Done()
 
 	for {
-		str_data, _, err := mq.ReceiveString(0, 0)
+		topic, message, ok, err := ring.Read(-1)
 		if err != nil {
 			fmt.Println(err)
+			continue
+		} else if !ok {
+			continue
 		}
-		index := strings.Index(str_data, ";")
-		if index == -1 {
-			fmt.Printf("Error: vanetza_to_dds missing ';', message: %s\n", str_data)
+		output, found := outputs[topic]
+		if !found {
+			fmt.Printf("Error: vanetza_to_dds unknown topic %s\n", topic)
 			continue
 		}
-		topic := str_data[:index]
-		message := str_data[index+1:]
-		outputs[topic].Instance.SetString("message", message)
-		outputs[topic].Write()
+		output.Instance.SetString("message", message)
+		output.Write()
 	}
 }
 
-func dds_to_vanetza(wg *sync.WaitGroup, mq *sysv_mq.MessageQueue) {
+func dds_to_vanetza(wg *sync.WaitGroup, ring *shmring.Ring) {
 	defer wg.Done()
 
 	for {
@@ -60,7 +60,7 @@ func dds_to_vanetza(wg *sync.WaitGroup, mq *sysv_mq.MessageQueue) {
 					if err != nil {
 						log.Println(err)
 					} else {
-						err = mq.SendString(tuple.topic+";"+message, 1, 0)
+						err = ring.Write(tuple.topic, message)
 						if err != nil {
 							fmt.Println(err)
 						}
@@ -80,17 +80,18 @@ func main() {
 	to_dds_key, _ := cfg.Section("general").Key("to_dds_key").Int()
 	from_dds_key, _ := cfg.Section("general").Key("from_dds_key").Int()
 
-	to_dds_mq, err := sysv_mq.NewMessageQueue(&sysv_mq.QueueConfig{
-		Key:     to_dds_key,               // SysV IPC key
-		MaxSize: 15008,                    // Max size of a message
-		Mode:    sysv_mq.IPC_CREAT | 0600, // Creates if it doesn't exist, 0600 permissions
-	})
+	// keys name the shared memory rings, whichever side starts first creates them
+	to_dds_ring, err := shmring.Open(shmring.Name(to_dds_key), shmring.DefaultCapacity)
+	if err != nil {
+		log.Panic(err)
+	}
+	defer to_dds_ring.Close()
 
-	from_dds_mq, err := sysv_mq.NewMessageQueue(&sysv_mq.QueueConfig{
-		Key:     from_dds_key,             // SysV IPC key
-		MaxSize: 15008,                    // Max size of a message
-		Mode:    sysv_mq.IPC_CREAT | 0600, // Creates if it doesn't exist, 0600 permissions
-	})
+	from_dds_ring, err := shmring.Open(shmring.Name(from_dds_key), shmring.DefaultCapacity)
+	if err != nil {
+		log.Panic(err)
+	}
+	defer from_dds_ring.Close()
 
 	connector, _ = rti.NewConnector("participant_library::vanetza", os.Args[2])
 	defer connector.Delete()
@@ -122,8 +123,8 @@ func main() {
 	wg.Add(2)
 	fmt.Println("Starting")
 
-	go dds_to_vanetza(&wg, from_dds_mq)
-	go vanetza_to_dds(&wg, to_dds_mq)
+	go dds_to_vanetza(&wg, from_dds_ring)
+	go vanetza_to_dds(&wg, to_dds_ring)
 
 	wg.Wait()
 
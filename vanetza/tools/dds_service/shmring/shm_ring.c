@@ -0,0 +1,321 @@
+/*
+ * Single-producer/single-consumer ring buffer in shared memory
+ */
+#define _GNU_SOURCE
+#include "shm_ring.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SHM_RING_MAGIC 0x474e5256u /* "VRNG" */
+#define SHM_RING_VERSION 1u
+#define SHM_RING_PADDING 0xffffu /* topic of records filling the gap at the end of data area */
+#define CACHE_LINE 64
+
+enum { STATE_EMPTY = 0, STATE_INITIALIZING = 1, STATE_READY = 2 };
+
+/* layout of shared header, producer and consumer positions are kept on separate cache lines */
+struct shm_ring_shared {
+	_Alignas(CACHE_LINE) _Atomic uint32_t state;
+	uint32_t magic;
+	uint32_t version;
+	uint64_t capacity;
+	_Atomic uint64_t dropped;
+
+	_Alignas(CACHE_LINE) _Atomic uint64_t head; /* written by producer only */
+	_Alignas(CACHE_LINE) _Atomic uint64_t tail; /* written by consumer only */
+	_Alignas(CACHE_LINE) _Atomic uint32_t wake; /* futex word, bumped by producer */
+	_Atomic uint32_t waiting; /* set by consumer before sleeping */
+
+	_Alignas(CACHE_LINE) _Atomic uint32_t topic_count;
+	char topics[SHM_RING_MAX_TOPICS][SHM_RING_TOPIC_SIZE];
+};
+
+struct record_header {
+	uint32_t length;
+	uint16_t topic;
+	uint16_t reserved;
+};
+
+struct shm_ring {
+	struct shm_ring_shared *shared;
+	unsigned char *data;
+	uint64_t mask;
+	size_t mapped;
+	uint64_t pending; /* size of record handed out by last read */
+};
+
+static size_t header_size(void)
+{
+	return (sizeof(struct shm_ring_shared) + CACHE_LINE - 1) & ~(size_t)(CACHE_LINE - 1);
+}
+
+static uint64_t record_size(size_t length)
+{
+	return (sizeof(struct record_header) + length + 7) & ~(uint64_t)7;
+}
+
+static int is_power_of_two(uint64_t value)
+{
+	return value != 0 && (value & (value - 1)) == 0;
+}
+
+static long futex(_Atomic uint32_t *word, int op, uint32_t value, const struct timespec *timeout)
+{
+	/* not FUTEX_PRIVATE: words are shared between processes */
+	return syscall(SYS_futex, (uint32_t *)word, op, value, timeout, NULL, 0);
+}
+
+static int wait_ready(struct shm_ring_shared *shared)
+{
+	const struct timespec pause = { 0, 1000000 };
+	int attempts;
+
+	for (attempts = 0; attempts < 1000; ++attempts) {
+		if (atomic_load_explicit(&shared->state, memory_order_acquire) == STATE_READY) {
+			return 1;
+		}
+		nanosleep(&pause, NULL);
+	}
+	return 0;
+}
+
+shm_ring_t *shm_ring_open(const char *name, size_t capacity)
+{
+	struct shm_ring *ring = NULL;
+	struct shm_ring_shared *shared;
+	struct stat st;
+	void *map;
+	uint32_t expected = STATE_EMPTY;
+	int fd;
+
+	if (!name || !is_power_of_two(capacity) || capacity < 4096) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	/* fresh objects are empty, ftruncate zero-fills them */
+	if (fstat(fd, &st) != 0 || (st.st_size == 0 && ftruncate(fd, header_size() + capacity) != 0) || fstat(fd, &st) != 0) {
+		goto fail_fd;
+	}
+	if ((size_t)st.st_size < header_size() + 4096) {
+		errno = EINVAL;
+		goto fail_fd;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		goto fail_fd;
+	}
+	close(fd);
+	fd = -1;
+
+	shared = map;
+	if (atomic_compare_exchange_strong(&shared->state, &expected, STATE_INITIALIZING)) {
+		uint64_t available = st.st_size - header_size();
+		uint64_t ring_capacity = 4096;
+		while (ring_capacity * 2 <= available) {
+			ring_capacity *= 2;
+		}
+		shared->magic = SHM_RING_MAGIC;
+		shared->version = SHM_RING_VERSION;
+		shared->capacity = ring_capacity;
+		atomic_store_explicit(&shared->state, STATE_READY, memory_order_release);
+	} else if (!wait_ready(shared)) {
+		errno = ETIMEDOUT;
+		goto fail_map;
+	}
+
+	if (shared->magic != SHM_RING_MAGIC || shared->version != SHM_RING_VERSION ||
+			!is_power_of_two(shared->capacity) || header_size() + shared->capacity > (uint64_t)st.st_size) {
+		errno = EPROTO;
+		goto fail_map;
+	}
+
+	ring = calloc(1, sizeof(*ring));
+	if (!ring) {
+		goto fail_map;
+	}
+	ring->shared = shared;
+	ring->data = (unsigned char *)map + header_size();
+	ring->mask = shared->capacity - 1;
+	ring->mapped = st.st_size;
+	return ring;
+
+fail_map:
+	munmap(map, st.st_size);
+fail_fd:
+	if (fd >= 0) {
+		int error = errno;
+		close(fd);
+		errno = error;
+	}
+	return NULL;
+}
+
+void shm_ring_close(shm_ring_t *ring)
+{
+	if (ring) {
+		munmap(ring->shared, ring->mapped);
+		free(ring);
+	}
+}
+
+int shm_ring_intern(shm_ring_t *ring, const char *topic, size_t length)
+{
+	struct shm_ring_shared *shared = ring->shared;
+	uint32_t count = atomic_load_explicit(&shared->topic_count, memory_order_acquire);
+	uint32_t i;
+
+	if (length >= SHM_RING_TOPIC_SIZE || memchr(topic, '\0', length)) {
+		return SHM_RING_NO_TOPIC;
+	}
+
+	/* table survives restarts of either side, hence indices stay valid */
+	for (i = 0; i < count; ++i) {
+		if (strncmp(shared->topics[i], topic, length) == 0 && shared->topics[i][length] == '\0') {
+			return (int)i;
+		}
+	}
+
+	if (count >= SHM_RING_MAX_TOPICS) {
+		return SHM_RING_NO_TOPIC;
+	}
+	memcpy(shared->topics[count], topic, length);
+	shared->topics[count][length] = '\0';
+	atomic_store_explicit(&shared->topic_count, count + 1, memory_order_release);
+	return (int)count;
+}
+
+const char *shm_ring_topic(shm_ring_t *ring, int topic, size_t *length)
+{
+	struct shm_ring_shared *shared = ring->shared;
+
+	if (topic < 0 || (uint32_t)topic >= atomic_load_explicit(&shared->topic_count, memory_order_acquire)) {
+		return NULL;
+	}
+	if (length) {
+		*length = strlen(shared->topics[topic]);
+	}
+	return shared->topics[topic];
+}
+
+int shm_ring_write(shm_ring_t *ring, int topic, const void *data, size_t length)
+{
+	struct shm_ring_shared *shared = ring->shared;
+	const uint64_t capacity = ring->mask + 1;
+	const uint64_t size = record_size(length);
+	uint64_t head, tail, offset, gap;
+	struct record_header header;
+
+	if (topic < 0 || topic >= SHM_RING_MAX_TOPICS) {
+		return SHM_RING_INVALID;
+	}
+	/* any record up to half the capacity fits behind a padding record */
+	if (size > capacity / 2 || length > UINT32_MAX) {
+		return SHM_RING_TOO_LARGE;
+	}
+
+	head = atomic_load_explicit(&shared->head, memory_order_relaxed);
+	tail = atomic_load_explicit(&shared->tail, memory_order_acquire);
+	offset = head & ring->mask;
+	gap = capacity - offset < size ? capacity - offset : 0;
+	if (head + gap + size - tail > capacity) {
+		atomic_fetch_add_explicit(&shared->dropped, 1, memory_order_relaxed);
+		return SHM_RING_FULL;
+	}
+
+	if (gap > 0) {
+		header.length = (uint32_t)(gap - sizeof(header));
+		header.topic = SHM_RING_PADDING;
+		header.reserved = 0;
+		memcpy(ring->data + offset, &header, sizeof(header));
+		offset = 0;
+	}
+
+	header.length = (uint32_t)length;
+	header.topic = (uint16_t)topic;
+	header.reserved = 0;
+	memcpy(ring->data + offset, &header, sizeof(header));
+	memcpy(ring->data + offset + sizeof(header), data, length);
+
+	/* sequentially consistent store orders head before loading consumer's waiting flag */
+	atomic_store_explicit(&shared->head, head + gap + size, memory_order_seq_cst);
+	if (atomic_load_explicit(&shared->waiting, memory_order_seq_cst)) {
+		atomic_fetch_add_explicit(&shared->wake, 1, memory_order_seq_cst);
+		futex(&shared->wake, FUTEX_WAKE, 1, NULL);
+	}
+	return SHM_RING_OK;
+}
+
+int shm_ring_read(shm_ring_t *ring, int *topic, const void **data, size_t *length, int timeout_ms)
+{
+	struct shm_ring_shared *shared = ring->shared;
+	uint64_t tail = atomic_load_explicit(&shared->tail, memory_order_relaxed);
+	int waited = 0;
+
+	if (ring->pending) {
+		return SHM_RING_INVALID;
+	}
+
+	for (;;) {
+		uint64_t head = atomic_load_explicit(&shared->head, memory_order_acquire);
+		while (tail != head) {
+			struct record_header header;
+			memcpy(&header, ring->data + (tail & ring->mask), sizeof(header));
+			if (header.topic == SHM_RING_PADDING) {
+				tail += sizeof(header) + header.length;
+				atomic_store_explicit(&shared->tail, tail, memory_order_release);
+				continue;
+			}
+			*topic = header.topic;
+			*data = ring->data + (tail & ring->mask) + sizeof(header);
+			*length = header.length;
+			ring->pending = record_size(header.length);
+			return SHM_RING_OK;
+		}
+
+		if (timeout_ms == 0 || waited) {
+			return SHM_RING_EMPTY;
+		}
+
+		/* announce sleep, then check once more to not miss a record written meanwhile */
+		uint32_t wake = atomic_load_explicit(&shared->wake, memory_order_seq_cst);
+		atomic_store_explicit(&shared->waiting, 1, memory_order_seq_cst);
+		if (atomic_load_explicit(&shared->head, memory_order_seq_cst) == tail) {
+			struct timespec timeout = { timeout_ms / 1000, (timeout_ms % 1000) * 1000000L };
+			futex(&shared->wake, FUTEX_WAIT, wake, timeout_ms > 0 ? &timeout : NULL);
+			waited = 1;
+		}
+		atomic_store_explicit(&shared->waiting, 0, memory_order_relaxed);
+	}
+}
+
+void shm_ring_release(shm_ring_t *ring)
+{
+	if (ring->pending) {
+		struct shm_ring_shared *shared = ring->shared;
+		uint64_t tail = atomic_load_explicit(&shared->tail, memory_order_relaxed);
+		atomic_store_explicit(&shared->tail, tail + ring->pending, memory_order_release);
+		ring->pending = 0;
+	}
+}
+
+uint64_t shm_ring_dropped(const shm_ring_t *ring)
+{
+	return atomic_load_explicit(&ring->shared->dropped, memory_order_relaxed);
+}
@@ -0,0 +1,95 @@
+/*
+ * Single-producer/single-consumer ring buffer in shared memory
+ *
+ * Records are length-prefixed and refer to their topic by an index into a topic table
+ * kept in the shared header, i.e. topic names are transferred only once per ring.
+ * Producer and consumer never block each other; an idle consumer sleeps on a futex
+ * which is only woken by the producer if the consumer announced that it is waiting.
+ */
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* default size of a ring's data area in bytes */
+#define SHM_RING_DEFAULT_CAPACITY (4u * 1024u * 1024u)
+/* maximum number of distinct topics per ring */
+#define SHM_RING_MAX_TOPICS 64
+/* maximum length of a topic name including terminating null character */
+#define SHM_RING_TOPIC_SIZE 128
+
+/* return codes */
+#define SHM_RING_OK 0
+#define SHM_RING_EMPTY 1          /* no record available before timeout */
+#define SHM_RING_FULL (-1)        /* not enough space for record, record has been dropped */
+#define SHM_RING_TOO_LARGE (-2)   /* record can never fit into ring */
+#define SHM_RING_NO_TOPIC (-3)    /* topic name too long or topic table exhausted */
+#define SHM_RING_INVALID (-4)     /* invalid argument or ring state */
+
+typedef struct shm_ring shm_ring_t;
+
+/*
+ * Open ring in POSIX shared memory, create it if missing.
+ * Both sides may open a ring in any order, the first one initializes it.
+ * \param name shared memory object name, e.g. "/vanetza_dds_6060"
+ * \param capacity size of data area in bytes (power of two), used only when ring is created
+ * \return ring handle or NULL on error (errno is set)
+ */
+shm_ring_t *shm_ring_open(const char *name, size_t capacity);
+
+/*
+ * Unmap ring, shared memory object is kept for the other side
+ */
+void shm_ring_close(shm_ring_t *ring);
+
+/*
+ * Get index of topic, registers topic on first use (producer only)
+ * \return topic index or SHM_RING_NO_TOPIC
+ */
+int shm_ring_intern(shm_ring_t *ring, const char *topic, size_t length);
+
+/*
+ * Get name of a registered topic
+ * \param length set to name length if not NULL
+ * \return topic name or NULL for unknown index
+ */
+const char *shm_ring_topic(shm_ring_t *ring, int topic, size_t *length);
+
+/*
+ * Append record to ring without blocking (producer only)
+ * \return SHM_RING_OK, SHM_RING_FULL, SHM_RING_TOO_LARGE or SHM_RING_INVALID
+ */
+int shm_ring_write(shm_ring_t *ring, int topic, const void *data, size_t length);
+
+/*
+ * Wait for next record (consumer only)
+ *
+ * Record data remains valid until shm_ring_release() is called.
+ * \param topic set to record's topic index
+ * \param data set to record's payload within shared memory
+ * \param length set to payload length
+ * \param timeout_ms maximum waiting time, negative to wait infinitely, zero to poll
+ * \return SHM_RING_OK, SHM_RING_EMPTY or SHM_RING_INVALID
+ */
+int shm_ring_read(shm_ring_t *ring, int *topic, const void **data, size_t *length, int timeout_ms);
+
+/*
+ * Release record returned by last successful shm_ring_read() (consumer only)
+ */
+void shm_ring_release(shm_ring_t *ring);
+
+/*
+ * Number of records dropped by shm_ring_write() because ring was full
+ */
+uint64_t shm_ring_dropped(const shm_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHM_RING_H */
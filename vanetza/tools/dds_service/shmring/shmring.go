@@ -0,0 +1,138 @@
+// Package shmring wraps the shared-memory ring used between socktap and the DDS service.
+package shmring
+
+/*
+#cgo CFLAGS: -std=gnu11
+#cgo LDFLAGS: -lrt
+#include <stdlib.h>
+#include "shm_ring.h"
+*/
+import "C"
+
+import (
+	"errors"
+	"fmt"
+	"reflect"
+	"sync"
+	"unsafe"
+)
+
+// DefaultCapacity is the size of a ring's data area if the ring is created by this side.
+const DefaultCapacity = C.SHM_RING_DEFAULT_CAPACITY
+
+var (
+	ErrFull     = errors.New("shmring: ring is full, record dropped")
+	ErrTooLarge = errors.New("shmring: record exceeds ring capacity")
+	ErrNoTopic  = errors.New("shmring: topic name too long or topic table exhausted")
+	ErrInvalid  = errors.New("shmring: invalid argument")
+)
+
+// Ring is one direction of the transport, a Ring must be used either for writing or for reading.
+type Ring struct {
+	ring   *C.shm_ring_t
+	mutex  sync.Mutex
+	topics map[string]C.int
+	names  map[C.int]string
+}
+
+// Name returns the shared memory object name derived from a configured key.
+func Name(key int) string {
+	return fmt.Sprintf("/vanetza_dds_%d", key)
+}
+
+// Open maps the ring with given name, it is created if it does not exist yet.
+func Open(name string, capacity int) (*Ring, error) {
+	cname := C.CString(name)
+	defer C.free(unsafe.Pointer(cname))
+	ring, err := C.shm_ring_open(cname, C.size_t(capacity))
+	if ring == nil {
+		return nil, fmt.Errorf("shmring: opening %s failed: %v", name, err)
+	}
+	return &Ring{ring: ring, topics: map[string]C.int{}, names: map[C.int]string{}}, nil
+}
+
+// Close unmaps the ring.
+func (r *Ring) Close() {
+	r.mutex.Lock()
+	defer r.mutex.Unlock()
+	if r.ring != nil {
+		C.shm_ring_close(r.ring)
+		r.ring = nil
+	}
+}
+
+// Write appends a message without blocking, it is dropped if the reader lags behind.
+func (r *Ring) Write(topic string, message string) error {
+	r.mutex.Lock()
+	defer r.mutex.Unlock()
+
+	index, found := r.topics[topic]
+	if !found {
+		ctopic := C.CString(topic)
+		index = C.shm_ring_intern(r.ring, ctopic, C.size_t(len(topic)))
+		C.free(unsafe.Pointer(ctopic))
+		if index < 0 {
+			return ErrNoTopic
+		}
+		r.topics[topic] = index
+	}
+
+	var data unsafe.Pointer
+	if len(message) > 0 {
+		// message bytes are copied into ring, no need to convert string first
+		data = unsafe.Pointer((*reflect.StringHeader)(unsafe.Pointer(&message)).Data)
+	}
+	return result(C.shm_ring_write(r.ring, index, data, C.size_t(len(message))))
+}
+
+// Read waits at most timeoutMs milliseconds (negative for infinitely) for the next message.
+// The returned flag is false if no message arrived in time.
+func (r *Ring) Read(timeoutMs int) (string, string, bool, error) {
+	r.mutex.Lock()
+	defer r.mutex.Unlock()
+
+	var index C.int
+	var data unsafe.Pointer
+	var length C.size_t
+	rc := C.shm_ring_read(r.ring, &index, &data, &length, C.int(timeoutMs))
+	if rc == C.SHM_RING_EMPTY {
+		return "", "", false, nil
+	} else if err := result(rc); err != nil {
+		return "", "", false, err
+	}
+
+	message := C.GoStringN((*C.char)(data), C.int(length))
+	C.shm_ring_release(r.ring)
+
+	topic, found := r.names[index]
+	if !found {
+		var topicLength C.size_t
+		name := C.shm_ring_topic(r.ring, index, &topicLength)
+		if name == nil {
+			return "", "", false, ErrNoTopic
+		}
+		topic = C.GoStringN(name, C.int(topicLength))
+		r.names[index] = topic
+	}
+	return topic, message, true, nil
+}
+
+// Dropped returns the number of records discarded because the ring was full.
+func (r *Ring) Dropped() uint64 {
+	return uint64(C.shm_ring_dropped(r.ring))
+}
+
+func result(rc C.int) error {
+	switch rc {
+	case C.SHM_RING_OK:
+		return nil
+	case C.SHM_RING_FULL:
+		return ErrFull
+	case C.SHM_RING_TOO_LARGE:
+		return ErrTooLarge
+	case C.SHM_RING_NO_TOPIC:
+		return ErrNoTopic
+	default:
+		return ErrInvalid
+	}
+}
@@ -0,0 +1,148 @@
+package shmring
+
+import (
+	"fmt"
+	"os"
+	"strings"
+	"testing"
+)
+
+const testCapacity = 4096
+
+func openTestRings(t *testing.T) (string, *Ring, *Ring) {
+	name := fmt.Sprintf("/vanetza_shmring_test_%d_%s", os.Getpid(), t.Name())
+	writer, err := Open(name, testCapacity)
+	if err != nil {
+		t.Fatal(err)
+	}
+	reader, err := Open(name, testCapacity)
+	if err != nil {
+		writer.Close()
+		t.Fatal(err)
+	}
+	t.Cleanup(func() {
+		writer.Close()
+		reader.Close()
+		os.Remove("/dev/shm" + name)
+	})
+	return name, writer, reader
+}
+
+func expectRead(t *testing.T, ring *Ring, topic string, message string) {
+	t.Helper()
+	gotTopic, gotMessage, ok, err := ring.Read(0)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if !ok {
+		t.Fatalf("expected message %q on %q, ring is empty", message, topic)
+	}
+	if gotTopic != topic || gotMessage != message {
+		t.Fatalf("expected %q on %q, got %q on %q", message, topic, gotMessage, gotTopic)
+	}
+}
+
+func expectEmpty(t *testing.T, ring *Ring) {
+	t.Helper()
+	if _, message, ok, err := ring.Read(0); err != nil || ok {
+		t.Fatalf("expected empty ring, got %q (error %v)", message, err)
+	}
+}
+
+func TestEmpty(t *testing.T) {
+	_, _, reader := openTestRings(t)
+	expectEmpty(t, reader)
+	if _, _, ok, err := reader.Read(1); err != nil || ok {
+		t.Fatal("expected timeout on empty ring")
+	}
+}
+
+func TestWrapAround(t *testing.T) {
+	_, writer, reader := openTestRings(t)
+
+	// odd record size makes padding records at the end of the data area necessary
+	for i := 0; i < 500; i++ {
+		topic := fmt.Sprintf("topic%d", i%3)
+		message := fmt.Sprintf("%04d-%s", i, strings.Repeat("x", 90+i%7))
+		if err := writer.Write(topic, message); err != nil {
+			t.Fatalf("write %d: %v", i, err)
+		}
+		expectRead(t, reader, topic, message)
+	}
+	expectEmpty(t, reader)
+	if writer.Dropped() != 0 {
+		t.Fatalf("expected no drops, got %d", writer.Dropped())
+	}
+}
+
+func TestFull(t *testing.T) {
+	_, writer, reader := openTestRings(t)
+	message := strings.Repeat("y", 1000)
+
+	written := 0
+	for ; written < 10; written++ {
+		if err := writer.Write("full", message); err == ErrFull {
+			break
+		} else if err != nil {
+			t.Fatal(err)
+		}
+	}
+	if written == 0 || written == 10 {
+		t.Fatalf("expected ring to fill up, %d records written", written)
+	}
+	if writer.Dropped() != 1 {
+		t.Fatalf("expected one drop, got %d", writer.Dropped())
+	}
+
+	// consuming a record makes room for exactly one more
+	expectRead(t, reader, "full", message)
+	if err := writer.Write("full", message); err != nil {
+		t.Fatal(err)
+	}
+	for i := 0; i < written; i++ {
+		expectRead(t, reader, "full", message)
+	}
+	expectEmpty(t, reader)
+}
+
+func TestTooLarge(t *testing.T) {
+	_, writer, _ := openTestRings(t)
+	if err := writer.Write("large", strings.Repeat("z", testCapacity)); err != ErrTooLarge {
+		t.Fatalf("expected ErrTooLarge, got %v", err)
+	}
+	if writer.Dropped() != 0 {
+		t.Fatalf("oversized record must not count as drop, got %d", writer.Dropped())
+	}
+}
+
+func TestReopen(t *testing.T) {
+	name, writer, reader := openTestRings(t)
+	if err := writer.Write("first", "one"); err != nil {
+		t.Fatal(err)
+	}
+	if err := writer.Write("second", "two"); err != nil {
+		t.Fatal(err)
+	}
+	expectRead(t, reader, "first", "one")
+
+	// both sides restart, unread records and topic table survive
+	writer.Close()
+	reader.Close()
+	writer, err := Open(name, DefaultCapacity)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer writer.Close()
+	reader, err = Open(name, DefaultCapacity)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer reader.Close()
+
+	expectRead(t, reader, "second", "two")
+	if err := writer.Write("first", "three"); err != nil {
+		t.Fatal(err)
+	}
+	expectRead(t, reader, "first", "three")
+	expectEmpty(t, reader)
+}
@@ -2,6 +2,10 @@
 #include <vanetza/btp/header.hpp>
 #include <vanetza/btp/header_conversion.hpp>
 #include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <unordered_set>
 
 using namespace vanetza;
 
@@ -30,6 +34,52 @@ Application::DataConfirm Application::request(const DataRequest& request, DownPa
     return confirm;
 }
 
+bool Application::enqueue(const DataRequest& request, DownPacketPtr packet, PipelineStopwatch stopwatch)
+{
+    if (!context_ || !packet) {
+        return false;
+    }
+    stopwatch.lap(PipelineStage::JsonParse);
+
+    // UPER encoding happens here so the router thread only deals with lower layers
+    ByteBuffer payload;
+    packet->layer(OsiLayer::Application).convert(payload);
+    packet->layer(OsiLayer::Application) = std::move(payload);
+    stopwatch.lap(PipelineStage::UperEncode);
+
+    return context_->submit(this, request, std::move(packet), stopwatch);
+}
+
+void Application::init_metrics(const metrics_t& metrics, const std::string& message)
+{
+    rx_metrics_.reset(new PipelineMetrics(metrics, message, "rx"));
+    tx_metrics_.reset(new PipelineMetrics(metrics, message, "tx"));
+    filtered_counter_ = packet_drop_counter(metrics.drop_counter, "application", "filtered");
+    decode_failed_counter_ = packet_drop_counter(metrics.drop_counter, "application", "decode_failed");
+}
+
+PipelineStopwatch Application::rx_stopwatch()
+{
+    if (!context_ || !rx_metrics_) {
+        return PipelineStopwatch {};
+    }
+
+    const PacketTrace& trace = context_->trace();
+    PipelineStopwatch stopwatch { rx_metrics_.get(), trace.indicated - trace.socket };
+    stopwatch.lap(PipelineStage::SocketRx, trace.indicated);
+    if (trace.security > PacketTrace::clock::duration::zero()) {
+        stopwatch.record(PipelineStage::SecurityVerify, trace.security);
+    }
+    stopwatch.lap(PipelineStage::GeonetParse, trace.dispatched, trace.security);
+    stopwatch.lap(PipelineStage::BtpDispatch);
+    return stopwatch;
+}
+
+PipelineStopwatch Application::tx_stopwatch()
+{
+    return tx_metrics_ ? PipelineStopwatch { tx_metrics_.get(), PipelineStopwatch::clock::now() } : PipelineStopwatch {};
+}
+
 void initialize_request(const Application::DataRequest& generic, geonet::DataRequest& geonet)
 {
     geonet.upper_protocol = geonet::UpperProtocol::BTP_B;
@@ -63,3 +113,29 @@ Application::PromiscuousHook* Application::promiscuous_hook()
 {
     return nullptr;
 }
+
+Application::HeaderFilter create_header_filter(const config_t& config)
+{
+    std::unordered_set<std::uint32_t> accepted;
+    std::istringstream list(config.accept_station_ids);
+    std::string station;
+    while (std::getline(list, station, ',')) {
+        if (station.find_first_not_of(" \t") != std::string::npos) {
+            accepted.insert(std::stoul(station));
+        }
+    }
+
+    // own messages may also be received via other stations forwarding them
+    const bool ignore_own = config.ignore_own_messages;
+    const std::uint32_t own_station = config.station_id;
+    if (accepted.empty() && !ignore_own) {
+        return nullptr;
+    }
+
+    return [accepted, ignore_own, own_station](const asn1::PduHeader& header) {
+        if (ignore_own && header.station_id == own_station) {
+            return false;
+        }
+        return accepted.empty() || accepted.count(header.station_id) > 0;
+    };
+}
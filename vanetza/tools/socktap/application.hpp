@@ -1,6 +1,8 @@
 #ifndef APPLICATION_HPP_PSIGPUTG
 #define APPLICATION_HPP_PSIGPUTG
 
+#include <vanetza/asn1/packet_visitor.hpp>
+#include <vanetza/asn1/pdu_peek.hpp>
 #include <vanetza/btp/data_interface.hpp>
 #include <vanetza/btp/data_indication.hpp>
 #include <vanetza/btp/data_request.hpp>
@@ -8,14 +10,20 @@
 #include <vanetza/geonet/data_confirm.hpp>
 #include <vanetza/geonet/router.hpp>
 #include "asn1json.hpp"
+#include "asn1json_reader.hpp"
+#include "asn1json_writer.hpp"
 
 #include <nlohmann/json.hpp>
 #include "dds.h"
 #include "router_context.hpp"
 #include "config.hpp"
+#include "pipeline_metrics.hpp"
 
 #include <prometheus/counter.h>
 #include <prometheus/registry.h>
+#include <boost/variant/apply_visitor.hpp>
+#include <functional>
+#include <memory>
 
 class Application : public vanetza::btp::IndicationInterface
 {
@@ -24,6 +32,7 @@ public:
     using DataIndication = vanetza::btp::DataIndication;
     using DataRequest = vanetza::btp::DataRequestGeoNetParams;
     using DownPacketPtr = vanetza::geonet::Router::DownPacketPtr;
+    using HeaderFilter = std::function<bool(const vanetza::asn1::PduHeader&)>;
     using PortType = vanetza::btp::port_type;
     using PromiscuousHook = vanetza::btp::PortDispatcher::PromiscuousHook;
     using UpPacketPtr = vanetza::geonet::Router::UpPacketPtr;
@@ -37,15 +46,84 @@ public:
     virtual PromiscuousHook* promiscuous_hook();
     void on_message(string);
 
+    /**
+     * Set filter dropping received messages by their ITS PDU header before they are decoded
+     * \param filter returns true for messages to be decoded, empty filter accepts all messages
+     */
+    void set_header_filter(HeaderFilter filter) { header_filter_ = std::move(filter); }
+
 protected:
     DataConfirm request(const DataRequest&, DownPacketPtr);
 
+    /**
+     * Hand over a request to the router thread
+     *
+     * Safe to call from any thread, e.g. MQTT or DDS ingress threads.
+     * The application layer payload is encoded by the calling thread already.
+     *
+     * \param stopwatch observes transmission stages, it is finished by the router thread
+     * \return true if request has been queued for the router
+     */
+    bool enqueue(const DataRequest&, DownPacketPtr, PipelineStopwatch stopwatch = {});
+
+    /**
+     * Create pipeline histograms and drop counters of this application
+     * \param metrics metric families
+     * \param message message label, e.g. "cam"
+     */
+    void init_metrics(const metrics_t& metrics, const std::string& message);
+
+    /**
+     * Start stopwatch for a packet being indicated by the router
+     *
+     * Stages passed by the packet before reaching the application are observed already.
+     */
+    PipelineStopwatch rx_stopwatch();
+
+    /**
+     * Start stopwatch for a message received from MQTT or DDS
+     */
+    PipelineStopwatch tx_stopwatch();
+
+    /**
+     * Decode message of a received packet unless the header filter rejects it
+     * \param packet received packet
+     * \return message or nullptr if message is filtered or broken
+     */
+    template<typename T>
+    std::shared_ptr<const T> decode(const vanetza::PacketVariant& packet) const
+    {
+        vanetza::asn1::PacketVisitor<T> visitor;
+        if (header_filter_) {
+            // reference avoids copying the filter's state for every packet
+            visitor.set_header_filter(std::cref(header_filter_));
+        }
+        std::shared_ptr<const T> message = boost::apply_visitor(visitor, packet);
+        if (!message) {
+            count_packet_drop(visitor.filtered() ? filtered_counter_ : decode_failed_counter_);
+        }
+        return message;
+    }
+
 private:
     friend class RouterContext;
     vanetza::geonet::GbcDataRequest request_gbc(const DataRequest&);
     vanetza::geonet::ShbDataRequest request_shb(const DataRequest&);
-    vanetza::geonet::Router* router_;
+    vanetza::geonet::Router* router_ = nullptr;
+    RouterContext* context_ = nullptr;
+    HeaderFilter header_filter_;
+    std::unique_ptr<PipelineMetrics> rx_metrics_;
+    std::unique_ptr<PipelineMetrics> tx_metrics_;
+    prometheus::Counter* filtered_counter_ = nullptr;
+    prometheus::Counter* decode_failed_counter_ = nullptr;
 };
 
+/**
+ * Create header filter according to configuration
+ * \param config socktap configuration
+ * \return filter or empty filter if all messages shall be decoded
+ */
+Application::HeaderFilter create_header_filter(const config_t& config);
+
 #endif /* APPLICATION_HPP_PSIGPUTG */
 
@@ -1,6 +1,10 @@
 # To run:
 # python3 asn1json.py cpp > asn1json.cpp
 # python3 asn1json.py hpp > asn1json.hpp
+# python3 asn1json.py writer-cpp > asn1json_writer.cpp
+# python3 asn1json.py writer-hpp > asn1json_writer.hpp
+# python3 asn1json.py reader-cpp > asn1json_reader.cpp
+# python3 asn1json.py reader-hpp > asn1json_reader.hpp
 
 from email import header
 import asn1tools
@@ -72,6 +76,177 @@ bitstrings = {}
 
 initial_len = len(printed)
 
+######
+# Streaming JSON writer (write_json) emitters
+#
+# write_json produces the same text as nlohmann::json(p).dump() without building a DOM.
+# nlohmann::json stores object keys in a std::map, hence members are written in sorted key order.
+# An object without any present member is null in nlohmann::json and so is an empty array.
+######
+
+def comment_str(name, definition_type, parent_name, parent_file):
+    return """
+/*
+*   """ + name + """ - Type """ + definition_type + """
+*   From """ + parent_name + """ - File """ + parent_file + """
+*/
+"""
+
+def member_access(asn1_type, m):
+    return 'p.' + ('choice.' if asn1_type.definition["type"] == "CHOICE" else '') + (m["name"] if m['name'] not in capitalize_first_letter else m['name'].title()).replace("-", "_")
+
+def member_statement(asn1_type, m):
+    access = member_access(asn1_type, m)
+    optional = "optional" in m and m["optional"]
+    value = ('*(' if optional else '(') + access + ')'
+    if m["type"] in transformation:
+        factor, sentinels = transformation[m["type"]]
+        scaled = ('(double) *(' if optional else '(double)(') + access + ')' + " / " + str(float(factor))
+        if len(sentinels) > 0:
+            value = "(" + (" && " if optional else " || ").join([value + (" != " if optional else " == ") + str(n) for n in sentinels]) + ") ? " + value + " : " + scaled
+        else:
+            value = scaled
+    if m["type"] in bitstrings:
+        return 'write_json_' + (m["type"] if optional else m["type"].replace("-", "_")) + '(w, ' + value + ');'
+    return 'write_json(w, ' + value + ');'
+
+def writer_declaration_str(type_name):
+    return "\nvoid write_json(JsonWriter& w, const " + type_name + "& p);\n"
+
+def writer_sequence_str(type_name, entries):
+    # entries are (key, condition for optional members or None, statement)
+    entries = sorted(entries, key=lambda e: e[0])
+    body = ""
+    if all(e[1] is not None for e in entries):
+        if len(entries) == 0:
+            return "\nvoid write_json(JsonWriter& w, const " + type_name + "& p) {\n    w.null();\n}"
+        body += "    if (!(" + " || ".join([e[1] for e in entries]) + ")) {\n        w.null();\n        return;\n    }\n"
+    body += "    w.begin_object();\n"
+    for key, condition, statement in entries:
+        if condition is None:
+            body += '    w.key("' + key + '");\n    ' + statement + '\n'
+        else:
+            body += '    if (' + condition + ') {\n        w.key("' + key + '");\n        ' + statement + '\n    }\n'
+    body += "    w.end_object();\n"
+    return "\nvoid write_json(JsonWriter& w, const " + type_name + "& p) {\n" + body + "}"
+
+def writer_choice_str(type_name, entries):
+    # entries are (key, condition, statement)
+    return "\nvoid write_json(JsonWriter& w, const " + type_name + "& p) {\n    if " + " else if ".join(['(' + condition + ') {\n        w.begin_object();\n        w.key("' + key + '");\n        ' + statement + '\n        w.end_object();\n    }' for key, condition, statement in entries]) + " else {\n        w.null();\n    }\n}"
+
+def writer_sequence_of_str(type_name):
+    return """
+void write_json(JsonWriter& w, const """ + type_name + """& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}"""
+
+def writer_bit_string_declaration_str(name):
+    return "\nvoid write_json_" + name + "(JsonWriter& w, const " + name + "_t& p);\n"
+
+def writer_bit_string_str(name, entries):
+    # entries are (bit name, boolean expression)
+    entries = sorted(entries, key=lambda e: e[0])
+    if len(entries) == 0:
+        return "\nvoid write_json_" + name + "(JsonWriter& w, const " + name + "_t& p) {\n    w.null();\n}"
+    return "\nvoid write_json_" + name + "(JsonWriter& w, const " + name + "_t& p) {\n    w.begin_object();\n" + ''.join(['    w.key("' + key + '");\n    w.value(' + expression + ');\n' for key, expression in entries]) + "    w.end_object();\n}"
+
+def writer_todo_str(type_name):
+    return "\nvoid write_json(JsonWriter& w, const " + type_name + "& p) {\n    w.null(); // TODO\n}"
+
+######
+# Streaming JSON reader (read_json) emitters
+#
+# read_json fills zero-initialised asn1c structures directly from the JSON text without building a DOM.
+# Its semantics follow the from_json functions: unknown members are skipped, null equals an empty object or list,
+# optional members are allocated when present and missing mandatory members are reported as errors.
+######
+
+def member_read_statements(asn1_type, m):
+    access = member_access(asn1_type, m)
+    optional = "optional" in m and m["optional"]
+    target = ('*(' if optional else '(') + access + ')'
+    statements = [access + ' = vanetza::asn1::allocate<' + m["type"].replace("-", "_") + '_t>();'] if optional else []
+    if m["type"] in bitstrings:
+        statements.append('read_json_' + m["type"].replace("-", "_") + '(r, ' + target + ');')
+    elif m["type"] in transformation:
+        factor, sentinels = transformation[m["type"]]
+        statements.append('const double value = r.number();')
+        statements.append(target + ' = ' + (('(' + ' && '.join(['value != ' + str(n) for n in sentinels]) + ') ? ') if len(sentinels) > 0 else '') + 'value * ' + str(int(factor)) + (' : value' if len(sentinels) > 0 else '') + ';')
+    else:
+        statements.append('read_json(r, ' + target + ');')
+    return statements
+
+def reader_declaration_str(type_name):
+    return "\nvoid read_json(JsonReader& r, " + type_name + "& p);\n"
+
+def reader_members_str(entries, prologue, epilogue):
+    # entries are (key, statements) and are dispatched by their index in the key table
+    if len(entries) > 64:
+        raise ValueError("member mask supports up to 64 members")
+    if len(entries) == 0:
+        return prologue + "    r.skip();\n" + epilogue
+    # members are looked up in key table order which matches the sorted key order of nlohmann's output
+    entries = sorted(entries, key=lambda e: e[0])
+    body = "    static const char* const keys[] = { " + ", ".join(['"' + key + '"' for key, statements in entries]) + " };\n"
+    body += prologue
+    body += "    JsonReader::Members members(r, keys);\n    while (members.next()) {\n        switch (members.index()) {\n"
+    for i, (key, statements) in enumerate(entries):
+        if any(s.startswith("const ") for s in statements):
+            body += "            case " + str(i) + ": {\n" + ''.join(["                " + s + "\n" for s in statements]) + "                break;\n            }\n"
+        else:
+            body += "            case " + str(i) + ":\n" + ''.join(["                " + s + "\n" for s in statements]) + "                break;\n"
+    body += "            default:\n                r.skip();\n                break;\n        }\n    }\n"
+    return body + epilogue
+
+def required_mask_str(flags):
+    mask = sum([1 << i for i, required in enumerate(flags) if required])
+    return ("    members.require(" + hex(mask) + "ull);\n") if mask != 0 else ""
+
+def reader_sequence_str(type_name, entries):
+    # entries are (key, mandatory, statements)
+    entries = sorted(entries, key=lambda e: e[0])
+    return "\nvoid read_json(JsonReader& r, " + type_name + "& p) {\n" + reader_members_str([(key, statements) for key, mandatory, statements in entries], "", required_mask_str([mandatory for key, mandatory, statements in entries])) + "}"
+
+def reader_choice_str(type_name, entries):
+    # entries are (key, presence, statements)
+    return "\nvoid read_json(JsonReader& r, " + type_name + "& p) {\n" + reader_members_str([(key, ["members.exclusive();", "p.present = " + presence + ";"] + statements) for key, presence, statements in entries], "", "") + "}"
+
+def reader_sequence_of_str(type_name, element):
+    return """
+void read_json(JsonReader& r, """ + type_name + """& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        """ + element + """_t* element = vanetza::asn1::allocate<""" + element + """_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}"""
+
+def reader_bit_string_declaration_str(name):
+    return "\nvoid read_json_" + name + "(JsonReader& r, " + name + "_t& p);\n"
+
+def reader_bit_string_str(name, entries):
+    # entries are (bit name, bit position) in declaration order
+    count = str(len(entries))
+    prologue = """    p.size = (""" + count + """ / 8) + 1;
+    p.bits_unused = (""" + count + """ % 8) != 0 ? 8 - (""" + count + """ % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+"""
+    members = [(key, ['if (r.boolean()) *(p.buf + (sizeof(uint8_t) * ' + str(int(int(bit) / 8)) + ')) |= (1 << ' + str(7 - (int(bit) % 8)) + ');']) for key, bit in entries]
+    return "\nvoid read_json_" + name + "(JsonReader& r, " + name + "_t& p) {\n" + reader_members_str(members, prologue, required_mask_str([True for e in entries])) + "}"
+
+def reader_todo_str(type_name):
+    return "\nvoid read_json(JsonReader& r, " + type_name + "& p) {\n    r.skip(); // TODO\n}"
+
+
 class ASN1Sequence:
     def __init__(self, name, definition, parent_name, parent_file):
         self.name = name
@@ -118,6 +293,20 @@ void from_json(const json& j, """ + (self.name.replace("-", "_") + "_t" if self.
     """ + '\n    '.join(['p.' + ('choice.' if self.definition["type"] == "CHOICE" else '') + (m["name"] if m['name'] not in capitalize_first_letter else m['name'].title()).replace("-", "_") + '=nullptr;' for m in self.ignored_members if "optional" in m and m["optional"]]) + """
 }"""
 
+    def writer_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_declaration_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def writer_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_sequence_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"),
+            [(m["name"], (member_access(self, m) + ' != 0') if "optional" in m and m["optional"] else None, member_statement(self, m)) for m in self.members])
+
+    def reader_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_declaration_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def reader_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_sequence_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"),
+            [(m["name"], "optional" not in m or not m["optional"], member_read_statements(self, m)) for m in self.members])
+
 
 class ASN1Choice:
     def __init__(self, name, definition, parent_name, parent_file):
@@ -166,6 +355,23 @@ void from_json(const json& j, """ + (self.name.replace("-", "_") + "_t" if self.
     }
 }"""
 
+    def writer_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_declaration_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def writer_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_choice_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"),
+            [(m["name"], 'p.present == ' + (self.actual_type.replace("-", "_") if self.actual_type is not None else self.name.replace("-", "_")) + '_PR_' + m['name'].replace("-", "_"),
+              ('write_json(w, p.choice.' + m['name'].replace("-", "_") + ');') if m["type"] not in bitstrings else ('write_json_' + m["type"].replace("-", "_") + '(w, p.choice.' + m['name'].replace("-", "_") + ');')) for m in self.members])
+
+    def reader_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_declaration_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def reader_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_choice_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"),
+            [(m["name"], (self.actual_type.replace("-", "_") if self.actual_type is not None else self.name.replace("-", "_")) + '_PR_' + m['name'].replace("-", "_"),
+              [('read_json(r, p.choice.' + m['name'].replace("-", "_") + ');') if m["type"] not in bitstrings else ('read_json_' + m["type"].replace("-", "_") + '(r, p.choice.' + m['name'].replace("-", "_") + ');')]) for m in self.members])
+
+
 class ASN1SequenceOf:
     def __init__(self, name, definition, parent_name, parent_file):
         self.name = name
@@ -217,6 +423,18 @@ void from_json(const json& j, """ + (self.name.replace("-", "_") + "_t" if self.
     delete p_tmp;
 }"""
 
+    def writer_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_declaration_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def writer_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_sequence_of_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def reader_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_declaration_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"))
+
+    def reader_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_sequence_of_str(self.name.replace("-", "_") + "_t" if self.name in add_t else self.name.replace("-", "_"), self.element.replace("-", "_"))
+
 
 class ASN1BitString:
     def __init__(self, name, definition, parent_name, parent_file):
@@ -263,6 +481,19 @@ void from_json_""" + self.name.replace("-", "_") + """(const json& j, """ + self
     delete p_tmp;
 }"""
 
+    def writer_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_bit_string_declaration_str(self.name.replace("-", "_"))
+
+    def writer_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_bit_string_str(self.name.replace("-", "_"),
+            [(m[0], '(bool) (*(p.buf + (sizeof(uint8_t) * (' + str(m[1]) + ' / 8))) & (1 << ((7 * ((' + str(int(m[1])) + ' / 8) + 1))-(' + str(m[1]) + ' % 8))))') for m in self.members])
+
+    def reader_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_bit_string_declaration_str(self.name.replace("-", "_"))
+
+    def reader_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_bit_string_str(self.name.replace("-", "_"), [(m[0], m[1]) for m in self.members])
+
 
 class ASN1TODO:
     def __init__(self, name, definition, parent_name, parent_file):
@@ -298,6 +529,18 @@ void from_json(const json& j, """ + (self.name + "_t" if self.name in add_t else
     // TODO
 }"""
 
+    def writer_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_declaration_str(self.name + "_t" if self.name in add_t else self.name)
+
+    def writer_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + writer_todo_str(self.name + "_t" if self.name in add_t else self.name)
+
+    def reader_header_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_declaration_str(self.name + "_t" if self.name in add_t else self.name)
+
+    def reader_str(self):
+        return comment_str(self.name, self.definition["type"], self.parent_name, self.parent_file) + reader_todo_str(self.name + "_t" if self.name in add_t else self.name)
+
 
 def parse_type(type_name, top_level_key, asn1_file, asn1_type):
     if asn1_type["type"] in ["SEQUENCE"]:
@@ -328,13 +571,6 @@ def parse_type(type_name, top_level_key, asn1_file, asn1_type):
         printed.append(type_name)
 
 
-for asn1_file in asn1_files:
-    parsed_info = asn1tools.parse_files(base_dir + "/" + asn1_file)
-    top_level_key = list(parsed_info.keys())[0]
-    for type_name in parsed_info[top_level_key]["types"]:
-        asn1_type = parsed_info[top_level_key]["types"][type_name]
-        parse_type(type_name, top_level_key, asn1_file, asn1_type)
-
 intro = """/*
 *   JSON marshalling and unmarshalling functions for use by nlohmann::json
 *   Auto-generated from the asn1 directory by asn1json.py on """ + str(datetime.now()) + """
@@ -405,26 +641,126 @@ void to_json(json& j, const TimestampIts_t& p);
 void from_json(const json& j, TimestampIts_t& p);
 """
 
-if sys.argv[1] == "hpp":
-    print(header_intro)
-else:
-    print(intro)
-
-b = len(printed)
-
-# TODO: Replace with better algorithm when there's time
-# for i in range(10):
-while len(printed) + initial_len != len(asn1_types) + b:
-    for t in asn1_types:
-        if t.name not in printed and (t.definition["type"] in ["BIT STRING", "OCTET STRING", "NumericString", "UTF8String", "IA5String", "CLASS"] or all([d["type"] in printed + default_types for d in t.members])):
-            print(t.header_str() if sys.argv[1] == "hpp" else t)
-            printed.append(t.name)
-        # elif t.name not in printed:
-        #    print(t.name + " " + t.definition["type"])
-        #    print(all([d["type"] in printed + default_types for d in t.members]))
-        #    print([d["type"] for d in t.members if d["type"] not in printed + default_types])
-    # print('\n\n\n\n')
-    # time.sleep(1)
-
-if sys.argv[1] == "hpp":
-    print("\n#endif")
\ No newline at end of file
+writer_intro = """/*
+*   Streaming JSON writer functions producing the same output as nlohmann::json without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on """ + str(datetime.now()) + """
+*/
+
+#include "asn1json_writer.hpp"
+
+void write_json(JsonWriter& w, const TimestampIts_t& p) {
+    long tmp = 0;
+    asn_INTEGER2long(&p, &tmp);
+    w.value(tmp);
+}
+"""
+
+writer_header_intro = """/*
+*   Streaming JSON writer functions producing the same output as nlohmann::json without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on """ + str(datetime.now()) + """
+*/
+
+#ifndef ASN1_JSON_WRITER_HPP
+#define ASN1_JSON_WRITER_HPP
+
+#include "json_writer.hpp"
+#include <type_traits>
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/denm.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/vam.hpp>
+#include <vanetza/asn1/spatem.hpp>
+#include <vanetza/asn1/mapem.hpp>
+
+""" + '\n'.join(['#include <vanetza/asn1/its/' + inc.replace("-", "_") + '.h>' for inc in include]) + """
+
+template<typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type write_json(JsonWriter& w, T v) {
+    w.value(v);
+}
+
+void write_json(JsonWriter& w, const TimestampIts_t& p);
+"""
+
+reader_intro = """/*
+*   Streaming JSON reader functions filling asn1c structures like the from_json functions without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on """ + str(datetime.now()) + """
+*/
+
+#include "asn1json_reader.hpp"
+
+void read_json(JsonReader& r, TimestampIts_t& p) {
+    p.buf = nullptr;
+    asn_long2INTEGER(&p, r.integer());
+}
+"""
+
+reader_header_intro = """/*
+*   Streaming JSON reader functions filling asn1c structures like the from_json functions without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on """ + str(datetime.now()) + """
+*/
+
+#ifndef ASN1_JSON_READER_HPP
+#define ASN1_JSON_READER_HPP
+
+#include "json_reader.hpp"
+#include <type_traits>
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/denm.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/vam.hpp>
+#include <vanetza/asn1/spatem.hpp>
+#include <vanetza/asn1/mapem.hpp>
+
+""" + '\n'.join(['#include <vanetza/asn1/its/' + inc.replace("-", "_") + '.h>' for inc in include]) + """
+
+template<typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type read_json(JsonReader& r, T& v) {
+    v = static_cast<T>(r.number());
+}
+
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value>::type read_json(JsonReader& r, T& v) {
+    v = static_cast<T>(r.integer());
+}
+
+void read_json(JsonReader& r, TimestampIts_t& p);
+"""
+
+if __name__ == "__main__":
+    mode = sys.argv[1]
+    writer = mode.startswith("writer-")
+    reader = mode.startswith("reader-")
+    header = mode.endswith("hpp")
+
+    for asn1_file in asn1_files:
+        parsed_info = asn1tools.parse_files(base_dir + "/" + asn1_file)
+        top_level_key = list(parsed_info.keys())[0]
+        for type_name in parsed_info[top_level_key]["types"]:
+            asn1_type = parsed_info[top_level_key]["types"][type_name]
+            parse_type(type_name, top_level_key, asn1_file, asn1_type)
+
+    if writer:
+        print(writer_header_intro if header else writer_intro)
+    elif reader:
+        print(reader_header_intro if header else reader_intro)
+    else:
+        print(header_intro if header else intro)
+
+    b = len(printed)
+
+    # TODO: Replace with better algorithm when there's time
+    # for i in range(10):
+    while len(printed) + initial_len != len(asn1_types) + b:
+        for t in asn1_types:
+            if t.name not in printed and (t.definition["type"] in ["BIT STRING", "OCTET STRING", "NumericString", "UTF8String", "IA5String", "CLASS"] or all([d["type"] in printed + default_types for d in t.members])):
+                if writer:
+                    print(t.writer_header_str() if header else t.writer_str())
+                elif reader:
+                    print(t.reader_header_str() if header else t.reader_str())
+                else:
+                    print(t.header_str() if header else t)
+                printed.append(t.name)
+
+    if header:
+        print("\n#endif")
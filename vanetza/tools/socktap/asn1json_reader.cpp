@@ -0,0 +1,6342 @@
+/*
+*   Streaming JSON reader functions filling asn1c structures like the from_json functions without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on 2026-10-16 18:03:43.698141
+*/
+
+#include "asn1json_reader.hpp"
+
+void read_json(JsonReader& r, TimestampIts_t& p) {
+    p.buf = nullptr;
+    asn_long2INTEGER(&p, r.integer());
+}
+
+
+/*
+*   ItsPduHeader - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ItsPduHeader_t& p) {
+    static const char* const keys[] = { "messageID", "protocolVersion", "stationID" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.messageID));
+                break;
+            case 1:
+                read_json(r, (p.protocolVersion));
+                break;
+            case 2:
+                read_json(r, (p.stationID));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   DeltaReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, DeltaReferencePosition_t& p) {
+    static const char* const keys[] = { "deltaAltitude", "deltaLatitude", "deltaLongitude" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.deltaAltitude));
+                break;
+            case 1:
+                read_json(r, (p.deltaLatitude));
+                break;
+            case 2:
+                read_json(r, (p.deltaLongitude));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   Altitude - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Altitude& p) {
+    static const char* const keys[] = { "altitudeConfidence", "altitudeValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.altitudeConfidence));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.altitudeValue) = (value != 800001) ? value * 100 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   PosConfidenceEllipse - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PosConfidenceEllipse& p) {
+    static const char* const keys[] = { "semiMajorConfidence", "semiMajorOrientation", "semiMinorConfidence" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.semiMajorConfidence));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.semiMajorOrientation) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 2:
+                read_json(r, (p.semiMinorConfidence));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   PathPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PathPoint& p) {
+    static const char* const keys[] = { "pathDeltaTime", "pathPosition" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.pathDeltaTime = vanetza::asn1::allocate<PathDeltaTime_t>();
+                read_json(r, *(p.pathDeltaTime));
+                break;
+            case 1:
+                read_json(r, (p.pathPosition));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   PtActivationData - Type OCTET STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PtActivationData_t& p) {
+    r.skip(); // TODO
+}
+
+/*
+*   AccelerationControl - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_AccelerationControl(JsonReader& r, AccelerationControl_t& p) {
+    static const char* const keys[] = { "accEngaged", "brakePedalEngaged", "collisionWarningEngaged", "cruiseControlEngaged", "emergencyBrakeEngaged", "gasPedalEngaged", "speedLimiterEngaged" };
+    p.size = (7 / 8) + 1;
+    p.bits_unused = (7 % 8) != 0 ? 8 - (7 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7full);
+}
+
+/*
+*   CauseCode - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, CauseCode& p) {
+    static const char* const keys[] = { "causeCode", "subCauseCode" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.causeCode));
+                break;
+            case 1:
+                read_json(r, (p.subCauseCode));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Curvature - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Curvature& p) {
+    static const char* const keys[] = { "curvatureConfidence", "curvatureValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.curvatureConfidence));
+                break;
+            case 1:
+                read_json(r, (p.curvatureValue));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Heading - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Heading& p) {
+    static const char* const keys[] = { "headingConfidence", "headingValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.headingConfidence) = (value != 126 && value != 127) ? value * 10 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.headingValue) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   DrivingLaneStatus - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_DrivingLaneStatus(JsonReader& r, DrivingLaneStatus_t& p) {
+    p.size = (0 / 8) + 1;
+    p.bits_unused = (0 % 8) != 0 ? 8 - (0 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    r.skip();
+}
+
+/*
+*   Speed - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Speed& p) {
+    static const char* const keys[] = { "speedConfidence", "speedValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.speedConfidence) = (value != 126 && value != 127) ? value * 100 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.speedValue) = (value != 16383) ? value * 100 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   LongitudinalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, LongitudinalAcceleration& p) {
+    static const char* const keys[] = { "longitudinalAccelerationConfidence", "longitudinalAccelerationValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.longitudinalAccelerationConfidence) = (value != 102) ? value * 10 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.longitudinalAccelerationValue) = (value != 161) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   LateralAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, LateralAcceleration& p) {
+    static const char* const keys[] = { "lateralAccelerationConfidence", "lateralAccelerationValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.lateralAccelerationConfidence) = (value != 102) ? value * 10 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.lateralAccelerationValue) = (value != 161) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VerticalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, VerticalAcceleration_t& p) {
+    static const char* const keys[] = { "verticalAccelerationConfidence", "verticalAccelerationValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.verticalAccelerationConfidence) = (value != 102) ? value * 10 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.verticalAccelerationValue) = (value != 161) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ExteriorLights - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_ExteriorLights(JsonReader& r, ExteriorLights_t& p) {
+    static const char* const keys[] = { "daytimeRunningLightsOn", "fogLightOn", "highBeamHeadlightsOn", "leftTurnSignalOn", "lowBeamHeadlightsOn", "parkingLightsOn", "reverseLightOn", "rightTurnSignalOn" };
+    p.size = (8 / 8) + 1;
+    p.bits_unused = (8 % 8) != 0 ? 8 - (8 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xffull);
+}
+
+/*
+*   DangerousGoodsExtended - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, DangerousGoodsExtended& p) {
+    static const char* const keys[] = { "companyName", "dangerousGoodsType", "elevatedTemperature", "emergencyActionCode", "limitedQuantity", "tunnelsRestricted", "unNumber" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.companyName = vanetza::asn1::allocate<UTF8String_t>();
+                read_json(r, *(p.companyName));
+                break;
+            case 1:
+                read_json(r, (p.dangerousGoodsType));
+                break;
+            case 2:
+                read_json(r, (p.elevatedTemperature));
+                break;
+            case 3:
+                p.emergencyActionCode = vanetza::asn1::allocate<IA5String_t>();
+                read_json(r, *(p.emergencyActionCode));
+                break;
+            case 4:
+                read_json(r, (p.limitedQuantity));
+                break;
+            case 5:
+                read_json(r, (p.tunnelsRestricted));
+                break;
+            case 6:
+                read_json(r, (p.unNumber));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x76ull);
+}
+
+/*
+*   SpecialTransportType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_SpecialTransportType(JsonReader& r, SpecialTransportType_t& p) {
+    static const char* const keys[] = { "excessHeight", "excessLength", "excessWidth", "heavyLoad" };
+    p.size = (4 / 8) + 1;
+    p.bits_unused = (4 % 8) != 0 ? 8 - (4 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfull);
+}
+
+/*
+*   LightBarSirenInUse - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_LightBarSirenInUse(JsonReader& r, LightBarSirenInUse_t& p) {
+    static const char* const keys[] = { "lightBarActivated", "sirenActivated" };
+    p.size = (2 / 8) + 1;
+    p.bits_unused = (2 % 8) != 0 ? 8 - (2 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   PositionOfOccupants - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_PositionOfOccupants(JsonReader& r, PositionOfOccupants_t& p) {
+    static const char* const keys[] = { "row1LeftOccupied", "row1MidOccupied", "row1NotDetectable", "row1NotPresent", "row1RightOccupied", "row2LeftOccupied", "row2MidOccupied", "row2NotDetectable", "row2NotPresent", "row2RightOccupied", "row3LeftOccupied", "row3MidOccupied", "row3NotDetectable", "row3NotPresent", "row3RightOccupied", "row4LeftOccupied", "row4MidOccupied", "row4NotDetectable", "row4NotPresent", "row4RightOccupied" };
+    p.size = (20 / 8) + 1;
+    p.bits_unused = (20 % 8) != 0 ? 8 - (20 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 7);
+                break;
+            case 8:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 6);
+                break;
+            case 9:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 10:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 5);
+                break;
+            case 11:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 3);
+                break;
+            case 12:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 2);
+                break;
+            case 13:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 1);
+                break;
+            case 14:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 4);
+                break;
+            case 15:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 0);
+                break;
+            case 16:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 2)) |= (1 << 6);
+                break;
+            case 17:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 2)) |= (1 << 5);
+                break;
+            case 18:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 2)) |= (1 << 4);
+                break;
+            case 19:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 2)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfffffull);
+}
+
+/*
+*   VehicleIdentification - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, VehicleIdentification& p) {
+    r.skip();
+}
+
+/*
+*   EnergyStorageType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_EnergyStorageType(JsonReader& r, EnergyStorageType_t& p) {
+    static const char* const keys[] = { "ammonia", "compressedNaturalGas", "diesel", "electricEnergyStorage", "gasoline", "hydrogenStorage", "liquidPropaneGas" };
+    p.size = (7 / 8) + 1;
+    p.bits_unused = (7 % 8) != 0 ? 8 - (7 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7full);
+}
+
+/*
+*   VehicleLength - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, VehicleLength_t& p) {
+    static const char* const keys[] = { "vehicleLengthConfidenceIndication", "vehicleLengthValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.vehicleLengthConfidenceIndication));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.vehicleLengthValue) = (value != 1023) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   PathHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PathHistory& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        PathPoint_t* element = vanetza::asn1::allocate<PathPoint_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   EmergencyPriority - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_EmergencyPriority(JsonReader& r, EmergencyPriority_t& p) {
+    static const char* const keys[] = { "requestForFreeCrossingAtATrafficLight", "requestForRightOfWay" };
+    p.size = (2 / 8) + 1;
+    p.bits_unused = (2 % 8) != 0 ? 8 - (2 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   SteeringWheelAngle - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, SteeringWheelAngle& p) {
+    static const char* const keys[] = { "steeringWheelAngleConfidence", "steeringWheelAngleValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.steeringWheelAngleConfidence));
+                break;
+            case 1:
+                read_json(r, (p.steeringWheelAngleValue));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   YawRate - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, YawRate& p) {
+    static const char* const keys[] = { "yawRateConfidence", "yawRateValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.yawRateConfidence));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.yawRateValue) = (value != 32767) ? value * 100 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ActionID - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ActionID& p) {
+    static const char* const keys[] = { "originatingStationID", "sequenceNumber" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.originatingStationID));
+                break;
+            case 1:
+                read_json(r, (p.sequenceNumber));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ProtectedCommunicationZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ProtectedCommunicationZone& p) {
+    static const char* const keys[] = { "protectedZoneID", "protectedZoneLatitude", "protectedZoneLongitude", "protectedZoneRadius", "protectedZoneType" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.protectedZoneID = vanetza::asn1::allocate<ProtectedZoneID_t>();
+                read_json(r, *(p.protectedZoneID));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.protectedZoneLatitude) = (value != 900000001) ? value * 10000000 : value;
+                break;
+            }
+            case 2: {
+                const double value = r.number();
+                (p.protectedZoneLongitude) = (value != 1800000001) ? value * 10000000 : value;
+                break;
+            }
+            case 3:
+                p.protectedZoneRadius = vanetza::asn1::allocate<ProtectedZoneRadius_t>();
+                read_json(r, *(p.protectedZoneRadius));
+                break;
+            case 4:
+                read_json(r, (p.protectedZoneType));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x16ull);
+}
+
+/*
+*   Traces - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Traces& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        PathHistory_t* element = vanetza::asn1::allocate<PathHistory_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   PositionOfPillars - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PositionOfPillars& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        PosPillar_t* element = vanetza::asn1::allocate<PosPillar_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   RestrictedTypes - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, RestrictedTypes& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        StationType_t* element = vanetza::asn1::allocate<StationType_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   EventPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, EventPoint& p) {
+    static const char* const keys[] = { "eventDeltaTime", "eventPosition", "informationQuality" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.eventDeltaTime = vanetza::asn1::allocate<PathDeltaTime_t>();
+                read_json(r, *(p.eventDeltaTime));
+                break;
+            case 1:
+                read_json(r, (p.eventPosition));
+                break;
+            case 2:
+                read_json(r, (p.informationQuality));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   ProtectedCommunicationZonesRSU - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ProtectedCommunicationZonesRSU& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        ProtectedCommunicationZone_t* element = vanetza::asn1::allocate<ProtectedCommunicationZone_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   CenDsrcTollingZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, CenDsrcTollingZone& p) {
+    static const char* const keys[] = { "cenDsrcTollingZoneID", "protectedZoneLatitude", "protectedZoneLongitude" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.cenDsrcTollingZoneID = vanetza::asn1::allocate<CenDsrcTollingZoneID_t>();
+                read_json(r, *(p.cenDsrcTollingZoneID));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.protectedZoneLatitude) = (value != 900000001) ? value * 10000000 : value;
+                break;
+            }
+            case 2: {
+                const double value = r.number();
+                (p.protectedZoneLongitude) = (value != 1800000001) ? value * 10000000 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   BasicVehicleContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, BasicVehicleContainerHighFrequency& p) {
+    static const char* const keys[] = { "accelerationControl", "cenDsrcTollingZone", "curvature", "curvatureCalculationMode", "driveDirection", "heading", "lanePosition", "lateralAcceleration", "longitudinalAcceleration", "performanceClass", "speed", "steeringWheelAngle", "vehicleLength", "vehicleWidth", "verticalAcceleration", "yawRate" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.accelerationControl = vanetza::asn1::allocate<AccelerationControl_t>();
+                read_json_AccelerationControl(r, *(p.accelerationControl));
+                break;
+            case 1:
+                p.cenDsrcTollingZone = vanetza::asn1::allocate<CenDsrcTollingZone_t>();
+                read_json(r, *(p.cenDsrcTollingZone));
+                break;
+            case 2:
+                read_json(r, (p.curvature));
+                break;
+            case 3:
+                read_json(r, (p.curvatureCalculationMode));
+                break;
+            case 4:
+                read_json(r, (p.driveDirection));
+                break;
+            case 5:
+                read_json(r, (p.heading));
+                break;
+            case 6:
+                p.lanePosition = vanetza::asn1::allocate<LanePosition_t>();
+                read_json(r, *(p.lanePosition));
+                break;
+            case 7:
+                p.lateralAcceleration = vanetza::asn1::allocate<LateralAcceleration_t>();
+                read_json(r, *(p.lateralAcceleration));
+                break;
+            case 8:
+                read_json(r, (p.longitudinalAcceleration));
+                break;
+            case 9:
+                p.performanceClass = vanetza::asn1::allocate<PerformanceClass_t>();
+                read_json(r, *(p.performanceClass));
+                break;
+            case 10:
+                read_json(r, (p.speed));
+                break;
+            case 11:
+                p.steeringWheelAngle = vanetza::asn1::allocate<SteeringWheelAngle_t>();
+                read_json(r, *(p.steeringWheelAngle));
+                break;
+            case 12:
+                read_json(r, (p.vehicleLength));
+                break;
+            case 13: {
+                const double value = r.number();
+                (p.vehicleWidth) = (value != 61 && value != 62) ? value * 10 : value;
+                break;
+            }
+            case 14:
+                p.verticalAcceleration = vanetza::asn1::allocate<VerticalAcceleration_t>();
+                read_json(r, *(p.verticalAcceleration));
+                break;
+            case 15:
+                read_json(r, (p.yawRate));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xb53cull);
+}
+
+/*
+*   BasicVehicleContainerLowFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, BasicVehicleContainerLowFrequency& p) {
+    static const char* const keys[] = { "exteriorLights", "pathHistory", "vehicleRole" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json_ExteriorLights(r, (p.exteriorLights));
+                break;
+            case 1:
+                read_json(r, (p.pathHistory));
+                break;
+            case 2:
+                read_json(r, (p.vehicleRole));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   SpecialTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, SpecialTransportContainer& p) {
+    static const char* const keys[] = { "lightBarSirenInUse", "specialTransportType" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json_LightBarSirenInUse(r, (p.lightBarSirenInUse));
+                break;
+            case 1:
+                read_json_SpecialTransportType(r, (p.specialTransportType));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   DangerousGoodsContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, DangerousGoodsContainer& p) {
+    static const char* const keys[] = { "dangerousGoodsBasic" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.dangerousGoodsBasic));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   RescueContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, RescueContainer& p) {
+    static const char* const keys[] = { "lightBarSirenInUse" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json_LightBarSirenInUse(r, (p.lightBarSirenInUse));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   EmergencyContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, EmergencyContainer& p) {
+    static const char* const keys[] = { "emergencyPriority", "incidentIndication", "lightBarSirenInUse" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.emergencyPriority = vanetza::asn1::allocate<EmergencyPriority_t>();
+                read_json_EmergencyPriority(r, *(p.emergencyPriority));
+                break;
+            case 1:
+                p.incidentIndication = vanetza::asn1::allocate<CauseCode_t>();
+                read_json(r, *(p.incidentIndication));
+                break;
+            case 2:
+                read_json_LightBarSirenInUse(r, (p.lightBarSirenInUse));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x4ull);
+}
+
+/*
+*   SafetyCarContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, SafetyCarContainer& p) {
+    static const char* const keys[] = { "incidentIndication", "lightBarSirenInUse", "speedLimit", "trafficRule" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.incidentIndication = vanetza::asn1::allocate<CauseCode_t>();
+                read_json(r, *(p.incidentIndication));
+                break;
+            case 1:
+                read_json_LightBarSirenInUse(r, (p.lightBarSirenInUse));
+                break;
+            case 2:
+                p.speedLimit = vanetza::asn1::allocate<SpeedLimit_t>();
+                read_json(r, *(p.speedLimit));
+                break;
+            case 3:
+                p.trafficRule = vanetza::asn1::allocate<TrafficRule_t>();
+                read_json(r, *(p.trafficRule));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   RSUContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, RSUContainerHighFrequency& p) {
+    static const char* const keys[] = { "protectedCommunicationZonesRSU" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.protectedCommunicationZonesRSU = vanetza::asn1::allocate<ProtectedCommunicationZonesRSU_t>();
+                read_json(r, *(p.protectedCommunicationZonesRSU));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   LocationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, LocationContainer& p) {
+    static const char* const keys[] = { "eventPositionHeading", "eventSpeed", "roadType", "traces" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.eventPositionHeading = vanetza::asn1::allocate<Heading_t>();
+                read_json(r, *(p.eventPositionHeading));
+                break;
+            case 1:
+                p.eventSpeed = vanetza::asn1::allocate<Speed_t>();
+                read_json(r, *(p.eventSpeed));
+                break;
+            case 2:
+                p.roadType = vanetza::asn1::allocate<RoadType_t>();
+                read_json(r, *(p.roadType));
+                break;
+            case 3:
+                read_json(r, (p.traces));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x8ull);
+}
+
+/*
+*   ImpactReductionContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, ImpactReductionContainer& p) {
+    static const char* const keys[] = { "heightLonCarrLeft", "heightLonCarrRight", "posCentMass", "posFrontAx", "posLonCarrLeft", "posLonCarrRight", "positionOfOccupants", "positionOfPillars", "requestResponseIndication", "turningRadius", "vehicleMass", "wheelBaseVehicle" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.heightLonCarrLeft));
+                break;
+            case 1:
+                read_json(r, (p.heightLonCarrRight));
+                break;
+            case 2:
+                read_json(r, (p.posCentMass));
+                break;
+            case 3:
+                read_json(r, (p.posFrontAx));
+                break;
+            case 4:
+                read_json(r, (p.posLonCarrLeft));
+                break;
+            case 5:
+                read_json(r, (p.posLonCarrRight));
+                break;
+            case 6:
+                read_json_PositionOfOccupants(r, (p.positionOfOccupants));
+                break;
+            case 7:
+                read_json(r, (p.positionOfPillars));
+                break;
+            case 8:
+                read_json(r, (p.requestResponseIndication));
+                break;
+            case 9:
+                read_json(r, (p.turningRadius));
+                break;
+            case 10:
+                read_json(r, (p.vehicleMass));
+                break;
+            case 11:
+                read_json(r, (p.wheelBaseVehicle));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfffull);
+}
+
+/*
+*   StationaryVehicleContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, StationaryVehicleContainer& p) {
+    static const char* const keys[] = { "carryingDangerousGoods", "energyStorageType", "numberOfOccupants", "stationaryCause", "stationarySince", "vehicleIdentification" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.carryingDangerousGoods = vanetza::asn1::allocate<DangerousGoodsExtended_t>();
+                read_json(r, *(p.carryingDangerousGoods));
+                break;
+            case 1:
+                p.energyStorageType = vanetza::asn1::allocate<EnergyStorageType_t>();
+                read_json_EnergyStorageType(r, *(p.energyStorageType));
+                break;
+            case 2:
+                p.numberOfOccupants = vanetza::asn1::allocate<NumberOfOccupants_t>();
+                read_json(r, *(p.numberOfOccupants));
+                break;
+            case 3:
+                p.stationaryCause = vanetza::asn1::allocate<CauseCode_t>();
+                read_json(r, *(p.stationaryCause));
+                break;
+            case 4:
+                p.stationarySince = vanetza::asn1::allocate<StationarySince_t>();
+                read_json(r, *(p.stationarySince));
+                break;
+            case 5:
+                p.vehicleIdentification = vanetza::asn1::allocate<VehicleIdentification_t>();
+                read_json(r, *(p.vehicleIdentification));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ReferenceDenms - Type SEQUENCE OF
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, ReferenceDenms& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        ActionID_t* element = vanetza::asn1::allocate<ActionID_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   VruProfileAndSubprofile - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruProfileAndSubprofile& p) {
+    static const char* const keys[] = { "animal", "bicyclist", "motorcylist", "pedestrian" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = VruProfileAndSubprofile_PR_animal;
+                read_json(r, p.choice.animal);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = VruProfileAndSubprofile_PR_bicyclist;
+                read_json(r, p.choice.bicyclist);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = VruProfileAndSubprofile_PR_motorcylist;
+                read_json(r, p.choice.motorcylist);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = VruProfileAndSubprofile_PR_pedestrian;
+                read_json(r, p.choice.pedestrian);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   VruSpecificExteriorLights - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json_VruSpecificExteriorLights(JsonReader& r, VruSpecificExteriorLights_t& p) {
+    static const char* const keys[] = { "armLight", "backFlashLight", "helmetLight", "legLight", "unavailable", "wheelLight" };
+    p.size = (6 / 8) + 1;
+    p.bits_unused = (6 % 8) != 0 ? 8 - (6 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3full);
+}
+
+/*
+*   ClusterProfiles - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json_ClusterProfiles(JsonReader& r, ClusterProfiles_t& p) {
+    static const char* const keys[] = { "animal", "bicyclist", "motorcyclist", "pedestrian" };
+    p.size = (4 / 8) + 1;
+    p.bits_unused = (4 % 8) != 0 ? 8 - (4 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfull);
+}
+
+/*
+*   ClusterJoinInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterJoinInfo& p) {
+    static const char* const keys[] = { "clusterId", "joinTime" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.clusterId));
+                break;
+            case 1:
+                read_json(r, (p.joinTime));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ClusterLeaveInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterLeaveInfo& p) {
+    static const char* const keys[] = { "clusterId", "clusterLeaveReason" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.clusterId));
+                break;
+            case 1:
+                read_json(r, (p.clusterLeaveReason));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ClusterBreakupInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterBreakupInfo& p) {
+    static const char* const keys[] = { "breakupTime", "clusterBreakupReason" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.breakupTime));
+                break;
+            case 1:
+                read_json(r, (p.clusterBreakupReason));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VruSafeDistanceIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruSafeDistanceIndication& p) {
+    static const char* const keys[] = { "stationSafeDistanceIndication", "subjectStation", "timeToCollision" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.stationSafeDistanceIndication));
+                break;
+            case 1:
+                p.subjectStation = vanetza::asn1::allocate<StationID_t>();
+                read_json(r, *(p.subjectStation));
+                break;
+            case 2:
+                p.timeToCollision = vanetza::asn1::allocate<ActionDeltaTime_t>();
+                read_json(r, *(p.timeToCollision));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   TrajectoryInterceptionIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, TrajectoryInterceptionIndication& p) {
+    static const char* const keys[] = { "subjectStation", "trajectoryInterceptionConfidence", "trajectoryInterceptionProbability" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.subjectStation = vanetza::asn1::allocate<StationID_t>();
+                read_json(r, *(p.subjectStation));
+                break;
+            case 1:
+                p.trajectoryInterceptionConfidence = vanetza::asn1::allocate<TrajectoryInterceptionConfidence_t>();
+                read_json(r, *(p.trajectoryInterceptionConfidence));
+                break;
+            case 2:
+                read_json(r, (p.trajectoryInterceptionProbability));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x4ull);
+}
+
+/*
+*   HeadingChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, HeadingChangeIndication& p) {
+    static const char* const keys[] = { "actionDeltaTime", "direction" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.actionDeltaTime));
+                break;
+            case 1:
+                read_json(r, (p.direction));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   AccelerationChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, AccelerationChangeIndication& p) {
+    static const char* const keys[] = { "accelOrDecel", "actionDeltaTime" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.accelOrDecel));
+                break;
+            case 1:
+                read_json(r, (p.actionDeltaTime));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   StabilityChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, StabilityChangeIndication& p) {
+    static const char* const keys[] = { "actionDeltaTime", "lossProbability" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.actionDeltaTime));
+                break;
+            case 1:
+                read_json(r, (p.lossProbability));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   AdvisorySpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, AdvisorySpeed& p) {
+    static const char* const keys[] = { "class", "confidence", "distance", "speed", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.Class = vanetza::asn1::allocate<RestrictionClassID_t>();
+                read_json(r, *(p.Class));
+                break;
+            case 1: {
+                p.confidence = vanetza::asn1::allocate<SpeedConfidence_t>();
+                const double value = r.number();
+                *(p.confidence) = (value != 126 && value != 127) ? value * 100 : value;
+                break;
+            }
+            case 2:
+                p.distance = vanetza::asn1::allocate<ZoneLength_t>();
+                read_json(r, *(p.distance));
+                break;
+            case 3:
+                p.speed = vanetza::asn1::allocate<SpeedAdvice_t>();
+                read_json(r, *(p.speed));
+                break;
+            case 4:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x10ull);
+}
+
+/*
+*   AdvisorySpeedList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, AdvisorySpeedList_t& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        AdvisorySpeed_t* element = vanetza::asn1::allocate<AdvisorySpeed_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   ComputedLane::ComputedLane__offsetXaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ComputedLane::ComputedLane__offsetXaxis& p) {
+    static const char* const keys[] = { "large", "small" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = ComputedLane__offsetXaxis_PR_large;
+                read_json(r, p.choice.large);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = ComputedLane__offsetXaxis_PR_small;
+                read_json(r, p.choice.small);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ComputedLane::ComputedLane__offsetYaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ComputedLane::ComputedLane__offsetYaxis& p) {
+    static const char* const keys[] = { "large", "small" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = ComputedLane__offsetYaxis_PR_large;
+                read_json(r, p.choice.large);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = ComputedLane__offsetYaxis_PR_small;
+                read_json(r, p.choice.small);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ComputedLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ComputedLane_t& p) {
+    static const char* const keys[] = { "offsetXaxis", "offsetYaxis", "referenceLaneId", "rotateXY", "scaleXaxis", "scaleYaxis" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.offsetXaxis));
+                break;
+            case 1:
+                read_json(r, (p.offsetYaxis));
+                break;
+            case 2:
+                read_json(r, (p.referenceLaneId));
+                break;
+            case 3:
+                p.rotateXY = vanetza::asn1::allocate<Angle_t>();
+                read_json(r, *(p.rotateXY));
+                break;
+            case 4:
+                p.scaleXaxis = vanetza::asn1::allocate<Scale_B12_t>();
+                read_json(r, *(p.scaleXaxis));
+                break;
+            case 5:
+                p.scaleYaxis = vanetza::asn1::allocate<Scale_B12_t>();
+                read_json(r, *(p.scaleYaxis));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   ConnectionManeuverAssist - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ConnectionManeuverAssist_t& p) {
+    static const char* const keys[] = { "availableStorageLength", "connectionID", "pedBicycleDetect", "queueLength", "waitOnStop" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.availableStorageLength = vanetza::asn1::allocate<ZoneLength_t>();
+                read_json(r, *(p.availableStorageLength));
+                break;
+            case 1:
+                read_json(r, (p.connectionID));
+                break;
+            case 2:
+                p.pedBicycleDetect = vanetza::asn1::allocate<PedestrianBicycleDetect_t>();
+                read_json(r, *(p.pedBicycleDetect));
+                break;
+            case 3:
+                p.queueLength = vanetza::asn1::allocate<ZoneLength_t>();
+                read_json(r, *(p.queueLength));
+                break;
+            case 4:
+                p.waitOnStop = vanetza::asn1::allocate<WaitOnStopline_t>();
+                read_json(r, *(p.waitOnStop));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   DataParameters - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, DataParameters_t& p) {
+    static const char* const keys[] = { "geoidUsed", "lastCheckedDate", "processAgency", "processMethod" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.geoidUsed = vanetza::asn1::allocate<IA5String_t>();
+                read_json(r, *(p.geoidUsed));
+                break;
+            case 1:
+                p.lastCheckedDate = vanetza::asn1::allocate<IA5String_t>();
+                read_json(r, *(p.lastCheckedDate));
+                break;
+            case 2:
+                p.processAgency = vanetza::asn1::allocate<IA5String_t>();
+                read_json(r, *(p.processAgency));
+                break;
+            case 3:
+                p.processMethod = vanetza::asn1::allocate<IA5String_t>();
+                read_json(r, *(p.processMethod));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   EnabledLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, EnabledLaneList_t& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        LaneID_t* element = vanetza::asn1::allocate<LaneID_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   IntersectionAccessPoint - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionAccessPoint_t& p) {
+    static const char* const keys[] = { "approach", "connection", "lane" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = IntersectionAccessPoint_PR_approach;
+                read_json(r, p.choice.approach);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = IntersectionAccessPoint_PR_connection;
+                read_json(r, p.choice.connection);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = IntersectionAccessPoint_PR_lane;
+                read_json(r, p.choice.lane);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   IntersectionReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionReferenceID& p) {
+    static const char* const keys[] = { "id", "region" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.id));
+                break;
+            case 1:
+                p.region = vanetza::asn1::allocate<RoadRegulatorID_t>();
+                read_json(r, *(p.region));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   LaneSharing - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneSharing(JsonReader& r, LaneSharing_t& p) {
+    static const char* const keys[] = { "busVehicleTraffic", "cyclistVehicleTraffic", "individualMotorizedVehicleTraffic", "multipleLanesTreatedAsOneLane", "otherNonMotorizedTrafficTypes", "overlappingLaneDescriptionProvided", "pedestrianTraffic", "pedestriansTraffic", "taxiVehicleTraffic", "trackedVehicleTraffic" };
+    p.size = (10 / 8) + 1;
+    p.bits_unused = (10 % 8) != 0 ? 8 - (10 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 6);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 8:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 9:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ffull);
+}
+
+/*
+*   ManeuverAssistList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ManeuverAssistList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        ConnectionManeuverAssist_t* element = vanetza::asn1::allocate<ConnectionManeuverAssist_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   Node-LLmD-64b - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, Node_LLmD_64b& p) {
+    static const char* const keys[] = { "lat", "lon" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.lat) = (value != 900000001) ? value * 10000000 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.lon) = (value != 1800000001) ? value * 10000000 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   OverlayLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, OverlayLaneList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        LaneID_t* element = vanetza::asn1::allocate<LaneID_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   Position3D - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, Position3D_t& p) {
+    static const char* const keys[] = { "elevation", "lat", "long" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.elevation = vanetza::asn1::allocate<Elevation_t>();
+                read_json(r, *(p.elevation));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.lat) = (value != 900000001) ? value * 10000000 : value;
+                break;
+            }
+            case 2: {
+                const double value = r.number();
+                (p.Long) = (value != 1800000001) ? value * 10000000 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   RestrictionUserType - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionUserType& p) {
+    static const char* const keys[] = { "basicType" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = RestrictionUserType_PR_basicType;
+                read_json(r, p.choice.basicType);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   RoadSegmentReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadSegmentReferenceID& p) {
+    static const char* const keys[] = { "id", "region" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.id));
+                break;
+            case 1:
+                p.region = vanetza::asn1::allocate<RoadRegulatorID_t>();
+                read_json(r, *(p.region));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   TimeChangeDetails - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, TimeChangeDetails& p) {
+    static const char* const keys[] = { "confidence", "likelyTime", "maxEndTime", "minEndTime", "nextTime", "startTime" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.confidence = vanetza::asn1::allocate<TimeIntervalConfidence_t>();
+                read_json(r, *(p.confidence));
+                break;
+            case 1:
+                p.likelyTime = vanetza::asn1::allocate<TimeMark_t>();
+                read_json(r, *(p.likelyTime));
+                break;
+            case 2:
+                p.maxEndTime = vanetza::asn1::allocate<TimeMark_t>();
+                read_json(r, *(p.maxEndTime));
+                break;
+            case 3:
+                read_json(r, (p.minEndTime));
+                break;
+            case 4:
+                p.nextTime = vanetza::asn1::allocate<TimeMark_t>();
+                read_json(r, *(p.nextTime));
+                break;
+            case 5:
+                p.startTime = vanetza::asn1::allocate<TimeMark_t>();
+                read_json(r, *(p.startTime));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x8ull);
+}
+
+/*
+*   TransmissionAndSpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, TransmissionAndSpeed_t& p) {
+    static const char* const keys[] = { "speed", "transmisson" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.speed));
+                break;
+            case 1:
+                read_json(r, (p.transmisson));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VehicleID - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, VehicleID_t& p) {
+    static const char* const keys[] = { "stationID" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = VehicleID_PR_stationID;
+                read_json(r, p.choice.stationID);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   AllowedManeuvers - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_AllowedManeuvers(JsonReader& r, AllowedManeuvers_t& p) {
+    static const char* const keys[] = { "caution", "goWithHalt", "maneuverLaneChangeAllowed", "maneuverLeftAllowed", "maneuverLeftTurnOnRedAllowed", "maneuverNoStoppingAllowed", "maneuverRightAllowed", "maneuverRightTurnOnRedAllowed", "maneuverStraightAllowed", "maneuverUTurnAllowed", "reserved1", "yieldAllwaysRequired" };
+    p.size = (12 / 8) + 1;
+    p.bits_unused = (12 % 8) != 0 ? 8 - (12 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 5);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 6);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 8:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 9:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 10:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 4);
+                break;
+            case 11:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfffull);
+}
+
+/*
+*   IntersectionStatusObject - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_IntersectionStatusObject(JsonReader& r, IntersectionStatusObject_t& p) {
+    static const char* const keys[] = { "failureFlash", "failureMode", "fixedTimeOperation", "manualControlIsEnabled", "noValidMAPisAvailableAtThisTime", "noValidSPATisAvailableAtThisTime", "off", "preemptIsActive", "recentChangeInMAPassignedLanesIDsUsed", "recentMAPmessageUpdate", "signalPriorityIsActive", "standbyOperation", "stopTimeIsActivated", "trafficDependentOperation" };
+    p.size = (14 / 8) + 1;
+    p.bits_unused = (14 % 8) != 0 ? 8 - (14 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 7);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 3);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 2);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 6);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 8:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 4);
+                break;
+            case 9:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 5);
+                break;
+            case 10:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 11:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 12:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 13:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3fffull);
+}
+
+/*
+*   LaneAttributes-Barrier - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Barrier(JsonReader& r, LaneAttributes_Barrier_t& p) {
+    static const char* const keys[] = { "constructionBarrier", "doubleStripedLines", "highCurbs", "lowCurbs", "median", "median-RevocableLane", "stripedLines", "trafficChannels", "trafficCones", "whiteLineHashing" };
+    p.size = (10 / 8) + 1;
+    p.bits_unused = (10 % 8) != 0 ? 8 - (10 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 6);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 7);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 8:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 9:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ffull);
+}
+
+/*
+*   LaneAttributes-Bike - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Bike(JsonReader& r, LaneAttributes_Bike_t& p) {
+    static const char* const keys[] = { "biDirectionalCycleTimes", "bikeRevocableLane", "fixedCycleTime", "isBikeFlyOverLane", "isolatedByBarrier", "pedestrianUseAllowed", "unsignalizedSegmentsPresent" };
+    p.size = (7 / 8) + 1;
+    p.bits_unused = (7 % 8) != 0 ? 8 - (7 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7full);
+}
+
+/*
+*   LaneAttributes-Crosswalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Crosswalk(JsonReader& r, LaneAttributes_Crosswalk_t& p) {
+    static const char* const keys[] = { "audioSupport", "biDirectionalCycleTimes", "bicyleUseAllowed", "crosswalkRevocableLane", "fixedCycleTime", "hasPushToWalkButton", "isXwalkFlyOverLane", "rfSignalRequestPresent", "unsignalizedSegmentsPresent" };
+    p.size = (9 / 8) + 1;
+    p.bits_unused = (9 % 8) != 0 ? 8 - (9 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 8:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 1)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ffull);
+}
+
+/*
+*   LaneAttributes-Parking - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Parking(JsonReader& r, LaneAttributes_Parking_t& p) {
+    static const char* const keys[] = { "doNotParkZone", "headInParkingInUse", "noPublicParkingUse", "parallelParkingInUse", "parkingForBusUse", "parkingForTaxiUse", "parkingRevocableLane" };
+    p.size = (7 / 8) + 1;
+    p.bits_unused = (7 % 8) != 0 ? 8 - (7 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7full);
+}
+
+/*
+*   LaneAttributes-Sidewalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Sidewalk(JsonReader& r, LaneAttributes_Sidewalk_t& p) {
+    static const char* const keys[] = { "bicyleUseAllowed", "isSidewalkFlyOverLane", "sidewalk-RevocableLane", "walkBikes" };
+    p.size = (4 / 8) + 1;
+    p.bits_unused = (4 % 8) != 0 ? 8 - (4 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfull);
+}
+
+/*
+*   LaneAttributes-Striping - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Striping(JsonReader& r, LaneAttributes_Striping_t& p) {
+    static const char* const keys[] = { "stripeDrawOnLeft", "stripeDrawOnRight", "stripeToConnectingLanesAhead", "stripeToConnectingLanesLeft", "stripeToConnectingLanesRevocableLane", "stripeToConnectingLanesRight" };
+    p.size = (6 / 8) + 1;
+    p.bits_unused = (6 % 8) != 0 ? 8 - (6 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3full);
+}
+
+/*
+*   LaneAttributes-TrackedVehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_TrackedVehicle(JsonReader& r, LaneAttributes_TrackedVehicle_t& p) {
+    static const char* const keys[] = { "spec-RevocableLane", "spec-commuterRailRoadTrack", "spec-heavyRailRoadTrack", "spec-lightRailRoadTrack", "spec-otherRailType" };
+    p.size = (5 / 8) + 1;
+    p.bits_unused = (5 % 8) != 0 ? 8 - (5 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1full);
+}
+
+/*
+*   LaneAttributes-Vehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Vehicle(JsonReader& r, LaneAttributes_Vehicle_t& p) {
+    static const char* const keys[] = { "hasIRbeaconCoverage", "hovLaneUseOnly", "isVehicleFlyOverLane", "isVehicleRevocableLane", "permissionOnRequest", "restrictedFromPublicUse", "restrictedToBusUse", "restrictedToTaxiUse" };
+    p.size = (8 / 8) + 1;
+    p.bits_unused = (8 % 8) != 0 ? 8 - (8 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 0);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 6:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 7:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xffull);
+}
+
+/*
+*   LaneDirection - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneDirection(JsonReader& r, LaneDirection_t& p) {
+    static const char* const keys[] = { "egressPath", "ingressPath" };
+    p.size = (2 / 8) + 1;
+    p.bits_unused = (2 % 8) != 0 ? 8 - (2 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   TransitVehicleStatus - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_TransitVehicleStatus(JsonReader& r, TransitVehicleStatus_t& p) {
+    static const char* const keys[] = { "aBikeLoad", "anADAuse", "atStopLine", "charging", "doorOpen", "loading" };
+    p.size = (6 / 8) + 1;
+    p.bits_unused = (6 % 8) != 0 ? 8 - (6 % 8) : 0;
+    p.buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p.size);
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
+                break;
+            case 1:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
+                break;
+            case 2:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
+                break;
+            case 3:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
+                break;
+            case 4:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
+                break;
+            case 5:
+                if (r.boolean()) *(p.buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3full);
+}
+
+/*
+*   Node-XY-20b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_20b& p) {
+    static const char* const keys[] = { "x", "y" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.x));
+                break;
+            case 1:
+                read_json(r, (p.y));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Node-XY-22b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_22b& p) {
+    static const char* const keys[] = { "x", "y" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.x));
+                break;
+            case 1:
+                read_json(r, (p.y));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Node-XY-24b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_24b& p) {
+    static const char* const keys[] = { "x", "y" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.x));
+                break;
+            case 1:
+                read_json(r, (p.y));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Node-XY-26b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_26b& p) {
+    static const char* const keys[] = { "x", "y" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.x));
+                break;
+            case 1:
+                read_json(r, (p.y));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Node-XY-28b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_28b& p) {
+    static const char* const keys[] = { "x", "y" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.x));
+                break;
+            case 1:
+                read_json(r, (p.y));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   Node-XY-32b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_32b& p) {
+    static const char* const keys[] = { "x", "y" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.x));
+                break;
+            case 1:
+                read_json(r, (p.y));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   NodeAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeAttributeXYList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        NodeAttributeXY_t* element = vanetza::asn1::allocate<NodeAttributeXY_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   RegulatorySpeedLimit - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, RegulatorySpeedLimit& p) {
+    static const char* const keys[] = { "speed", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.speed));
+                break;
+            case 1:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   SegmentAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, SegmentAttributeXYList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        SegmentAttributeXY_t* element = vanetza::asn1::allocate<SegmentAttributeXY_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   SpeedLimitList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, SpeedLimitList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        RegulatorySpeedLimit_t* element = vanetza::asn1::allocate<RegulatorySpeedLimit_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   OriginatingRSUContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OriginatingRSUContainer& p) {
+    static const char* const keys[] = { "intersectionReferenceId", "roadSegmentReferenceId" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = OriginatingRSUContainer_PR_intersectionReferenceId;
+                read_json(r, p.choice.intersectionReferenceId);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = OriginatingRSUContainer_PR_roadSegmentReferenceId;
+                read_json(r, p.choice.roadSegmentReferenceId);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   VehicleSensorProperties - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSensorProperties& p) {
+    static const char* const keys[] = { "horizontalOpeningAngleEnd", "horizontalOpeningAngleStart", "range", "verticalOpeningAngleEnd", "verticalOpeningAngleStart" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.horizontalOpeningAngleEnd) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.horizontalOpeningAngleStart) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 2:
+                read_json(r, (p.range));
+                break;
+            case 3: {
+                p.verticalOpeningAngleEnd = vanetza::asn1::allocate<HeadingValue_t>();
+                const double value = r.number();
+                *(p.verticalOpeningAngleEnd) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 4: {
+                p.verticalOpeningAngleStart = vanetza::asn1::allocate<HeadingValue_t>();
+                const double value = r.number();
+                *(p.verticalOpeningAngleStart) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   ObjectDistanceWithConfidence - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectDistanceWithConfidence& p) {
+    static const char* const keys[] = { "confidence", "value" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.confidence) = (value != 101 && value != 102) ? value * 100 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.value) = value * 100;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ObjectDimension - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectDimension& p) {
+    static const char* const keys[] = { "confidence", "value" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.value) = value * 10;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   CartesianAngle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CartesianAngle& p) {
+    static const char* const keys[] = { "confidence", "value" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.value) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   WGS84Angle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, WGS84Angle& p) {
+    static const char* const keys[] = { "confidence", "value" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.value) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   SpeedExtended - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SpeedExtended& p) {
+    static const char* const keys[] = { "confidence", "value" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0: {
+                const double value = r.number();
+                (p.confidence) = (value != 126 && value != 127) ? value * 100 : value;
+                break;
+            }
+            case 1: {
+                const double value = r.number();
+                (p.value) = (value != 16383) ? value * 100 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   SensorIdList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SensorIdList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        Identifier_t* element = vanetza::asn1::allocate<Identifier_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   TrailerData - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, TrailerData& p) {
+    static const char* const keys[] = { "frontOverhang", "hitchAngle", "hitchPointOffset", "rearOverhang", "refPointId", "trailerWidth" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.frontOverhang));
+                break;
+            case 1:
+                p.hitchAngle = vanetza::asn1::allocate<CartesianAngle_t>();
+                read_json(r, *(p.hitchAngle));
+                break;
+            case 2:
+                read_json(r, (p.hitchPointOffset));
+                break;
+            case 3:
+                read_json(r, (p.rearOverhang));
+                break;
+            case 4:
+                read_json(r, (p.refPointId));
+                break;
+            case 5: {
+                p.trailerWidth = vanetza::asn1::allocate<VehicleWidth_t>();
+                const double value = r.number();
+                *(p.trailerWidth) = (value != 61 && value != 62) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1dull);
+}
+
+/*
+*   LongitudinalLanePosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, LongitudinalLanePosition& p) {
+    static const char* const keys[] = { "longitudinalLanePositionConfidence", "longitudinalLanePositionValue" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.longitudinalLanePositionConfidence));
+                break;
+            case 1:
+                read_json(r, (p.longitudinalLanePositionValue));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   MatchedPosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, MatchedPosition& p) {
+    static const char* const keys[] = { "laneID", "longitudinalLanePosition" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.laneID = vanetza::asn1::allocate<LaneID_t>();
+                read_json(r, *(p.laneID));
+                break;
+            case 1:
+                p.longitudinalLanePosition = vanetza::asn1::allocate<LongitudinalLanePosition_t>();
+                read_json(r, *(p.longitudinalLanePosition));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   PerceivedObjectContainerSegmentInfo - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PerceivedObjectContainerSegmentInfo& p) {
+    static const char* const keys[] = { "thisSegmentNum", "totalMsgSegments" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.thisSegmentNum));
+                break;
+            case 1:
+                read_json(r, (p.totalMsgSegments));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VehicleSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSubclass& p) {
+    static const char* const keys[] = { "confidence", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   PersonSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PersonSubclass& p) {
+    static const char* const keys[] = { "confidence", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   AnimalSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AnimalSubclass& p) {
+    static const char* const keys[] = { "confidence", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   OtherSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OtherSubclass& p) {
+    static const char* const keys[] = { "confidence", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.confidence));
+                break;
+            case 1:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   NodeOffsetPointZ - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, NodeOffsetPointZ& p) {
+    static const char* const keys[] = { "node-Z1", "node-Z2", "node-Z3", "node-Z4", "node-Z5", "node-Z6" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = NodeOffsetPointZ_PR_node_Z1;
+                read_json(r, p.choice.node_Z1);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = NodeOffsetPointZ_PR_node_Z2;
+                read_json(r, p.choice.node_Z2);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = NodeOffsetPointZ_PR_node_Z3;
+                read_json(r, p.choice.node_Z3);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = NodeOffsetPointZ_PR_node_Z4;
+                read_json(r, p.choice.node_Z4);
+                break;
+            case 4:
+                members.exclusive();
+                p.present = NodeOffsetPointZ_PR_node_Z5;
+                read_json(r, p.choice.node_Z5);
+                break;
+            case 5:
+                members.exclusive();
+                p.present = NodeOffsetPointZ_PR_node_Z6;
+                read_json(r, p.choice.node_Z6);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ReferencePosition& p) {
+    static const char* const keys[] = { "altitude", "latitude", "longitude", "positionConfidenceEllipse" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.altitude));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.latitude) = (value != 900000001) ? value * 10000000 : value;
+                break;
+            }
+            case 2: {
+                const double value = r.number();
+                (p.longitude) = (value != 1800000001) ? value * 10000000 : value;
+                break;
+            }
+            case 3:
+                read_json(r, (p.positionConfidenceEllipse));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfull);
+}
+
+/*
+*   PtActivation - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PtActivation& p) {
+    static const char* const keys[] = { "ptActivationData", "ptActivationType" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.ptActivationData));
+                break;
+            case 1:
+                read_json(r, (p.ptActivationType));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   ClosedLanes - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ClosedLanes& p) {
+    static const char* const keys[] = { "drivingLaneStatus", "innerhardShoulderStatus", "outerhardShoulderStatus" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.drivingLaneStatus = vanetza::asn1::allocate<DrivingLaneStatus_t>();
+                read_json_DrivingLaneStatus(r, *(p.drivingLaneStatus));
+                break;
+            case 1:
+                p.innerhardShoulderStatus = vanetza::asn1::allocate<HardShoulderStatus_t>();
+                read_json(r, *(p.innerhardShoulderStatus));
+                break;
+            case 2:
+                p.outerhardShoulderStatus = vanetza::asn1::allocate<HardShoulderStatus_t>();
+                read_json(r, *(p.outerhardShoulderStatus));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ItineraryPath - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ItineraryPath& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        ReferencePosition_t* element = vanetza::asn1::allocate<ReferencePosition_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   EventHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, EventHistory& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        EventPoint_t* element = vanetza::asn1::allocate<EventPoint_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   DigitalMap - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, DigitalMap_t& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        ReferencePosition_t* element = vanetza::asn1::allocate<ReferencePosition_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   HighFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, HighFrequencyContainer& p) {
+    static const char* const keys[] = { "basicVehicleContainerHighFrequency", "rsuContainerHighFrequency" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = HighFrequencyContainer_PR_basicVehicleContainerHighFrequency;
+                read_json(r, p.choice.basicVehicleContainerHighFrequency);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = HighFrequencyContainer_PR_rsuContainerHighFrequency;
+                read_json(r, p.choice.rsuContainerHighFrequency);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   LowFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, LowFrequencyContainer& p) {
+    static const char* const keys[] = { "basicVehicleContainerLowFrequency" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = LowFrequencyContainer_PR_basicVehicleContainerLowFrequency;
+                read_json(r, p.choice.basicVehicleContainerLowFrequency);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   BasicContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, BasicContainer& p) {
+    static const char* const keys[] = { "referencePosition", "stationType" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.referencePosition));
+                break;
+            case 1:
+                read_json(r, (p.stationType));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   PublicTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, PublicTransportContainer& p) {
+    static const char* const keys[] = { "embarkationStatus", "ptActivation" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.embarkationStatus));
+                break;
+            case 1:
+                p.ptActivation = vanetza::asn1::allocate<PtActivation_t>();
+                read_json(r, *(p.ptActivation));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   RoadWorksContainerBasic - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, RoadWorksContainerBasic& p) {
+    static const char* const keys[] = { "closedLanes", "lightBarSirenInUse", "roadworksSubCauseCode" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.closedLanes = vanetza::asn1::allocate<ClosedLanes_t>();
+                read_json(r, *(p.closedLanes));
+                break;
+            case 1:
+                read_json_LightBarSirenInUse(r, (p.lightBarSirenInUse));
+                break;
+            case 2:
+                p.roadworksSubCauseCode = vanetza::asn1::allocate<RoadworksSubCauseCode_t>();
+                read_json(r, *(p.roadworksSubCauseCode));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   ManagementContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, ManagementContainer& p) {
+    static const char* const keys[] = { "actionID", "detectionTime", "eventPosition", "referenceTime", "relevanceDistance", "relevanceTrafficDirection", "stationType", "termination", "transmissionInterval", "validityDuration" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.actionID));
+                break;
+            case 1:
+                read_json(r, (p.detectionTime));
+                break;
+            case 2:
+                read_json(r, (p.eventPosition));
+                break;
+            case 3:
+                read_json(r, (p.referenceTime));
+                break;
+            case 4:
+                p.relevanceDistance = vanetza::asn1::allocate<RelevanceDistance_t>();
+                read_json(r, *(p.relevanceDistance));
+                break;
+            case 5:
+                p.relevanceTrafficDirection = vanetza::asn1::allocate<RelevanceTrafficDirection_t>();
+                read_json(r, *(p.relevanceTrafficDirection));
+                break;
+            case 6:
+                read_json(r, (p.stationType));
+                break;
+            case 7:
+                p.termination = vanetza::asn1::allocate<Termination_t>();
+                read_json(r, *(p.termination));
+                break;
+            case 8:
+                p.transmissionInterval = vanetza::asn1::allocate<TransmissionInterval_t>();
+                read_json(r, *(p.transmissionInterval));
+                break;
+            case 9:
+                p.validityDuration = vanetza::asn1::allocate<ValidityDuration_t>();
+                read_json(r, *(p.validityDuration));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x4full);
+}
+
+/*
+*   SituationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, SituationContainer& p) {
+    static const char* const keys[] = { "eventHistory", "eventType", "informationQuality", "linkedCause" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.eventHistory = vanetza::asn1::allocate<EventHistory_t>();
+                read_json(r, *(p.eventHistory));
+                break;
+            case 1:
+                read_json(r, (p.eventType));
+                break;
+            case 2:
+                read_json(r, (p.informationQuality));
+                break;
+            case 3:
+                p.linkedCause = vanetza::asn1::allocate<CauseCode_t>();
+                read_json(r, *(p.linkedCause));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   RoadWorksContainerExtended - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, RoadWorksContainerExtended& p) {
+    static const char* const keys[] = { "closedLanes", "incidentIndication", "lightBarSirenInUse", "recommendedPath", "referenceDenms", "restriction", "speedLimit", "startingPointSpeedLimit", "trafficFlowRule" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.closedLanes = vanetza::asn1::allocate<ClosedLanes_t>();
+                read_json(r, *(p.closedLanes));
+                break;
+            case 1:
+                p.incidentIndication = vanetza::asn1::allocate<CauseCode_t>();
+                read_json(r, *(p.incidentIndication));
+                break;
+            case 2:
+                p.lightBarSirenInUse = vanetza::asn1::allocate<LightBarSirenInUse_t>();
+                read_json_LightBarSirenInUse(r, *(p.lightBarSirenInUse));
+                break;
+            case 3:
+                p.recommendedPath = vanetza::asn1::allocate<ItineraryPath_t>();
+                read_json(r, *(p.recommendedPath));
+                break;
+            case 4:
+                p.referenceDenms = vanetza::asn1::allocate<ReferenceDenms_t>();
+                read_json(r, *(p.referenceDenms));
+                break;
+            case 5:
+                p.restriction = vanetza::asn1::allocate<RestrictedTypes_t>();
+                read_json(r, *(p.restriction));
+                break;
+            case 6:
+                p.speedLimit = vanetza::asn1::allocate<SpeedLimit_t>();
+                read_json(r, *(p.speedLimit));
+                break;
+            case 7:
+                p.startingPointSpeedLimit = vanetza::asn1::allocate<DeltaReferencePosition_t>();
+                read_json(r, *(p.startingPointSpeedLimit));
+                break;
+            case 8:
+                p.trafficFlowRule = vanetza::asn1::allocate<TrafficRule_t>();
+                read_json(r, *(p.trafficFlowRule));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   AlacarteContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, AlacarteContainer& p) {
+    static const char* const keys[] = { "externalTemperature", "impactReduction", "lanePosition", "positioningSolution", "roadWorks", "stationaryVehicle" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.externalTemperature = vanetza::asn1::allocate<Temperature_t>();
+                read_json(r, *(p.externalTemperature));
+                break;
+            case 1:
+                p.impactReduction = vanetza::asn1::allocate<ImpactReductionContainer_t>();
+                read_json(r, *(p.impactReduction));
+                break;
+            case 2:
+                p.lanePosition = vanetza::asn1::allocate<LanePosition_t>();
+                read_json(r, *(p.lanePosition));
+                break;
+            case 3:
+                p.positioningSolution = vanetza::asn1::allocate<PositioningSolutionType_t>();
+                read_json(r, *(p.positioningSolution));
+                break;
+            case 4:
+                p.roadWorks = vanetza::asn1::allocate<RoadWorksContainerExtended_t>();
+                read_json(r, *(p.roadWorks));
+                break;
+            case 5:
+                p.stationaryVehicle = vanetza::asn1::allocate<StationaryVehicleContainer_t>();
+                read_json(r, *(p.stationaryVehicle));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   MapPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, MapPosition& p) {
+    static const char* const keys[] = { "intersectionId", "lane" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.intersectionId));
+                break;
+            case 1:
+                read_json(r, (p.lane));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VruExteriorLights - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruExteriorLights& p) {
+    static const char* const keys[] = { "vehicular", "vruSpecific" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json_ExteriorLights(r, (p.vehicular));
+                break;
+            case 1:
+                read_json_VruSpecificExteriorLights(r, (p.vruSpecific));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VruClusterOperationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruClusterOperationContainer& p) {
+    static const char* const keys[] = { "clusterBreakupInfo", "clusterIdChangeTimeInfo", "clusterJoinInfo", "clusterLeaveInfo" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.clusterBreakupInfo = vanetza::asn1::allocate<ClusterBreakupInfo_t>();
+                read_json(r, *(p.clusterBreakupInfo));
+                break;
+            case 1:
+                p.clusterIdChangeTimeInfo = vanetza::asn1::allocate<VruClusterOpTimestamp_t>();
+                read_json(r, *(p.clusterIdChangeTimeInfo));
+                break;
+            case 2:
+                p.clusterJoinInfo = vanetza::asn1::allocate<ClusterJoinInfo_t>();
+                read_json(r, *(p.clusterJoinInfo));
+                break;
+            case 3:
+                p.clusterLeaveInfo = vanetza::asn1::allocate<ClusterLeaveInfo_t>();
+                read_json(r, *(p.clusterLeaveInfo));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   VruPathPoint - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruPathPoint& p) {
+    static const char* const keys[] = { "pathDeltaTime", "pathPosition" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.pathDeltaTime = vanetza::asn1::allocate<PathDeltaTime_t>();
+                read_json(r, *(p.pathDeltaTime));
+                break;
+            case 1:
+                read_json(r, (p.pathPosition));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   SequenceOfVruSafeDistanceIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, SequenceOfVruSafeDistanceIndication& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        VruSafeDistanceIndication_t* element = vanetza::asn1::allocate<VruSafeDistanceIndication_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   SequenceOfTrajectoryInterceptionIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, SequenceOfTrajectoryInterceptionIndication& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        TrajectoryInterceptionIndication_t* element = vanetza::asn1::allocate<TrajectoryInterceptionIndication_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   ConnectingLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ConnectingLane& p) {
+    static const char* const keys[] = { "lane", "maneuver" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.lane));
+                break;
+            case 1:
+                p.maneuver = vanetza::asn1::allocate<AllowedManeuvers_t>();
+                read_json_AllowedManeuvers(r, *(p.maneuver));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   Connection - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, Connection& p) {
+    static const char* const keys[] = { "connectingLane", "connectionID", "remoteIntersection", "signalGroup", "userClass" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.connectingLane));
+                break;
+            case 1:
+                p.connectionID = vanetza::asn1::allocate<LaneConnectionID_t>();
+                read_json(r, *(p.connectionID));
+                break;
+            case 2:
+                p.remoteIntersection = vanetza::asn1::allocate<IntersectionReferenceID_t>();
+                read_json(r, *(p.remoteIntersection));
+                break;
+            case 3:
+                p.signalGroup = vanetza::asn1::allocate<SignalGroupID_t>();
+                read_json(r, *(p.signalGroup));
+                break;
+            case 4:
+                p.userClass = vanetza::asn1::allocate<RestrictionClassID_t>();
+                read_json(r, *(p.userClass));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   LaneTypeAttributes - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, LaneTypeAttributes& p) {
+    static const char* const keys[] = { "bikeLane", "crosswalk", "median", "parking", "sidewalk", "striping", "trackedVehicle", "vehicle" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_bikeLane;
+                read_json_LaneAttributes_Bike(r, p.choice.bikeLane);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_crosswalk;
+                read_json_LaneAttributes_Crosswalk(r, p.choice.crosswalk);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_median;
+                read_json_LaneAttributes_Barrier(r, p.choice.median);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_parking;
+                read_json_LaneAttributes_Parking(r, p.choice.parking);
+                break;
+            case 4:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_sidewalk;
+                read_json_LaneAttributes_Sidewalk(r, p.choice.sidewalk);
+                break;
+            case 5:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_striping;
+                read_json_LaneAttributes_Striping(r, p.choice.striping);
+                break;
+            case 6:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_trackedVehicle;
+                read_json_LaneAttributes_TrackedVehicle(r, p.choice.trackedVehicle);
+                break;
+            case 7:
+                members.exclusive();
+                p.present = LaneTypeAttributes_PR_vehicle;
+                read_json_LaneAttributes_Vehicle(r, p.choice.vehicle);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   MovementEvent - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementEvent& p) {
+    static const char* const keys[] = { "eventState", "speeds", "timing" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.eventState));
+                break;
+            case 1:
+                p.speeds = vanetza::asn1::allocate<AdvisorySpeedList_t>();
+                read_json(r, *(p.speeds));
+                break;
+            case 2:
+                p.timing = vanetza::asn1::allocate<TimeChangeDetails_t>();
+                read_json(r, *(p.timing));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   RestrictionUserTypeList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionUserTypeList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        RestrictionUserType_t* element = vanetza::asn1::allocate<RestrictionUserType_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   LaneDataAttribute - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, LaneDataAttribute& p) {
+    static const char* const keys[] = { "laneAngle", "laneCrownPointCenter", "laneCrownPointLeft", "laneCrownPointRight", "pathEndPointAngle", "speedLimits" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = LaneDataAttribute_PR_laneAngle;
+                read_json(r, p.choice.laneAngle);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = LaneDataAttribute_PR_laneCrownPointCenter;
+                read_json(r, p.choice.laneCrownPointCenter);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = LaneDataAttribute_PR_laneCrownPointLeft;
+                read_json(r, p.choice.laneCrownPointLeft);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = LaneDataAttribute_PR_laneCrownPointRight;
+                read_json(r, p.choice.laneCrownPointRight);
+                break;
+            case 4:
+                members.exclusive();
+                p.present = LaneDataAttribute_PR_pathEndPointAngle;
+                read_json(r, p.choice.pathEndPointAngle);
+                break;
+            case 5:
+                members.exclusive();
+                p.present = LaneDataAttribute_PR_speedLimits;
+                read_json(r, p.choice.speedLimits);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   LaneDataAttributeList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, LaneDataAttributeList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        LaneDataAttribute_t* element = vanetza::asn1::allocate<LaneDataAttribute_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   NodeOffsetPointXY - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeOffsetPointXY& p) {
+    static const char* const keys[] = { "node-LatLon", "node-XY1", "node-XY2", "node-XY3", "node-XY4", "node-XY5", "node-XY6" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_LatLon;
+                read_json(r, p.choice.node_LatLon);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_XY1;
+                read_json(r, p.choice.node_XY1);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_XY2;
+                read_json(r, p.choice.node_XY2);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_XY3;
+                read_json(r, p.choice.node_XY3);
+                break;
+            case 4:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_XY4;
+                read_json(r, p.choice.node_XY4);
+                break;
+            case 5:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_XY5;
+                read_json(r, p.choice.node_XY5);
+                break;
+            case 6:
+                members.exclusive();
+                p.present = NodeOffsetPointXY_PR_node_XY6;
+                read_json(r, p.choice.node_XY6);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   NodeAttributeSetXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeAttributeSetXY_t& p) {
+    static const char* const keys[] = { "dElevation", "dWidth", "data", "disabled", "enabled", "localNode" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.dElevation = vanetza::asn1::allocate<Offset_B10_t>();
+                read_json(r, *(p.dElevation));
+                break;
+            case 1:
+                p.dWidth = vanetza::asn1::allocate<Offset_B10_t>();
+                read_json(r, *(p.dWidth));
+                break;
+            case 2:
+                p.data = vanetza::asn1::allocate<LaneDataAttributeList_t>();
+                read_json(r, *(p.data));
+                break;
+            case 3:
+                p.disabled = vanetza::asn1::allocate<SegmentAttributeXYList_t>();
+                read_json(r, *(p.disabled));
+                break;
+            case 4:
+                p.enabled = vanetza::asn1::allocate<SegmentAttributeXYList_t>();
+                read_json(r, *(p.enabled));
+                break;
+            case 5:
+                p.localNode = vanetza::asn1::allocate<NodeAttributeXYList_t>();
+                read_json(r, *(p.localNode));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   CpmManagementContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CpmManagementContainer& p) {
+    static const char* const keys[] = { "perceivedObjectContainerSegmentInfo", "referencePosition", "stationType" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.perceivedObjectContainerSegmentInfo = vanetza::asn1::allocate<PerceivedObjectContainerSegmentInfo_t>();
+                read_json(r, *(p.perceivedObjectContainerSegmentInfo));
+                break;
+            case 1:
+                read_json(r, (p.referencePosition));
+                break;
+            case 2:
+                read_json(r, (p.stationType));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   VehicleSensorPropertyList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSensorPropertyList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        VehicleSensorProperties_t* element = vanetza::asn1::allocate<VehicleSensorProperties_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   TrailerDataContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, TrailerDataContainer& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        TrailerData_t* element = vanetza::asn1::allocate<TrailerData_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   ObjectClass::ObjectClass__class - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectClass::ObjectClass__class& p) {
+    static const char* const keys[] = { "animal", "other", "person", "vehicle" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = ObjectClass__class_PR_animal;
+                read_json(r, p.choice.animal);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = ObjectClass__class_PR_other;
+                read_json(r, p.choice.other);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = ObjectClass__class_PR_person;
+                read_json(r, p.choice.person);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = ObjectClass__class_PR_vehicle;
+                read_json(r, p.choice.vehicle);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ObjectClass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectClass_t& p) {
+    static const char* const keys[] = { "class", "confidence" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.Class));
+                break;
+            case 1:
+                read_json(r, (p.confidence));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   OffsetPoint - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OffsetPoint& p) {
+    static const char* const keys[] = { "nodeOffsetPointZ", "nodeOffsetPointxy" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.nodeOffsetPointZ = vanetza::asn1::allocate<NodeOffsetPointZ_t>();
+                read_json(r, *(p.nodeOffsetPointZ));
+                break;
+            case 1:
+                read_json(r, (p.nodeOffsetPointxy));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   SpecialVehicleContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, SpecialVehicleContainer& p) {
+    static const char* const keys[] = { "dangerousGoodsContainer", "emergencyContainer", "publicTransportContainer", "rescueContainer", "roadWorksContainerBasic", "safetyCarContainer", "specialTransportContainer" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_dangerousGoodsContainer;
+                read_json(r, p.choice.dangerousGoodsContainer);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_emergencyContainer;
+                read_json(r, p.choice.emergencyContainer);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_publicTransportContainer;
+                read_json(r, p.choice.publicTransportContainer);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_rescueContainer;
+                read_json(r, p.choice.rescueContainer);
+                break;
+            case 4:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_roadWorksContainerBasic;
+                read_json(r, p.choice.roadWorksContainerBasic);
+                break;
+            case 5:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_safetyCarContainer;
+                read_json(r, p.choice.safetyCarContainer);
+                break;
+            case 6:
+                members.exclusive();
+                p.present = SpecialVehicleContainer_PR_specialTransportContainer;
+                read_json(r, p.choice.specialTransportContainer);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   DecentralizedEnvironmentalNotificationMessage - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, DecentralizedEnvironmentalNotificationMessage& p) {
+    static const char* const keys[] = { "alacarte", "location", "management", "situation" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.alacarte = vanetza::asn1::allocate<AlacarteContainer_t>();
+                read_json(r, *(p.alacarte));
+                break;
+            case 1:
+                p.location = vanetza::asn1::allocate<LocationContainer_t>();
+                read_json(r, *(p.location));
+                break;
+            case 2:
+                read_json(r, (p.management));
+                break;
+            case 3:
+                p.situation = vanetza::asn1::allocate<SituationContainer_t>();
+                read_json(r, *(p.situation));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x4ull);
+}
+
+/*
+*   NonIslandLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, NonIslandLanePosition& p) {
+    static const char* const keys[] = { "mapPosition", "offRoadLanePosition", "vehicularLanePosition" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = NonIslandLanePosition_PR_mapPosition;
+                read_json(r, p.choice.mapPosition);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = NonIslandLanePosition_PR_offRoadLanePosition;
+                read_json(r, p.choice.offRoadLanePosition);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = NonIslandLanePosition_PR_vehicularLanePosition;
+                read_json(r, p.choice.vehicularLanePosition);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   VruLowFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruLowFrequencyContainer& p) {
+    static const char* const keys[] = { "exteriorLights", "profileAndSubprofile", "sizeClass" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.exteriorLights = vanetza::asn1::allocate<VruExteriorLights_t>();
+                read_json(r, *(p.exteriorLights));
+                break;
+            case 1:
+                p.profileAndSubprofile = vanetza::asn1::allocate<VruProfileAndSubprofile_t>();
+                read_json(r, *(p.profileAndSubprofile));
+                break;
+            case 2:
+                p.sizeClass = vanetza::asn1::allocate<VruSizeClass_t>();
+                read_json(r, *(p.sizeClass));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   SequenceOfVruPathPoint - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, SequenceOfVruPathPoint& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        VruPathPoint_t* element = vanetza::asn1::allocate<VruPathPoint_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   ConnectsToList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ConnectsToList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        Connection_t* element = vanetza::asn1::allocate<Connection_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   LaneAttributes - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, LaneAttributes& p) {
+    static const char* const keys[] = { "directionalUse", "laneType", "sharedWith" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json_LaneDirection(r, (p.directionalUse));
+                break;
+            case 1:
+                read_json(r, (p.laneType));
+                break;
+            case 2:
+                read_json_LaneSharing(r, (p.sharedWith));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x7ull);
+}
+
+/*
+*   MovementEventList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementEventList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        MovementEvent_t* element = vanetza::asn1::allocate<MovementEvent_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   MovementState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementState& p) {
+    static const char* const keys[] = { "maneuverAssistList", "signalGroup", "state-time-speed" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.maneuverAssistList = vanetza::asn1::allocate<ManeuverAssistList_t>();
+                read_json(r, *(p.maneuverAssistList));
+                break;
+            case 1:
+                read_json(r, (p.signalGroup));
+                break;
+            case 2:
+                read_json(r, (p.state_time_speed));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   RestrictionClassAssignment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionClassAssignment& p) {
+    static const char* const keys[] = { "id", "users" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.id));
+                break;
+            case 1:
+                read_json(r, (p.users));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   RestrictionClassList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionClassList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        RestrictionClassAssignment_t* element = vanetza::asn1::allocate<RestrictionClassAssignment_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   NodeXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeXY_t& p) {
+    static const char* const keys[] = { "attributes", "delta" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.attributes = vanetza::asn1::allocate<NodeAttributeSetXY_t>();
+                read_json(r, *(p.attributes));
+                break;
+            case 1:
+                read_json(r, (p.delta));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   OriginatingVehicleContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OriginatingVehicleContainer& p) {
+    static const char* const keys[] = { "driveDirection", "heading", "lateralAcceleration", "longitudinalAcceleration", "pitchAngle", "rollAngle", "speed", "trailerDataContainer", "vehicleHeight", "vehicleLength", "vehicleOrientationAngle", "vehicleWidth", "verticalAcceleration", "yawRate" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.driveDirection));
+                break;
+            case 1:
+                read_json(r, (p.heading));
+                break;
+            case 2:
+                p.lateralAcceleration = vanetza::asn1::allocate<LateralAcceleration_t>();
+                read_json(r, *(p.lateralAcceleration));
+                break;
+            case 3:
+                p.longitudinalAcceleration = vanetza::asn1::allocate<LongitudinalAcceleration_t>();
+                read_json(r, *(p.longitudinalAcceleration));
+                break;
+            case 4:
+                p.pitchAngle = vanetza::asn1::allocate<CartesianAngle_t>();
+                read_json(r, *(p.pitchAngle));
+                break;
+            case 5:
+                p.rollAngle = vanetza::asn1::allocate<CartesianAngle_t>();
+                read_json(r, *(p.rollAngle));
+                break;
+            case 6:
+                read_json(r, (p.speed));
+                break;
+            case 7:
+                p.trailerDataContainer = vanetza::asn1::allocate<TrailerDataContainer_t>();
+                read_json(r, *(p.trailerDataContainer));
+                break;
+            case 8:
+                p.vehicleHeight = vanetza::asn1::allocate<VehicleHeight_t>();
+                read_json(r, *(p.vehicleHeight));
+                break;
+            case 9:
+                p.vehicleLength = vanetza::asn1::allocate<VehicleLength_t>();
+                read_json(r, *(p.vehicleLength));
+                break;
+            case 10:
+                p.vehicleOrientationAngle = vanetza::asn1::allocate<WGS84Angle_t>();
+                read_json(r, *(p.vehicleOrientationAngle));
+                break;
+            case 11: {
+                p.vehicleWidth = vanetza::asn1::allocate<VehicleWidth_t>();
+                const double value = r.number();
+                *(p.vehicleWidth) = (value != 61 && value != 62) ? value * 10 : value;
+                break;
+            }
+            case 12:
+                p.verticalAcceleration = vanetza::asn1::allocate<VerticalAcceleration_t>();
+                read_json(r, *(p.verticalAcceleration));
+                break;
+            case 13:
+                p.yawRate = vanetza::asn1::allocate<YawRate_t>();
+                read_json(r, *(p.yawRate));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x43ull);
+}
+
+/*
+*   VehicleSensor - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSensor& p) {
+    static const char* const keys[] = { "refPointId", "vehicleSensorPropertyList", "xSensorOffset", "ySensorOffset", "zSensorOffset" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.refPointId));
+                break;
+            case 1:
+                read_json(r, (p.vehicleSensorPropertyList));
+                break;
+            case 2:
+                read_json(r, (p.xSensorOffset));
+                break;
+            case 3:
+                read_json(r, (p.ySensorOffset));
+                break;
+            case 4:
+                p.zSensorOffset = vanetza::asn1::allocate<ZSensorOffset_t>();
+                read_json(r, *(p.zSensorOffset));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfull);
+}
+
+/*
+*   AreaCircular - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaCircular& p) {
+    static const char* const keys[] = { "nodeCenterPoint", "radius" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.nodeCenterPoint = vanetza::asn1::allocate<OffsetPoint_t>();
+                read_json(r, *(p.nodeCenterPoint));
+                break;
+            case 1: {
+                const double value = r.number();
+                (p.radius) = value * 10;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x2ull);
+}
+
+/*
+*   AreaEllipse - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaEllipse& p) {
+    static const char* const keys[] = { "nodeCenterPoint", "semiHeight", "semiMajorRangeLength", "semiMajorRangeOrientation", "semiMinorRangeLength" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.nodeCenterPoint = vanetza::asn1::allocate<OffsetPoint_t>();
+                read_json(r, *(p.nodeCenterPoint));
+                break;
+            case 1: {
+                p.semiHeight = vanetza::asn1::allocate<ObjectDimensionValue_t>();
+                const double value = r.number();
+                *(p.semiHeight) = value * 10;
+                break;
+            }
+            case 2: {
+                const double value = r.number();
+                (p.semiMajorRangeLength) = value * 10;
+                break;
+            }
+            case 3: {
+                const double value = r.number();
+                (p.semiMajorRangeOrientation) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 4: {
+                const double value = r.number();
+                (p.semiMinorRangeLength) = value * 10;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1cull);
+}
+
+/*
+*   AreaRectangle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaRectangle& p) {
+    static const char* const keys[] = { "nodeCenterPoint", "semiHeight", "semiMajorRangeLength", "semiMajorRangeOrientation", "semiMinorRangeLength" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.nodeCenterPoint = vanetza::asn1::allocate<OffsetPoint_t>();
+                read_json(r, *(p.nodeCenterPoint));
+                break;
+            case 1: {
+                p.semiHeight = vanetza::asn1::allocate<ObjectDimensionValue_t>();
+                const double value = r.number();
+                *(p.semiHeight) = value * 10;
+                break;
+            }
+            case 2: {
+                const double value = r.number();
+                (p.semiMajorRangeLength) = value * 10;
+                break;
+            }
+            case 3: {
+                const double value = r.number();
+                (p.semiMajorRangeOrientation) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 4: {
+                const double value = r.number();
+                (p.semiMinorRangeLength) = value * 10;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1cull);
+}
+
+/*
+*   PolyPointList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PolyPointList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        OffsetPoint_t* element = vanetza::asn1::allocate<OffsetPoint_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   AreaRadial - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaRadial& p) {
+    static const char* const keys[] = { "range", "sensorHeight", "sensorPositionOffset", "stationaryHorizontalOpeningAngleEnd", "stationaryHorizontalOpeningAngleStart", "verticalOpeningAngleEnd", "verticalOpeningAngleStart" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.range));
+                break;
+            case 1: {
+                p.sensorHeight = vanetza::asn1::allocate<DistanceValue_t>();
+                const double value = r.number();
+                *(p.sensorHeight) = value * 100;
+                break;
+            }
+            case 2:
+                p.sensorPositionOffset = vanetza::asn1::allocate<OffsetPoint_t>();
+                read_json(r, *(p.sensorPositionOffset));
+                break;
+            case 3: {
+                const double value = r.number();
+                (p.stationaryHorizontalOpeningAngleEnd) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 4: {
+                const double value = r.number();
+                (p.stationaryHorizontalOpeningAngleStart) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 5: {
+                p.verticalOpeningAngleEnd = vanetza::asn1::allocate<HeadingValue_t>();
+                const double value = r.number();
+                *(p.verticalOpeningAngleEnd) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            case 6: {
+                p.verticalOpeningAngleStart = vanetza::asn1::allocate<HeadingValue_t>();
+                const double value = r.number();
+                *(p.verticalOpeningAngleStart) = (value != 3601) ? value * 10 : value;
+                break;
+            }
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x19ull);
+}
+
+/*
+*   ObjectClassDescription - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectClassDescription& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        ObjectClass_t* element = vanetza::asn1::allocate<ObjectClass_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   CamParameters - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, CamParameters& p) {
+    static const char* const keys[] = { "basicContainer", "highFrequencyContainer", "lowFrequencyContainer", "specialVehicleContainer" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.basicContainer));
+                break;
+            case 1:
+                read_json(r, (p.highFrequencyContainer));
+                break;
+            case 2:
+                p.lowFrequencyContainer = vanetza::asn1::allocate<LowFrequencyContainer_t>();
+                read_json(r, *(p.lowFrequencyContainer));
+                break;
+            case 3:
+                p.specialVehicleContainer = vanetza::asn1::allocate<SpecialVehicleContainer_t>();
+                read_json(r, *(p.specialVehicleContainer));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   DENM - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, DENM& p) {
+    static const char* const keys[] = { "denm", "header" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.denm));
+                break;
+            case 1:
+                read_json(r, (p.header));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   TrafficIslandPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, TrafficIslandPosition& p) {
+    static const char* const keys[] = { "oneSide", "otherSide" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.oneSide));
+                break;
+            case 1:
+                read_json(r, (p.otherSide));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VruMotionPredictionContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruMotionPredictionContainer& p) {
+    static const char* const keys[] = { "accelerationChangeIndication", "headingChangeIndication", "pathHistory", "pathPrediction", "safeDistance", "stabilityChangeIndication", "trajectoryInterceptionIndication" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.accelerationChangeIndication = vanetza::asn1::allocate<AccelerationChangeIndication_t>();
+                read_json(r, *(p.accelerationChangeIndication));
+                break;
+            case 1:
+                p.headingChangeIndication = vanetza::asn1::allocate<HeadingChangeIndication_t>();
+                read_json(r, *(p.headingChangeIndication));
+                break;
+            case 2:
+                p.pathHistory = vanetza::asn1::allocate<PathHistory_t>();
+                read_json(r, *(p.pathHistory));
+                break;
+            case 3:
+                p.pathPrediction = vanetza::asn1::allocate<SequenceOfVruPathPoint_t>();
+                read_json(r, *(p.pathPrediction));
+                break;
+            case 4:
+                p.safeDistance = vanetza::asn1::allocate<SequenceOfVruSafeDistanceIndication_t>();
+                read_json(r, *(p.safeDistance));
+                break;
+            case 5:
+                p.stabilityChangeIndication = vanetza::asn1::allocate<StabilityChangeIndication_t>();
+                read_json(r, *(p.stabilityChangeIndication));
+                break;
+            case 6:
+                p.trajectoryInterceptionIndication = vanetza::asn1::allocate<SequenceOfTrajectoryInterceptionIndication_t>();
+                read_json(r, *(p.trajectoryInterceptionIndication));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   MovementList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        MovementState_t* element = vanetza::asn1::allocate<MovementState_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   NodeSetXY - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeSetXY& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        NodeXY_t* element = vanetza::asn1::allocate<NodeXY_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   StationDataContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, StationDataContainer& p) {
+    static const char* const keys[] = { "originatingRSUContainer", "originatingVehicleContainer" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = StationDataContainer_PR_originatingRSUContainer;
+                read_json(r, p.choice.originatingRSUContainer);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = StationDataContainer_PR_originatingVehicleContainer;
+                read_json(r, p.choice.originatingVehicleContainer);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   PerceivedObject - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PerceivedObject& p) {
+    static const char* const keys[] = { "classification", "dynamicStatus", "matchedPosition", "objectAge", "objectConfidence", "objectID", "objectRefPoint", "planarObjectDimension1", "planarObjectDimension2", "sensorIDList", "timeOfMeasurement", "verticalObjectDimension", "xAcceleration", "xDistance", "xSpeed", "yAcceleration", "yDistance", "ySpeed", "yawAngle", "zAcceleration", "zDistance", "zSpeed" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.classification = vanetza::asn1::allocate<ObjectClassDescription_t>();
+                read_json(r, *(p.classification));
+                break;
+            case 1:
+                p.dynamicStatus = vanetza::asn1::allocate<DynamicStatus_t>();
+                read_json(r, *(p.dynamicStatus));
+                break;
+            case 2:
+                p.matchedPosition = vanetza::asn1::allocate<MatchedPosition_t>();
+                read_json(r, *(p.matchedPosition));
+                break;
+            case 3:
+                p.objectAge = vanetza::asn1::allocate<ObjectAge_t>();
+                read_json(r, *(p.objectAge));
+                break;
+            case 4:
+                read_json(r, (p.objectConfidence));
+                break;
+            case 5:
+                read_json(r, (p.objectID));
+                break;
+            case 6:
+                read_json(r, (p.objectRefPoint));
+                break;
+            case 7:
+                p.planarObjectDimension1 = vanetza::asn1::allocate<ObjectDimension_t>();
+                read_json(r, *(p.planarObjectDimension1));
+                break;
+            case 8:
+                p.planarObjectDimension2 = vanetza::asn1::allocate<ObjectDimension_t>();
+                read_json(r, *(p.planarObjectDimension2));
+                break;
+            case 9:
+                p.sensorIDList = vanetza::asn1::allocate<SensorIdList_t>();
+                read_json(r, *(p.sensorIDList));
+                break;
+            case 10:
+                read_json(r, (p.timeOfMeasurement));
+                break;
+            case 11:
+                p.verticalObjectDimension = vanetza::asn1::allocate<ObjectDimension_t>();
+                read_json(r, *(p.verticalObjectDimension));
+                break;
+            case 12:
+                p.xAcceleration = vanetza::asn1::allocate<LongitudinalAcceleration_t>();
+                read_json(r, *(p.xAcceleration));
+                break;
+            case 13:
+                read_json(r, (p.xDistance));
+                break;
+            case 14:
+                read_json(r, (p.xSpeed));
+                break;
+            case 15:
+                p.yAcceleration = vanetza::asn1::allocate<LateralAcceleration_t>();
+                read_json(r, *(p.yAcceleration));
+                break;
+            case 16:
+                read_json(r, (p.yDistance));
+                break;
+            case 17:
+                read_json(r, (p.ySpeed));
+                break;
+            case 18:
+                p.yawAngle = vanetza::asn1::allocate<CartesianAngle_t>();
+                read_json(r, *(p.yawAngle));
+                break;
+            case 19:
+                p.zAcceleration = vanetza::asn1::allocate<VerticalAcceleration_t>();
+                read_json(r, *(p.zAcceleration));
+                break;
+            case 20:
+                p.zDistance = vanetza::asn1::allocate<ObjectDistanceWithConfidence_t>();
+                read_json(r, *(p.zDistance));
+                break;
+            case 21:
+                p.zSpeed = vanetza::asn1::allocate<SpeedExtended_t>();
+                read_json(r, *(p.zSpeed));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x36470ull);
+}
+
+/*
+*   AreaPolygon - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaPolygon& p) {
+    static const char* const keys[] = { "polyPointList" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.polyPointList));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   FreeSpaceArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, FreeSpaceArea& p) {
+    static const char* const keys[] = { "freeSpaceCircular", "freeSpaceEllipse", "freeSpacePolygon", "freeSpaceRectangle" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = FreeSpaceArea_PR_freeSpaceCircular;
+                read_json(r, p.choice.freeSpaceCircular);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = FreeSpaceArea_PR_freeSpaceEllipse;
+                read_json(r, p.choice.freeSpaceEllipse);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = FreeSpaceArea_PR_freeSpacePolygon;
+                read_json(r, p.choice.freeSpacePolygon);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = FreeSpaceArea_PR_freeSpaceRectangle;
+                read_json(r, p.choice.freeSpaceRectangle);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   CoopAwareness - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, CoopAwareness& p) {
+    static const char* const keys[] = { "camParameters", "generationDeltaTime" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.camParameters));
+                break;
+            case 1:
+                read_json(r, (p.generationDeltaTime));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VruLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruLanePosition& p) {
+    static const char* const keys[] = { "mapPosition", "offRoadLanePosition", "trafficIslandPosition", "vehicularLanePosition" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = VruLanePosition_PR_mapPosition;
+                read_json(r, p.choice.mapPosition);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = VruLanePosition_PR_offRoadLanePosition;
+                read_json(r, p.choice.offRoadLanePosition);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = VruLanePosition_PR_trafficIslandPosition;
+                read_json(r, p.choice.trafficIslandPosition);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = VruLanePosition_PR_vehicularLanePosition;
+                read_json(r, p.choice.vehicularLanePosition);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   ClusterBoundingBoxShape - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterBoundingBoxShape& p) {
+    static const char* const keys[] = { "clusterCircle", "clusterPolygon", "clusterRectangle" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = ClusterBoundingBoxShape_PR_clusterCircle;
+                read_json(r, p.choice.clusterCircle);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = ClusterBoundingBoxShape_PR_clusterPolygon;
+                read_json(r, p.choice.clusterPolygon);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = ClusterBoundingBoxShape_PR_clusterRectangle;
+                read_json(r, p.choice.clusterRectangle);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   IntersectionState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionState& p) {
+    static const char* const keys[] = { "enabledLanes", "id", "maneuverAssistList", "moy", "revision", "states", "status", "timeStamp" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.enabledLanes = vanetza::asn1::allocate<EnabledLaneList_t>();
+                read_json(r, *(p.enabledLanes));
+                break;
+            case 1:
+                read_json(r, (p.id));
+                break;
+            case 2:
+                p.maneuverAssistList = vanetza::asn1::allocate<ManeuverAssistList_t>();
+                read_json(r, *(p.maneuverAssistList));
+                break;
+            case 3:
+                p.moy = vanetza::asn1::allocate<MinuteOfTheYear_t>();
+                read_json(r, *(p.moy));
+                break;
+            case 4:
+                read_json(r, (p.revision));
+                break;
+            case 5:
+                read_json(r, (p.states));
+                break;
+            case 6:
+                read_json_IntersectionStatusObject(r, (p.status));
+                break;
+            case 7:
+                p.timeStamp = vanetza::asn1::allocate<DSecond_t>();
+                read_json(r, *(p.timeStamp));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x72ull);
+}
+
+/*
+*   IntersectionStateList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionStateList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        IntersectionState_t* element = vanetza::asn1::allocate<IntersectionState_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   NodeListXY - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, NodeListXY& p) {
+    static const char* const keys[] = { "computed", "nodes" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = NodeListXY_PR_computed;
+                read_json(r, p.choice.computed);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = NodeListXY_PR_nodes;
+                read_json(r, p.choice.nodes);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   PerceivedObjectContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PerceivedObjectContainer_t& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        PerceivedObject_t* element = vanetza::asn1::allocate<PerceivedObject_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   DetectionArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, DetectionArea& p) {
+    static const char* const keys[] = { "stationarySensorCircular", "stationarySensorEllipse", "stationarySensorPolygon", "stationarySensorRadial", "stationarySensorRectangle", "vehicleSensor" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                members.exclusive();
+                p.present = DetectionArea_PR_stationarySensorCircular;
+                read_json(r, p.choice.stationarySensorCircular);
+                break;
+            case 1:
+                members.exclusive();
+                p.present = DetectionArea_PR_stationarySensorEllipse;
+                read_json(r, p.choice.stationarySensorEllipse);
+                break;
+            case 2:
+                members.exclusive();
+                p.present = DetectionArea_PR_stationarySensorPolygon;
+                read_json(r, p.choice.stationarySensorPolygon);
+                break;
+            case 3:
+                members.exclusive();
+                p.present = DetectionArea_PR_stationarySensorRadial;
+                read_json(r, p.choice.stationarySensorRadial);
+                break;
+            case 4:
+                members.exclusive();
+                p.present = DetectionArea_PR_stationarySensorRectangle;
+                read_json(r, p.choice.stationarySensorRectangle);
+                break;
+            case 5:
+                members.exclusive();
+                p.present = DetectionArea_PR_vehicleSensor;
+                read_json(r, p.choice.vehicleSensor);
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+}
+
+/*
+*   FreeSpaceAddendum - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, FreeSpaceAddendum& p) {
+    static const char* const keys[] = { "freeSpaceArea", "freeSpaceConfidence", "sensorIDList" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.freeSpaceArea));
+                break;
+            case 1:
+                read_json(r, (p.freeSpaceConfidence));
+                break;
+            case 2:
+                p.sensorIDList = vanetza::asn1::allocate<SensorIdList_t>();
+                read_json(r, *(p.sensorIDList));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   CAM - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, CAM& p) {
+    static const char* const keys[] = { "cam", "header" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.cam));
+                break;
+            case 1:
+                read_json(r, (p.header));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VruHighFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruHighFrequencyContainer& p) {
+    static const char* const keys[] = { "curvature", "curvatureCalculationMode", "deviceUsage", "environment", "heading", "lateralAcceleration", "longitudinalAcceleration", "movementControl", "orientation", "rollAngle", "speed", "verticalAcceleration", "vruLanePosition", "yawRate" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.curvature = vanetza::asn1::allocate<Curvature_t>();
+                read_json(r, *(p.curvature));
+                break;
+            case 1:
+                p.curvatureCalculationMode = vanetza::asn1::allocate<CurvatureCalculationMode_t>();
+                read_json(r, *(p.curvatureCalculationMode));
+                break;
+            case 2:
+                p.deviceUsage = vanetza::asn1::allocate<VruDeviceUsage_t>();
+                read_json(r, *(p.deviceUsage));
+                break;
+            case 3:
+                p.environment = vanetza::asn1::allocate<VruEnvironment_t>();
+                read_json(r, *(p.environment));
+                break;
+            case 4:
+                read_json(r, (p.heading));
+                break;
+            case 5:
+                p.lateralAcceleration = vanetza::asn1::allocate<LateralAcceleration_t>();
+                read_json(r, *(p.lateralAcceleration));
+                break;
+            case 6:
+                read_json(r, (p.longitudinalAcceleration));
+                break;
+            case 7:
+                p.movementControl = vanetza::asn1::allocate<VruMovementControl_t>();
+                read_json(r, *(p.movementControl));
+                break;
+            case 8:
+                p.orientation = vanetza::asn1::allocate<VruOrientation_t>();
+                read_json(r, *(p.orientation));
+                break;
+            case 9:
+                p.rollAngle = vanetza::asn1::allocate<VruRollAngle_t>();
+                read_json(r, *(p.rollAngle));
+                break;
+            case 10:
+                read_json(r, (p.speed));
+                break;
+            case 11:
+                p.verticalAcceleration = vanetza::asn1::allocate<VerticalAcceleration_t>();
+                read_json(r, *(p.verticalAcceleration));
+                break;
+            case 12:
+                p.vruLanePosition = vanetza::asn1::allocate<VruLanePosition_t>();
+                read_json(r, *(p.vruLanePosition));
+                break;
+            case 13:
+                p.yawRate = vanetza::asn1::allocate<YawRate_t>();
+                read_json(r, *(p.yawRate));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x450ull);
+}
+
+/*
+*   VruClusterInformationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruClusterInformationContainer& p) {
+    static const char* const keys[] = { "clusterBoundingBoxShape", "clusterCardinalitySize", "clusterId", "clusterProfiles" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.clusterBoundingBoxShape));
+                break;
+            case 1:
+                read_json(r, (p.clusterCardinalitySize));
+                break;
+            case 2:
+                read_json(r, (p.clusterId));
+                break;
+            case 3:
+                read_json_ClusterProfiles(r, (p.clusterProfiles));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xfull);
+}
+
+/*
+*   SPAT - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, SPAT& p) {
+    static const char* const keys[] = { "intersections", "timeStamp" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.intersections));
+                break;
+            case 1:
+                p.timeStamp = vanetza::asn1::allocate<MinuteOfTheYear_t>();
+                read_json(r, *(p.timeStamp));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   GenericLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, GenericLane& p) {
+    static const char* const keys[] = { "connectsTo", "egressApproach", "ingressApproach", "laneAttributes", "laneID", "maneuvers", "nodeList", "overlays" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.connectsTo = vanetza::asn1::allocate<ConnectsToList_t>();
+                read_json(r, *(p.connectsTo));
+                break;
+            case 1:
+                p.egressApproach = vanetza::asn1::allocate<ApproachID_t>();
+                read_json(r, *(p.egressApproach));
+                break;
+            case 2:
+                p.ingressApproach = vanetza::asn1::allocate<ApproachID_t>();
+                read_json(r, *(p.ingressApproach));
+                break;
+            case 3:
+                read_json(r, (p.laneAttributes));
+                break;
+            case 4:
+                read_json(r, (p.laneID));
+                break;
+            case 5:
+                p.maneuvers = vanetza::asn1::allocate<AllowedManeuvers_t>();
+                read_json_AllowedManeuvers(r, *(p.maneuvers));
+                break;
+            case 6:
+                read_json(r, (p.nodeList));
+                break;
+            case 7:
+                p.overlays = vanetza::asn1::allocate<OverlayLaneList_t>();
+                read_json(r, *(p.overlays));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x58ull);
+}
+
+/*
+*   LaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, LaneList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        GenericLane_t* element = vanetza::asn1::allocate<GenericLane_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   RoadLaneSetList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadLaneSetList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        GenericLane_t* element = vanetza::asn1::allocate<GenericLane_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   RoadSegment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadSegment& p) {
+    static const char* const keys[] = { "id", "laneWidth", "refPoint", "revision", "roadLaneSet", "speedLimits" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.id));
+                break;
+            case 1:
+                p.laneWidth = vanetza::asn1::allocate<LaneWidth_t>();
+                read_json(r, *(p.laneWidth));
+                break;
+            case 2:
+                read_json(r, (p.refPoint));
+                break;
+            case 3:
+                read_json(r, (p.revision));
+                break;
+            case 4:
+                read_json(r, (p.roadLaneSet));
+                break;
+            case 5:
+                p.speedLimits = vanetza::asn1::allocate<SpeedLimitList_t>();
+                read_json(r, *(p.speedLimits));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1dull);
+}
+
+/*
+*   RoadSegmentList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadSegmentList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        RoadSegment_t* element = vanetza::asn1::allocate<RoadSegment_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   SensorInformation - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SensorInformation& p) {
+    static const char* const keys[] = { "detectionArea", "freeSpaceConfidence", "sensorID", "type" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.detectionArea));
+                break;
+            case 1:
+                p.freeSpaceConfidence = vanetza::asn1::allocate<FreeSpaceConfidence_t>();
+                read_json(r, *(p.freeSpaceConfidence));
+                break;
+            case 2:
+                read_json(r, (p.sensorID));
+                break;
+            case 3:
+                read_json(r, (p.type));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0xdull);
+}
+
+/*
+*   FreeSpaceAddendumContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, FreeSpaceAddendumContainer& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        FreeSpaceAddendum_t* element = vanetza::asn1::allocate<FreeSpaceAddendum_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   SPATEM - Type SEQUENCE
+*   From SPATEM-PDU-Descriptions - File TS103301v211-SPATEM.asn
+*/
+
+void read_json(JsonReader& r, SPATEM& p) {
+    static const char* const keys[] = { "header", "spat" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.header));
+                break;
+            case 1:
+                read_json(r, (p.spat));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VamParameters - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VamParameters& p) {
+    static const char* const keys[] = { "basicContainer", "vruClusterInformationContainer", "vruClusterOperationContainer", "vruHighFrequencyContainer", "vruLowFrequencyContainer", "vruMotionPredictionContainer" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.basicContainer));
+                break;
+            case 1:
+                p.vruClusterInformationContainer = vanetza::asn1::allocate<VruClusterInformationContainer_t>();
+                read_json(r, *(p.vruClusterInformationContainer));
+                break;
+            case 2:
+                p.vruClusterOperationContainer = vanetza::asn1::allocate<VruClusterOperationContainer_t>();
+                read_json(r, *(p.vruClusterOperationContainer));
+                break;
+            case 3:
+                p.vruHighFrequencyContainer = vanetza::asn1::allocate<VruHighFrequencyContainer_t>();
+                read_json(r, *(p.vruHighFrequencyContainer));
+                break;
+            case 4:
+                p.vruLowFrequencyContainer = vanetza::asn1::allocate<VruLowFrequencyContainer_t>();
+                read_json(r, *(p.vruLowFrequencyContainer));
+                break;
+            case 5:
+                p.vruMotionPredictionContainer = vanetza::asn1::allocate<VruMotionPredictionContainer_t>();
+                read_json(r, *(p.vruMotionPredictionContainer));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1ull);
+}
+
+/*
+*   IntersectionGeometry - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionGeometry& p) {
+    static const char* const keys[] = { "id", "laneSet", "laneWidth", "refPoint", "revision", "speedLimits" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.id));
+                break;
+            case 1:
+                read_json(r, (p.laneSet));
+                break;
+            case 2:
+                p.laneWidth = vanetza::asn1::allocate<LaneWidth_t>();
+                read_json(r, *(p.laneWidth));
+                break;
+            case 3:
+                read_json(r, (p.refPoint));
+                break;
+            case 4:
+                read_json(r, (p.revision));
+                break;
+            case 5:
+                p.speedLimits = vanetza::asn1::allocate<SpeedLimitList_t>();
+                read_json(r, *(p.speedLimits));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x1bull);
+}
+
+/*
+*   IntersectionGeometryList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionGeometryList& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        IntersectionGeometry_t* element = vanetza::asn1::allocate<IntersectionGeometry_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   SensorInformationContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SensorInformationContainer& p) {
+    JsonReader::Elements elements(r);
+    while (elements.next()) {
+        SensorInformation_t* element = vanetza::asn1::allocate<SensorInformation_t>();
+        asn_set_add(&(p.list), element);
+        read_json(r, *element);
+    }
+}
+
+/*
+*   VruAwareness - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruAwareness& p) {
+    static const char* const keys[] = { "generationDeltaTime", "vamParameters" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.generationDeltaTime));
+                break;
+            case 1:
+                read_json(r, (p.vamParameters));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   MapData - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MapData_t& p) {
+    static const char* const keys[] = { "dataParameters", "intersections", "layerID", "layerType", "msgIssueRevision", "restrictionList", "roadSegments", "timeStamp" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.dataParameters = vanetza::asn1::allocate<DataParameters_t>();
+                read_json(r, *(p.dataParameters));
+                break;
+            case 1:
+                p.intersections = vanetza::asn1::allocate<IntersectionGeometryList_t>();
+                read_json(r, *(p.intersections));
+                break;
+            case 2:
+                p.layerID = vanetza::asn1::allocate<LayerID_t>();
+                read_json(r, *(p.layerID));
+                break;
+            case 3:
+                p.layerType = vanetza::asn1::allocate<LayerType_t>();
+                read_json(r, *(p.layerType));
+                break;
+            case 4:
+                read_json(r, (p.msgIssueRevision));
+                break;
+            case 5:
+                p.restrictionList = vanetza::asn1::allocate<RestrictionClassList_t>();
+                read_json(r, *(p.restrictionList));
+                break;
+            case 6:
+                p.roadSegments = vanetza::asn1::allocate<RoadSegmentList_t>();
+                read_json(r, *(p.roadSegments));
+                break;
+            case 7:
+                p.timeStamp = vanetza::asn1::allocate<MinuteOfTheYear_t>();
+                read_json(r, *(p.timeStamp));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x10ull);
+}
+
+/*
+*   CpmParameters - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CpmParameters& p) {
+    static const char* const keys[] = { "freeSpaceAddendumContainer", "managementContainer", "numberOfPerceivedObjects", "perceivedObjectContainer", "sensorInformationContainer", "stationDataContainer" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                p.freeSpaceAddendumContainer = vanetza::asn1::allocate<FreeSpaceAddendumContainer_t>();
+                read_json(r, *(p.freeSpaceAddendumContainer));
+                break;
+            case 1:
+                read_json(r, (p.managementContainer));
+                break;
+            case 2:
+                read_json(r, (p.numberOfPerceivedObjects));
+                break;
+            case 3:
+                p.perceivedObjectContainer = vanetza::asn1::allocate<PerceivedObjectContainer_t>();
+                read_json(r, *(p.perceivedObjectContainer));
+                break;
+            case 4:
+                p.sensorInformationContainer = vanetza::asn1::allocate<SensorInformationContainer_t>();
+                read_json(r, *(p.sensorInformationContainer));
+                break;
+            case 5:
+                p.stationDataContainer = vanetza::asn1::allocate<StationDataContainer_t>();
+                read_json(r, *(p.stationDataContainer));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x6ull);
+}
+
+/*
+*   MAPEM - Type SEQUENCE
+*   From MAPEM-PDU-Descriptions - File TS103301v211-MAPEM.asn
+*/
+
+void read_json(JsonReader& r, MAPEM& p) {
+    static const char* const keys[] = { "header", "map" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.header));
+                break;
+            case 1:
+                read_json(r, (p.map));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   VAM - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VAM& p) {
+    static const char* const keys[] = { "header", "vam" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.header));
+                break;
+            case 1:
+                read_json(r, (p.vam));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   CollectivePerceptionMessage - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CollectivePerceptionMessage& p) {
+    static const char* const keys[] = { "cpmParameters", "generationDeltaTime" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.cpmParameters));
+                break;
+            case 1:
+                read_json(r, (p.generationDeltaTime));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
+
+/*
+*   CPM - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CPM& p) {
+    static const char* const keys[] = { "cpm", "header" };
+    JsonReader::Members members(r, keys);
+    while (members.next()) {
+        switch (members.index()) {
+            case 0:
+                read_json(r, (p.cpm));
+                break;
+            case 1:
+                read_json(r, (p.header));
+                break;
+            default:
+                r.skip();
+                break;
+        }
+    }
+    members.require(0x3ull);
+}
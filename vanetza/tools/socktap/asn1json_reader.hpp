@@ -0,0 +1,1764 @@
+/*
+*   Streaming JSON reader functions filling asn1c structures like the from_json functions without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on 2026-10-16 18:03:43.592380
+*/
+
+#ifndef ASN1_JSON_READER_HPP
+#define ASN1_JSON_READER_HPP
+
+#include "json_reader.hpp"
+#include <type_traits>
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/denm.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/vam.hpp>
+#include <vanetza/asn1/spatem.hpp>
+#include <vanetza/asn1/mapem.hpp>
+
+#include <vanetza/asn1/its/NodeXY.h>
+#include <vanetza/asn1/its/VehicleID.h>
+#include <vanetza/asn1/its/TransitVehicleStatus.h>
+#include <vanetza/asn1/its/TransmissionAndSpeed.h>
+#include <vanetza/asn1/its/DigitalMap.h>
+#include <vanetza/asn1/its/Position3D.h>
+#include <vanetza/asn1/its/IntersectionAccessPoint.h>
+#include <vanetza/asn1/its/ComputedLane.h>
+#include <vanetza/asn1/its/AdvisorySpeedList.h>
+#include <vanetza/asn1/its/ConnectionManeuverAssist.h>
+#include <vanetza/asn1/its/DataParameters.h>
+#include <vanetza/asn1/its/EnabledLaneList.h>
+
+template<typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type read_json(JsonReader& r, T& v) {
+    v = static_cast<T>(r.number());
+}
+
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value>::type read_json(JsonReader& r, T& v) {
+    v = static_cast<T>(r.integer());
+}
+
+void read_json(JsonReader& r, TimestampIts_t& p);
+
+
+/*
+*   ItsPduHeader - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ItsPduHeader_t& p);
+
+
+/*
+*   DeltaReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, DeltaReferencePosition_t& p);
+
+
+/*
+*   Altitude - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Altitude& p);
+
+
+/*
+*   PosConfidenceEllipse - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PosConfidenceEllipse& p);
+
+
+/*
+*   PathPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PathPoint& p);
+
+
+/*
+*   PtActivationData - Type OCTET STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PtActivationData_t& p);
+
+
+/*
+*   AccelerationControl - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_AccelerationControl(JsonReader& r, AccelerationControl_t& p);
+
+
+/*
+*   CauseCode - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, CauseCode& p);
+
+
+/*
+*   Curvature - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Curvature& p);
+
+
+/*
+*   Heading - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Heading& p);
+
+
+/*
+*   DrivingLaneStatus - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_DrivingLaneStatus(JsonReader& r, DrivingLaneStatus_t& p);
+
+
+/*
+*   Speed - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Speed& p);
+
+
+/*
+*   LongitudinalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, LongitudinalAcceleration& p);
+
+
+/*
+*   LateralAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, LateralAcceleration& p);
+
+
+/*
+*   VerticalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, VerticalAcceleration_t& p);
+
+
+/*
+*   ExteriorLights - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_ExteriorLights(JsonReader& r, ExteriorLights_t& p);
+
+
+/*
+*   DangerousGoodsExtended - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, DangerousGoodsExtended& p);
+
+
+/*
+*   SpecialTransportType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_SpecialTransportType(JsonReader& r, SpecialTransportType_t& p);
+
+
+/*
+*   LightBarSirenInUse - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_LightBarSirenInUse(JsonReader& r, LightBarSirenInUse_t& p);
+
+
+/*
+*   PositionOfOccupants - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_PositionOfOccupants(JsonReader& r, PositionOfOccupants_t& p);
+
+
+/*
+*   VehicleIdentification - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, VehicleIdentification& p);
+
+
+/*
+*   EnergyStorageType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_EnergyStorageType(JsonReader& r, EnergyStorageType_t& p);
+
+
+/*
+*   VehicleLength - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, VehicleLength_t& p);
+
+
+/*
+*   PathHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PathHistory& p);
+
+
+/*
+*   EmergencyPriority - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json_EmergencyPriority(JsonReader& r, EmergencyPriority_t& p);
+
+
+/*
+*   SteeringWheelAngle - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, SteeringWheelAngle& p);
+
+
+/*
+*   YawRate - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, YawRate& p);
+
+
+/*
+*   ActionID - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ActionID& p);
+
+
+/*
+*   ProtectedCommunicationZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ProtectedCommunicationZone& p);
+
+
+/*
+*   Traces - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, Traces& p);
+
+
+/*
+*   PositionOfPillars - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PositionOfPillars& p);
+
+
+/*
+*   RestrictedTypes - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, RestrictedTypes& p);
+
+
+/*
+*   EventPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, EventPoint& p);
+
+
+/*
+*   ProtectedCommunicationZonesRSU - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ProtectedCommunicationZonesRSU& p);
+
+
+/*
+*   CenDsrcTollingZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, CenDsrcTollingZone& p);
+
+
+/*
+*   BasicVehicleContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, BasicVehicleContainerHighFrequency& p);
+
+
+/*
+*   BasicVehicleContainerLowFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, BasicVehicleContainerLowFrequency& p);
+
+
+/*
+*   SpecialTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, SpecialTransportContainer& p);
+
+
+/*
+*   DangerousGoodsContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, DangerousGoodsContainer& p);
+
+
+/*
+*   RescueContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, RescueContainer& p);
+
+
+/*
+*   EmergencyContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, EmergencyContainer& p);
+
+
+/*
+*   SafetyCarContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, SafetyCarContainer& p);
+
+
+/*
+*   RSUContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, RSUContainerHighFrequency& p);
+
+
+/*
+*   LocationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, LocationContainer& p);
+
+
+/*
+*   ImpactReductionContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, ImpactReductionContainer& p);
+
+
+/*
+*   StationaryVehicleContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, StationaryVehicleContainer& p);
+
+
+/*
+*   ReferenceDenms - Type SEQUENCE OF
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, ReferenceDenms& p);
+
+
+/*
+*   VruProfileAndSubprofile - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruProfileAndSubprofile& p);
+
+
+/*
+*   VruSpecificExteriorLights - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json_VruSpecificExteriorLights(JsonReader& r, VruSpecificExteriorLights_t& p);
+
+
+/*
+*   ClusterProfiles - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json_ClusterProfiles(JsonReader& r, ClusterProfiles_t& p);
+
+
+/*
+*   ClusterJoinInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterJoinInfo& p);
+
+
+/*
+*   ClusterLeaveInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterLeaveInfo& p);
+
+
+/*
+*   ClusterBreakupInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterBreakupInfo& p);
+
+
+/*
+*   VruSafeDistanceIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruSafeDistanceIndication& p);
+
+
+/*
+*   TrajectoryInterceptionIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, TrajectoryInterceptionIndication& p);
+
+
+/*
+*   HeadingChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, HeadingChangeIndication& p);
+
+
+/*
+*   AccelerationChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, AccelerationChangeIndication& p);
+
+
+/*
+*   StabilityChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, StabilityChangeIndication& p);
+
+
+/*
+*   AdvisorySpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, AdvisorySpeed& p);
+
+
+/*
+*   AdvisorySpeedList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, AdvisorySpeedList_t& p);
+
+
+/*
+*   ComputedLane::ComputedLane__offsetXaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ComputedLane::ComputedLane__offsetXaxis& p);
+
+
+/*
+*   ComputedLane::ComputedLane__offsetYaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ComputedLane::ComputedLane__offsetYaxis& p);
+
+
+/*
+*   ComputedLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ComputedLane_t& p);
+
+
+/*
+*   ConnectionManeuverAssist - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ConnectionManeuverAssist_t& p);
+
+
+/*
+*   DataParameters - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, DataParameters_t& p);
+
+
+/*
+*   EnabledLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, EnabledLaneList_t& p);
+
+
+/*
+*   IntersectionAccessPoint - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionAccessPoint_t& p);
+
+
+/*
+*   IntersectionReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionReferenceID& p);
+
+
+/*
+*   LaneSharing - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneSharing(JsonReader& r, LaneSharing_t& p);
+
+
+/*
+*   ManeuverAssistList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ManeuverAssistList& p);
+
+
+/*
+*   Node-LLmD-64b - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, Node_LLmD_64b& p);
+
+
+/*
+*   OverlayLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, OverlayLaneList& p);
+
+
+/*
+*   Position3D - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, Position3D_t& p);
+
+
+/*
+*   RestrictionUserType - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionUserType& p);
+
+
+/*
+*   RoadSegmentReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadSegmentReferenceID& p);
+
+
+/*
+*   TimeChangeDetails - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, TimeChangeDetails& p);
+
+
+/*
+*   TransmissionAndSpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, TransmissionAndSpeed_t& p);
+
+
+/*
+*   VehicleID - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, VehicleID_t& p);
+
+
+/*
+*   AllowedManeuvers - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_AllowedManeuvers(JsonReader& r, AllowedManeuvers_t& p);
+
+
+/*
+*   IntersectionStatusObject - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_IntersectionStatusObject(JsonReader& r, IntersectionStatusObject_t& p);
+
+
+/*
+*   LaneAttributes-Barrier - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Barrier(JsonReader& r, LaneAttributes_Barrier_t& p);
+
+
+/*
+*   LaneAttributes-Bike - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Bike(JsonReader& r, LaneAttributes_Bike_t& p);
+
+
+/*
+*   LaneAttributes-Crosswalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Crosswalk(JsonReader& r, LaneAttributes_Crosswalk_t& p);
+
+
+/*
+*   LaneAttributes-Parking - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Parking(JsonReader& r, LaneAttributes_Parking_t& p);
+
+
+/*
+*   LaneAttributes-Sidewalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Sidewalk(JsonReader& r, LaneAttributes_Sidewalk_t& p);
+
+
+/*
+*   LaneAttributes-Striping - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Striping(JsonReader& r, LaneAttributes_Striping_t& p);
+
+
+/*
+*   LaneAttributes-TrackedVehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_TrackedVehicle(JsonReader& r, LaneAttributes_TrackedVehicle_t& p);
+
+
+/*
+*   LaneAttributes-Vehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneAttributes_Vehicle(JsonReader& r, LaneAttributes_Vehicle_t& p);
+
+
+/*
+*   LaneDirection - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_LaneDirection(JsonReader& r, LaneDirection_t& p);
+
+
+/*
+*   TransitVehicleStatus - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json_TransitVehicleStatus(JsonReader& r, TransitVehicleStatus_t& p);
+
+
+/*
+*   Node-XY-20b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_20b& p);
+
+
+/*
+*   Node-XY-22b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_22b& p);
+
+
+/*
+*   Node-XY-24b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_24b& p);
+
+
+/*
+*   Node-XY-26b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_26b& p);
+
+
+/*
+*   Node-XY-28b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_28b& p);
+
+
+/*
+*   Node-XY-32b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, Node_XY_32b& p);
+
+
+/*
+*   NodeAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeAttributeXYList& p);
+
+
+/*
+*   RegulatorySpeedLimit - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, RegulatorySpeedLimit& p);
+
+
+/*
+*   SegmentAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, SegmentAttributeXYList& p);
+
+
+/*
+*   SpeedLimitList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, SpeedLimitList& p);
+
+
+/*
+*   OriginatingRSUContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OriginatingRSUContainer& p);
+
+
+/*
+*   VehicleSensorProperties - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSensorProperties& p);
+
+
+/*
+*   ObjectDistanceWithConfidence - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectDistanceWithConfidence& p);
+
+
+/*
+*   ObjectDimension - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectDimension& p);
+
+
+/*
+*   CartesianAngle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CartesianAngle& p);
+
+
+/*
+*   WGS84Angle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, WGS84Angle& p);
+
+
+/*
+*   SpeedExtended - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SpeedExtended& p);
+
+
+/*
+*   SensorIdList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SensorIdList& p);
+
+
+/*
+*   TrailerData - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, TrailerData& p);
+
+
+/*
+*   LongitudinalLanePosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, LongitudinalLanePosition& p);
+
+
+/*
+*   MatchedPosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, MatchedPosition& p);
+
+
+/*
+*   PerceivedObjectContainerSegmentInfo - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PerceivedObjectContainerSegmentInfo& p);
+
+
+/*
+*   VehicleSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSubclass& p);
+
+
+/*
+*   PersonSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PersonSubclass& p);
+
+
+/*
+*   AnimalSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AnimalSubclass& p);
+
+
+/*
+*   OtherSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OtherSubclass& p);
+
+
+/*
+*   NodeOffsetPointZ - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, NodeOffsetPointZ& p);
+
+
+/*
+*   ReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ReferencePosition& p);
+
+
+/*
+*   PtActivation - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, PtActivation& p);
+
+
+/*
+*   ClosedLanes - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ClosedLanes& p);
+
+
+/*
+*   ItineraryPath - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, ItineraryPath& p);
+
+
+/*
+*   EventHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, EventHistory& p);
+
+
+/*
+*   DigitalMap - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void read_json(JsonReader& r, DigitalMap_t& p);
+
+
+/*
+*   HighFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, HighFrequencyContainer& p);
+
+
+/*
+*   LowFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, LowFrequencyContainer& p);
+
+
+/*
+*   BasicContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, BasicContainer& p);
+
+
+/*
+*   PublicTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, PublicTransportContainer& p);
+
+
+/*
+*   RoadWorksContainerBasic - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, RoadWorksContainerBasic& p);
+
+
+/*
+*   ManagementContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, ManagementContainer& p);
+
+
+/*
+*   SituationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, SituationContainer& p);
+
+
+/*
+*   RoadWorksContainerExtended - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, RoadWorksContainerExtended& p);
+
+
+/*
+*   AlacarteContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, AlacarteContainer& p);
+
+
+/*
+*   MapPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, MapPosition& p);
+
+
+/*
+*   VruExteriorLights - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruExteriorLights& p);
+
+
+/*
+*   VruClusterOperationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruClusterOperationContainer& p);
+
+
+/*
+*   VruPathPoint - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruPathPoint& p);
+
+
+/*
+*   SequenceOfVruSafeDistanceIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, SequenceOfVruSafeDistanceIndication& p);
+
+
+/*
+*   SequenceOfTrajectoryInterceptionIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, SequenceOfTrajectoryInterceptionIndication& p);
+
+
+/*
+*   ConnectingLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ConnectingLane& p);
+
+
+/*
+*   Connection - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, Connection& p);
+
+
+/*
+*   LaneTypeAttributes - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, LaneTypeAttributes& p);
+
+
+/*
+*   MovementEvent - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementEvent& p);
+
+
+/*
+*   RestrictionUserTypeList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionUserTypeList& p);
+
+
+/*
+*   LaneDataAttribute - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, LaneDataAttribute& p);
+
+
+/*
+*   LaneDataAttributeList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, LaneDataAttributeList& p);
+
+
+/*
+*   NodeOffsetPointXY - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeOffsetPointXY& p);
+
+
+/*
+*   NodeAttributeSetXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeAttributeSetXY_t& p);
+
+
+/*
+*   CpmManagementContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CpmManagementContainer& p);
+
+
+/*
+*   VehicleSensorPropertyList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSensorPropertyList& p);
+
+
+/*
+*   TrailerDataContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, TrailerDataContainer& p);
+
+
+/*
+*   ObjectClass::ObjectClass__class - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectClass::ObjectClass__class& p);
+
+
+/*
+*   ObjectClass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectClass_t& p);
+
+
+/*
+*   OffsetPoint - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OffsetPoint& p);
+
+
+/*
+*   SpecialVehicleContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, SpecialVehicleContainer& p);
+
+
+/*
+*   DecentralizedEnvironmentalNotificationMessage - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, DecentralizedEnvironmentalNotificationMessage& p);
+
+
+/*
+*   NonIslandLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, NonIslandLanePosition& p);
+
+
+/*
+*   VruLowFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruLowFrequencyContainer& p);
+
+
+/*
+*   SequenceOfVruPathPoint - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, SequenceOfVruPathPoint& p);
+
+
+/*
+*   ConnectsToList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, ConnectsToList& p);
+
+
+/*
+*   LaneAttributes - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, LaneAttributes& p);
+
+
+/*
+*   MovementEventList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementEventList& p);
+
+
+/*
+*   MovementState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementState& p);
+
+
+/*
+*   RestrictionClassAssignment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionClassAssignment& p);
+
+
+/*
+*   RestrictionClassList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RestrictionClassList& p);
+
+
+/*
+*   NodeXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeXY_t& p);
+
+
+/*
+*   OriginatingVehicleContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, OriginatingVehicleContainer& p);
+
+
+/*
+*   VehicleSensor - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, VehicleSensor& p);
+
+
+/*
+*   AreaCircular - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaCircular& p);
+
+
+/*
+*   AreaEllipse - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaEllipse& p);
+
+
+/*
+*   AreaRectangle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaRectangle& p);
+
+
+/*
+*   PolyPointList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PolyPointList& p);
+
+
+/*
+*   AreaRadial - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaRadial& p);
+
+
+/*
+*   ObjectClassDescription - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, ObjectClassDescription& p);
+
+
+/*
+*   CamParameters - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, CamParameters& p);
+
+
+/*
+*   DENM - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void read_json(JsonReader& r, DENM& p);
+
+
+/*
+*   TrafficIslandPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, TrafficIslandPosition& p);
+
+
+/*
+*   VruMotionPredictionContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruMotionPredictionContainer& p);
+
+
+/*
+*   MovementList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MovementList& p);
+
+
+/*
+*   NodeSetXY - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void read_json(JsonReader& r, NodeSetXY& p);
+
+
+/*
+*   StationDataContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, StationDataContainer& p);
+
+
+/*
+*   PerceivedObject - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PerceivedObject& p);
+
+
+/*
+*   AreaPolygon - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, AreaPolygon& p);
+
+
+/*
+*   FreeSpaceArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, FreeSpaceArea& p);
+
+
+/*
+*   CoopAwareness - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, CoopAwareness& p);
+
+
+/*
+*   VruLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruLanePosition& p);
+
+
+/*
+*   ClusterBoundingBoxShape - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, ClusterBoundingBoxShape& p);
+
+
+/*
+*   IntersectionState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionState& p);
+
+
+/*
+*   IntersectionStateList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionStateList& p);
+
+
+/*
+*   NodeListXY - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, NodeListXY& p);
+
+
+/*
+*   PerceivedObjectContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, PerceivedObjectContainer_t& p);
+
+
+/*
+*   DetectionArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, DetectionArea& p);
+
+
+/*
+*   FreeSpaceAddendum - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, FreeSpaceAddendum& p);
+
+
+/*
+*   CAM - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void read_json(JsonReader& r, CAM& p);
+
+
+/*
+*   VruHighFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruHighFrequencyContainer& p);
+
+
+/*
+*   VruClusterInformationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruClusterInformationContainer& p);
+
+
+/*
+*   SPAT - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, SPAT& p);
+
+
+/*
+*   GenericLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, GenericLane& p);
+
+
+/*
+*   LaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, LaneList& p);
+
+
+/*
+*   RoadLaneSetList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadLaneSetList& p);
+
+
+/*
+*   RoadSegment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadSegment& p);
+
+
+/*
+*   RoadSegmentList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, RoadSegmentList& p);
+
+
+/*
+*   SensorInformation - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SensorInformation& p);
+
+
+/*
+*   FreeSpaceAddendumContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, FreeSpaceAddendumContainer& p);
+
+
+/*
+*   SPATEM - Type SEQUENCE
+*   From SPATEM-PDU-Descriptions - File TS103301v211-SPATEM.asn
+*/
+
+void read_json(JsonReader& r, SPATEM& p);
+
+
+/*
+*   VamParameters - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VamParameters& p);
+
+
+/*
+*   IntersectionGeometry - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionGeometry& p);
+
+
+/*
+*   IntersectionGeometryList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, IntersectionGeometryList& p);
+
+
+/*
+*   SensorInformationContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, SensorInformationContainer& p);
+
+
+/*
+*   VruAwareness - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VruAwareness& p);
+
+
+/*
+*   MapData - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void read_json(JsonReader& r, MapData_t& p);
+
+
+/*
+*   CpmParameters - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CpmParameters& p);
+
+
+/*
+*   MAPEM - Type SEQUENCE
+*   From MAPEM-PDU-Descriptions - File TS103301v211-MAPEM.asn
+*/
+
+void read_json(JsonReader& r, MAPEM& p);
+
+
+/*
+*   VAM - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void read_json(JsonReader& r, VAM& p);
+
+
+/*
+*   CollectivePerceptionMessage - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CollectivePerceptionMessage& p);
+
+
+/*
+*   CPM - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void read_json(JsonReader& r, CPM& p);
+
+
+#endif
@@ -0,0 +1,4573 @@
+/*
+*   Streaming JSON writer functions producing the same output as nlohmann::json without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on 2026-10-16 17:35:55.423722
+*/
+
+#include "asn1json_writer.hpp"
+
+void write_json(JsonWriter& w, const TimestampIts_t& p) {
+    long tmp = 0;
+    asn_INTEGER2long(&p, &tmp);
+    w.value(tmp);
+}
+
+
+/*
+*   ItsPduHeader - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ItsPduHeader_t& p) {
+    w.begin_object();
+    w.key("messageID");
+    write_json(w, (p.messageID));
+    w.key("protocolVersion");
+    write_json(w, (p.protocolVersion));
+    w.key("stationID");
+    write_json(w, (p.stationID));
+    w.end_object();
+}
+
+/*
+*   DeltaReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const DeltaReferencePosition_t& p) {
+    w.begin_object();
+    w.key("deltaAltitude");
+    write_json(w, (p.deltaAltitude));
+    w.key("deltaLatitude");
+    write_json(w, (p.deltaLatitude));
+    w.key("deltaLongitude");
+    write_json(w, (p.deltaLongitude));
+    w.end_object();
+}
+
+/*
+*   Altitude - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Altitude& p) {
+    w.begin_object();
+    w.key("altitudeConfidence");
+    write_json(w, (p.altitudeConfidence));
+    w.key("altitudeValue");
+    write_json(w, ((p.altitudeValue) == 800001) ? (p.altitudeValue) : (double)(p.altitudeValue) / 100.0);
+    w.end_object();
+}
+
+/*
+*   PosConfidenceEllipse - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PosConfidenceEllipse& p) {
+    w.begin_object();
+    w.key("semiMajorConfidence");
+    write_json(w, (p.semiMajorConfidence));
+    w.key("semiMajorOrientation");
+    write_json(w, ((p.semiMajorOrientation) == 3601) ? (p.semiMajorOrientation) : (double)(p.semiMajorOrientation) / 10.0);
+    w.key("semiMinorConfidence");
+    write_json(w, (p.semiMinorConfidence));
+    w.end_object();
+}
+
+/*
+*   PathPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PathPoint& p) {
+    w.begin_object();
+    if (p.pathDeltaTime != 0) {
+        w.key("pathDeltaTime");
+        write_json(w, *(p.pathDeltaTime));
+    }
+    w.key("pathPosition");
+    write_json(w, (p.pathPosition));
+    w.end_object();
+}
+
+/*
+*   PtActivationData - Type OCTET STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PtActivationData_t& p) {
+    w.null(); // TODO
+}
+
+/*
+*   AccelerationControl - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_AccelerationControl(JsonWriter& w, const AccelerationControl_t& p) {
+    w.begin_object();
+    w.key("accEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("brakePedalEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("collisionWarningEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("cruiseControlEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("emergencyBrakeEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("gasPedalEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("speedLimiterEngaged");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.end_object();
+}
+
+/*
+*   CauseCode - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const CauseCode& p) {
+    w.begin_object();
+    w.key("causeCode");
+    write_json(w, (p.causeCode));
+    w.key("subCauseCode");
+    write_json(w, (p.subCauseCode));
+    w.end_object();
+}
+
+/*
+*   Curvature - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Curvature& p) {
+    w.begin_object();
+    w.key("curvatureConfidence");
+    write_json(w, (p.curvatureConfidence));
+    w.key("curvatureValue");
+    write_json(w, (p.curvatureValue));
+    w.end_object();
+}
+
+/*
+*   Heading - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Heading& p) {
+    w.begin_object();
+    w.key("headingConfidence");
+    write_json(w, ((p.headingConfidence) == 126 || (p.headingConfidence) == 127) ? (p.headingConfidence) : (double)(p.headingConfidence) / 10.0);
+    w.key("headingValue");
+    write_json(w, ((p.headingValue) == 3601) ? (p.headingValue) : (double)(p.headingValue) / 10.0);
+    w.end_object();
+}
+
+/*
+*   DrivingLaneStatus - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_DrivingLaneStatus(JsonWriter& w, const DrivingLaneStatus_t& p) {
+    w.null();
+}
+
+/*
+*   Speed - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Speed& p) {
+    w.begin_object();
+    w.key("speedConfidence");
+    write_json(w, ((p.speedConfidence) == 126 || (p.speedConfidence) == 127) ? (p.speedConfidence) : (double)(p.speedConfidence) / 100.0);
+    w.key("speedValue");
+    write_json(w, ((p.speedValue) == 16383) ? (p.speedValue) : (double)(p.speedValue) / 100.0);
+    w.end_object();
+}
+
+/*
+*   LongitudinalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const LongitudinalAcceleration& p) {
+    w.begin_object();
+    w.key("longitudinalAccelerationConfidence");
+    write_json(w, ((p.longitudinalAccelerationConfidence) == 102) ? (p.longitudinalAccelerationConfidence) : (double)(p.longitudinalAccelerationConfidence) / 10.0);
+    w.key("longitudinalAccelerationValue");
+    write_json(w, ((p.longitudinalAccelerationValue) == 161) ? (p.longitudinalAccelerationValue) : (double)(p.longitudinalAccelerationValue) / 10.0);
+    w.end_object();
+}
+
+/*
+*   LateralAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const LateralAcceleration& p) {
+    w.begin_object();
+    w.key("lateralAccelerationConfidence");
+    write_json(w, ((p.lateralAccelerationConfidence) == 102) ? (p.lateralAccelerationConfidence) : (double)(p.lateralAccelerationConfidence) / 10.0);
+    w.key("lateralAccelerationValue");
+    write_json(w, ((p.lateralAccelerationValue) == 161) ? (p.lateralAccelerationValue) : (double)(p.lateralAccelerationValue) / 10.0);
+    w.end_object();
+}
+
+/*
+*   VerticalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const VerticalAcceleration_t& p) {
+    w.begin_object();
+    w.key("verticalAccelerationConfidence");
+    write_json(w, ((p.verticalAccelerationConfidence) == 102) ? (p.verticalAccelerationConfidence) : (double)(p.verticalAccelerationConfidence) / 10.0);
+    w.key("verticalAccelerationValue");
+    write_json(w, ((p.verticalAccelerationValue) == 161) ? (p.verticalAccelerationValue) : (double)(p.verticalAccelerationValue) / 10.0);
+    w.end_object();
+}
+
+/*
+*   ExteriorLights - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_ExteriorLights(JsonWriter& w, const ExteriorLights_t& p) {
+    w.begin_object();
+    w.key("daytimeRunningLightsOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("fogLightOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("highBeamHeadlightsOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("leftTurnSignalOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("lowBeamHeadlightsOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("parkingLightsOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("reverseLightOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("rightTurnSignalOn");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.end_object();
+}
+
+/*
+*   DangerousGoodsExtended - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const DangerousGoodsExtended& p) {
+    w.begin_object();
+    if (p.companyName != 0) {
+        w.key("companyName");
+        write_json(w, *(p.companyName));
+    }
+    w.key("dangerousGoodsType");
+    write_json(w, (p.dangerousGoodsType));
+    w.key("elevatedTemperature");
+    write_json(w, (p.elevatedTemperature));
+    if (p.emergencyActionCode != 0) {
+        w.key("emergencyActionCode");
+        write_json(w, *(p.emergencyActionCode));
+    }
+    w.key("limitedQuantity");
+    write_json(w, (p.limitedQuantity));
+    w.key("tunnelsRestricted");
+    write_json(w, (p.tunnelsRestricted));
+    w.key("unNumber");
+    write_json(w, (p.unNumber));
+    w.end_object();
+}
+
+/*
+*   SpecialTransportType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_SpecialTransportType(JsonWriter& w, const SpecialTransportType_t& p) {
+    w.begin_object();
+    w.key("excessHeight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("excessLength");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("excessWidth");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("heavyLoad");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LightBarSirenInUse - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_LightBarSirenInUse(JsonWriter& w, const LightBarSirenInUse_t& p) {
+    w.begin_object();
+    w.key("lightBarActivated");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("sirenActivated");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.end_object();
+}
+
+/*
+*   PositionOfOccupants - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_PositionOfOccupants(JsonWriter& w, const PositionOfOccupants_t& p) {
+    w.begin_object();
+    w.key("row1LeftOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("row1MidOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("row1NotDetectable");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("row1NotPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("row1RightOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("row2LeftOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("row2MidOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("row2NotDetectable");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (8 / 8))) & (1 << ((7 * ((8 / 8) + 1))-(8 % 8)))));
+    w.key("row2NotPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (9 / 8))) & (1 << ((7 * ((9 / 8) + 1))-(9 % 8)))));
+    w.key("row2RightOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("row3LeftOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (10 / 8))) & (1 << ((7 * ((10 / 8) + 1))-(10 % 8)))));
+    w.key("row3MidOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (12 / 8))) & (1 << ((7 * ((12 / 8) + 1))-(12 % 8)))));
+    w.key("row3NotDetectable");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (13 / 8))) & (1 << ((7 * ((13 / 8) + 1))-(13 % 8)))));
+    w.key("row3NotPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (14 / 8))) & (1 << ((7 * ((14 / 8) + 1))-(14 % 8)))));
+    w.key("row3RightOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (11 / 8))) & (1 << ((7 * ((11 / 8) + 1))-(11 % 8)))));
+    w.key("row4LeftOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (15 / 8))) & (1 << ((7 * ((15 / 8) + 1))-(15 % 8)))));
+    w.key("row4MidOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (17 / 8))) & (1 << ((7 * ((17 / 8) + 1))-(17 % 8)))));
+    w.key("row4NotDetectable");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (18 / 8))) & (1 << ((7 * ((18 / 8) + 1))-(18 % 8)))));
+    w.key("row4NotPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (19 / 8))) & (1 << ((7 * ((19 / 8) + 1))-(19 % 8)))));
+    w.key("row4RightOccupied");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (16 / 8))) & (1 << ((7 * ((16 / 8) + 1))-(16 % 8)))));
+    w.end_object();
+}
+
+/*
+*   VehicleIdentification - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleIdentification& p) {
+    w.null();
+}
+
+/*
+*   EnergyStorageType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_EnergyStorageType(JsonWriter& w, const EnergyStorageType_t& p) {
+    w.begin_object();
+    w.key("ammonia");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("compressedNaturalGas");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("diesel");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("electricEnergyStorage");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("gasoline");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("hydrogenStorage");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("liquidPropaneGas");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.end_object();
+}
+
+/*
+*   VehicleLength - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleLength_t& p) {
+    w.begin_object();
+    w.key("vehicleLengthConfidenceIndication");
+    write_json(w, (p.vehicleLengthConfidenceIndication));
+    w.key("vehicleLengthValue");
+    write_json(w, ((p.vehicleLengthValue) == 1023) ? (p.vehicleLengthValue) : (double)(p.vehicleLengthValue) / 10.0);
+    w.end_object();
+}
+
+/*
+*   PathHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PathHistory& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   EmergencyPriority - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_EmergencyPriority(JsonWriter& w, const EmergencyPriority_t& p) {
+    w.begin_object();
+    w.key("requestForFreeCrossingAtATrafficLight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("requestForRightOfWay");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.end_object();
+}
+
+/*
+*   SteeringWheelAngle - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const SteeringWheelAngle& p) {
+    w.begin_object();
+    w.key("steeringWheelAngleConfidence");
+    write_json(w, (p.steeringWheelAngleConfidence));
+    w.key("steeringWheelAngleValue");
+    write_json(w, (p.steeringWheelAngleValue));
+    w.end_object();
+}
+
+/*
+*   YawRate - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const YawRate& p) {
+    w.begin_object();
+    w.key("yawRateConfidence");
+    write_json(w, (p.yawRateConfidence));
+    w.key("yawRateValue");
+    write_json(w, ((p.yawRateValue) == 32767) ? (p.yawRateValue) : (double)(p.yawRateValue) / 100.0);
+    w.end_object();
+}
+
+/*
+*   ActionID - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ActionID& p) {
+    w.begin_object();
+    w.key("originatingStationID");
+    write_json(w, (p.originatingStationID));
+    w.key("sequenceNumber");
+    write_json(w, (p.sequenceNumber));
+    w.end_object();
+}
+
+/*
+*   ProtectedCommunicationZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ProtectedCommunicationZone& p) {
+    w.begin_object();
+    if (p.protectedZoneID != 0) {
+        w.key("protectedZoneID");
+        write_json(w, *(p.protectedZoneID));
+    }
+    w.key("protectedZoneLatitude");
+    write_json(w, ((p.protectedZoneLatitude) == 900000001) ? (p.protectedZoneLatitude) : (double)(p.protectedZoneLatitude) / 10000000.0);
+    w.key("protectedZoneLongitude");
+    write_json(w, ((p.protectedZoneLongitude) == 1800000001) ? (p.protectedZoneLongitude) : (double)(p.protectedZoneLongitude) / 10000000.0);
+    if (p.protectedZoneRadius != 0) {
+        w.key("protectedZoneRadius");
+        write_json(w, *(p.protectedZoneRadius));
+    }
+    w.key("protectedZoneType");
+    write_json(w, (p.protectedZoneType));
+    w.end_object();
+}
+
+/*
+*   Traces - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Traces& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   PositionOfPillars - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PositionOfPillars& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   RestrictedTypes - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictedTypes& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   EventPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const EventPoint& p) {
+    w.begin_object();
+    if (p.eventDeltaTime != 0) {
+        w.key("eventDeltaTime");
+        write_json(w, *(p.eventDeltaTime));
+    }
+    w.key("eventPosition");
+    write_json(w, (p.eventPosition));
+    w.key("informationQuality");
+    write_json(w, (p.informationQuality));
+    w.end_object();
+}
+
+/*
+*   ProtectedCommunicationZonesRSU - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ProtectedCommunicationZonesRSU& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   CenDsrcTollingZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const CenDsrcTollingZone& p) {
+    w.begin_object();
+    if (p.cenDsrcTollingZoneID != 0) {
+        w.key("cenDsrcTollingZoneID");
+        write_json(w, *(p.cenDsrcTollingZoneID));
+    }
+    w.key("protectedZoneLatitude");
+    write_json(w, ((p.protectedZoneLatitude) == 900000001) ? (p.protectedZoneLatitude) : (double)(p.protectedZoneLatitude) / 10000000.0);
+    w.key("protectedZoneLongitude");
+    write_json(w, ((p.protectedZoneLongitude) == 1800000001) ? (p.protectedZoneLongitude) : (double)(p.protectedZoneLongitude) / 10000000.0);
+    w.end_object();
+}
+
+/*
+*   BasicVehicleContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const BasicVehicleContainerHighFrequency& p) {
+    w.begin_object();
+    if (p.accelerationControl != 0) {
+        w.key("accelerationControl");
+        write_json_AccelerationControl(w, *(p.accelerationControl));
+    }
+    if (p.cenDsrcTollingZone != 0) {
+        w.key("cenDsrcTollingZone");
+        write_json(w, *(p.cenDsrcTollingZone));
+    }
+    w.key("curvature");
+    write_json(w, (p.curvature));
+    w.key("curvatureCalculationMode");
+    write_json(w, (p.curvatureCalculationMode));
+    w.key("driveDirection");
+    write_json(w, (p.driveDirection));
+    w.key("heading");
+    write_json(w, (p.heading));
+    if (p.lanePosition != 0) {
+        w.key("lanePosition");
+        write_json(w, *(p.lanePosition));
+    }
+    if (p.lateralAcceleration != 0) {
+        w.key("lateralAcceleration");
+        write_json(w, *(p.lateralAcceleration));
+    }
+    w.key("longitudinalAcceleration");
+    write_json(w, (p.longitudinalAcceleration));
+    if (p.performanceClass != 0) {
+        w.key("performanceClass");
+        write_json(w, *(p.performanceClass));
+    }
+    w.key("speed");
+    write_json(w, (p.speed));
+    if (p.steeringWheelAngle != 0) {
+        w.key("steeringWheelAngle");
+        write_json(w, *(p.steeringWheelAngle));
+    }
+    w.key("vehicleLength");
+    write_json(w, (p.vehicleLength));
+    w.key("vehicleWidth");
+    write_json(w, ((p.vehicleWidth) == 61 || (p.vehicleWidth) == 62) ? (p.vehicleWidth) : (double)(p.vehicleWidth) / 10.0);
+    if (p.verticalAcceleration != 0) {
+        w.key("verticalAcceleration");
+        write_json(w, *(p.verticalAcceleration));
+    }
+    w.key("yawRate");
+    write_json(w, (p.yawRate));
+    w.end_object();
+}
+
+/*
+*   BasicVehicleContainerLowFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const BasicVehicleContainerLowFrequency& p) {
+    w.begin_object();
+    w.key("exteriorLights");
+    write_json_ExteriorLights(w, (p.exteriorLights));
+    w.key("pathHistory");
+    write_json(w, (p.pathHistory));
+    w.key("vehicleRole");
+    write_json(w, (p.vehicleRole));
+    w.end_object();
+}
+
+/*
+*   SpecialTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const SpecialTransportContainer& p) {
+    w.begin_object();
+    w.key("lightBarSirenInUse");
+    write_json_LightBarSirenInUse(w, (p.lightBarSirenInUse));
+    w.key("specialTransportType");
+    write_json_SpecialTransportType(w, (p.specialTransportType));
+    w.end_object();
+}
+
+/*
+*   DangerousGoodsContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const DangerousGoodsContainer& p) {
+    w.begin_object();
+    w.key("dangerousGoodsBasic");
+    write_json(w, (p.dangerousGoodsBasic));
+    w.end_object();
+}
+
+/*
+*   RescueContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const RescueContainer& p) {
+    w.begin_object();
+    w.key("lightBarSirenInUse");
+    write_json_LightBarSirenInUse(w, (p.lightBarSirenInUse));
+    w.end_object();
+}
+
+/*
+*   EmergencyContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const EmergencyContainer& p) {
+    w.begin_object();
+    if (p.emergencyPriority != 0) {
+        w.key("emergencyPriority");
+        write_json_EmergencyPriority(w, *(p.emergencyPriority));
+    }
+    if (p.incidentIndication != 0) {
+        w.key("incidentIndication");
+        write_json(w, *(p.incidentIndication));
+    }
+    w.key("lightBarSirenInUse");
+    write_json_LightBarSirenInUse(w, (p.lightBarSirenInUse));
+    w.end_object();
+}
+
+/*
+*   SafetyCarContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const SafetyCarContainer& p) {
+    w.begin_object();
+    if (p.incidentIndication != 0) {
+        w.key("incidentIndication");
+        write_json(w, *(p.incidentIndication));
+    }
+    w.key("lightBarSirenInUse");
+    write_json_LightBarSirenInUse(w, (p.lightBarSirenInUse));
+    if (p.speedLimit != 0) {
+        w.key("speedLimit");
+        write_json(w, *(p.speedLimit));
+    }
+    if (p.trafficRule != 0) {
+        w.key("trafficRule");
+        write_json(w, *(p.trafficRule));
+    }
+    w.end_object();
+}
+
+/*
+*   RSUContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const RSUContainerHighFrequency& p) {
+    if (!(p.protectedCommunicationZonesRSU != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.protectedCommunicationZonesRSU != 0) {
+        w.key("protectedCommunicationZonesRSU");
+        write_json(w, *(p.protectedCommunicationZonesRSU));
+    }
+    w.end_object();
+}
+
+/*
+*   LocationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const LocationContainer& p) {
+    w.begin_object();
+    if (p.eventPositionHeading != 0) {
+        w.key("eventPositionHeading");
+        write_json(w, *(p.eventPositionHeading));
+    }
+    if (p.eventSpeed != 0) {
+        w.key("eventSpeed");
+        write_json(w, *(p.eventSpeed));
+    }
+    if (p.roadType != 0) {
+        w.key("roadType");
+        write_json(w, *(p.roadType));
+    }
+    w.key("traces");
+    write_json(w, (p.traces));
+    w.end_object();
+}
+
+/*
+*   ImpactReductionContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const ImpactReductionContainer& p) {
+    w.begin_object();
+    w.key("heightLonCarrLeft");
+    write_json(w, (p.heightLonCarrLeft));
+    w.key("heightLonCarrRight");
+    write_json(w, (p.heightLonCarrRight));
+    w.key("posCentMass");
+    write_json(w, (p.posCentMass));
+    w.key("posFrontAx");
+    write_json(w, (p.posFrontAx));
+    w.key("posLonCarrLeft");
+    write_json(w, (p.posLonCarrLeft));
+    w.key("posLonCarrRight");
+    write_json(w, (p.posLonCarrRight));
+    w.key("positionOfOccupants");
+    write_json_PositionOfOccupants(w, (p.positionOfOccupants));
+    w.key("positionOfPillars");
+    write_json(w, (p.positionOfPillars));
+    w.key("requestResponseIndication");
+    write_json(w, (p.requestResponseIndication));
+    w.key("turningRadius");
+    write_json(w, (p.turningRadius));
+    w.key("vehicleMass");
+    write_json(w, (p.vehicleMass));
+    w.key("wheelBaseVehicle");
+    write_json(w, (p.wheelBaseVehicle));
+    w.end_object();
+}
+
+/*
+*   StationaryVehicleContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const StationaryVehicleContainer& p) {
+    if (!(p.carryingDangerousGoods != 0 || p.energyStorageType != 0 || p.numberOfOccupants != 0 || p.stationaryCause != 0 || p.stationarySince != 0 || p.vehicleIdentification != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.carryingDangerousGoods != 0) {
+        w.key("carryingDangerousGoods");
+        write_json(w, *(p.carryingDangerousGoods));
+    }
+    if (p.energyStorageType != 0) {
+        w.key("energyStorageType");
+        write_json_EnergyStorageType(w, *(p.energyStorageType));
+    }
+    if (p.numberOfOccupants != 0) {
+        w.key("numberOfOccupants");
+        write_json(w, *(p.numberOfOccupants));
+    }
+    if (p.stationaryCause != 0) {
+        w.key("stationaryCause");
+        write_json(w, *(p.stationaryCause));
+    }
+    if (p.stationarySince != 0) {
+        w.key("stationarySince");
+        write_json(w, *(p.stationarySince));
+    }
+    if (p.vehicleIdentification != 0) {
+        w.key("vehicleIdentification");
+        write_json(w, *(p.vehicleIdentification));
+    }
+    w.end_object();
+}
+
+/*
+*   ReferenceDenms - Type SEQUENCE OF
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const ReferenceDenms& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   VruProfileAndSubprofile - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruProfileAndSubprofile& p) {
+    if (p.present == VruProfileAndSubprofile_PR_pedestrian) {
+        w.begin_object();
+        w.key("pedestrian");
+        write_json(w, p.choice.pedestrian);
+        w.end_object();
+    } else if (p.present == VruProfileAndSubprofile_PR_bicyclist) {
+        w.begin_object();
+        w.key("bicyclist");
+        write_json(w, p.choice.bicyclist);
+        w.end_object();
+    } else if (p.present == VruProfileAndSubprofile_PR_motorcylist) {
+        w.begin_object();
+        w.key("motorcylist");
+        write_json(w, p.choice.motorcylist);
+        w.end_object();
+    } else if (p.present == VruProfileAndSubprofile_PR_animal) {
+        w.begin_object();
+        w.key("animal");
+        write_json(w, p.choice.animal);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   VruSpecificExteriorLights - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json_VruSpecificExteriorLights(JsonWriter& w, const VruSpecificExteriorLights_t& p) {
+    w.begin_object();
+    w.key("armLight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("backFlashLight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("helmetLight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("legLight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("unavailable");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("wheelLight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.end_object();
+}
+
+/*
+*   ClusterProfiles - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json_ClusterProfiles(JsonWriter& w, const ClusterProfiles_t& p) {
+    w.begin_object();
+    w.key("animal");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("bicyclist");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("motorcyclist");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("pedestrian");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.end_object();
+}
+
+/*
+*   ClusterJoinInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterJoinInfo& p) {
+    w.begin_object();
+    w.key("clusterId");
+    write_json(w, (p.clusterId));
+    w.key("joinTime");
+    write_json(w, (p.joinTime));
+    w.end_object();
+}
+
+/*
+*   ClusterLeaveInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterLeaveInfo& p) {
+    w.begin_object();
+    w.key("clusterId");
+    write_json(w, (p.clusterId));
+    w.key("clusterLeaveReason");
+    write_json(w, (p.clusterLeaveReason));
+    w.end_object();
+}
+
+/*
+*   ClusterBreakupInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterBreakupInfo& p) {
+    w.begin_object();
+    w.key("breakupTime");
+    write_json(w, (p.breakupTime));
+    w.key("clusterBreakupReason");
+    write_json(w, (p.clusterBreakupReason));
+    w.end_object();
+}
+
+/*
+*   VruSafeDistanceIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruSafeDistanceIndication& p) {
+    w.begin_object();
+    w.key("stationSafeDistanceIndication");
+    write_json(w, (p.stationSafeDistanceIndication));
+    if (p.subjectStation != 0) {
+        w.key("subjectStation");
+        write_json(w, *(p.subjectStation));
+    }
+    if (p.timeToCollision != 0) {
+        w.key("timeToCollision");
+        write_json(w, *(p.timeToCollision));
+    }
+    w.end_object();
+}
+
+/*
+*   TrajectoryInterceptionIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const TrajectoryInterceptionIndication& p) {
+    w.begin_object();
+    if (p.subjectStation != 0) {
+        w.key("subjectStation");
+        write_json(w, *(p.subjectStation));
+    }
+    if (p.trajectoryInterceptionConfidence != 0) {
+        w.key("trajectoryInterceptionConfidence");
+        write_json(w, *(p.trajectoryInterceptionConfidence));
+    }
+    w.key("trajectoryInterceptionProbability");
+    write_json(w, (p.trajectoryInterceptionProbability));
+    w.end_object();
+}
+
+/*
+*   HeadingChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const HeadingChangeIndication& p) {
+    w.begin_object();
+    w.key("actionDeltaTime");
+    write_json(w, (p.actionDeltaTime));
+    w.key("direction");
+    write_json(w, (p.direction));
+    w.end_object();
+}
+
+/*
+*   AccelerationChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const AccelerationChangeIndication& p) {
+    w.begin_object();
+    w.key("accelOrDecel");
+    write_json(w, (p.accelOrDecel));
+    w.key("actionDeltaTime");
+    write_json(w, (p.actionDeltaTime));
+    w.end_object();
+}
+
+/*
+*   StabilityChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const StabilityChangeIndication& p) {
+    w.begin_object();
+    w.key("actionDeltaTime");
+    write_json(w, (p.actionDeltaTime));
+    w.key("lossProbability");
+    write_json(w, (p.lossProbability));
+    w.end_object();
+}
+
+/*
+*   AdvisorySpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const AdvisorySpeed& p) {
+    w.begin_object();
+    if (p.Class != 0) {
+        w.key("class");
+        write_json(w, *(p.Class));
+    }
+    if (p.confidence != 0) {
+        w.key("confidence");
+        write_json(w, (*(p.confidence) != 126 && *(p.confidence) != 127) ? *(p.confidence) : (double) *(p.confidence) / 100.0);
+    }
+    if (p.distance != 0) {
+        w.key("distance");
+        write_json(w, *(p.distance));
+    }
+    if (p.speed != 0) {
+        w.key("speed");
+        write_json(w, *(p.speed));
+    }
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   AdvisorySpeedList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const AdvisorySpeedList_t& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   ComputedLane::ComputedLane__offsetXaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ComputedLane::ComputedLane__offsetXaxis& p) {
+    if (p.present == ComputedLane__offsetXaxis_PR_small) {
+        w.begin_object();
+        w.key("small");
+        write_json(w, p.choice.small);
+        w.end_object();
+    } else if (p.present == ComputedLane__offsetXaxis_PR_large) {
+        w.begin_object();
+        w.key("large");
+        write_json(w, p.choice.large);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   ComputedLane::ComputedLane__offsetYaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ComputedLane::ComputedLane__offsetYaxis& p) {
+    if (p.present == ComputedLane__offsetYaxis_PR_small) {
+        w.begin_object();
+        w.key("small");
+        write_json(w, p.choice.small);
+        w.end_object();
+    } else if (p.present == ComputedLane__offsetYaxis_PR_large) {
+        w.begin_object();
+        w.key("large");
+        write_json(w, p.choice.large);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   ComputedLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ComputedLane_t& p) {
+    w.begin_object();
+    w.key("offsetXaxis");
+    write_json(w, (p.offsetXaxis));
+    w.key("offsetYaxis");
+    write_json(w, (p.offsetYaxis));
+    w.key("referenceLaneId");
+    write_json(w, (p.referenceLaneId));
+    if (p.rotateXY != 0) {
+        w.key("rotateXY");
+        write_json(w, *(p.rotateXY));
+    }
+    if (p.scaleXaxis != 0) {
+        w.key("scaleXaxis");
+        write_json(w, *(p.scaleXaxis));
+    }
+    if (p.scaleYaxis != 0) {
+        w.key("scaleYaxis");
+        write_json(w, *(p.scaleYaxis));
+    }
+    w.end_object();
+}
+
+/*
+*   ConnectionManeuverAssist - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ConnectionManeuverAssist_t& p) {
+    w.begin_object();
+    if (p.availableStorageLength != 0) {
+        w.key("availableStorageLength");
+        write_json(w, *(p.availableStorageLength));
+    }
+    w.key("connectionID");
+    write_json(w, (p.connectionID));
+    if (p.pedBicycleDetect != 0) {
+        w.key("pedBicycleDetect");
+        write_json(w, *(p.pedBicycleDetect));
+    }
+    if (p.queueLength != 0) {
+        w.key("queueLength");
+        write_json(w, *(p.queueLength));
+    }
+    if (p.waitOnStop != 0) {
+        w.key("waitOnStop");
+        write_json(w, *(p.waitOnStop));
+    }
+    w.end_object();
+}
+
+/*
+*   DataParameters - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const DataParameters_t& p) {
+    if (!(p.geoidUsed != 0 || p.lastCheckedDate != 0 || p.processAgency != 0 || p.processMethod != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.geoidUsed != 0) {
+        w.key("geoidUsed");
+        write_json(w, *(p.geoidUsed));
+    }
+    if (p.lastCheckedDate != 0) {
+        w.key("lastCheckedDate");
+        write_json(w, *(p.lastCheckedDate));
+    }
+    if (p.processAgency != 0) {
+        w.key("processAgency");
+        write_json(w, *(p.processAgency));
+    }
+    if (p.processMethod != 0) {
+        w.key("processMethod");
+        write_json(w, *(p.processMethod));
+    }
+    w.end_object();
+}
+
+/*
+*   EnabledLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const EnabledLaneList_t& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   IntersectionAccessPoint - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionAccessPoint_t& p) {
+    if (p.present == IntersectionAccessPoint_PR_lane) {
+        w.begin_object();
+        w.key("lane");
+        write_json(w, p.choice.lane);
+        w.end_object();
+    } else if (p.present == IntersectionAccessPoint_PR_approach) {
+        w.begin_object();
+        w.key("approach");
+        write_json(w, p.choice.approach);
+        w.end_object();
+    } else if (p.present == IntersectionAccessPoint_PR_connection) {
+        w.begin_object();
+        w.key("connection");
+        write_json(w, p.choice.connection);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   IntersectionReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionReferenceID& p) {
+    w.begin_object();
+    w.key("id");
+    write_json(w, (p.id));
+    if (p.region != 0) {
+        w.key("region");
+        write_json(w, *(p.region));
+    }
+    w.end_object();
+}
+
+/*
+*   LaneSharing - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneSharing(JsonWriter& w, const LaneSharing_t& p) {
+    w.begin_object();
+    w.key("busVehicleTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("cyclistVehicleTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("individualMotorizedVehicleTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("multipleLanesTreatedAsOneLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("otherNonMotorizedTrafficTypes");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("overlappingLaneDescriptionProvided");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("pedestrianTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (9 / 8))) & (1 << ((7 * ((9 / 8) + 1))-(9 % 8)))));
+    w.key("pedestriansTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("taxiVehicleTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("trackedVehicleTraffic");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (8 / 8))) & (1 << ((7 * ((8 / 8) + 1))-(8 % 8)))));
+    w.end_object();
+}
+
+/*
+*   ManeuverAssistList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ManeuverAssistList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   Node-LLmD-64b - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const Node_LLmD_64b& p) {
+    w.begin_object();
+    w.key("lat");
+    write_json(w, ((p.lat) == 900000001) ? (p.lat) : (double)(p.lat) / 10000000.0);
+    w.key("lon");
+    write_json(w, ((p.lon) == 1800000001) ? (p.lon) : (double)(p.lon) / 10000000.0);
+    w.end_object();
+}
+
+/*
+*   OverlayLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const OverlayLaneList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   Position3D - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const Position3D_t& p) {
+    w.begin_object();
+    if (p.elevation != 0) {
+        w.key("elevation");
+        write_json(w, *(p.elevation));
+    }
+    w.key("lat");
+    write_json(w, ((p.lat) == 900000001) ? (p.lat) : (double)(p.lat) / 10000000.0);
+    w.key("long");
+    write_json(w, ((p.Long) == 1800000001) ? (p.Long) : (double)(p.Long) / 10000000.0);
+    w.end_object();
+}
+
+/*
+*   RestrictionUserType - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionUserType& p) {
+    if (p.present == RestrictionUserType_PR_basicType) {
+        w.begin_object();
+        w.key("basicType");
+        write_json(w, p.choice.basicType);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   RoadSegmentReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadSegmentReferenceID& p) {
+    w.begin_object();
+    w.key("id");
+    write_json(w, (p.id));
+    if (p.region != 0) {
+        w.key("region");
+        write_json(w, *(p.region));
+    }
+    w.end_object();
+}
+
+/*
+*   TimeChangeDetails - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const TimeChangeDetails& p) {
+    w.begin_object();
+    if (p.confidence != 0) {
+        w.key("confidence");
+        write_json(w, *(p.confidence));
+    }
+    if (p.likelyTime != 0) {
+        w.key("likelyTime");
+        write_json(w, *(p.likelyTime));
+    }
+    if (p.maxEndTime != 0) {
+        w.key("maxEndTime");
+        write_json(w, *(p.maxEndTime));
+    }
+    w.key("minEndTime");
+    write_json(w, (p.minEndTime));
+    if (p.nextTime != 0) {
+        w.key("nextTime");
+        write_json(w, *(p.nextTime));
+    }
+    if (p.startTime != 0) {
+        w.key("startTime");
+        write_json(w, *(p.startTime));
+    }
+    w.end_object();
+}
+
+/*
+*   TransmissionAndSpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const TransmissionAndSpeed_t& p) {
+    w.begin_object();
+    w.key("speed");
+    write_json(w, (p.speed));
+    w.key("transmisson");
+    write_json(w, (p.transmisson));
+    w.end_object();
+}
+
+/*
+*   VehicleID - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleID_t& p) {
+    if (p.present == VehicleID_PR_stationID) {
+        w.begin_object();
+        w.key("stationID");
+        write_json(w, p.choice.stationID);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   AllowedManeuvers - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_AllowedManeuvers(JsonWriter& w, const AllowedManeuvers_t& p) {
+    w.begin_object();
+    w.key("caution");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (10 / 8))) & (1 << ((7 * ((10 / 8) + 1))-(10 % 8)))));
+    w.key("goWithHalt");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (9 / 8))) & (1 << ((7 * ((9 / 8) + 1))-(9 % 8)))));
+    w.key("maneuverLaneChangeAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("maneuverLeftAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("maneuverLeftTurnOnRedAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("maneuverNoStoppingAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("maneuverRightAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("maneuverRightTurnOnRedAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("maneuverStraightAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("maneuverUTurnAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("reserved1");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (11 / 8))) & (1 << ((7 * ((11 / 8) + 1))-(11 % 8)))));
+    w.key("yieldAllwaysRequired");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (8 / 8))) & (1 << ((7 * ((8 / 8) + 1))-(8 % 8)))));
+    w.end_object();
+}
+
+/*
+*   IntersectionStatusObject - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_IntersectionStatusObject(JsonWriter& w, const IntersectionStatusObject_t& p) {
+    w.begin_object();
+    w.key("failureFlash");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("failureMode");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (8 / 8))) & (1 << ((7 * ((8 / 8) + 1))-(8 % 8)))));
+    w.key("fixedTimeOperation");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("manualControlIsEnabled");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("noValidMAPisAvailableAtThisTime");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (12 / 8))) & (1 << ((7 * ((12 / 8) + 1))-(12 % 8)))));
+    w.key("noValidSPATisAvailableAtThisTime");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (13 / 8))) & (1 << ((7 * ((13 / 8) + 1))-(13 % 8)))));
+    w.key("off");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (9 / 8))) & (1 << ((7 * ((9 / 8) + 1))-(9 % 8)))));
+    w.key("preemptIsActive");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("recentChangeInMAPassignedLanesIDsUsed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (11 / 8))) & (1 << ((7 * ((11 / 8) + 1))-(11 % 8)))));
+    w.key("recentMAPmessageUpdate");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (10 / 8))) & (1 << ((7 * ((10 / 8) + 1))-(10 % 8)))));
+    w.key("signalPriorityIsActive");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("standbyOperation");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("stopTimeIsActivated");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("trafficDependentOperation");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Barrier - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Barrier(JsonWriter& w, const LaneAttributes_Barrier_t& p) {
+    w.begin_object();
+    w.key("constructionBarrier");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("doubleStripedLines");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("highCurbs");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (9 / 8))) & (1 << ((7 * ((9 / 8) + 1))-(9 % 8)))));
+    w.key("lowCurbs");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (8 / 8))) & (1 << ((7 * ((8 / 8) + 1))-(8 % 8)))));
+    w.key("median");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("median-RevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("stripedLines");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("trafficChannels");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("trafficCones");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("whiteLineHashing");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Bike - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Bike(JsonWriter& w, const LaneAttributes_Bike_t& p) {
+    w.begin_object();
+    w.key("biDirectionalCycleTimes");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("bikeRevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("fixedCycleTime");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("isBikeFlyOverLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("isolatedByBarrier");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("pedestrianUseAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("unsignalizedSegmentsPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Crosswalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Crosswalk(JsonWriter& w, const LaneAttributes_Crosswalk_t& p) {
+    w.begin_object();
+    w.key("audioSupport");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("biDirectionalCycleTimes");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("bicyleUseAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("crosswalkRevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("fixedCycleTime");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("hasPushToWalkButton");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("isXwalkFlyOverLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("rfSignalRequestPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("unsignalizedSegmentsPresent");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (8 / 8))) & (1 << ((7 * ((8 / 8) + 1))-(8 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Parking - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Parking(JsonWriter& w, const LaneAttributes_Parking_t& p) {
+    w.begin_object();
+    w.key("doNotParkZone");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("headInParkingInUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("noPublicParkingUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("parallelParkingInUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("parkingForBusUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("parkingForTaxiUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("parkingRevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Sidewalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Sidewalk(JsonWriter& w, const LaneAttributes_Sidewalk_t& p) {
+    w.begin_object();
+    w.key("bicyleUseAllowed");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("isSidewalkFlyOverLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("sidewalk-RevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("walkBikes");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Striping - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Striping(JsonWriter& w, const LaneAttributes_Striping_t& p) {
+    w.begin_object();
+    w.key("stripeDrawOnLeft");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("stripeDrawOnRight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("stripeToConnectingLanesAhead");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("stripeToConnectingLanesLeft");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("stripeToConnectingLanesRevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("stripeToConnectingLanesRight");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-TrackedVehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_TrackedVehicle(JsonWriter& w, const LaneAttributes_TrackedVehicle_t& p) {
+    w.begin_object();
+    w.key("spec-RevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("spec-commuterRailRoadTrack");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("spec-heavyRailRoadTrack");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("spec-lightRailRoadTrack");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("spec-otherRailType");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneAttributes-Vehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Vehicle(JsonWriter& w, const LaneAttributes_Vehicle_t& p) {
+    w.begin_object();
+    w.key("hasIRbeaconCoverage");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (6 / 8))) & (1 << ((7 * ((6 / 8) + 1))-(6 % 8)))));
+    w.key("hovLaneUseOnly");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("isVehicleFlyOverLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("isVehicleRevocableLane");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.key("permissionOnRequest");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (7 / 8))) & (1 << ((7 * ((7 / 8) + 1))-(7 % 8)))));
+    w.key("restrictedFromPublicUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("restrictedToBusUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("restrictedToTaxiUse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.end_object();
+}
+
+/*
+*   LaneDirection - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneDirection(JsonWriter& w, const LaneDirection_t& p) {
+    w.begin_object();
+    w.key("egressPath");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("ingressPath");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.end_object();
+}
+
+/*
+*   TransitVehicleStatus - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_TransitVehicleStatus(JsonWriter& w, const TransitVehicleStatus_t& p) {
+    w.begin_object();
+    w.key("aBikeLoad");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (2 / 8))) & (1 << ((7 * ((2 / 8) + 1))-(2 % 8)))));
+    w.key("anADAuse");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (1 / 8))) & (1 << ((7 * ((1 / 8) + 1))-(1 % 8)))));
+    w.key("atStopLine");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (5 / 8))) & (1 << ((7 * ((5 / 8) + 1))-(5 % 8)))));
+    w.key("charging");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (4 / 8))) & (1 << ((7 * ((4 / 8) + 1))-(4 % 8)))));
+    w.key("doorOpen");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (3 / 8))) & (1 << ((7 * ((3 / 8) + 1))-(3 % 8)))));
+    w.key("loading");
+    w.value((bool) (*(p.buf + (sizeof(uint8_t) * (0 / 8))) & (1 << ((7 * ((0 / 8) + 1))-(0 % 8)))));
+    w.end_object();
+}
+
+/*
+*   Node-XY-20b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_20b& p) {
+    w.begin_object();
+    w.key("x");
+    write_json(w, (p.x));
+    w.key("y");
+    write_json(w, (p.y));
+    w.end_object();
+}
+
+/*
+*   Node-XY-22b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_22b& p) {
+    w.begin_object();
+    w.key("x");
+    write_json(w, (p.x));
+    w.key("y");
+    write_json(w, (p.y));
+    w.end_object();
+}
+
+/*
+*   Node-XY-24b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_24b& p) {
+    w.begin_object();
+    w.key("x");
+    write_json(w, (p.x));
+    w.key("y");
+    write_json(w, (p.y));
+    w.end_object();
+}
+
+/*
+*   Node-XY-26b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_26b& p) {
+    w.begin_object();
+    w.key("x");
+    write_json(w, (p.x));
+    w.key("y");
+    write_json(w, (p.y));
+    w.end_object();
+}
+
+/*
+*   Node-XY-28b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_28b& p) {
+    w.begin_object();
+    w.key("x");
+    write_json(w, (p.x));
+    w.key("y");
+    write_json(w, (p.y));
+    w.end_object();
+}
+
+/*
+*   Node-XY-32b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_32b& p) {
+    w.begin_object();
+    w.key("x");
+    write_json(w, (p.x));
+    w.key("y");
+    write_json(w, (p.y));
+    w.end_object();
+}
+
+/*
+*   NodeAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeAttributeXYList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   RegulatorySpeedLimit - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const RegulatorySpeedLimit& p) {
+    w.begin_object();
+    w.key("speed");
+    write_json(w, (p.speed));
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   SegmentAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const SegmentAttributeXYList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   SpeedLimitList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const SpeedLimitList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   OriginatingRSUContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OriginatingRSUContainer& p) {
+    if (p.present == OriginatingRSUContainer_PR_intersectionReferenceId) {
+        w.begin_object();
+        w.key("intersectionReferenceId");
+        write_json(w, p.choice.intersectionReferenceId);
+        w.end_object();
+    } else if (p.present == OriginatingRSUContainer_PR_roadSegmentReferenceId) {
+        w.begin_object();
+        w.key("roadSegmentReferenceId");
+        write_json(w, p.choice.roadSegmentReferenceId);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   VehicleSensorProperties - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSensorProperties& p) {
+    w.begin_object();
+    w.key("horizontalOpeningAngleEnd");
+    write_json(w, ((p.horizontalOpeningAngleEnd) == 3601) ? (p.horizontalOpeningAngleEnd) : (double)(p.horizontalOpeningAngleEnd) / 10.0);
+    w.key("horizontalOpeningAngleStart");
+    write_json(w, ((p.horizontalOpeningAngleStart) == 3601) ? (p.horizontalOpeningAngleStart) : (double)(p.horizontalOpeningAngleStart) / 10.0);
+    w.key("range");
+    write_json(w, (p.range));
+    if (p.verticalOpeningAngleEnd != 0) {
+        w.key("verticalOpeningAngleEnd");
+        write_json(w, (*(p.verticalOpeningAngleEnd) != 3601) ? *(p.verticalOpeningAngleEnd) : (double) *(p.verticalOpeningAngleEnd) / 10.0);
+    }
+    if (p.verticalOpeningAngleStart != 0) {
+        w.key("verticalOpeningAngleStart");
+        write_json(w, (*(p.verticalOpeningAngleStart) != 3601) ? *(p.verticalOpeningAngleStart) : (double) *(p.verticalOpeningAngleStart) / 10.0);
+    }
+    w.end_object();
+}
+
+/*
+*   ObjectDistanceWithConfidence - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectDistanceWithConfidence& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, ((p.confidence) == 101 || (p.confidence) == 102) ? (p.confidence) : (double)(p.confidence) / 100.0);
+    w.key("value");
+    write_json(w, (double)(p.value) / 100.0);
+    w.end_object();
+}
+
+/*
+*   ObjectDimension - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectDimension& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("value");
+    write_json(w, (double)(p.value) / 10.0);
+    w.end_object();
+}
+
+/*
+*   CartesianAngle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CartesianAngle& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("value");
+    write_json(w, ((p.value) == 3601) ? (p.value) : (double)(p.value) / 10.0);
+    w.end_object();
+}
+
+/*
+*   WGS84Angle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const WGS84Angle& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("value");
+    write_json(w, ((p.value) == 3601) ? (p.value) : (double)(p.value) / 10.0);
+    w.end_object();
+}
+
+/*
+*   SpeedExtended - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SpeedExtended& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, ((p.confidence) == 126 || (p.confidence) == 127) ? (p.confidence) : (double)(p.confidence) / 100.0);
+    w.key("value");
+    write_json(w, ((p.value) == 16383) ? (p.value) : (double)(p.value) / 100.0);
+    w.end_object();
+}
+
+/*
+*   SensorIdList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SensorIdList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   TrailerData - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const TrailerData& p) {
+    w.begin_object();
+    w.key("frontOverhang");
+    write_json(w, (p.frontOverhang));
+    if (p.hitchAngle != 0) {
+        w.key("hitchAngle");
+        write_json(w, *(p.hitchAngle));
+    }
+    w.key("hitchPointOffset");
+    write_json(w, (p.hitchPointOffset));
+    w.key("rearOverhang");
+    write_json(w, (p.rearOverhang));
+    w.key("refPointId");
+    write_json(w, (p.refPointId));
+    if (p.trailerWidth != 0) {
+        w.key("trailerWidth");
+        write_json(w, (*(p.trailerWidth) != 61 && *(p.trailerWidth) != 62) ? *(p.trailerWidth) : (double) *(p.trailerWidth) / 10.0);
+    }
+    w.end_object();
+}
+
+/*
+*   LongitudinalLanePosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const LongitudinalLanePosition& p) {
+    w.begin_object();
+    w.key("longitudinalLanePositionConfidence");
+    write_json(w, (p.longitudinalLanePositionConfidence));
+    w.key("longitudinalLanePositionValue");
+    write_json(w, (p.longitudinalLanePositionValue));
+    w.end_object();
+}
+
+/*
+*   MatchedPosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const MatchedPosition& p) {
+    if (!(p.laneID != 0 || p.longitudinalLanePosition != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.laneID != 0) {
+        w.key("laneID");
+        write_json(w, *(p.laneID));
+    }
+    if (p.longitudinalLanePosition != 0) {
+        w.key("longitudinalLanePosition");
+        write_json(w, *(p.longitudinalLanePosition));
+    }
+    w.end_object();
+}
+
+/*
+*   PerceivedObjectContainerSegmentInfo - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PerceivedObjectContainerSegmentInfo& p) {
+    w.begin_object();
+    w.key("thisSegmentNum");
+    write_json(w, (p.thisSegmentNum));
+    w.key("totalMsgSegments");
+    write_json(w, (p.totalMsgSegments));
+    w.end_object();
+}
+
+/*
+*   VehicleSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSubclass& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   PersonSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PersonSubclass& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   AnimalSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AnimalSubclass& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   OtherSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OtherSubclass& p) {
+    w.begin_object();
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   NodeOffsetPointZ - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const NodeOffsetPointZ& p) {
+    if (p.present == NodeOffsetPointZ_PR_node_Z1) {
+        w.begin_object();
+        w.key("node-Z1");
+        write_json(w, p.choice.node_Z1);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointZ_PR_node_Z2) {
+        w.begin_object();
+        w.key("node-Z2");
+        write_json(w, p.choice.node_Z2);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointZ_PR_node_Z3) {
+        w.begin_object();
+        w.key("node-Z3");
+        write_json(w, p.choice.node_Z3);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointZ_PR_node_Z4) {
+        w.begin_object();
+        w.key("node-Z4");
+        write_json(w, p.choice.node_Z4);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointZ_PR_node_Z5) {
+        w.begin_object();
+        w.key("node-Z5");
+        write_json(w, p.choice.node_Z5);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointZ_PR_node_Z6) {
+        w.begin_object();
+        w.key("node-Z6");
+        write_json(w, p.choice.node_Z6);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   ReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ReferencePosition& p) {
+    w.begin_object();
+    w.key("altitude");
+    write_json(w, (p.altitude));
+    w.key("latitude");
+    write_json(w, ((p.latitude) == 900000001) ? (p.latitude) : (double)(p.latitude) / 10000000.0);
+    w.key("longitude");
+    write_json(w, ((p.longitude) == 1800000001) ? (p.longitude) : (double)(p.longitude) / 10000000.0);
+    w.key("positionConfidenceEllipse");
+    write_json(w, (p.positionConfidenceEllipse));
+    w.end_object();
+}
+
+/*
+*   PtActivation - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PtActivation& p) {
+    w.begin_object();
+    w.key("ptActivationData");
+    write_json(w, (p.ptActivationData));
+    w.key("ptActivationType");
+    write_json(w, (p.ptActivationType));
+    w.end_object();
+}
+
+/*
+*   ClosedLanes - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ClosedLanes& p) {
+    if (!(p.drivingLaneStatus != 0 || p.innerhardShoulderStatus != 0 || p.outerhardShoulderStatus != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.drivingLaneStatus != 0) {
+        w.key("drivingLaneStatus");
+        write_json_DrivingLaneStatus(w, *(p.drivingLaneStatus));
+    }
+    if (p.innerhardShoulderStatus != 0) {
+        w.key("innerhardShoulderStatus");
+        write_json(w, *(p.innerhardShoulderStatus));
+    }
+    if (p.outerhardShoulderStatus != 0) {
+        w.key("outerhardShoulderStatus");
+        write_json(w, *(p.outerhardShoulderStatus));
+    }
+    w.end_object();
+}
+
+/*
+*   ItineraryPath - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ItineraryPath& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   EventHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const EventHistory& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   DigitalMap - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const DigitalMap_t& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   HighFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const HighFrequencyContainer& p) {
+    if (p.present == HighFrequencyContainer_PR_basicVehicleContainerHighFrequency) {
+        w.begin_object();
+        w.key("basicVehicleContainerHighFrequency");
+        write_json(w, p.choice.basicVehicleContainerHighFrequency);
+        w.end_object();
+    } else if (p.present == HighFrequencyContainer_PR_rsuContainerHighFrequency) {
+        w.begin_object();
+        w.key("rsuContainerHighFrequency");
+        write_json(w, p.choice.rsuContainerHighFrequency);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   LowFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const LowFrequencyContainer& p) {
+    if (p.present == LowFrequencyContainer_PR_basicVehicleContainerLowFrequency) {
+        w.begin_object();
+        w.key("basicVehicleContainerLowFrequency");
+        write_json(w, p.choice.basicVehicleContainerLowFrequency);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   BasicContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const BasicContainer& p) {
+    w.begin_object();
+    w.key("referencePosition");
+    write_json(w, (p.referencePosition));
+    w.key("stationType");
+    write_json(w, (p.stationType));
+    w.end_object();
+}
+
+/*
+*   PublicTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const PublicTransportContainer& p) {
+    w.begin_object();
+    w.key("embarkationStatus");
+    write_json(w, (p.embarkationStatus));
+    if (p.ptActivation != 0) {
+        w.key("ptActivation");
+        write_json(w, *(p.ptActivation));
+    }
+    w.end_object();
+}
+
+/*
+*   RoadWorksContainerBasic - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const RoadWorksContainerBasic& p) {
+    w.begin_object();
+    if (p.closedLanes != 0) {
+        w.key("closedLanes");
+        write_json(w, *(p.closedLanes));
+    }
+    w.key("lightBarSirenInUse");
+    write_json_LightBarSirenInUse(w, (p.lightBarSirenInUse));
+    if (p.roadworksSubCauseCode != 0) {
+        w.key("roadworksSubCauseCode");
+        write_json(w, *(p.roadworksSubCauseCode));
+    }
+    w.end_object();
+}
+
+/*
+*   ManagementContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const ManagementContainer& p) {
+    w.begin_object();
+    w.key("actionID");
+    write_json(w, (p.actionID));
+    w.key("detectionTime");
+    write_json(w, (p.detectionTime));
+    w.key("eventPosition");
+    write_json(w, (p.eventPosition));
+    w.key("referenceTime");
+    write_json(w, (p.referenceTime));
+    if (p.relevanceDistance != 0) {
+        w.key("relevanceDistance");
+        write_json(w, *(p.relevanceDistance));
+    }
+    if (p.relevanceTrafficDirection != 0) {
+        w.key("relevanceTrafficDirection");
+        write_json(w, *(p.relevanceTrafficDirection));
+    }
+    w.key("stationType");
+    write_json(w, (p.stationType));
+    if (p.termination != 0) {
+        w.key("termination");
+        write_json(w, *(p.termination));
+    }
+    if (p.transmissionInterval != 0) {
+        w.key("transmissionInterval");
+        write_json(w, *(p.transmissionInterval));
+    }
+    if (p.validityDuration != 0) {
+        w.key("validityDuration");
+        write_json(w, *(p.validityDuration));
+    }
+    w.end_object();
+}
+
+/*
+*   SituationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const SituationContainer& p) {
+    w.begin_object();
+    if (p.eventHistory != 0) {
+        w.key("eventHistory");
+        write_json(w, *(p.eventHistory));
+    }
+    w.key("eventType");
+    write_json(w, (p.eventType));
+    w.key("informationQuality");
+    write_json(w, (p.informationQuality));
+    if (p.linkedCause != 0) {
+        w.key("linkedCause");
+        write_json(w, *(p.linkedCause));
+    }
+    w.end_object();
+}
+
+/*
+*   RoadWorksContainerExtended - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const RoadWorksContainerExtended& p) {
+    if (!(p.closedLanes != 0 || p.incidentIndication != 0 || p.lightBarSirenInUse != 0 || p.recommendedPath != 0 || p.referenceDenms != 0 || p.restriction != 0 || p.speedLimit != 0 || p.startingPointSpeedLimit != 0 || p.trafficFlowRule != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.closedLanes != 0) {
+        w.key("closedLanes");
+        write_json(w, *(p.closedLanes));
+    }
+    if (p.incidentIndication != 0) {
+        w.key("incidentIndication");
+        write_json(w, *(p.incidentIndication));
+    }
+    if (p.lightBarSirenInUse != 0) {
+        w.key("lightBarSirenInUse");
+        write_json_LightBarSirenInUse(w, *(p.lightBarSirenInUse));
+    }
+    if (p.recommendedPath != 0) {
+        w.key("recommendedPath");
+        write_json(w, *(p.recommendedPath));
+    }
+    if (p.referenceDenms != 0) {
+        w.key("referenceDenms");
+        write_json(w, *(p.referenceDenms));
+    }
+    if (p.restriction != 0) {
+        w.key("restriction");
+        write_json(w, *(p.restriction));
+    }
+    if (p.speedLimit != 0) {
+        w.key("speedLimit");
+        write_json(w, *(p.speedLimit));
+    }
+    if (p.startingPointSpeedLimit != 0) {
+        w.key("startingPointSpeedLimit");
+        write_json(w, *(p.startingPointSpeedLimit));
+    }
+    if (p.trafficFlowRule != 0) {
+        w.key("trafficFlowRule");
+        write_json(w, *(p.trafficFlowRule));
+    }
+    w.end_object();
+}
+
+/*
+*   AlacarteContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const AlacarteContainer& p) {
+    if (!(p.externalTemperature != 0 || p.impactReduction != 0 || p.lanePosition != 0 || p.positioningSolution != 0 || p.roadWorks != 0 || p.stationaryVehicle != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.externalTemperature != 0) {
+        w.key("externalTemperature");
+        write_json(w, *(p.externalTemperature));
+    }
+    if (p.impactReduction != 0) {
+        w.key("impactReduction");
+        write_json(w, *(p.impactReduction));
+    }
+    if (p.lanePosition != 0) {
+        w.key("lanePosition");
+        write_json(w, *(p.lanePosition));
+    }
+    if (p.positioningSolution != 0) {
+        w.key("positioningSolution");
+        write_json(w, *(p.positioningSolution));
+    }
+    if (p.roadWorks != 0) {
+        w.key("roadWorks");
+        write_json(w, *(p.roadWorks));
+    }
+    if (p.stationaryVehicle != 0) {
+        w.key("stationaryVehicle");
+        write_json(w, *(p.stationaryVehicle));
+    }
+    w.end_object();
+}
+
+/*
+*   MapPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const MapPosition& p) {
+    w.begin_object();
+    w.key("intersectionId");
+    write_json(w, (p.intersectionId));
+    w.key("lane");
+    write_json(w, (p.lane));
+    w.end_object();
+}
+
+/*
+*   VruExteriorLights - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruExteriorLights& p) {
+    w.begin_object();
+    w.key("vehicular");
+    write_json_ExteriorLights(w, (p.vehicular));
+    w.key("vruSpecific");
+    write_json_VruSpecificExteriorLights(w, (p.vruSpecific));
+    w.end_object();
+}
+
+/*
+*   VruClusterOperationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruClusterOperationContainer& p) {
+    if (!(p.clusterBreakupInfo != 0 || p.clusterIdChangeTimeInfo != 0 || p.clusterJoinInfo != 0 || p.clusterLeaveInfo != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.clusterBreakupInfo != 0) {
+        w.key("clusterBreakupInfo");
+        write_json(w, *(p.clusterBreakupInfo));
+    }
+    if (p.clusterIdChangeTimeInfo != 0) {
+        w.key("clusterIdChangeTimeInfo");
+        write_json(w, *(p.clusterIdChangeTimeInfo));
+    }
+    if (p.clusterJoinInfo != 0) {
+        w.key("clusterJoinInfo");
+        write_json(w, *(p.clusterJoinInfo));
+    }
+    if (p.clusterLeaveInfo != 0) {
+        w.key("clusterLeaveInfo");
+        write_json(w, *(p.clusterLeaveInfo));
+    }
+    w.end_object();
+}
+
+/*
+*   VruPathPoint - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruPathPoint& p) {
+    w.begin_object();
+    if (p.pathDeltaTime != 0) {
+        w.key("pathDeltaTime");
+        write_json(w, *(p.pathDeltaTime));
+    }
+    w.key("pathPosition");
+    write_json(w, (p.pathPosition));
+    w.end_object();
+}
+
+/*
+*   SequenceOfVruSafeDistanceIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const SequenceOfVruSafeDistanceIndication& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   SequenceOfTrajectoryInterceptionIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const SequenceOfTrajectoryInterceptionIndication& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   ConnectingLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ConnectingLane& p) {
+    w.begin_object();
+    w.key("lane");
+    write_json(w, (p.lane));
+    if (p.maneuver != 0) {
+        w.key("maneuver");
+        write_json_AllowedManeuvers(w, *(p.maneuver));
+    }
+    w.end_object();
+}
+
+/*
+*   Connection - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const Connection& p) {
+    w.begin_object();
+    w.key("connectingLane");
+    write_json(w, (p.connectingLane));
+    if (p.connectionID != 0) {
+        w.key("connectionID");
+        write_json(w, *(p.connectionID));
+    }
+    if (p.remoteIntersection != 0) {
+        w.key("remoteIntersection");
+        write_json(w, *(p.remoteIntersection));
+    }
+    if (p.signalGroup != 0) {
+        w.key("signalGroup");
+        write_json(w, *(p.signalGroup));
+    }
+    if (p.userClass != 0) {
+        w.key("userClass");
+        write_json(w, *(p.userClass));
+    }
+    w.end_object();
+}
+
+/*
+*   LaneTypeAttributes - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const LaneTypeAttributes& p) {
+    if (p.present == LaneTypeAttributes_PR_vehicle) {
+        w.begin_object();
+        w.key("vehicle");
+        write_json_LaneAttributes_Vehicle(w, p.choice.vehicle);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_crosswalk) {
+        w.begin_object();
+        w.key("crosswalk");
+        write_json_LaneAttributes_Crosswalk(w, p.choice.crosswalk);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_bikeLane) {
+        w.begin_object();
+        w.key("bikeLane");
+        write_json_LaneAttributes_Bike(w, p.choice.bikeLane);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_sidewalk) {
+        w.begin_object();
+        w.key("sidewalk");
+        write_json_LaneAttributes_Sidewalk(w, p.choice.sidewalk);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_median) {
+        w.begin_object();
+        w.key("median");
+        write_json_LaneAttributes_Barrier(w, p.choice.median);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_striping) {
+        w.begin_object();
+        w.key("striping");
+        write_json_LaneAttributes_Striping(w, p.choice.striping);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_trackedVehicle) {
+        w.begin_object();
+        w.key("trackedVehicle");
+        write_json_LaneAttributes_TrackedVehicle(w, p.choice.trackedVehicle);
+        w.end_object();
+    } else if (p.present == LaneTypeAttributes_PR_parking) {
+        w.begin_object();
+        w.key("parking");
+        write_json_LaneAttributes_Parking(w, p.choice.parking);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   MovementEvent - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementEvent& p) {
+    w.begin_object();
+    w.key("eventState");
+    write_json(w, (p.eventState));
+    if (p.speeds != 0) {
+        w.key("speeds");
+        write_json(w, *(p.speeds));
+    }
+    if (p.timing != 0) {
+        w.key("timing");
+        write_json(w, *(p.timing));
+    }
+    w.end_object();
+}
+
+/*
+*   RestrictionUserTypeList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionUserTypeList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   LaneDataAttribute - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const LaneDataAttribute& p) {
+    if (p.present == LaneDataAttribute_PR_pathEndPointAngle) {
+        w.begin_object();
+        w.key("pathEndPointAngle");
+        write_json(w, p.choice.pathEndPointAngle);
+        w.end_object();
+    } else if (p.present == LaneDataAttribute_PR_laneCrownPointCenter) {
+        w.begin_object();
+        w.key("laneCrownPointCenter");
+        write_json(w, p.choice.laneCrownPointCenter);
+        w.end_object();
+    } else if (p.present == LaneDataAttribute_PR_laneCrownPointLeft) {
+        w.begin_object();
+        w.key("laneCrownPointLeft");
+        write_json(w, p.choice.laneCrownPointLeft);
+        w.end_object();
+    } else if (p.present == LaneDataAttribute_PR_laneCrownPointRight) {
+        w.begin_object();
+        w.key("laneCrownPointRight");
+        write_json(w, p.choice.laneCrownPointRight);
+        w.end_object();
+    } else if (p.present == LaneDataAttribute_PR_laneAngle) {
+        w.begin_object();
+        w.key("laneAngle");
+        write_json(w, p.choice.laneAngle);
+        w.end_object();
+    } else if (p.present == LaneDataAttribute_PR_speedLimits) {
+        w.begin_object();
+        w.key("speedLimits");
+        write_json(w, p.choice.speedLimits);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   LaneDataAttributeList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const LaneDataAttributeList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   NodeOffsetPointXY - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeOffsetPointXY& p) {
+    if (p.present == NodeOffsetPointXY_PR_node_XY1) {
+        w.begin_object();
+        w.key("node-XY1");
+        write_json(w, p.choice.node_XY1);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointXY_PR_node_XY2) {
+        w.begin_object();
+        w.key("node-XY2");
+        write_json(w, p.choice.node_XY2);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointXY_PR_node_XY3) {
+        w.begin_object();
+        w.key("node-XY3");
+        write_json(w, p.choice.node_XY3);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointXY_PR_node_XY4) {
+        w.begin_object();
+        w.key("node-XY4");
+        write_json(w, p.choice.node_XY4);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointXY_PR_node_XY5) {
+        w.begin_object();
+        w.key("node-XY5");
+        write_json(w, p.choice.node_XY5);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointXY_PR_node_XY6) {
+        w.begin_object();
+        w.key("node-XY6");
+        write_json(w, p.choice.node_XY6);
+        w.end_object();
+    } else if (p.present == NodeOffsetPointXY_PR_node_LatLon) {
+        w.begin_object();
+        w.key("node-LatLon");
+        write_json(w, p.choice.node_LatLon);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   NodeAttributeSetXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeAttributeSetXY_t& p) {
+    if (!(p.dElevation != 0 || p.dWidth != 0 || p.data != 0 || p.disabled != 0 || p.enabled != 0 || p.localNode != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.dElevation != 0) {
+        w.key("dElevation");
+        write_json(w, *(p.dElevation));
+    }
+    if (p.dWidth != 0) {
+        w.key("dWidth");
+        write_json(w, *(p.dWidth));
+    }
+    if (p.data != 0) {
+        w.key("data");
+        write_json(w, *(p.data));
+    }
+    if (p.disabled != 0) {
+        w.key("disabled");
+        write_json(w, *(p.disabled));
+    }
+    if (p.enabled != 0) {
+        w.key("enabled");
+        write_json(w, *(p.enabled));
+    }
+    if (p.localNode != 0) {
+        w.key("localNode");
+        write_json(w, *(p.localNode));
+    }
+    w.end_object();
+}
+
+/*
+*   CpmManagementContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CpmManagementContainer& p) {
+    w.begin_object();
+    if (p.perceivedObjectContainerSegmentInfo != 0) {
+        w.key("perceivedObjectContainerSegmentInfo");
+        write_json(w, *(p.perceivedObjectContainerSegmentInfo));
+    }
+    w.key("referencePosition");
+    write_json(w, (p.referencePosition));
+    w.key("stationType");
+    write_json(w, (p.stationType));
+    w.end_object();
+}
+
+/*
+*   VehicleSensorPropertyList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSensorPropertyList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   TrailerDataContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const TrailerDataContainer& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   ObjectClass::ObjectClass__class - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectClass::ObjectClass__class& p) {
+    if (p.present == ObjectClass__class_PR_vehicle) {
+        w.begin_object();
+        w.key("vehicle");
+        write_json(w, p.choice.vehicle);
+        w.end_object();
+    } else if (p.present == ObjectClass__class_PR_person) {
+        w.begin_object();
+        w.key("person");
+        write_json(w, p.choice.person);
+        w.end_object();
+    } else if (p.present == ObjectClass__class_PR_animal) {
+        w.begin_object();
+        w.key("animal");
+        write_json(w, p.choice.animal);
+        w.end_object();
+    } else if (p.present == ObjectClass__class_PR_other) {
+        w.begin_object();
+        w.key("other");
+        write_json(w, p.choice.other);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   ObjectClass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectClass_t& p) {
+    w.begin_object();
+    w.key("class");
+    write_json(w, (p.Class));
+    w.key("confidence");
+    write_json(w, (p.confidence));
+    w.end_object();
+}
+
+/*
+*   OffsetPoint - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OffsetPoint& p) {
+    w.begin_object();
+    if (p.nodeOffsetPointZ != 0) {
+        w.key("nodeOffsetPointZ");
+        write_json(w, *(p.nodeOffsetPointZ));
+    }
+    w.key("nodeOffsetPointxy");
+    write_json(w, (p.nodeOffsetPointxy));
+    w.end_object();
+}
+
+/*
+*   SpecialVehicleContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const SpecialVehicleContainer& p) {
+    if (p.present == SpecialVehicleContainer_PR_publicTransportContainer) {
+        w.begin_object();
+        w.key("publicTransportContainer");
+        write_json(w, p.choice.publicTransportContainer);
+        w.end_object();
+    } else if (p.present == SpecialVehicleContainer_PR_specialTransportContainer) {
+        w.begin_object();
+        w.key("specialTransportContainer");
+        write_json(w, p.choice.specialTransportContainer);
+        w.end_object();
+    } else if (p.present == SpecialVehicleContainer_PR_dangerousGoodsContainer) {
+        w.begin_object();
+        w.key("dangerousGoodsContainer");
+        write_json(w, p.choice.dangerousGoodsContainer);
+        w.end_object();
+    } else if (p.present == SpecialVehicleContainer_PR_roadWorksContainerBasic) {
+        w.begin_object();
+        w.key("roadWorksContainerBasic");
+        write_json(w, p.choice.roadWorksContainerBasic);
+        w.end_object();
+    } else if (p.present == SpecialVehicleContainer_PR_rescueContainer) {
+        w.begin_object();
+        w.key("rescueContainer");
+        write_json(w, p.choice.rescueContainer);
+        w.end_object();
+    } else if (p.present == SpecialVehicleContainer_PR_emergencyContainer) {
+        w.begin_object();
+        w.key("emergencyContainer");
+        write_json(w, p.choice.emergencyContainer);
+        w.end_object();
+    } else if (p.present == SpecialVehicleContainer_PR_safetyCarContainer) {
+        w.begin_object();
+        w.key("safetyCarContainer");
+        write_json(w, p.choice.safetyCarContainer);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   DecentralizedEnvironmentalNotificationMessage - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const DecentralizedEnvironmentalNotificationMessage& p) {
+    w.begin_object();
+    if (p.alacarte != 0) {
+        w.key("alacarte");
+        write_json(w, *(p.alacarte));
+    }
+    if (p.location != 0) {
+        w.key("location");
+        write_json(w, *(p.location));
+    }
+    w.key("management");
+    write_json(w, (p.management));
+    if (p.situation != 0) {
+        w.key("situation");
+        write_json(w, *(p.situation));
+    }
+    w.end_object();
+}
+
+/*
+*   NonIslandLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const NonIslandLanePosition& p) {
+    if (p.present == NonIslandLanePosition_PR_offRoadLanePosition) {
+        w.begin_object();
+        w.key("offRoadLanePosition");
+        write_json(w, p.choice.offRoadLanePosition);
+        w.end_object();
+    } else if (p.present == NonIslandLanePosition_PR_vehicularLanePosition) {
+        w.begin_object();
+        w.key("vehicularLanePosition");
+        write_json(w, p.choice.vehicularLanePosition);
+        w.end_object();
+    } else if (p.present == NonIslandLanePosition_PR_mapPosition) {
+        w.begin_object();
+        w.key("mapPosition");
+        write_json(w, p.choice.mapPosition);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   VruLowFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruLowFrequencyContainer& p) {
+    if (!(p.exteriorLights != 0 || p.profileAndSubprofile != 0 || p.sizeClass != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.exteriorLights != 0) {
+        w.key("exteriorLights");
+        write_json(w, *(p.exteriorLights));
+    }
+    if (p.profileAndSubprofile != 0) {
+        w.key("profileAndSubprofile");
+        write_json(w, *(p.profileAndSubprofile));
+    }
+    if (p.sizeClass != 0) {
+        w.key("sizeClass");
+        write_json(w, *(p.sizeClass));
+    }
+    w.end_object();
+}
+
+/*
+*   SequenceOfVruPathPoint - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const SequenceOfVruPathPoint& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   ConnectsToList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ConnectsToList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   LaneAttributes - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const LaneAttributes& p) {
+    w.begin_object();
+    w.key("directionalUse");
+    write_json_LaneDirection(w, (p.directionalUse));
+    w.key("laneType");
+    write_json(w, (p.laneType));
+    w.key("sharedWith");
+    write_json_LaneSharing(w, (p.sharedWith));
+    w.end_object();
+}
+
+/*
+*   MovementEventList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementEventList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   MovementState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementState& p) {
+    w.begin_object();
+    if (p.maneuverAssistList != 0) {
+        w.key("maneuverAssistList");
+        write_json(w, *(p.maneuverAssistList));
+    }
+    w.key("signalGroup");
+    write_json(w, (p.signalGroup));
+    w.key("state-time-speed");
+    write_json(w, (p.state_time_speed));
+    w.end_object();
+}
+
+/*
+*   RestrictionClassAssignment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionClassAssignment& p) {
+    w.begin_object();
+    w.key("id");
+    write_json(w, (p.id));
+    w.key("users");
+    write_json(w, (p.users));
+    w.end_object();
+}
+
+/*
+*   RestrictionClassList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionClassList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   NodeXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeXY_t& p) {
+    w.begin_object();
+    if (p.attributes != 0) {
+        w.key("attributes");
+        write_json(w, *(p.attributes));
+    }
+    w.key("delta");
+    write_json(w, (p.delta));
+    w.end_object();
+}
+
+/*
+*   OriginatingVehicleContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OriginatingVehicleContainer& p) {
+    w.begin_object();
+    w.key("driveDirection");
+    write_json(w, (p.driveDirection));
+    w.key("heading");
+    write_json(w, (p.heading));
+    if (p.lateralAcceleration != 0) {
+        w.key("lateralAcceleration");
+        write_json(w, *(p.lateralAcceleration));
+    }
+    if (p.longitudinalAcceleration != 0) {
+        w.key("longitudinalAcceleration");
+        write_json(w, *(p.longitudinalAcceleration));
+    }
+    if (p.pitchAngle != 0) {
+        w.key("pitchAngle");
+        write_json(w, *(p.pitchAngle));
+    }
+    if (p.rollAngle != 0) {
+        w.key("rollAngle");
+        write_json(w, *(p.rollAngle));
+    }
+    w.key("speed");
+    write_json(w, (p.speed));
+    if (p.trailerDataContainer != 0) {
+        w.key("trailerDataContainer");
+        write_json(w, *(p.trailerDataContainer));
+    }
+    if (p.vehicleHeight != 0) {
+        w.key("vehicleHeight");
+        write_json(w, *(p.vehicleHeight));
+    }
+    if (p.vehicleLength != 0) {
+        w.key("vehicleLength");
+        write_json(w, *(p.vehicleLength));
+    }
+    if (p.vehicleOrientationAngle != 0) {
+        w.key("vehicleOrientationAngle");
+        write_json(w, *(p.vehicleOrientationAngle));
+    }
+    if (p.vehicleWidth != 0) {
+        w.key("vehicleWidth");
+        write_json(w, (*(p.vehicleWidth) != 61 && *(p.vehicleWidth) != 62) ? *(p.vehicleWidth) : (double) *(p.vehicleWidth) / 10.0);
+    }
+    if (p.verticalAcceleration != 0) {
+        w.key("verticalAcceleration");
+        write_json(w, *(p.verticalAcceleration));
+    }
+    if (p.yawRate != 0) {
+        w.key("yawRate");
+        write_json(w, *(p.yawRate));
+    }
+    w.end_object();
+}
+
+/*
+*   VehicleSensor - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSensor& p) {
+    w.begin_object();
+    w.key("refPointId");
+    write_json(w, (p.refPointId));
+    w.key("vehicleSensorPropertyList");
+    write_json(w, (p.vehicleSensorPropertyList));
+    w.key("xSensorOffset");
+    write_json(w, (p.xSensorOffset));
+    w.key("ySensorOffset");
+    write_json(w, (p.ySensorOffset));
+    if (p.zSensorOffset != 0) {
+        w.key("zSensorOffset");
+        write_json(w, *(p.zSensorOffset));
+    }
+    w.end_object();
+}
+
+/*
+*   AreaCircular - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaCircular& p) {
+    w.begin_object();
+    if (p.nodeCenterPoint != 0) {
+        w.key("nodeCenterPoint");
+        write_json(w, *(p.nodeCenterPoint));
+    }
+    w.key("radius");
+    write_json(w, (double)(p.radius) / 10.0);
+    w.end_object();
+}
+
+/*
+*   AreaEllipse - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaEllipse& p) {
+    w.begin_object();
+    if (p.nodeCenterPoint != 0) {
+        w.key("nodeCenterPoint");
+        write_json(w, *(p.nodeCenterPoint));
+    }
+    if (p.semiHeight != 0) {
+        w.key("semiHeight");
+        write_json(w, (double) *(p.semiHeight) / 10.0);
+    }
+    w.key("semiMajorRangeLength");
+    write_json(w, (double)(p.semiMajorRangeLength) / 10.0);
+    w.key("semiMajorRangeOrientation");
+    write_json(w, ((p.semiMajorRangeOrientation) == 3601) ? (p.semiMajorRangeOrientation) : (double)(p.semiMajorRangeOrientation) / 10.0);
+    w.key("semiMinorRangeLength");
+    write_json(w, (double)(p.semiMinorRangeLength) / 10.0);
+    w.end_object();
+}
+
+/*
+*   AreaRectangle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaRectangle& p) {
+    w.begin_object();
+    if (p.nodeCenterPoint != 0) {
+        w.key("nodeCenterPoint");
+        write_json(w, *(p.nodeCenterPoint));
+    }
+    if (p.semiHeight != 0) {
+        w.key("semiHeight");
+        write_json(w, (double) *(p.semiHeight) / 10.0);
+    }
+    w.key("semiMajorRangeLength");
+    write_json(w, (double)(p.semiMajorRangeLength) / 10.0);
+    w.key("semiMajorRangeOrientation");
+    write_json(w, ((p.semiMajorRangeOrientation) == 3601) ? (p.semiMajorRangeOrientation) : (double)(p.semiMajorRangeOrientation) / 10.0);
+    w.key("semiMinorRangeLength");
+    write_json(w, (double)(p.semiMinorRangeLength) / 10.0);
+    w.end_object();
+}
+
+/*
+*   PolyPointList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PolyPointList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   AreaRadial - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaRadial& p) {
+    w.begin_object();
+    w.key("range");
+    write_json(w, (p.range));
+    if (p.sensorHeight != 0) {
+        w.key("sensorHeight");
+        write_json(w, (double) *(p.sensorHeight) / 100.0);
+    }
+    if (p.sensorPositionOffset != 0) {
+        w.key("sensorPositionOffset");
+        write_json(w, *(p.sensorPositionOffset));
+    }
+    w.key("stationaryHorizontalOpeningAngleEnd");
+    write_json(w, ((p.stationaryHorizontalOpeningAngleEnd) == 3601) ? (p.stationaryHorizontalOpeningAngleEnd) : (double)(p.stationaryHorizontalOpeningAngleEnd) / 10.0);
+    w.key("stationaryHorizontalOpeningAngleStart");
+    write_json(w, ((p.stationaryHorizontalOpeningAngleStart) == 3601) ? (p.stationaryHorizontalOpeningAngleStart) : (double)(p.stationaryHorizontalOpeningAngleStart) / 10.0);
+    if (p.verticalOpeningAngleEnd != 0) {
+        w.key("verticalOpeningAngleEnd");
+        write_json(w, (*(p.verticalOpeningAngleEnd) != 3601) ? *(p.verticalOpeningAngleEnd) : (double) *(p.verticalOpeningAngleEnd) / 10.0);
+    }
+    if (p.verticalOpeningAngleStart != 0) {
+        w.key("verticalOpeningAngleStart");
+        write_json(w, (*(p.verticalOpeningAngleStart) != 3601) ? *(p.verticalOpeningAngleStart) : (double) *(p.verticalOpeningAngleStart) / 10.0);
+    }
+    w.end_object();
+}
+
+/*
+*   ObjectClassDescription - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectClassDescription& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   CamParameters - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const CamParameters& p) {
+    w.begin_object();
+    w.key("basicContainer");
+    write_json(w, (p.basicContainer));
+    w.key("highFrequencyContainer");
+    write_json(w, (p.highFrequencyContainer));
+    if (p.lowFrequencyContainer != 0) {
+        w.key("lowFrequencyContainer");
+        write_json(w, *(p.lowFrequencyContainer));
+    }
+    if (p.specialVehicleContainer != 0) {
+        w.key("specialVehicleContainer");
+        write_json(w, *(p.specialVehicleContainer));
+    }
+    w.end_object();
+}
+
+/*
+*   DENM - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const DENM& p) {
+    w.begin_object();
+    w.key("denm");
+    write_json(w, (p.denm));
+    w.key("header");
+    write_json(w, (p.header));
+    w.end_object();
+}
+
+/*
+*   TrafficIslandPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const TrafficIslandPosition& p) {
+    w.begin_object();
+    w.key("oneSide");
+    write_json(w, (p.oneSide));
+    w.key("otherSide");
+    write_json(w, (p.otherSide));
+    w.end_object();
+}
+
+/*
+*   VruMotionPredictionContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruMotionPredictionContainer& p) {
+    if (!(p.accelerationChangeIndication != 0 || p.headingChangeIndication != 0 || p.pathHistory != 0 || p.pathPrediction != 0 || p.safeDistance != 0 || p.stabilityChangeIndication != 0 || p.trajectoryInterceptionIndication != 0)) {
+        w.null();
+        return;
+    }
+    w.begin_object();
+    if (p.accelerationChangeIndication != 0) {
+        w.key("accelerationChangeIndication");
+        write_json(w, *(p.accelerationChangeIndication));
+    }
+    if (p.headingChangeIndication != 0) {
+        w.key("headingChangeIndication");
+        write_json(w, *(p.headingChangeIndication));
+    }
+    if (p.pathHistory != 0) {
+        w.key("pathHistory");
+        write_json(w, *(p.pathHistory));
+    }
+    if (p.pathPrediction != 0) {
+        w.key("pathPrediction");
+        write_json(w, *(p.pathPrediction));
+    }
+    if (p.safeDistance != 0) {
+        w.key("safeDistance");
+        write_json(w, *(p.safeDistance));
+    }
+    if (p.stabilityChangeIndication != 0) {
+        w.key("stabilityChangeIndication");
+        write_json(w, *(p.stabilityChangeIndication));
+    }
+    if (p.trajectoryInterceptionIndication != 0) {
+        w.key("trajectoryInterceptionIndication");
+        write_json(w, *(p.trajectoryInterceptionIndication));
+    }
+    w.end_object();
+}
+
+/*
+*   MovementList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   NodeSetXY - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeSetXY& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   StationDataContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const StationDataContainer& p) {
+    if (p.present == StationDataContainer_PR_originatingVehicleContainer) {
+        w.begin_object();
+        w.key("originatingVehicleContainer");
+        write_json(w, p.choice.originatingVehicleContainer);
+        w.end_object();
+    } else if (p.present == StationDataContainer_PR_originatingRSUContainer) {
+        w.begin_object();
+        w.key("originatingRSUContainer");
+        write_json(w, p.choice.originatingRSUContainer);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   PerceivedObject - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PerceivedObject& p) {
+    w.begin_object();
+    if (p.classification != 0) {
+        w.key("classification");
+        write_json(w, *(p.classification));
+    }
+    if (p.dynamicStatus != 0) {
+        w.key("dynamicStatus");
+        write_json(w, *(p.dynamicStatus));
+    }
+    if (p.matchedPosition != 0) {
+        w.key("matchedPosition");
+        write_json(w, *(p.matchedPosition));
+    }
+    if (p.objectAge != 0) {
+        w.key("objectAge");
+        write_json(w, *(p.objectAge));
+    }
+    w.key("objectConfidence");
+    write_json(w, (p.objectConfidence));
+    w.key("objectID");
+    write_json(w, (p.objectID));
+    w.key("objectRefPoint");
+    write_json(w, (p.objectRefPoint));
+    if (p.planarObjectDimension1 != 0) {
+        w.key("planarObjectDimension1");
+        write_json(w, *(p.planarObjectDimension1));
+    }
+    if (p.planarObjectDimension2 != 0) {
+        w.key("planarObjectDimension2");
+        write_json(w, *(p.planarObjectDimension2));
+    }
+    if (p.sensorIDList != 0) {
+        w.key("sensorIDList");
+        write_json(w, *(p.sensorIDList));
+    }
+    w.key("timeOfMeasurement");
+    write_json(w, (p.timeOfMeasurement));
+    if (p.verticalObjectDimension != 0) {
+        w.key("verticalObjectDimension");
+        write_json(w, *(p.verticalObjectDimension));
+    }
+    if (p.xAcceleration != 0) {
+        w.key("xAcceleration");
+        write_json(w, *(p.xAcceleration));
+    }
+    w.key("xDistance");
+    write_json(w, (p.xDistance));
+    w.key("xSpeed");
+    write_json(w, (p.xSpeed));
+    if (p.yAcceleration != 0) {
+        w.key("yAcceleration");
+        write_json(w, *(p.yAcceleration));
+    }
+    w.key("yDistance");
+    write_json(w, (p.yDistance));
+    w.key("ySpeed");
+    write_json(w, (p.ySpeed));
+    if (p.yawAngle != 0) {
+        w.key("yawAngle");
+        write_json(w, *(p.yawAngle));
+    }
+    if (p.zAcceleration != 0) {
+        w.key("zAcceleration");
+        write_json(w, *(p.zAcceleration));
+    }
+    if (p.zDistance != 0) {
+        w.key("zDistance");
+        write_json(w, *(p.zDistance));
+    }
+    if (p.zSpeed != 0) {
+        w.key("zSpeed");
+        write_json(w, *(p.zSpeed));
+    }
+    w.end_object();
+}
+
+/*
+*   AreaPolygon - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaPolygon& p) {
+    w.begin_object();
+    w.key("polyPointList");
+    write_json(w, (p.polyPointList));
+    w.end_object();
+}
+
+/*
+*   FreeSpaceArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const FreeSpaceArea& p) {
+    if (p.present == FreeSpaceArea_PR_freeSpacePolygon) {
+        w.begin_object();
+        w.key("freeSpacePolygon");
+        write_json(w, p.choice.freeSpacePolygon);
+        w.end_object();
+    } else if (p.present == FreeSpaceArea_PR_freeSpaceCircular) {
+        w.begin_object();
+        w.key("freeSpaceCircular");
+        write_json(w, p.choice.freeSpaceCircular);
+        w.end_object();
+    } else if (p.present == FreeSpaceArea_PR_freeSpaceEllipse) {
+        w.begin_object();
+        w.key("freeSpaceEllipse");
+        write_json(w, p.choice.freeSpaceEllipse);
+        w.end_object();
+    } else if (p.present == FreeSpaceArea_PR_freeSpaceRectangle) {
+        w.begin_object();
+        w.key("freeSpaceRectangle");
+        write_json(w, p.choice.freeSpaceRectangle);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   CoopAwareness - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const CoopAwareness& p) {
+    w.begin_object();
+    w.key("camParameters");
+    write_json(w, (p.camParameters));
+    w.key("generationDeltaTime");
+    write_json(w, (p.generationDeltaTime));
+    w.end_object();
+}
+
+/*
+*   VruLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruLanePosition& p) {
+    if (p.present == VruLanePosition_PR_offRoadLanePosition) {
+        w.begin_object();
+        w.key("offRoadLanePosition");
+        write_json(w, p.choice.offRoadLanePosition);
+        w.end_object();
+    } else if (p.present == VruLanePosition_PR_vehicularLanePosition) {
+        w.begin_object();
+        w.key("vehicularLanePosition");
+        write_json(w, p.choice.vehicularLanePosition);
+        w.end_object();
+    } else if (p.present == VruLanePosition_PR_trafficIslandPosition) {
+        w.begin_object();
+        w.key("trafficIslandPosition");
+        write_json(w, p.choice.trafficIslandPosition);
+        w.end_object();
+    } else if (p.present == VruLanePosition_PR_mapPosition) {
+        w.begin_object();
+        w.key("mapPosition");
+        write_json(w, p.choice.mapPosition);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   ClusterBoundingBoxShape - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterBoundingBoxShape& p) {
+    if (p.present == ClusterBoundingBoxShape_PR_clusterRectangle) {
+        w.begin_object();
+        w.key("clusterRectangle");
+        write_json(w, p.choice.clusterRectangle);
+        w.end_object();
+    } else if (p.present == ClusterBoundingBoxShape_PR_clusterCircle) {
+        w.begin_object();
+        w.key("clusterCircle");
+        write_json(w, p.choice.clusterCircle);
+        w.end_object();
+    } else if (p.present == ClusterBoundingBoxShape_PR_clusterPolygon) {
+        w.begin_object();
+        w.key("clusterPolygon");
+        write_json(w, p.choice.clusterPolygon);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   IntersectionState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionState& p) {
+    w.begin_object();
+    if (p.enabledLanes != 0) {
+        w.key("enabledLanes");
+        write_json(w, *(p.enabledLanes));
+    }
+    w.key("id");
+    write_json(w, (p.id));
+    if (p.maneuverAssistList != 0) {
+        w.key("maneuverAssistList");
+        write_json(w, *(p.maneuverAssistList));
+    }
+    if (p.moy != 0) {
+        w.key("moy");
+        write_json(w, *(p.moy));
+    }
+    w.key("revision");
+    write_json(w, (p.revision));
+    w.key("states");
+    write_json(w, (p.states));
+    w.key("status");
+    write_json_IntersectionStatusObject(w, (p.status));
+    if (p.timeStamp != 0) {
+        w.key("timeStamp");
+        write_json(w, *(p.timeStamp));
+    }
+    w.end_object();
+}
+
+/*
+*   IntersectionStateList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionStateList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   NodeListXY - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const NodeListXY& p) {
+    if (p.present == NodeListXY_PR_nodes) {
+        w.begin_object();
+        w.key("nodes");
+        write_json(w, p.choice.nodes);
+        w.end_object();
+    } else if (p.present == NodeListXY_PR_computed) {
+        w.begin_object();
+        w.key("computed");
+        write_json(w, p.choice.computed);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   PerceivedObjectContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PerceivedObjectContainer_t& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   DetectionArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const DetectionArea& p) {
+    if (p.present == DetectionArea_PR_vehicleSensor) {
+        w.begin_object();
+        w.key("vehicleSensor");
+        write_json(w, p.choice.vehicleSensor);
+        w.end_object();
+    } else if (p.present == DetectionArea_PR_stationarySensorRadial) {
+        w.begin_object();
+        w.key("stationarySensorRadial");
+        write_json(w, p.choice.stationarySensorRadial);
+        w.end_object();
+    } else if (p.present == DetectionArea_PR_stationarySensorPolygon) {
+        w.begin_object();
+        w.key("stationarySensorPolygon");
+        write_json(w, p.choice.stationarySensorPolygon);
+        w.end_object();
+    } else if (p.present == DetectionArea_PR_stationarySensorCircular) {
+        w.begin_object();
+        w.key("stationarySensorCircular");
+        write_json(w, p.choice.stationarySensorCircular);
+        w.end_object();
+    } else if (p.present == DetectionArea_PR_stationarySensorEllipse) {
+        w.begin_object();
+        w.key("stationarySensorEllipse");
+        write_json(w, p.choice.stationarySensorEllipse);
+        w.end_object();
+    } else if (p.present == DetectionArea_PR_stationarySensorRectangle) {
+        w.begin_object();
+        w.key("stationarySensorRectangle");
+        write_json(w, p.choice.stationarySensorRectangle);
+        w.end_object();
+    } else {
+        w.null();
+    }
+}
+
+/*
+*   FreeSpaceAddendum - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const FreeSpaceAddendum& p) {
+    w.begin_object();
+    w.key("freeSpaceArea");
+    write_json(w, (p.freeSpaceArea));
+    w.key("freeSpaceConfidence");
+    write_json(w, (p.freeSpaceConfidence));
+    if (p.sensorIDList != 0) {
+        w.key("sensorIDList");
+        write_json(w, *(p.sensorIDList));
+    }
+    w.end_object();
+}
+
+/*
+*   CAM - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const CAM& p) {
+    w.begin_object();
+    w.key("cam");
+    write_json(w, (p.cam));
+    w.key("header");
+    write_json(w, (p.header));
+    w.end_object();
+}
+
+/*
+*   VruHighFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruHighFrequencyContainer& p) {
+    w.begin_object();
+    if (p.curvature != 0) {
+        w.key("curvature");
+        write_json(w, *(p.curvature));
+    }
+    if (p.curvatureCalculationMode != 0) {
+        w.key("curvatureCalculationMode");
+        write_json(w, *(p.curvatureCalculationMode));
+    }
+    if (p.deviceUsage != 0) {
+        w.key("deviceUsage");
+        write_json(w, *(p.deviceUsage));
+    }
+    if (p.environment != 0) {
+        w.key("environment");
+        write_json(w, *(p.environment));
+    }
+    w.key("heading");
+    write_json(w, (p.heading));
+    if (p.lateralAcceleration != 0) {
+        w.key("lateralAcceleration");
+        write_json(w, *(p.lateralAcceleration));
+    }
+    w.key("longitudinalAcceleration");
+    write_json(w, (p.longitudinalAcceleration));
+    if (p.movementControl != 0) {
+        w.key("movementControl");
+        write_json(w, *(p.movementControl));
+    }
+    if (p.orientation != 0) {
+        w.key("orientation");
+        write_json(w, *(p.orientation));
+    }
+    if (p.rollAngle != 0) {
+        w.key("rollAngle");
+        write_json(w, *(p.rollAngle));
+    }
+    w.key("speed");
+    write_json(w, (p.speed));
+    if (p.verticalAcceleration != 0) {
+        w.key("verticalAcceleration");
+        write_json(w, *(p.verticalAcceleration));
+    }
+    if (p.vruLanePosition != 0) {
+        w.key("vruLanePosition");
+        write_json(w, *(p.vruLanePosition));
+    }
+    if (p.yawRate != 0) {
+        w.key("yawRate");
+        write_json(w, *(p.yawRate));
+    }
+    w.end_object();
+}
+
+/*
+*   VruClusterInformationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruClusterInformationContainer& p) {
+    w.begin_object();
+    w.key("clusterBoundingBoxShape");
+    write_json(w, (p.clusterBoundingBoxShape));
+    w.key("clusterCardinalitySize");
+    write_json(w, (p.clusterCardinalitySize));
+    w.key("clusterId");
+    write_json(w, (p.clusterId));
+    w.key("clusterProfiles");
+    write_json_ClusterProfiles(w, (p.clusterProfiles));
+    w.end_object();
+}
+
+/*
+*   SPAT - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const SPAT& p) {
+    w.begin_object();
+    w.key("intersections");
+    write_json(w, (p.intersections));
+    if (p.timeStamp != 0) {
+        w.key("timeStamp");
+        write_json(w, *(p.timeStamp));
+    }
+    w.end_object();
+}
+
+/*
+*   GenericLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const GenericLane& p) {
+    w.begin_object();
+    if (p.connectsTo != 0) {
+        w.key("connectsTo");
+        write_json(w, *(p.connectsTo));
+    }
+    if (p.egressApproach != 0) {
+        w.key("egressApproach");
+        write_json(w, *(p.egressApproach));
+    }
+    if (p.ingressApproach != 0) {
+        w.key("ingressApproach");
+        write_json(w, *(p.ingressApproach));
+    }
+    w.key("laneAttributes");
+    write_json(w, (p.laneAttributes));
+    w.key("laneID");
+    write_json(w, (p.laneID));
+    if (p.maneuvers != 0) {
+        w.key("maneuvers");
+        write_json_AllowedManeuvers(w, *(p.maneuvers));
+    }
+    w.key("nodeList");
+    write_json(w, (p.nodeList));
+    if (p.overlays != 0) {
+        w.key("overlays");
+        write_json(w, *(p.overlays));
+    }
+    w.end_object();
+}
+
+/*
+*   LaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const LaneList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   RoadLaneSetList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadLaneSetList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   RoadSegment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadSegment& p) {
+    w.begin_object();
+    w.key("id");
+    write_json(w, (p.id));
+    if (p.laneWidth != 0) {
+        w.key("laneWidth");
+        write_json(w, *(p.laneWidth));
+    }
+    w.key("refPoint");
+    write_json(w, (p.refPoint));
+    w.key("revision");
+    write_json(w, (p.revision));
+    w.key("roadLaneSet");
+    write_json(w, (p.roadLaneSet));
+    if (p.speedLimits != 0) {
+        w.key("speedLimits");
+        write_json(w, *(p.speedLimits));
+    }
+    w.end_object();
+}
+
+/*
+*   RoadSegmentList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadSegmentList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   SensorInformation - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SensorInformation& p) {
+    w.begin_object();
+    w.key("detectionArea");
+    write_json(w, (p.detectionArea));
+    if (p.freeSpaceConfidence != 0) {
+        w.key("freeSpaceConfidence");
+        write_json(w, *(p.freeSpaceConfidence));
+    }
+    w.key("sensorID");
+    write_json(w, (p.sensorID));
+    w.key("type");
+    write_json(w, (p.type));
+    w.end_object();
+}
+
+/*
+*   FreeSpaceAddendumContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const FreeSpaceAddendumContainer& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   SPATEM - Type SEQUENCE
+*   From SPATEM-PDU-Descriptions - File TS103301v211-SPATEM.asn
+*/
+
+void write_json(JsonWriter& w, const SPATEM& p) {
+    w.begin_object();
+    w.key("header");
+    write_json(w, (p.header));
+    w.key("spat");
+    write_json(w, (p.spat));
+    w.end_object();
+}
+
+/*
+*   VamParameters - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VamParameters& p) {
+    w.begin_object();
+    w.key("basicContainer");
+    write_json(w, (p.basicContainer));
+    if (p.vruClusterInformationContainer != 0) {
+        w.key("vruClusterInformationContainer");
+        write_json(w, *(p.vruClusterInformationContainer));
+    }
+    if (p.vruClusterOperationContainer != 0) {
+        w.key("vruClusterOperationContainer");
+        write_json(w, *(p.vruClusterOperationContainer));
+    }
+    if (p.vruHighFrequencyContainer != 0) {
+        w.key("vruHighFrequencyContainer");
+        write_json(w, *(p.vruHighFrequencyContainer));
+    }
+    if (p.vruLowFrequencyContainer != 0) {
+        w.key("vruLowFrequencyContainer");
+        write_json(w, *(p.vruLowFrequencyContainer));
+    }
+    if (p.vruMotionPredictionContainer != 0) {
+        w.key("vruMotionPredictionContainer");
+        write_json(w, *(p.vruMotionPredictionContainer));
+    }
+    w.end_object();
+}
+
+/*
+*   IntersectionGeometry - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionGeometry& p) {
+    w.begin_object();
+    w.key("id");
+    write_json(w, (p.id));
+    w.key("laneSet");
+    write_json(w, (p.laneSet));
+    if (p.laneWidth != 0) {
+        w.key("laneWidth");
+        write_json(w, *(p.laneWidth));
+    }
+    w.key("refPoint");
+    write_json(w, (p.refPoint));
+    w.key("revision");
+    write_json(w, (p.revision));
+    if (p.speedLimits != 0) {
+        w.key("speedLimits");
+        write_json(w, *(p.speedLimits));
+    }
+    w.end_object();
+}
+
+/*
+*   IntersectionGeometryList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionGeometryList& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   SensorInformationContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SensorInformationContainer& p) {
+    if (p.list.count == 0) {
+        w.null();
+        return;
+    }
+    w.begin_array();
+    for (int i = 0; i < p.list.count; i++) {
+        write_json(w, *(p.list.array[i]));
+    }
+    w.end_array();
+}
+
+/*
+*   VruAwareness - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruAwareness& p) {
+    w.begin_object();
+    w.key("generationDeltaTime");
+    write_json(w, (p.generationDeltaTime));
+    w.key("vamParameters");
+    write_json(w, (p.vamParameters));
+    w.end_object();
+}
+
+/*
+*   MapData - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MapData_t& p) {
+    w.begin_object();
+    if (p.dataParameters != 0) {
+        w.key("dataParameters");
+        write_json(w, *(p.dataParameters));
+    }
+    if (p.intersections != 0) {
+        w.key("intersections");
+        write_json(w, *(p.intersections));
+    }
+    if (p.layerID != 0) {
+        w.key("layerID");
+        write_json(w, *(p.layerID));
+    }
+    if (p.layerType != 0) {
+        w.key("layerType");
+        write_json(w, *(p.layerType));
+    }
+    w.key("msgIssueRevision");
+    write_json(w, (p.msgIssueRevision));
+    if (p.restrictionList != 0) {
+        w.key("restrictionList");
+        write_json(w, *(p.restrictionList));
+    }
+    if (p.roadSegments != 0) {
+        w.key("roadSegments");
+        write_json(w, *(p.roadSegments));
+    }
+    if (p.timeStamp != 0) {
+        w.key("timeStamp");
+        write_json(w, *(p.timeStamp));
+    }
+    w.end_object();
+}
+
+/*
+*   CpmParameters - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CpmParameters& p) {
+    w.begin_object();
+    if (p.freeSpaceAddendumContainer != 0) {
+        w.key("freeSpaceAddendumContainer");
+        write_json(w, *(p.freeSpaceAddendumContainer));
+    }
+    w.key("managementContainer");
+    write_json(w, (p.managementContainer));
+    w.key("numberOfPerceivedObjects");
+    write_json(w, (p.numberOfPerceivedObjects));
+    if (p.perceivedObjectContainer != 0) {
+        w.key("perceivedObjectContainer");
+        write_json(w, *(p.perceivedObjectContainer));
+    }
+    if (p.sensorInformationContainer != 0) {
+        w.key("sensorInformationContainer");
+        write_json(w, *(p.sensorInformationContainer));
+    }
+    if (p.stationDataContainer != 0) {
+        w.key("stationDataContainer");
+        write_json(w, *(p.stationDataContainer));
+    }
+    w.end_object();
+}
+
+/*
+*   MAPEM - Type SEQUENCE
+*   From MAPEM-PDU-Descriptions - File TS103301v211-MAPEM.asn
+*/
+
+void write_json(JsonWriter& w, const MAPEM& p) {
+    w.begin_object();
+    w.key("header");
+    write_json(w, (p.header));
+    w.key("map");
+    write_json(w, (p.map));
+    w.end_object();
+}
+
+/*
+*   VAM - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VAM& p) {
+    w.begin_object();
+    w.key("header");
+    write_json(w, (p.header));
+    w.key("vam");
+    write_json(w, (p.vam));
+    w.end_object();
+}
+
+/*
+*   CollectivePerceptionMessage - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CollectivePerceptionMessage& p) {
+    w.begin_object();
+    w.key("cpmParameters");
+    write_json(w, (p.cpmParameters));
+    w.key("generationDeltaTime");
+    write_json(w, (p.generationDeltaTime));
+    w.end_object();
+}
+
+/*
+*   CPM - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CPM& p) {
+    w.begin_object();
+    w.key("cpm");
+    write_json(w, (p.cpm));
+    w.key("header");
+    write_json(w, (p.header));
+    w.end_object();
+}
@@ -0,0 +1,1759 @@
+/*
+*   Streaming JSON writer functions producing the same output as nlohmann::json without building a DOM
+*   Auto-generated from the asn1 directory by asn1json.py on 2026-10-16 17:35:55.337328
+*/
+
+#ifndef ASN1_JSON_WRITER_HPP
+#define ASN1_JSON_WRITER_HPP
+
+#include "json_writer.hpp"
+#include <type_traits>
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/denm.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/vam.hpp>
+#include <vanetza/asn1/spatem.hpp>
+#include <vanetza/asn1/mapem.hpp>
+
+#include <vanetza/asn1/its/NodeXY.h>
+#include <vanetza/asn1/its/VehicleID.h>
+#include <vanetza/asn1/its/TransitVehicleStatus.h>
+#include <vanetza/asn1/its/TransmissionAndSpeed.h>
+#include <vanetza/asn1/its/DigitalMap.h>
+#include <vanetza/asn1/its/Position3D.h>
+#include <vanetza/asn1/its/IntersectionAccessPoint.h>
+#include <vanetza/asn1/its/ComputedLane.h>
+#include <vanetza/asn1/its/AdvisorySpeedList.h>
+#include <vanetza/asn1/its/ConnectionManeuverAssist.h>
+#include <vanetza/asn1/its/DataParameters.h>
+#include <vanetza/asn1/its/EnabledLaneList.h>
+
+template<typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type write_json(JsonWriter& w, T v) {
+    w.value(v);
+}
+
+void write_json(JsonWriter& w, const TimestampIts_t& p);
+
+
+/*
+*   ItsPduHeader - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ItsPduHeader_t& p);
+
+
+/*
+*   DeltaReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const DeltaReferencePosition_t& p);
+
+
+/*
+*   Altitude - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Altitude& p);
+
+
+/*
+*   PosConfidenceEllipse - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PosConfidenceEllipse& p);
+
+
+/*
+*   PathPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PathPoint& p);
+
+
+/*
+*   PtActivationData - Type OCTET STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PtActivationData_t& p);
+
+
+/*
+*   AccelerationControl - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_AccelerationControl(JsonWriter& w, const AccelerationControl_t& p);
+
+
+/*
+*   CauseCode - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const CauseCode& p);
+
+
+/*
+*   Curvature - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Curvature& p);
+
+
+/*
+*   Heading - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Heading& p);
+
+
+/*
+*   DrivingLaneStatus - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_DrivingLaneStatus(JsonWriter& w, const DrivingLaneStatus_t& p);
+
+
+/*
+*   Speed - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Speed& p);
+
+
+/*
+*   LongitudinalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const LongitudinalAcceleration& p);
+
+
+/*
+*   LateralAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const LateralAcceleration& p);
+
+
+/*
+*   VerticalAcceleration - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const VerticalAcceleration_t& p);
+
+
+/*
+*   ExteriorLights - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_ExteriorLights(JsonWriter& w, const ExteriorLights_t& p);
+
+
+/*
+*   DangerousGoodsExtended - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const DangerousGoodsExtended& p);
+
+
+/*
+*   SpecialTransportType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_SpecialTransportType(JsonWriter& w, const SpecialTransportType_t& p);
+
+
+/*
+*   LightBarSirenInUse - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_LightBarSirenInUse(JsonWriter& w, const LightBarSirenInUse_t& p);
+
+
+/*
+*   PositionOfOccupants - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_PositionOfOccupants(JsonWriter& w, const PositionOfOccupants_t& p);
+
+
+/*
+*   VehicleIdentification - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleIdentification& p);
+
+
+/*
+*   EnergyStorageType - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_EnergyStorageType(JsonWriter& w, const EnergyStorageType_t& p);
+
+
+/*
+*   VehicleLength - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleLength_t& p);
+
+
+/*
+*   PathHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PathHistory& p);
+
+
+/*
+*   EmergencyPriority - Type BIT STRING
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json_EmergencyPriority(JsonWriter& w, const EmergencyPriority_t& p);
+
+
+/*
+*   SteeringWheelAngle - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const SteeringWheelAngle& p);
+
+
+/*
+*   YawRate - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const YawRate& p);
+
+
+/*
+*   ActionID - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ActionID& p);
+
+
+/*
+*   ProtectedCommunicationZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ProtectedCommunicationZone& p);
+
+
+/*
+*   Traces - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const Traces& p);
+
+
+/*
+*   PositionOfPillars - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PositionOfPillars& p);
+
+
+/*
+*   RestrictedTypes - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictedTypes& p);
+
+
+/*
+*   EventPoint - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const EventPoint& p);
+
+
+/*
+*   ProtectedCommunicationZonesRSU - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ProtectedCommunicationZonesRSU& p);
+
+
+/*
+*   CenDsrcTollingZone - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const CenDsrcTollingZone& p);
+
+
+/*
+*   BasicVehicleContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const BasicVehicleContainerHighFrequency& p);
+
+
+/*
+*   BasicVehicleContainerLowFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const BasicVehicleContainerLowFrequency& p);
+
+
+/*
+*   SpecialTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const SpecialTransportContainer& p);
+
+
+/*
+*   DangerousGoodsContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const DangerousGoodsContainer& p);
+
+
+/*
+*   RescueContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const RescueContainer& p);
+
+
+/*
+*   EmergencyContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const EmergencyContainer& p);
+
+
+/*
+*   SafetyCarContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const SafetyCarContainer& p);
+
+
+/*
+*   RSUContainerHighFrequency - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const RSUContainerHighFrequency& p);
+
+
+/*
+*   LocationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const LocationContainer& p);
+
+
+/*
+*   ImpactReductionContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const ImpactReductionContainer& p);
+
+
+/*
+*   StationaryVehicleContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const StationaryVehicleContainer& p);
+
+
+/*
+*   ReferenceDenms - Type SEQUENCE OF
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const ReferenceDenms& p);
+
+
+/*
+*   VruProfileAndSubprofile - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruProfileAndSubprofile& p);
+
+
+/*
+*   VruSpecificExteriorLights - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json_VruSpecificExteriorLights(JsonWriter& w, const VruSpecificExteriorLights_t& p);
+
+
+/*
+*   ClusterProfiles - Type BIT STRING
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json_ClusterProfiles(JsonWriter& w, const ClusterProfiles_t& p);
+
+
+/*
+*   ClusterJoinInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterJoinInfo& p);
+
+
+/*
+*   ClusterLeaveInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterLeaveInfo& p);
+
+
+/*
+*   ClusterBreakupInfo - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterBreakupInfo& p);
+
+
+/*
+*   VruSafeDistanceIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruSafeDistanceIndication& p);
+
+
+/*
+*   TrajectoryInterceptionIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const TrajectoryInterceptionIndication& p);
+
+
+/*
+*   HeadingChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const HeadingChangeIndication& p);
+
+
+/*
+*   AccelerationChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const AccelerationChangeIndication& p);
+
+
+/*
+*   StabilityChangeIndication - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const StabilityChangeIndication& p);
+
+
+/*
+*   AdvisorySpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const AdvisorySpeed& p);
+
+
+/*
+*   AdvisorySpeedList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const AdvisorySpeedList_t& p);
+
+
+/*
+*   ComputedLane::ComputedLane__offsetXaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ComputedLane::ComputedLane__offsetXaxis& p);
+
+
+/*
+*   ComputedLane::ComputedLane__offsetYaxis - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ComputedLane::ComputedLane__offsetYaxis& p);
+
+
+/*
+*   ComputedLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ComputedLane_t& p);
+
+
+/*
+*   ConnectionManeuverAssist - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ConnectionManeuverAssist_t& p);
+
+
+/*
+*   DataParameters - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const DataParameters_t& p);
+
+
+/*
+*   EnabledLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const EnabledLaneList_t& p);
+
+
+/*
+*   IntersectionAccessPoint - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionAccessPoint_t& p);
+
+
+/*
+*   IntersectionReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionReferenceID& p);
+
+
+/*
+*   LaneSharing - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneSharing(JsonWriter& w, const LaneSharing_t& p);
+
+
+/*
+*   ManeuverAssistList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ManeuverAssistList& p);
+
+
+/*
+*   Node-LLmD-64b - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const Node_LLmD_64b& p);
+
+
+/*
+*   OverlayLaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const OverlayLaneList& p);
+
+
+/*
+*   Position3D - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const Position3D_t& p);
+
+
+/*
+*   RestrictionUserType - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionUserType& p);
+
+
+/*
+*   RoadSegmentReferenceID - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadSegmentReferenceID& p);
+
+
+/*
+*   TimeChangeDetails - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const TimeChangeDetails& p);
+
+
+/*
+*   TransmissionAndSpeed - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const TransmissionAndSpeed_t& p);
+
+
+/*
+*   VehicleID - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleID_t& p);
+
+
+/*
+*   AllowedManeuvers - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_AllowedManeuvers(JsonWriter& w, const AllowedManeuvers_t& p);
+
+
+/*
+*   IntersectionStatusObject - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_IntersectionStatusObject(JsonWriter& w, const IntersectionStatusObject_t& p);
+
+
+/*
+*   LaneAttributes-Barrier - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Barrier(JsonWriter& w, const LaneAttributes_Barrier_t& p);
+
+
+/*
+*   LaneAttributes-Bike - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Bike(JsonWriter& w, const LaneAttributes_Bike_t& p);
+
+
+/*
+*   LaneAttributes-Crosswalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Crosswalk(JsonWriter& w, const LaneAttributes_Crosswalk_t& p);
+
+
+/*
+*   LaneAttributes-Parking - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Parking(JsonWriter& w, const LaneAttributes_Parking_t& p);
+
+
+/*
+*   LaneAttributes-Sidewalk - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Sidewalk(JsonWriter& w, const LaneAttributes_Sidewalk_t& p);
+
+
+/*
+*   LaneAttributes-Striping - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Striping(JsonWriter& w, const LaneAttributes_Striping_t& p);
+
+
+/*
+*   LaneAttributes-TrackedVehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_TrackedVehicle(JsonWriter& w, const LaneAttributes_TrackedVehicle_t& p);
+
+
+/*
+*   LaneAttributes-Vehicle - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneAttributes_Vehicle(JsonWriter& w, const LaneAttributes_Vehicle_t& p);
+
+
+/*
+*   LaneDirection - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_LaneDirection(JsonWriter& w, const LaneDirection_t& p);
+
+
+/*
+*   TransitVehicleStatus - Type BIT STRING
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json_TransitVehicleStatus(JsonWriter& w, const TransitVehicleStatus_t& p);
+
+
+/*
+*   Node-XY-20b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_20b& p);
+
+
+/*
+*   Node-XY-22b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_22b& p);
+
+
+/*
+*   Node-XY-24b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_24b& p);
+
+
+/*
+*   Node-XY-26b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_26b& p);
+
+
+/*
+*   Node-XY-28b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_28b& p);
+
+
+/*
+*   Node-XY-32b - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const Node_XY_32b& p);
+
+
+/*
+*   NodeAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeAttributeXYList& p);
+
+
+/*
+*   RegulatorySpeedLimit - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const RegulatorySpeedLimit& p);
+
+
+/*
+*   SegmentAttributeXYList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const SegmentAttributeXYList& p);
+
+
+/*
+*   SpeedLimitList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const SpeedLimitList& p);
+
+
+/*
+*   OriginatingRSUContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OriginatingRSUContainer& p);
+
+
+/*
+*   VehicleSensorProperties - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSensorProperties& p);
+
+
+/*
+*   ObjectDistanceWithConfidence - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectDistanceWithConfidence& p);
+
+
+/*
+*   ObjectDimension - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectDimension& p);
+
+
+/*
+*   CartesianAngle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CartesianAngle& p);
+
+
+/*
+*   WGS84Angle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const WGS84Angle& p);
+
+
+/*
+*   SpeedExtended - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SpeedExtended& p);
+
+
+/*
+*   SensorIdList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SensorIdList& p);
+
+
+/*
+*   TrailerData - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const TrailerData& p);
+
+
+/*
+*   LongitudinalLanePosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const LongitudinalLanePosition& p);
+
+
+/*
+*   MatchedPosition - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const MatchedPosition& p);
+
+
+/*
+*   PerceivedObjectContainerSegmentInfo - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PerceivedObjectContainerSegmentInfo& p);
+
+
+/*
+*   VehicleSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSubclass& p);
+
+
+/*
+*   PersonSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PersonSubclass& p);
+
+
+/*
+*   AnimalSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AnimalSubclass& p);
+
+
+/*
+*   OtherSubclass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OtherSubclass& p);
+
+
+/*
+*   NodeOffsetPointZ - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const NodeOffsetPointZ& p);
+
+
+/*
+*   ReferencePosition - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ReferencePosition& p);
+
+
+/*
+*   PtActivation - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const PtActivation& p);
+
+
+/*
+*   ClosedLanes - Type SEQUENCE
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ClosedLanes& p);
+
+
+/*
+*   ItineraryPath - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const ItineraryPath& p);
+
+
+/*
+*   EventHistory - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const EventHistory& p);
+
+
+/*
+*   DigitalMap - Type SEQUENCE OF
+*   From ITS-Container - File TS102894-2v131-CDD.asn
+*/
+
+void write_json(JsonWriter& w, const DigitalMap_t& p);
+
+
+/*
+*   HighFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const HighFrequencyContainer& p);
+
+
+/*
+*   LowFrequencyContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const LowFrequencyContainer& p);
+
+
+/*
+*   BasicContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const BasicContainer& p);
+
+
+/*
+*   PublicTransportContainer - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const PublicTransportContainer& p);
+
+
+/*
+*   RoadWorksContainerBasic - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const RoadWorksContainerBasic& p);
+
+
+/*
+*   ManagementContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const ManagementContainer& p);
+
+
+/*
+*   SituationContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const SituationContainer& p);
+
+
+/*
+*   RoadWorksContainerExtended - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const RoadWorksContainerExtended& p);
+
+
+/*
+*   AlacarteContainer - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const AlacarteContainer& p);
+
+
+/*
+*   MapPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const MapPosition& p);
+
+
+/*
+*   VruExteriorLights - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruExteriorLights& p);
+
+
+/*
+*   VruClusterOperationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruClusterOperationContainer& p);
+
+
+/*
+*   VruPathPoint - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruPathPoint& p);
+
+
+/*
+*   SequenceOfVruSafeDistanceIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const SequenceOfVruSafeDistanceIndication& p);
+
+
+/*
+*   SequenceOfTrajectoryInterceptionIndication - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const SequenceOfTrajectoryInterceptionIndication& p);
+
+
+/*
+*   ConnectingLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ConnectingLane& p);
+
+
+/*
+*   Connection - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const Connection& p);
+
+
+/*
+*   LaneTypeAttributes - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const LaneTypeAttributes& p);
+
+
+/*
+*   MovementEvent - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementEvent& p);
+
+
+/*
+*   RestrictionUserTypeList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionUserTypeList& p);
+
+
+/*
+*   LaneDataAttribute - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const LaneDataAttribute& p);
+
+
+/*
+*   LaneDataAttributeList - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const LaneDataAttributeList& p);
+
+
+/*
+*   NodeOffsetPointXY - Type CHOICE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeOffsetPointXY& p);
+
+
+/*
+*   NodeAttributeSetXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeAttributeSetXY_t& p);
+
+
+/*
+*   CpmManagementContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CpmManagementContainer& p);
+
+
+/*
+*   VehicleSensorPropertyList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSensorPropertyList& p);
+
+
+/*
+*   TrailerDataContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const TrailerDataContainer& p);
+
+
+/*
+*   ObjectClass::ObjectClass__class - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectClass::ObjectClass__class& p);
+
+
+/*
+*   ObjectClass - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectClass_t& p);
+
+
+/*
+*   OffsetPoint - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OffsetPoint& p);
+
+
+/*
+*   SpecialVehicleContainer - Type CHOICE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const SpecialVehicleContainer& p);
+
+
+/*
+*   DecentralizedEnvironmentalNotificationMessage - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const DecentralizedEnvironmentalNotificationMessage& p);
+
+
+/*
+*   NonIslandLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const NonIslandLanePosition& p);
+
+
+/*
+*   VruLowFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruLowFrequencyContainer& p);
+
+
+/*
+*   SequenceOfVruPathPoint - Type SEQUENCE OF
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const SequenceOfVruPathPoint& p);
+
+
+/*
+*   ConnectsToList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const ConnectsToList& p);
+
+
+/*
+*   LaneAttributes - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const LaneAttributes& p);
+
+
+/*
+*   MovementEventList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementEventList& p);
+
+
+/*
+*   MovementState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementState& p);
+
+
+/*
+*   RestrictionClassAssignment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionClassAssignment& p);
+
+
+/*
+*   RestrictionClassList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RestrictionClassList& p);
+
+
+/*
+*   NodeXY - Type SEQUENCE
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeXY_t& p);
+
+
+/*
+*   OriginatingVehicleContainer - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const OriginatingVehicleContainer& p);
+
+
+/*
+*   VehicleSensor - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const VehicleSensor& p);
+
+
+/*
+*   AreaCircular - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaCircular& p);
+
+
+/*
+*   AreaEllipse - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaEllipse& p);
+
+
+/*
+*   AreaRectangle - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaRectangle& p);
+
+
+/*
+*   PolyPointList - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PolyPointList& p);
+
+
+/*
+*   AreaRadial - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaRadial& p);
+
+
+/*
+*   ObjectClassDescription - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const ObjectClassDescription& p);
+
+
+/*
+*   CamParameters - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const CamParameters& p);
+
+
+/*
+*   DENM - Type SEQUENCE
+*   From DENM-PDU-Descriptions - File EN302637-3v131-DENM.asn
+*/
+
+void write_json(JsonWriter& w, const DENM& p);
+
+
+/*
+*   TrafficIslandPosition - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const TrafficIslandPosition& p);
+
+
+/*
+*   VruMotionPredictionContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruMotionPredictionContainer& p);
+
+
+/*
+*   MovementList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MovementList& p);
+
+
+/*
+*   NodeSetXY - Type SEQUENCE OF
+*   From DSRC-REGION-noCircular - File DSRC_REGION_noCircular.asn
+*/
+
+void write_json(JsonWriter& w, const NodeSetXY& p);
+
+
+/*
+*   StationDataContainer - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const StationDataContainer& p);
+
+
+/*
+*   PerceivedObject - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PerceivedObject& p);
+
+
+/*
+*   AreaPolygon - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const AreaPolygon& p);
+
+
+/*
+*   FreeSpaceArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const FreeSpaceArea& p);
+
+
+/*
+*   CoopAwareness - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const CoopAwareness& p);
+
+
+/*
+*   VruLanePosition - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruLanePosition& p);
+
+
+/*
+*   ClusterBoundingBoxShape - Type CHOICE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const ClusterBoundingBoxShape& p);
+
+
+/*
+*   IntersectionState - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionState& p);
+
+
+/*
+*   IntersectionStateList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionStateList& p);
+
+
+/*
+*   NodeListXY - Type CHOICE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const NodeListXY& p);
+
+
+/*
+*   PerceivedObjectContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const PerceivedObjectContainer_t& p);
+
+
+/*
+*   DetectionArea - Type CHOICE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const DetectionArea& p);
+
+
+/*
+*   FreeSpaceAddendum - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const FreeSpaceAddendum& p);
+
+
+/*
+*   CAM - Type SEQUENCE
+*   From CAM-PDU-Descriptions - File EN302637-2v141-CAM.asn
+*/
+
+void write_json(JsonWriter& w, const CAM& p);
+
+
+/*
+*   VruHighFrequencyContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruHighFrequencyContainer& p);
+
+
+/*
+*   VruClusterInformationContainer - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruClusterInformationContainer& p);
+
+
+/*
+*   SPAT - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const SPAT& p);
+
+
+/*
+*   GenericLane - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const GenericLane& p);
+
+
+/*
+*   LaneList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const LaneList& p);
+
+
+/*
+*   RoadLaneSetList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadLaneSetList& p);
+
+
+/*
+*   RoadSegment - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadSegment& p);
+
+
+/*
+*   RoadSegmentList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const RoadSegmentList& p);
+
+
+/*
+*   SensorInformation - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SensorInformation& p);
+
+
+/*
+*   FreeSpaceAddendumContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const FreeSpaceAddendumContainer& p);
+
+
+/*
+*   SPATEM - Type SEQUENCE
+*   From SPATEM-PDU-Descriptions - File TS103301v211-SPATEM.asn
+*/
+
+void write_json(JsonWriter& w, const SPATEM& p);
+
+
+/*
+*   VamParameters - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VamParameters& p);
+
+
+/*
+*   IntersectionGeometry - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionGeometry& p);
+
+
+/*
+*   IntersectionGeometryList - Type SEQUENCE OF
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const IntersectionGeometryList& p);
+
+
+/*
+*   SensorInformationContainer - Type SEQUENCE OF
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const SensorInformationContainer& p);
+
+
+/*
+*   VruAwareness - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VruAwareness& p);
+
+
+/*
+*   MapData - Type SEQUENCE
+*   From DSRC - File DSRC.asn
+*/
+
+void write_json(JsonWriter& w, const MapData_t& p);
+
+
+/*
+*   CpmParameters - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CpmParameters& p);
+
+
+/*
+*   MAPEM - Type SEQUENCE
+*   From MAPEM-PDU-Descriptions - File TS103301v211-MAPEM.asn
+*/
+
+void write_json(JsonWriter& w, const MAPEM& p);
+
+
+/*
+*   VAM - Type SEQUENCE
+*   From VAM-PDU-Descriptions - File TS103300-3v211-VAM.asn
+*/
+
+void write_json(JsonWriter& w, const VAM& p);
+
+
+/*
+*   CollectivePerceptionMessage - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CollectivePerceptionMessage& p);
+
+
+/*
+*   CPM - Type SEQUENCE
+*   From CPM-PDU-Descriptions - File TR103562v211-CPM.asn
+*/
+
+void write_json(JsonWriter& w, const CPM& p);
+
+
+#endif
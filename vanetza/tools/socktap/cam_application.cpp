@@ -21,8 +21,6 @@ std::map<long, std::map<std::string, double>> persistence;
 
 prometheus::Counter *cam_rx_counter;
 prometheus::Counter *cam_tx_counter;
-prometheus::Counter *cam_rx_latency;
-prometheus::Counter *cam_tx_latency;
 
 boost::asio::io_service cam_io_service_;
 ip::udp::socket cam_udp_socket(cam_io_service_);
@@ -35,6 +33,22 @@ double time_speed = 0;
 HeadingValue_t last_heading = LLONG_MIN;
 double time_heading = 0;
 
+namespace
+{
+
+// simplified CAM values are given in SI units unless they are equal to the "unavailable" value
+long scaled(double value, double factor, double unavailable)
+{
+    return (value == unavailable) ? (long) value : (long) (value * factor);
+}
+
+long scaled(double value, double factor, double unavailable, double other_unavailable)
+{
+    return (value == unavailable || value == other_unavailable) ? (long) value : (long) (value * factor);
+}
+
+} // namespace
+
 CamApplication::CamApplication(PositionProvider& positioning, Runtime& rt, Mqtt *mqtt_, Dds* dds_, config_t config_s_, metrics_t metrics_s_) :
     positioning_(positioning), runtime_(rt), cam_interval_(seconds(1)), mqtt(mqtt_), dds(dds_), config_s(config_s_), metrics_s(metrics_s_)
 {
@@ -46,8 +60,7 @@ CamApplication::CamApplication(PositionProvider& positioning, Runtime& rt, Mqtt
     
     cam_rx_counter = &((*metrics_s.packet_counter).Add({{"message", "cam"}, {"direction", "rx"}}));
     cam_tx_counter = &((*metrics_s.packet_counter).Add({{"message", "cam"}, {"direction", "tx"}}));
-    cam_rx_latency = &((*metrics_s.latency_counter).Add({{"message", "cam"}, {"direction", "rx"}}));
-    cam_tx_latency = &((*metrics_s.latency_counter).Add({{"message", "cam"}, {"direction", "tx"}}));
+    init_metrics(metrics_s, "cam");
 
     if(config_s.cam.udp_out_port != 0) {
         cam_udp_socket.open(ip::udp::v4());
@@ -69,22 +82,18 @@ CamApplication::PortType CamApplication::port()
 
 void CamApplication::indicate(const DataIndication& indication, UpPacketPtr packet)
 {
-    struct indication_visitor : public boost::static_visitor<CohesivePacket>
-    {
-        CohesivePacket operator()(CohesivePacket& packet) {return packet;}
-        CohesivePacket operator()(ChunkPacket& packet) {return CohesivePacket(std::move(ByteBuffer()), OsiLayer::Physical);}
-    } ivis;
-
-    UpPacket* packet_ptr = packet.get();
-    CohesivePacket cp = boost::apply_visitor(ivis, *packet_ptr);
-
-    asn1::PacketVisitor<asn1::Cam> visitor;
-    std::shared_ptr<const asn1::Cam> cam = boost::apply_visitor(visitor, *packet);
+    PipelineStopwatch stopwatch = rx_stopwatch();
+    std::shared_ptr<const asn1::Cam> cam = decode<asn1::Cam>(*packet);
+    if (!cam) {
+        return;
+    }
+    stopwatch.lap(PipelineStage::UperDecode);
 
     //std::cout << "CAM application received a packet with " << (cam ? "decodable" : "broken") << " content" << std::endl;
 
     CAM_t cam_t = {(*cam)->header, (*cam)->cam};
-    string cam_json = buildJSON(cam_t, cp.time_received, cp.rssi, true);
+    const string& cam_json = buildJSON(cam_t, indication.time_received, indication.rssi, true);
+    stopwatch.lap(PipelineStage::JsonBuild);
 
     if(config_s.cam.mqtt_enabled) mqtt->publish(config_s.cam.topic_out, cam_json);
     if(config_s.cam.dds_enabled) dds->publish(config_s.cam.topic_out, cam_json);
@@ -92,22 +101,31 @@ void CamApplication::indicate(const DataIndication& indication, UpPacketPtr pack
     cam_rx_counter->Increment();
 
     if(config_s.full_cam_topic_out != "") { 
-        json fields_json = cam_t;
-        json full_json = {
-            {"timestamp", cp.time_received},
-            {"rssi", cp.rssi},
-            {"others", {
-                "json_timestamp", (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0}
-            },
-            {"fields", fields_json}
-        };
-        string json_dump = full_json.dump();
+        json_buffer_.clear();
+        JsonWriter w(json_buffer_);
+        w.begin_object();
+        w.key("fields");
+        write_json(w, cam_t);
+        w.key("others");
+        w.begin_array();
+        w.value("json_timestamp");
+        w.value((double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0);
+        w.end_array();
+        w.key("rssi");
+        w.value(indication.rssi);
+        w.key("timestamp");
+        w.value(indication.time_received);
+        w.end_object();
+        const string& json_dump = json_buffer_;
         if(config_s.cam.mqtt_enabled && config_s.full_cam_topic_out != "") mqtt->publish(config_s.full_cam_topic_out, json_dump);
         if(config_s.cam.dds_enabled && config_s.full_cam_topic_out != "") dds->publish(config_s.full_cam_topic_out, json_dump);
         if(config_s.cam.udp_out_port != 0) {
             cam_udp_socket.send_to(buffer(json_dump, json_dump.length()), cam_remote_endpoint, 0, cam_err);
         }
     }
+
+    stopwatch.lap(PipelineStage::Publish);
+    stopwatch.finish();
 }
 
 void CamApplication::schedule_timer()
@@ -115,16 +133,14 @@ void CamApplication::schedule_timer()
     runtime_.schedule(cam_interval_, std::bind(&CamApplication::on_timer, this, std::placeholders::_1), this);
 }
 
-std::string CamApplication::buildJSON(CAM_t message, double time_reception, int rssi, bool include_fields) { 
-    ItsPduHeader_t& header = message.header;
-    CoopAwareness_t& cam = message.cam;
-    BasicContainer_t& basic = cam.camParameters.basicContainer;
-    BasicVehicleContainerHighFrequency& bvc = cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
-    AccelerationControl_t* acc = cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.accelerationControl;
-    //json j = cam;
-    //std::cout << "CAM JSON: " << j << std::endl;
+const std::string& CamApplication::buildJSON(const CAM_t& message, double time_reception, int rssi, bool include_fields) {
+    const ItsPduHeader_t& header = message.header;
+    const CoopAwareness_t& cam = message.cam;
+    const BasicContainer_t& basic = cam.camParameters.basicContainer;
+    const BasicVehicleContainerHighFrequency& bvc = cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
+    const AccelerationControl_t* acc = bvc.accelerationControl;
 
-    string driveDirection = "UNAVAILABLE"; 
+    const char* driveDirection = "UNAVAILABLE";
     switch(bvc.driveDirection) {
         case(0):
             driveDirection = "FORWARD";
@@ -137,6 +153,10 @@ std::string CamApplication::buildJSON(CAM_t message, double time_reception, int
             break;
     }
 
+    auto engaged = [acc](int bit) {
+        return acc && acc->size > 0 && (bool) (*(acc->buf) & (1 << (7-bit)));
+    };
+
     long latitude = (long) basic.referencePosition.latitude;
     long longitude = (long) basic.referencePosition.longitude;
 
@@ -146,73 +166,99 @@ std::string CamApplication::buildJSON(CAM_t message, double time_reception, int
 
     const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
 
-    json json_payload = {
-            {"stationID", (long) header.stationID},
-            {"stationType", (long) basic.stationType},
-            {"latitude", (latitude == 900000001) ? latitude : (double) ((double) latitude / pow(10, 7))},
-            {"longitude", (longitude == 1800000001) ? longitude : (double) ((double) longitude / pow(10, 7))},
-            {"semiMajorConf", (long) basic.referencePosition.positionConfidenceEllipse.semiMajorConfidence},
-            {"semiMinorConf", (long) basic.referencePosition.positionConfidenceEllipse.semiMinorConfidence},
-            {"semiMajorOrient", (long) basic.referencePosition.positionConfidenceEllipse.semiMajorOrientation},
-            {"altitude", (basic.referencePosition.altitude.altitudeValue == 800001) ? (long) basic.referencePosition.altitude.altitudeValue : (double) ((double) basic.referencePosition.altitude.altitudeValue / pow(10, 2))},
-            {"altitudeConf", (long) basic.referencePosition.altitude.altitudeConfidence},
-            {"heading", (((long) bvc.heading.headingValue) == 3601) ? ((long) bvc.heading.headingValue) : (double) ((double) bvc.heading.headingValue / pow(10, 1))},
-            {"headingConf", ((bvc.heading.headingConfidence) == 126 || (bvc.heading.headingConfidence) == 127) ? (bvc.heading.headingConfidence) : (double) ((double) (bvc.heading.headingConfidence) / pow(10, 1))},
-            {"speed", ((bvc.speed.speedValue) == 16383) ? (bvc.speed.speedValue) : (double)((double) (bvc.speed.speedValue) / pow(10, 2))},
-            {"speedConf", ((bvc.speed.speedConfidence) == 126 || (bvc.speed.speedConfidence) == 127) ? (bvc.speed.speedConfidence) : (double) ((double)(bvc.speed.speedConfidence) / pow(10, 2))},
-            {"driveDirection", driveDirection},
-            {"length", ((bvc.vehicleLength.vehicleLengthValue) == 1023) ? (bvc.vehicleLength.vehicleLengthValue) : (double)((double) (bvc.vehicleLength.vehicleLengthValue) / pow(10, 1))},
-            {"width", ((bvc.vehicleWidth) == 61 || (bvc.vehicleWidth) == 62) ? (bvc.vehicleWidth) : (double)((double) (bvc.vehicleWidth) / pow(10,1))},
-            {"acceleration", ((bvc.longitudinalAcceleration.longitudinalAccelerationValue) == 161) ? (bvc.longitudinalAcceleration.longitudinalAccelerationValue) : (double)((double) (bvc.longitudinalAcceleration.longitudinalAccelerationValue) / pow(10,1))},
-            {"curvature", (long) bvc.curvature.curvatureValue},
-            {"yawRate", ((bvc.yawRate.yawRateValue) == 32767) ? (bvc.yawRate.yawRateValue) : (double)((double) (bvc.yawRate.yawRateValue) / pow(10,2))},
-            {"brakePedal", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-0)))},
-            {"gasPedal", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-1)))},
-            {"emergencyBrake", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-2)))},
-            {"collisionWarning", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-3)))},
-            {"accEngaged", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-4)))},
-            {"cruiseControl", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-5)))},
-            {"speedLimiter", (bool) (*(bvc.accelerationControl->buf) & (1 << (7-6)))},
-            {"specialVehicle", {
-                  {"publicTransportContainer", {
-                     {"embarkationStatus", false}
-                  }
-                  }
-            }}
-    };
-
+    // keys are written in lexicographical order as done by nlohmann::json
+    json_buffer_.clear();
+    JsonWriter w(json_buffer_);
+    w.begin_object();
+    w.key("accEngaged");
+    w.value(engaged(4));
+    w.key("acceleration");
+    w.value(((bvc.longitudinalAcceleration.longitudinalAccelerationValue) == 161) ? (bvc.longitudinalAcceleration.longitudinalAccelerationValue) : (double)((double) (bvc.longitudinalAcceleration.longitudinalAccelerationValue) / pow(10,1)));
+    w.key("altitude");
+    w.value((basic.referencePosition.altitude.altitudeValue == 800001) ? (long) basic.referencePosition.altitude.altitudeValue : (double) ((double) basic.referencePosition.altitude.altitudeValue / pow(10, 2)));
+    w.key("altitudeConf");
+    w.value((long) basic.referencePosition.altitude.altitudeConfidence);
+    w.key("brakePedal");
+    w.value(engaged(0));
+    w.key("collisionWarning");
+    w.value(engaged(3));
+    w.key("cruiseControl");
+    w.value(engaged(5));
+    w.key("curvature");
+    w.value((long) bvc.curvature.curvatureValue);
+    w.key("driveDirection");
+    w.value(driveDirection);
+    w.key("emergencyBrake");
+    w.value(engaged(2));
+    w.key("gasPedal");
+    w.value(engaged(1));
+    w.key("heading");
+    w.value((((long) bvc.heading.headingValue) == 3601) ? ((long) bvc.heading.headingValue) : (double) ((double) bvc.heading.headingValue / pow(10, 1)));
+    w.key("headingConf");
+    w.value(((bvc.heading.headingConfidence) == 126 || (bvc.heading.headingConfidence) == 127) ? (bvc.heading.headingConfidence) : (double) ((double) (bvc.heading.headingConfidence) / pow(10, 1)));
+    w.key("latitude");
+    w.value((latitude == 900000001) ? latitude : (double) ((double) latitude / pow(10, 7)));
+    w.key("length");
+    w.value(((bvc.vehicleLength.vehicleLengthValue) == 1023) ? (bvc.vehicleLength.vehicleLengthValue) : (double)((double) (bvc.vehicleLength.vehicleLengthValue) / pow(10, 1)));
+    w.key("longitude");
+    w.value((longitude == 1800000001) ? longitude : (double) ((double) longitude / pow(10, 7)));
     if(include_fields) {
-        json_payload["timestamp"] = time_reception;
-        json_payload["newInfo"] = new_info;
-        json_payload["rssi"] = rssi;
-        json_payload["test"] = {
-                {"json_timestamp", time_now}
-            };
-        json_payload["receiverID"] = config_s.station_id;
-        json_payload["receiverType"] = config_s.station_type;
+        w.key("newInfo");
+        w.value(new_info);
+        w.key("receiverID");
+        w.value(config_s.station_id);
+        w.key("receiverType");
+        w.value(config_s.station_type);
+        w.key("rssi");
+        w.value(rssi);
     }
+    w.key("semiMajorConf");
+    w.value((long) basic.referencePosition.positionConfidenceEllipse.semiMajorConfidence);
+    w.key("semiMajorOrient");
+    w.value((long) basic.referencePosition.positionConfidenceEllipse.semiMajorOrientation);
+    w.key("semiMinorConf");
+    w.value((long) basic.referencePosition.positionConfidenceEllipse.semiMinorConfidence);
+    w.key("specialVehicle");
+    w.begin_object();
+    w.key("publicTransportContainer");
+    w.begin_object();
+    w.key("embarkationStatus");
+    w.value(false);
+    w.end_object();
+    w.end_object();
+    w.key("speed");
+    w.value(((bvc.speed.speedValue) == 16383) ? (bvc.speed.speedValue) : (double)((double) (bvc.speed.speedValue) / pow(10, 2)));
+    w.key("speedConf");
+    w.value(((bvc.speed.speedConfidence) == 126 || (bvc.speed.speedConfidence) == 127) ? (bvc.speed.speedConfidence) : (double) ((double)(bvc.speed.speedConfidence) / pow(10, 2)));
+    w.key("speedLimiter");
+    w.value(engaged(6));
+    w.key("stationID");
+    w.value((long) header.stationID);
+    w.key("stationType");
+    w.value((long) basic.stationType);
+    if(include_fields) {
+        w.key("test");
+        w.begin_object();
+        w.key("json_timestamp");
+        w.value(time_now);
+        w.end_object();
+        w.key("timestamp");
+        w.value(time_reception);
+    }
+    w.key("width");
+    w.value(((bvc.vehicleWidth) == 61 || (bvc.vehicleWidth) == 62) ? (bvc.vehicleWidth) : (double)((double) (bvc.vehicleWidth) / pow(10,1)));
+    w.key("yawRate");
+    w.value(((bvc.yawRate.yawRateValue) == 32767) ? (bvc.yawRate.yawRateValue) : (double)((double) (bvc.yawRate.yawRateValue) / pow(10,2)));
+    w.end_object();
 
     if(new_info) persistence[header.stationID] = {{"lat", (double) latitude}, {"lng", (double) longitude}, {"time", time_reception}};
 
-    cam_rx_latency->Increment(time_now - time_reception);
-    return json_payload.dump();
+    return json_buffer_;
 }
 
 void CamApplication::on_message(string topic, string mqtt_message) {
 
-    const double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
-    json payload;
-
-    try {
-        payload = json::parse(mqtt_message);
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON spec\n" << e.what() << std::endl;
-        return;
-    } catch(...) {
-        std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
-        return;
-    }
+    PipelineStopwatch stopwatch = tx_stopwatch();
 
     vanetza::asn1::Cam message;
     ItsPduHeader_t& header = message->header;
@@ -220,94 +266,154 @@ void CamApplication::on_message(string topic, string mqtt_message) {
     header.messageID = ItsPduHeader__messageID_cam;
 
     if(topic == config_s.full_cam_topic_in) {
-        CoopAwareness_t cam;
         try {
-            cam = payload.get<CoopAwareness_t>();
-        } catch(nlohmann::detail::type_error& e) {
-            std::cout << "-- Vanetza ETSI Decoding Error --\nCheck that the message format follows ETSI spec\n" << e.what() << std::endl;
+            JsonReader reader(mqtt_message);
+            read_json(reader, message->cam);
+            reader.finish();
+        } catch(JsonReadError& e) {
+            std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON and ETSI spec\n" << e.what() << std::endl;
             return;
         } catch(...) {
             std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
             return;
         }
         header.stationID = config_s.station_id;
-        message->cam = cam;
     }
     else if(topic == config_s.cam.topic_in) {
         try {
-            CoopAwareness_t* cam = vanetza::asn1::allocate<CoopAwareness_t>();
-            header.stationID = payload["stationID"];
+            static const char* const keys[] = {
+                "stationID", "latitude", "longitude", "semiMajorConf", "semiMinorConf", "semiMajorOrient", "altitude", "altitudeConf", "stationType",
+                "heading", "headingConf", "speed", "speedConf", "driveDirection", "length", "width", "acceleration", "curvature", "yawRate",
+                "brakePedal", "gasPedal", "emergencyBrake", "collisionWarning", "accEngaged", "cruiseControl", "speedLimiter", "specialVehicle"
+            };
+            // all members but driveDirection (index 13) are mandatory
+            const std::uint64_t required = ((std::uint64_t(1) << 27) - 1) & ~(std::uint64_t(1) << 13);
+
+            CoopAwareness_t& cam = message->cam;
+            BasicContainer_t& basic = cam.camParameters.basicContainer;
+            cam.camParameters.highFrequencyContainer.present = HighFrequencyContainer_PR_basicVehicleContainerHighFrequency;
+            BasicVehicleContainerHighFrequency_t& bvc = cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
             const auto time_now = duration_cast<milliseconds>(runtime_.now().time_since_epoch());
             uint16_t gen_delta_time = time_now.count();
-            cam->generationDeltaTime = gen_delta_time * GenerationDeltaTime_oneMilliSec;
-            cam->camParameters.basicContainer.referencePosition.latitude = (payload["latitude"] == 900000001) ? (long) payload["latitude"] : (long) ((double) payload["latitude"] * pow(10, 7));
-            cam->camParameters.basicContainer.referencePosition.longitude = (payload["longitude"] == 1800000001) ? (long) payload["longitude"] : (long) ((double) payload["longitude"] * pow(10, 7));
-            cam->camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence = payload["semiMajorConf"];
-            cam->camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence = payload["semiMinorConf"];
-            cam->camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation = payload["semiMajorOrient"];
-            cam->camParameters.basicContainer.referencePosition.altitude.altitudeValue = (payload["altitude"] == 800001) ? (long) payload["altitude"] : (long) ((double) payload["altitude"] * pow(10, 2));
-            cam->camParameters.basicContainer.referencePosition.altitude.altitudeConfidence = payload["altitudeConf"];
-            cam->camParameters.basicContainer.stationType = payload["stationType"];
-            cam->camParameters.highFrequencyContainer.present = HighFrequencyContainer_PR_basicVehicleContainerHighFrequency;
-            cam->camParameters.highFrequencyContainer.choice.rsuContainerHighFrequency.protectedCommunicationZonesRSU = nullptr;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.heading.headingValue = (payload["heading"] == 3601) ? ((long) payload["heading"]) : (long) ((double) payload["heading"] * pow(10, 1));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.heading.headingConfidence = (payload["headingConf"] == 126 || payload["headingConf"] == 127) ? (long) payload["headingConf"] : (long) ((double) payload["headingConf"] * pow(10, 1));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.speed.speedValue = (payload["speed"] == 16383) ? (long) payload["speed"] : (long) ((double) payload["speed"] * pow(10, 2));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.speed.speedConfidence = (payload["speedConf"] == 126 || payload["speedConf"] == 127) ? (long) payload["speedConf"] : (long) ((double) payload["speedConf"] * pow(10, 2));
-            if(payload["driveDirection"] == "FORWARD") cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.driveDirection = DriveDirection_forward;
-            else if(payload["driveDirection"] == "BACKWARD") cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.driveDirection = DriveDirection_backward;
-            else cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.driveDirection = DriveDirection_unavailable;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.vehicleLength.vehicleLengthValue = (payload["length"] == 1023) ? (long) payload["length"] : (long) ((double) payload["length"] * pow(10, 1));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.vehicleWidth = (payload["width"] == 61 || payload["width"] == 62) ? (long) payload["width"] : (long) ((double) payload["width"] * pow(10,1));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.longitudinalAcceleration.longitudinalAccelerationValue = (payload["acceleration"] == 161) ? (long) payload["acceleration"] : (long) ((double) payload["acceleration"] * pow(10,1));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.curvature.curvatureValue = payload["curvature"];
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.yawRate.yawRateValue = (payload["yawRate"] == 32767) ? (long) payload["yawRate"] : (long) ((double) payload["yawRate"] * pow(10,2));
-            AccelerationControl_t* p_tmp = vanetza::asn1::allocate<AccelerationControl_t>();
-            bool brakePedalEngaged;
-            bool gasPedalEngaged;
-            bool emergencyBrakeEngaged;
-            bool collisionWarningEngaged;
-            bool accEngaged;
-            bool cruiseControlEngaged;
-            bool speedLimiterEngaged;
-            payload.at("brakePedal").get_to((brakePedalEngaged));
-            payload.at("gasPedal").get_to((gasPedalEngaged));
-            payload.at("emergencyBrake").get_to((emergencyBrakeEngaged));
-            payload.at("collisionWarning").get_to((collisionWarningEngaged));
-            payload.at("accEngaged").get_to((accEngaged));
-            payload.at("cruiseControl").get_to((cruiseControlEngaged));
-            payload.at("speedLimiter").get_to((speedLimiterEngaged));
-            p_tmp->size = (7 / 8) + 1;
-            p_tmp->bits_unused = (7 % 8) != 0 ? 8 - (7 % 8) : 0;
-            p_tmp->buf = (uint8_t *) calloc(1, sizeof(uint8_t) * p_tmp->size);
-            *(p_tmp->buf + (sizeof(uint8_t) * 0)) = (uint8_t) 0;
-            if (brakePedalEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 7);
-            if (gasPedalEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 6);
-            if (emergencyBrakeEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 5);
-            if (collisionWarningEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 4);
-            if (accEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 3);
-            if (cruiseControlEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 2);
-            if (speedLimiterEngaged) *(p_tmp->buf + (sizeof(uint8_t) * 0)) |= (1 << 1);
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.accelerationControl = p_tmp;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.lanePosition = nullptr;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.steeringWheelAngle = nullptr;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.lateralAcceleration = nullptr;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.verticalAcceleration = nullptr;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.performanceClass = nullptr;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.cenDsrcTollingZone = nullptr;
-            cam->camParameters.lowFrequencyContainer = nullptr;
-            cam->camParameters.specialVehicleContainer = nullptr;
-            cam->camParameters.specialVehicleContainer = vanetza::asn1::allocate<SpecialVehicleContainer_t>();
-            payload.at("specialVehicle").get_to(*(cam->camParameters.specialVehicleContainer));
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.longitudinalAcceleration.longitudinalAccelerationConfidence = AccelerationConfidence_unavailable;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.yawRate.yawRateConfidence = YawRateConfidence_unavailable;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.heading.headingConfidence = HeadingConfidence_unavailable;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.speed.speedConfidence = SpeedConfidence_unavailable;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.curvature.curvatureConfidence = CurvatureConfidence_unavailable;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.curvatureCalculationMode = CurvatureCalculationMode_yawRateUsed;
-            cam->camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency.vehicleLength.vehicleLengthConfidenceIndication = VehicleLengthConfidenceIndication_noTrailerPresent;
-            message->cam = *(cam);
-            delete cam;
+            cam.generationDeltaTime = gen_delta_time * GenerationDeltaTime_oneMilliSec;
+            bvc.driveDirection = DriveDirection_unavailable;
+
+            AccelerationControl_t* acceleration_control = vanetza::asn1::allocate<AccelerationControl_t>();
+            bvc.accelerationControl = acceleration_control;
+            acceleration_control->size = (7 / 8) + 1;
+            acceleration_control->bits_unused = (7 % 8) != 0 ? 8 - (7 % 8) : 0;
+            acceleration_control->buf = (uint8_t *) calloc(1, sizeof(uint8_t) * acceleration_control->size);
+
+            JsonReader reader(mqtt_message);
+            JsonReader::Members members(reader, keys);
+            while (members.next()) {
+                switch (members.index()) {
+                    case 0:
+                        header.stationID = reader.integer();
+                        break;
+                    case 1:
+                        basic.referencePosition.latitude = scaled(reader.number(), 1e7, 900000001);
+                        break;
+                    case 2:
+                        basic.referencePosition.longitude = scaled(reader.number(), 1e7, 1800000001);
+                        break;
+                    case 3:
+                        basic.referencePosition.positionConfidenceEllipse.semiMajorConfidence = reader.integer();
+                        break;
+                    case 4:
+                        basic.referencePosition.positionConfidenceEllipse.semiMinorConfidence = reader.integer();
+                        break;
+                    case 5:
+                        basic.referencePosition.positionConfidenceEllipse.semiMajorOrientation = reader.integer();
+                        break;
+                    case 6:
+                        basic.referencePosition.altitude.altitudeValue = scaled(reader.number(), 1e2, 800001);
+                        break;
+                    case 7:
+                        basic.referencePosition.altitude.altitudeConfidence = reader.integer();
+                        break;
+                    case 8:
+                        basic.stationType = reader.integer();
+                        break;
+                    case 9:
+                        bvc.heading.headingValue = scaled(reader.number(), 1e1, 3601);
+                        break;
+                    case 10:
+                        // validated but replaced by "unavailable" below
+                        reader.number();
+                        break;
+                    case 11:
+                        bvc.speed.speedValue = scaled(reader.number(), 1e2, 16383);
+                        break;
+                    case 12:
+                        // validated but replaced by "unavailable" below
+                        reader.number();
+                        break;
+                    case 13:
+                        if (!reader.null()) {
+                            const boost::string_ref direction = reader.string();
+                            if (direction == "FORWARD") bvc.driveDirection = DriveDirection_forward;
+                            else if (direction == "BACKWARD") bvc.driveDirection = DriveDirection_backward;
+                        }
+                        break;
+                    case 14:
+                        bvc.vehicleLength.vehicleLengthValue = scaled(reader.number(), 1e1, 1023);
+                        break;
+                    case 15:
+                        bvc.vehicleWidth = scaled(reader.number(), 1e1, 61, 62);
+                        break;
+                    case 16:
+                        bvc.longitudinalAcceleration.longitudinalAccelerationValue = scaled(reader.number(), 1e1, 161);
+                        break;
+                    case 17:
+                        bvc.curvature.curvatureValue = reader.integer();
+                        break;
+                    case 18:
+                        bvc.yawRate.yawRateValue = scaled(reader.number(), 1e2, 32767);
+                        break;
+                    case 19:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 7);
+                        break;
+                    case 20:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 6);
+                        break;
+                    case 21:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 5);
+                        break;
+                    case 22:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 4);
+                        break;
+                    case 23:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 3);
+                        break;
+                    case 24:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 2);
+                        break;
+                    case 25:
+                        if (reader.boolean()) *(acceleration_control->buf) |= (1 << 1);
+                        break;
+                    case 26:
+                        cam.camParameters.specialVehicleContainer = vanetza::asn1::allocate<SpecialVehicleContainer_t>();
+                        read_json(reader, *(cam.camParameters.specialVehicleContainer));
+                        break;
+                    default:
+                        reader.skip();
+                        break;
+                }
+            }
+            members.require(required);
+            reader.finish();
+
+            bvc.longitudinalAcceleration.longitudinalAccelerationConfidence = AccelerationConfidence_unavailable;
+            bvc.yawRate.yawRateConfidence = YawRateConfidence_unavailable;
+            bvc.heading.headingConfidence = HeadingConfidence_unavailable;
+            bvc.speed.speedConfidence = SpeedConfidence_unavailable;
+            bvc.curvature.curvatureConfidence = CurvatureConfidence_unavailable;
+            bvc.curvatureCalculationMode = CurvatureCalculationMode_yawRateUsed;
+            bvc.vehicleLength.vehicleLengthConfidenceIndication = VehicleLengthConfidenceIndication_noTrailerPresent;
+        } catch(JsonReadError& e) {
+            std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON spec\n" << e.what() << std::endl;
+            return;
         } catch(...) {
             std::cout << "-- Vanetza JSON Decoding Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
             return;
@@ -323,8 +429,7 @@ void CamApplication::on_message(string topic, string mqtt_message) {
     request.communication_profile = geonet::CommunicationProfile::ITS_G5;
 
     try {
-        auto confirm = Application::request(request, std::move(packet));
-        if (!confirm.accepted()) {
+        if (!Application::enqueue(request, std::move(packet), stopwatch)) {
             throw std::runtime_error("CAM application data request failed");
         }
     } catch(std::runtime_error& e) {
@@ -333,10 +438,7 @@ void CamApplication::on_message(string topic, string mqtt_message) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't send the requested message but did not throw a runtime error on UPER encode.\nNo other info available\n" << std::endl;
     }
 
-    const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
     cam_tx_counter->Increment();
-    cam_tx_latency->Increment(time_now - time_reception);
 }
 
 void CamApplication::on_timer(Clock::time_point)
@@ -421,13 +523,15 @@ void CamApplication::on_timer(Clock::time_point)
     *(bvc.accelerationControl->buf) = (uint8_t) 0b10111110;
 
     CAM_t cam_t = {message->header, message->cam};
-    string cam_json = buildJSON(cam_t, 0, 0, false);
+    const string& cam_json = buildJSON(cam_t, 0, 0, false);
     if(config_s.cam.mqtt_enabled) mqtt->publish(config_s.own_cam_topic_out, cam_json);
     if(config_s.cam.dds_enabled) dds->publish(config_s.own_cam_topic_out, cam_json);
 
     if(config_s.full_cam_topic_out != "") { 
-        json fields_json = cam_t;
-        string json_dump = fields_json["cam"].dump();
+        json_buffer_.clear();
+        JsonWriter w(json_buffer_);
+        write_json(w, cam_t.cam);
+        const string& json_dump = json_buffer_;
         if(config_s.cam.mqtt_enabled && config_s.own_full_cam_topic_out != "") mqtt->publish(config_s.own_full_cam_topic_out, json_dump);
         if(config_s.cam.dds_enabled && config_s.own_full_cam_topic_out != "") dds->publish(config_s.own_full_cam_topic_out, json_dump);
     }
@@ -29,7 +29,8 @@ private:
     config_t config_s;
     metrics_t metrics_s;
 
-    std::string buildJSON(CAM_t cam, double time_reception, int rssi, bool include_fields);
+    const std::string& buildJSON(const CAM_t& message, double time_reception, int rssi, bool include_fields);
+    std::string json_buffer_;
 };
 
 #endif /* CAM_APPLICATION_HPP_EUIC2VFR */
@@ -27,12 +27,15 @@ void read_config(config_t* config_s, string path) {
     config_s->length = getenv("VANETZA_LENGTH") == NULL ? reader.GetReal("station", "length", 10) : stod(getenv("VANETZA_LENGTH"));
     config_s->width = getenv("VANETZA_WIDTH") == NULL ? reader.GetReal("station", "width", 3) : stod(getenv("VANETZA_WIDTH"));
     config_s->interface = getenv("VANETZA_INTERFACE") == NULL ? reader.Get("general", "interface", "wlan0") : getenv("VANETZA_INTERFACE");
+    config_s->link_layer = getenv("VANETZA_LINK_LAYER") == NULL ? reader.Get("general", "link_layer", "ethernet") : getenv("VANETZA_LINK_LAYER");
+    config_s->link_batch_size = getenv("VANETZA_LINK_BATCH_SIZE") == NULL ? reader.GetInteger("general", "link_batch_size", 32) : stoi(getenv("VANETZA_LINK_BATCH_SIZE"));
     config_s->mqtt_broker = getenv("VANETZA_MQTT_BROKER") == NULL ? reader.Get("general", "mqtt_broker", "127.0.0.1") : getenv("VANETZA_MQTT_BROKER");
     config_s->mqtt_port = getenv("VANETZA_MQTT_PORT") == NULL ? reader.GetInteger("general", "mqtt_port", 1883) : stoi(getenv("VANETZA_MQTT_PORT"));
     config_s->prometheus_port = getenv("VANETZA_PROMETHEUS_PORT") == NULL ? reader.GetInteger("general", "prometheus_port", 9100) : stoi(getenv("VANETZA_PROMETHEUS_PORT"));
     config_s->rssi_port = getenv("VANETZA_RSSI_PORT") == NULL ? reader.GetInteger("general", "rssi_port", 3000) : stoi(getenv("VANETZA_RSSI_PORT"));
     config_s->ignore_own_messages = getenv("VANETZA_IGNORE_OWN_MESSAGES") == NULL ? reader.GetBoolean("general", "ignore_own_messages", true) : getenv("VANETZA_IGNORE_OWN_MESSAGES") == "true";
     config_s->ignore_rsu_messages = getenv("VANETZA_IGNORE_RSU_MESSAGES") == NULL ? reader.GetBoolean("general", "ignore_rsu_messages", false) : getenv("VANETZA_IGNORE_RSU_MESSAGES") == "true";
+    config_s->accept_station_ids = getenv("VANETZA_ACCEPT_STATION_IDS") == NULL ? reader.Get("general", "accept_station_ids", "") : getenv("VANETZA_ACCEPT_STATION_IDS");
     config_s->to_dds_key = getenv("VANETZA_TO_DDS_KEY") == NULL ? reader.GetInteger("general", "to_dds_key", 6060) : stoi(getenv("VANETZA_TO_DDS_KEY"));
     config_s->from_dds_key = getenv("VANETZA_FROM_DDS_KEY") == NULL ? reader.GetInteger("general", "from_dds_key", 6061) : stoi(getenv("VANETZA_FROM_DDS_KEY"));
     config_s->cam = read_message_config(reader, "VANETZA_CAM", "cam");
@@ -1,6 +1,7 @@
 #include "config_reader.hpp"
 #include <iostream>
 #include <prometheus/counter.h>
+#include <prometheus/histogram.h>
 #include <prometheus/registry.h>
 
 #ifndef CONFIG_H_
@@ -30,12 +31,15 @@ typedef struct config {
     double length;
     double width;
     string interface;
+    string link_layer;
+    int link_batch_size;
     string mqtt_broker;
     int mqtt_port;
     int prometheus_port;
     int rssi_port;
     bool ignore_own_messages;
     bool ignore_rsu_messages;
+    string accept_station_ids;
     int to_dds_key;
     int from_dds_key;
     message_config_t cam;
@@ -55,8 +59,11 @@ typedef struct config {
 typedef struct metrics {
     std::shared_ptr<prometheus::Registry> registry;
     prometheus::Family<prometheus::Counter> *packet_counter;
-    prometheus::Family<prometheus::Counter> *latency_counter;
     prometheus::Family<prometheus::Counter> *error_counter;
+    prometheus::Family<prometheus::Counter> *drop_counter;
+    prometheus::Family<prometheus::Histogram> *latency_histogram;
+    prometheus::Family<prometheus::Histogram> *stage_histogram;
+    prometheus::Family<prometheus::Counter> *certificate_cache_counter;
 } metrics_t;
 
 message_config_t read_message_config(INIReader reader, string env_prefix, string ini_section);
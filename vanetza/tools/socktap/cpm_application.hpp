@@ -25,6 +25,7 @@ private:
     config_t config_s;
     metrics_t metrics_s;
 
-    std::string buildJSON(CPM_t cpm, double time_reception, int rssi);
+    const std::string& buildJSON(const CPM_t& message, double time_reception, int rssi);
+    std::string json_buffer_;
 };
 
@@ -6,20 +6,18 @@
 #include <vanetza/dcc/mapping.hpp>
 #include <vanetza/net/chunk_packet.hpp>
 #include <iostream>
-#include <thread>
 
 using namespace vanetza;
 
-std::map<std::thread::id, TimeTrigger*> triggers_;
-
-DccPassthrough::DccPassthrough(access::Interface& access, boost::asio::io_context& io_context) :
-        access_(access), io_context_(io_context) {}
+DccPassthrough::DccPassthrough(access::Interface& access, TimeTrigger& trigger) :
+        access_(access), trigger_(trigger) {}
 
 
 void DccPassthrough::request(const dcc::DataRequest& request, std::unique_ptr<ChunkPacket> packet)
 {
     if (!allow_packet_flow_) {
         std::cout << "ignored request because packet flow is suppressed\n";
+        packet_dropped();
         return;
     }
 
@@ -44,9 +42,5 @@ bool DccPassthrough::allow_packet_flow()
 }
 
 TimeTrigger &DccPassthrough::get_trigger() {
-    std::thread::id curr_id = std::this_thread::get_id();
-    if (!triggers_.count(curr_id)) {
-        triggers_[curr_id] = new TimeTrigger(io_context_);
-    }
-    return *(triggers_[curr_id]);
+    return trigger_;
 }
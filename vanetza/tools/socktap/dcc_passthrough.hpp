@@ -3,6 +3,7 @@
 
 #include "time_trigger.hpp"
 #include <vanetza/access/interface.hpp>
+#include <vanetza/common/hook.hpp>
 #include <vanetza/dcc/data_request.hpp>
 #include <vanetza/dcc/interface.hpp>
 #include <vanetza/net/cohesive_packet.hpp>
@@ -10,7 +11,7 @@
 class DccPassthrough : public vanetza::dcc::RequestInterface
 {
 public:
-    DccPassthrough(vanetza::access::Interface&, boost::asio::io_context&);
+    DccPassthrough(vanetza::access::Interface&, TimeTrigger&);
 
     void request(const vanetza::dcc::DataRequest& request, std::unique_ptr<vanetza::ChunkPacket> packet) override;
 
@@ -18,9 +19,14 @@ public:
     bool allow_packet_flow();
     TimeTrigger& get_trigger();
 
+    /**
+     * Invoked for each request dropped because packet flow is suppressed
+     */
+    vanetza::Hook<> packet_dropped;
+
 private:
     vanetza::access::Interface& access_;
-    boost::asio::io_context& io_context_;
+    TimeTrigger& trigger_;
     bool allow_packet_flow_ = true;
 };
 
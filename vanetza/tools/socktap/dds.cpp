@@ -1,59 +1,87 @@
 #include "dds.h"
-#include <map>
+#include <cerrno>
+#include <system_error>
 
-using namespace boost::asio;
+namespace {
 
-map<string, Mqtt_client*> dds_subscribers;
-int to_dds_mq;
-int from_dds_mq;
+shm_ring_t* open_ring(int key) {
+    const string name = "/vanetza_dds_" + to_string(key);
+    shm_ring_t* ring = shm_ring_open(name.c_str(), SHM_RING_DEFAULT_CAPACITY);
+    if (!ring) {
+        throw system_error(errno, system_category(), "opening DDS ring " + name);
+    }
+    return ring;
+}
 
-typedef struct {
-	long mesg_type;
-	char mesg_text[15000];
-} message_t;
+} // namespace
 
-Dds::Dds(int to_dds_key, int from_dds_key) {
-    to_dds_mq = msgget(to_dds_key, 0666 | IPC_CREAT);
-    from_dds_mq = msgget(from_dds_key, 0666 | IPC_CREAT);
-    std::thread dds_th(&Dds::from_dds_thread, this);
-    dds_th.detach();
+Dds::Dds(int to_dds_key, int from_dds_key) :
+    to_dds_ring(open_ring(to_dds_key)), from_dds_ring(open_ring(from_dds_key)), running(true) {
+    from_dds_th = thread(&Dds::from_dds_thread, this);
 }
 
 Dds::~Dds() {
-
+    running = false;
+    if (from_dds_th.joinable()) {
+        from_dds_th.join();
+    }
+    shm_ring_close(to_dds_ring);
+    shm_ring_close(from_dds_ring);
 }
 
-bool Dds::publish(string topic, string message) {
-    string buf = topic + ";" + message;
-    message_t m = {};
-    m.mesg_type = 1;
-    strcpy(m.mesg_text, buf.c_str());
-    int a = msgsnd(to_dds_mq, &m, sizeof(m), 0);
-    return true;
+bool Dds::publish(const string& topic, const string& message) {
+    lock_guard<mutex> lock(publish_mutex);
+    auto found = to_dds_topics.find(topic);
+    if (found == to_dds_topics.end()) {
+        int index = shm_ring_intern(to_dds_ring, topic.data(), topic.size());
+        if (index < 0) {
+            cerr << "dds.cpp: cannot register topic " << topic << endl;
+            return false;
+        }
+        found = to_dds_topics.emplace(topic, index).first;
+    }
+
+    // never blocks, message is dropped if DDS service is lagging behind
+    return shm_ring_write(to_dds_ring, found->second, message.data(), message.size()) == SHM_RING_OK;
 }
 
 bool Dds::subscribe(string topic, Mqtt_client* object) {
-    dds_subscribers[topic] = object;
+    lock_guard<mutex> lock(subscribers_mutex);
+    subscribers[topic] = object;
     return true;
 }
 
 void Dds::from_dds_thread() {
-    while(1) {
-        message_t *m = new message_t;
-        msgrcv(from_dds_mq, m, sizeof(*m), 1, 0);
-        string data(m->mesg_text);
-        std::string::size_type pos = data.find(';');
-        if (pos != std::string::npos)
-        {
-            on_message(data.substr(0,pos), data.substr(pos+1, data.length()));
+    while (running) {
+        int index;
+        const void* data;
+        size_t length;
+        // limited timeout lets the thread notice shutdown
+        if (shm_ring_read(from_dds_ring, &index, &data, &length, 200) != SHM_RING_OK) {
+            continue;
+        }
+
+        string message(static_cast<const char*>(data), length);
+        shm_ring_release(from_dds_ring);
+
+        size_t topic_length = 0;
+        const char* topic = shm_ring_topic(from_dds_ring, index, &topic_length);
+        if (topic) {
+            on_message(string(topic, topic_length), message);
         }
-        delete m;
     }
 }
 
-
-void Dds::on_message(string topic, string message) {
-    if(dds_subscribers[topic] != nullptr) {
-        dds_subscribers[topic]->on_message(topic, message);
+void Dds::on_message(const string& topic, const string& message) {
+    Mqtt_client* subscriber = nullptr;
+    {
+        lock_guard<mutex> lock(subscribers_mutex);
+        auto found = subscribers.find(topic);
+        if (found != subscribers.end()) {
+            subscriber = found->second;
+        }
+    }
+    if (subscriber) {
+        subscriber->on_message(topic, message);
     }
-}
\ No newline at end of file
+}
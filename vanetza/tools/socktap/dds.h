@@ -2,25 +2,37 @@
 #include <cstring>
 #include <string>
 #include <vector>
-#include <boost/asio.hpp>
-#include <boost/bind/bind.hpp>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <thread>
 #include "mqtt.h"
-#include <sys/ipc.h>
-#include <sys/msg.h>
+#include "shm_ring.h"
 #include "time_trigger.hpp"
 
 using namespace std;
 
+/**
+ * Bridge to the DDS service via shared-memory rings, one ring per direction.
+ * Ring names are derived from the configured keys, i.e. "/vanetza_dds_<key>".
+ */
 class Dds {
 private:
-    void on_message(string topic, string message);
+    void on_message(const string& topic, const string& message);
     void from_dds_thread();
 
+    shm_ring_t* to_dds_ring;
+    shm_ring_t* from_dds_ring;
+    mutex publish_mutex; // ring has a single producer, applications publish from several threads
+    map<string, int> to_dds_topics;
+    mutex subscribers_mutex;
+    map<string, Mqtt_client*> subscribers;
+    atomic<bool> running;
+    thread from_dds_th;
+
 public:
-    Dds(int to_dds_port, int from_dds_port);
+    Dds(int to_dds_key, int from_dds_key);
     ~Dds();
-    bool publish(string topic, string message);
+    bool publish(const string& topic, const string& message);
     bool subscribe(string topic, Mqtt_client* object);
 };
-
@@ -19,8 +19,6 @@ using namespace boost::asio;
 
 prometheus::Counter *denm_rx_counter;
 prometheus::Counter *denm_tx_counter;
-prometheus::Counter *denm_rx_latency;
-prometheus::Counter *denm_tx_latency;
 
 boost::asio::io_service denm_io_service_;
 ip::udp::socket denm_udp_socket(denm_io_service_);
@@ -35,8 +33,7 @@ DenmApplication::DenmApplication(PositionProvider& positioning, Runtime& rt, Mqt
 
     denm_rx_counter = &((*metrics_s.packet_counter).Add({{"message", "denm"}, {"direction", "rx"}}));
     denm_tx_counter = &((*metrics_s.packet_counter).Add({{"message", "denm"}, {"direction", "tx"}}));
-    denm_rx_latency = &((*metrics_s.latency_counter).Add({{"message", "denm"}, {"direction", "rx"}}));
-    denm_tx_latency = &((*metrics_s.latency_counter).Add({{"message", "denm"}, {"direction", "tx"}}));
+    init_metrics(metrics_s, "denm");
 
     if(config_s.denm.udp_out_port != 0) {
         denm_udp_socket.open(ip::udp::v4());
@@ -58,22 +55,18 @@ DenmApplication::PortType DenmApplication::port()
 
 void DenmApplication::indicate(const DataIndication& indication, UpPacketPtr packet)
 {
-    struct indication_visitor : public boost::static_visitor<CohesivePacket>
-    {
-        CohesivePacket operator()(CohesivePacket& packet) {return packet;}
-        CohesivePacket operator()(ChunkPacket& packet) {return CohesivePacket(std::move(ByteBuffer()), OsiLayer::Physical);}
-    } ivis;
-
-    UpPacket* packet_ptr = packet.get();
-    CohesivePacket cp = boost::apply_visitor(ivis, *packet_ptr);
-
-    asn1::PacketVisitor<asn1::Denm> visitor;
-    std::shared_ptr<const asn1::Denm> denm = boost::apply_visitor(visitor, *packet);
+    PipelineStopwatch stopwatch = rx_stopwatch();
+    std::shared_ptr<const asn1::Denm> denm = decode<asn1::Denm>(*packet);
+    if (!denm) {
+        return;
+    }
+    stopwatch.lap(PipelineStage::UperDecode);
 
     //std::cout << "DENM application received a packet with " << (denm ? "decodable" : "broken") << " content" << std::endl;
 
     DENM_t denm_t = {(*denm)->header, (*denm)->denm};
-    string denm_json = buildJSON(denm_t, cp.time_received, cp.rssi);
+    const string& denm_json = buildJSON(denm_t, indication.time_received, indication.rssi);
+    stopwatch.lap(PipelineStage::JsonBuild);
 
     if(config_s.denm.mqtt_enabled) mqtt->publish(config_s.denm.topic_out, denm_json);
     if(config_s.denm.dds_enabled) dds->publish(config_s.denm.topic_out, denm_json);
@@ -83,6 +76,9 @@ void DenmApplication::indicate(const DataIndication& indication, UpPacketPtr pac
     if(config_s.denm.udp_out_port != 0) {
         denm_udp_socket.send_to(buffer(denm_json, denm_json.length()), denm_remote_endpoint, 0, denm_err);
     }
+
+    stopwatch.lap(PipelineStage::Publish);
+    stopwatch.finish();
 }
 
 void DenmApplication::schedule_timer()
@@ -90,67 +86,63 @@ void DenmApplication::schedule_timer()
     runtime_.schedule(denm_interval_, std::bind(&DenmApplication::on_timer, this, std::placeholders::_1), this);
 }
 
-std::string DenmApplication::buildJSON(DENM_t message, double time_reception, int rssi) {
-    ItsPduHeader_t& header = message.header;
-    nlohmann::json j = message;
+const std::string& DenmApplication::buildJSON(const DENM_t& message, double time_reception, int rssi) {
+    const ItsPduHeader_t& header = message.header;
+
+    // keys are written in lexicographical order as done by nlohmann::json
+    json_buffer_.clear();
+    JsonWriter w(json_buffer_);
+    w.begin_object();
+    w.key("fields");
+    write_json(w, message);
 
     const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
 
-    nlohmann::json json_payload = {
-            {"timestamp", time_reception},
-            {"newInfo", true},
-            {"rssi", rssi},
-            {"test", {
-                    {"json_timestamp", time_now}
-                },
-            },
-            {"fields", j},
-            {"stationID", (long) header.stationID},
-            {"receiverID", config_s.station_id},
-            {"receiverType", config_s.station_type}
-    };
-
-    denm_rx_latency->Increment(time_now - time_reception);
-    return json_payload.dump();
+    w.key("newInfo");
+    w.value(true);
+    w.key("receiverID");
+    w.value(config_s.station_id);
+    w.key("receiverType");
+    w.value(config_s.station_type);
+    w.key("rssi");
+    w.value(rssi);
+    w.key("stationID");
+    w.value((long) header.stationID);
+    w.key("test");
+    w.begin_object();
+    w.key("json_timestamp");
+    w.value(time_now);
+    w.end_object();
+    w.key("timestamp");
+    w.value(time_reception);
+    w.end_object();
+
+    return json_buffer_;
 }
 
 void DenmApplication::on_message(string topic, string mqtt_message) {
 
-    const double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
-    DecentralizedEnvironmentalNotificationMessage_t denm;
-
-    json payload;
+    PipelineStopwatch stopwatch = tx_stopwatch();
 
-    try {
-        payload = json::parse(mqtt_message);
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON spec\n" << e.what() << std::endl;
-        return;
-    } catch(...) {
-        std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
-        return;
-    }
+    vanetza::asn1::Denm message;
 
     try {
-        denm = payload.get<DecentralizedEnvironmentalNotificationMessage_t>();
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza ETSI Decoding Error --\nCheck that the message format follows ETSI spec\n" << e.what() << std::endl;
+        JsonReader reader(mqtt_message);
+        read_json(reader, message->denm);
+        reader.finish();
+    } catch(JsonReadError& e) {
+        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON and ETSI spec\n" << e.what() << std::endl;
         return;
     } catch(...) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
         return;
     }
 
-    vanetza::asn1::Denm message;
-
     ItsPduHeader_t& header = message->header;
     header.protocolVersion = 2;
     header.messageID = ItsPduHeader__messageID_denm;
     header.stationID = config_s.station_id;
 
-    message->denm = denm;
-
     DownPacketPtr packet { new DownPacket() };
     packet->layer(OsiLayer::Application) = std::move(message);
 
@@ -160,8 +152,7 @@ void DenmApplication::on_message(string topic, string mqtt_message) {
     request.communication_profile = geonet::CommunicationProfile::ITS_G5;
 
     try {
-        auto confirm = Application::request(request, std::move(packet));
-        if (!confirm.accepted()) {
+        if (!Application::enqueue(request, std::move(packet), stopwatch)) {
             throw std::runtime_error("DENM application data request failed");
         }
     } catch(std::runtime_error& e) {
@@ -170,10 +161,7 @@ void DenmApplication::on_message(string topic, string mqtt_message) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't send the requested message but did not throw a runtime error on UPER encode.\nNo other info available\n" << std::endl;
     }
 
-    const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
     denm_tx_counter->Increment();
-    denm_tx_latency->Increment(time_now - time_reception);
 }
 
 void DenmApplication::on_timer(Clock::time_point)
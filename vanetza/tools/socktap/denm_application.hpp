@@ -28,7 +28,8 @@ private:
     config_t config_s;
     metrics_t metrics_s;
 
-    std::string buildJSON(DENM_t denm, double time_reception, int rssi);
+    const std::string& buildJSON(const DENM_t& message, double time_reception, int rssi);
+    std::string json_buffer_;
 };
 
 #endif /* DENM_APPLICATION_HPP_EUIC2VFR */
@@ -0,0 +1,490 @@
+#include "json_reader.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+
+const unsigned max_depth = 256;
+
+// scope marker of arrays while scanning for duplicate keys
+const std::size_t array_scope = std::numeric_limits<std::size_t>::max();
+
+struct ScannedKey
+{
+    boost::string_ref name;
+    const char* position;
+};
+
+// buffers of duplicate scan keep their capacity, i.e. readers do not allocate per message
+struct ScanBuffers
+{
+    std::vector<std::size_t> scopes; // index of first key for each open object
+    std::vector<ScannedKey> keys;
+};
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool is_number_char(char c)
+{
+    return is_digit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+bool is_integer_token(boost::string_ref token)
+{
+    return token.find_first_of(".eE") == boost::string_ref::npos;
+}
+
+// validates JSON number grammar which is stricter than strtod
+bool is_number_token(boost::string_ref token)
+{
+    const char* it = token.begin();
+    const char* end = token.end();
+    if (it != end && *it == '-') {
+        ++it;
+    }
+    if (it == end) {
+        return false;
+    } else if (*it == '0') {
+        ++it;
+    } else if (is_digit(*it)) {
+        while (it != end && is_digit(*it)) ++it;
+    } else {
+        return false;
+    }
+    if (it != end && *it == '.') {
+        ++it;
+        if (it == end || !is_digit(*it)) return false;
+        while (it != end && is_digit(*it)) ++it;
+    }
+    if (it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        if (it != end && (*it == '+' || *it == '-')) ++it;
+        if (it == end || !is_digit(*it)) return false;
+        while (it != end && is_digit(*it)) ++it;
+    }
+    return it == end;
+}
+
+} // namespace
+
+JsonReadError::JsonReadError(const std::string& what, std::size_t offset) :
+    std::runtime_error(what), offset_(offset)
+{
+}
+
+JsonReader::JsonReader(const char* data, std::size_t length) :
+    begin_(data), cursor_(data), end_(data + length)
+{
+    scan_duplicates();
+}
+
+JsonReader::JsonReader(const std::string& text) :
+    JsonReader(text.data(), text.size())
+{
+}
+
+bool JsonReader::null()
+{
+    return peek() == 'n' && literal("null", 4);
+}
+
+bool JsonReader::boolean()
+{
+    const char c = peek();
+    if (c == 't' && literal("true", 4)) {
+        return true;
+    } else if (c == 'f' && literal("false", 5)) {
+        return false;
+    }
+    fail("expected boolean");
+}
+
+double JsonReader::number()
+{
+    const char c = peek();
+    if (c == 't' || c == 'f') {
+        return boolean() ? 1.0 : 0.0;
+    }
+
+    const boost::string_ref digits = token();
+    char buffer[64];
+    if (digits.size() >= sizeof(buffer)) {
+        fail("number too long");
+    }
+    std::memcpy(buffer, digits.data(), digits.size());
+    buffer[digits.size()] = '\0';
+    return std::strtod(buffer, nullptr);
+}
+
+long long JsonReader::integer()
+{
+    const char c = peek();
+    if (c == 't' || c == 'f') {
+        return boolean() ? 1 : 0;
+    }
+
+    const char* start = cursor_;
+    const boost::string_ref digits = token();
+    if (!is_integer_token(digits)) {
+        // like nlohmann::json, floating point numbers are truncated
+        cursor_ = start;
+        const double value = number();
+        if (!(value > static_cast<double>(std::numeric_limits<long long>::min()) &&
+              value < static_cast<double>(std::numeric_limits<long long>::max()))) {
+            fail("integer out of range");
+        }
+        return static_cast<long long>(value);
+    }
+
+    char buffer[32];
+    if (digits.size() >= sizeof(buffer)) {
+        fail("integer out of range");
+    }
+    std::memcpy(buffer, digits.data(), digits.size());
+    buffer[digits.size()] = '\0';
+    errno = 0;
+    const long long value = std::strtoll(buffer, nullptr, 10);
+    if (errno == ERANGE) {
+        fail("integer out of range");
+    }
+    return value;
+}
+
+boost::string_ref JsonReader::string()
+{
+    expect('"');
+    const char* start = cursor_;
+    while (cursor_ != end_) {
+        const char c = *cursor_;
+        if (c == '"') {
+            boost::string_ref contents { start, static_cast<std::size_t>(cursor_ - start) };
+            ++cursor_;
+            return contents;
+        } else if (c == '\\') {
+            if (++cursor_ == end_) break;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            fail("control character in string");
+        }
+        ++cursor_;
+    }
+    fail("unterminated string");
+}
+
+void JsonReader::skip()
+{
+    skip_value(0);
+}
+
+void JsonReader::finish()
+{
+    skip_whitespace();
+    if (cursor_ != end_) {
+        fail("unexpected characters after value");
+    }
+}
+
+void JsonReader::fail(const char* reason) const
+{
+    const std::size_t offset = cursor_ - begin_;
+    std::string what = reason;
+    what += " at offset ";
+    what += std::to_string(offset);
+    if (!key_.empty()) {
+        what += " near key \"";
+        what.append(key_.data(), key_.size());
+        what += '"';
+    }
+    throw JsonReadError(what, offset);
+}
+
+char JsonReader::peek()
+{
+    skip_whitespace();
+    if (cursor_ == end_) {
+        fail("unexpected end of input");
+    }
+    return *cursor_;
+}
+
+void JsonReader::expect(char c)
+{
+    if (peek() != c) {
+        char reason[] = "expected ' '";
+        reason[10] = c;
+        fail(reason);
+    }
+    ++cursor_;
+}
+
+bool JsonReader::literal(const char* word, std::size_t length)
+{
+    if (static_cast<std::size_t>(end_ - cursor_) >= length && std::memcmp(cursor_, word, length) == 0) {
+        cursor_ += length;
+        return true;
+    }
+    return false;
+}
+
+boost::string_ref JsonReader::token()
+{
+    const char* start = cursor_;
+    while (cursor_ != end_ && is_number_char(*cursor_)) {
+        ++cursor_;
+    }
+    const boost::string_ref digits { start, static_cast<std::size_t>(cursor_ - start) };
+    if (!is_number_token(digits)) {
+        cursor_ = start;
+        fail("expected number");
+    }
+    return digits;
+}
+
+void JsonReader::skip_whitespace()
+{
+    while (cursor_ != end_ && (*cursor_ == ' ' || *cursor_ == '\n' || *cursor_ == '\r' || *cursor_ == '\t')) {
+        ++cursor_;
+    }
+}
+
+void JsonReader::skip_value(unsigned depth)
+{
+    if (depth > max_depth) {
+        fail("nesting too deep");
+    }
+
+    switch (peek()) {
+        case '{': {
+            ++cursor_;
+            if (peek() == '}') {
+                ++cursor_;
+                break;
+            }
+            for (;;) {
+                string();
+                expect(':');
+                skip_value(depth + 1);
+                if (peek() != ',') break;
+                ++cursor_;
+            }
+            expect('}');
+            break;
+        }
+        case '[': {
+            ++cursor_;
+            if (peek() == ']') {
+                ++cursor_;
+                break;
+            }
+            for (;;) {
+                skip_value(depth + 1);
+                if (peek() != ',') break;
+                ++cursor_;
+            }
+            expect(']');
+            break;
+        }
+        case '"':
+            string();
+            break;
+        case 't':
+        case 'f':
+            boolean();
+            break;
+        case 'n':
+            if (!null()) {
+                fail("expected null");
+            }
+            break;
+        default:
+            token();
+            break;
+    }
+}
+
+void JsonReader::scan_duplicates()
+{
+    // Lexical pass over the whole text: it tracks the keys of all open objects
+    // and records keys which occur again in the same object.
+    // Malformed text ends the pass early, parsing reports the actual error later.
+    static thread_local ScanBuffers buffers;
+    std::vector<std::size_t>& scopes = buffers.scopes;
+    std::vector<ScannedKey>& keys = buffers.keys;
+    scopes.clear();
+    keys.clear();
+    bool expect_key = false;
+
+    for (const char* it = begin_; it != end_; ++it) {
+        switch (*it) {
+            case '{':
+                scopes.push_back(keys.size());
+                expect_key = true;
+                break;
+            case '[':
+                scopes.push_back(array_scope);
+                expect_key = false;
+                break;
+            case '}':
+            case ']':
+                if (scopes.empty()) {
+                    return;
+                } else if (scopes.back() != array_scope) {
+                    keys.resize(scopes.back());
+                }
+                scopes.pop_back();
+                expect_key = false;
+                break;
+            case ',':
+                expect_key = !scopes.empty() && scopes.back() != array_scope;
+                break;
+            case '"': {
+                const char* start = it;
+                for (++it; it != end_ && *it != '"'; ++it) {
+                    if (*it == '\\' && ++it == end_) {
+                        return;
+                    }
+                }
+                if (it == end_) {
+                    return;
+                }
+
+                if (expect_key) {
+                    const boost::string_ref name { start + 1, static_cast<std::size_t>(it - start - 1) };
+                    auto key = std::find_if(keys.begin() + scopes.back(), keys.end(),
+                        [&name](const ScannedKey& key) { return key.name == name; });
+                    if (key != keys.end()) {
+                        superseded_.push_back(key->position);
+                        key->position = start;
+                    } else {
+                        keys.push_back(ScannedKey { name, start });
+                    }
+                    expect_key = false;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    std::sort(superseded_.begin(), superseded_.end());
+}
+
+bool JsonReader::superseded(const char* key) const
+{
+    return !superseded_.empty() && std::binary_search(superseded_.begin(), superseded_.end(), key);
+}
+
+JsonReader::Members::Members(JsonReader& reader, const char* const* keys, std::size_t count) :
+    reader_(reader), keys_(keys), count_(count), present_(0), index_(-1), empty_(false), first_(true)
+{
+    // from_json functions treat null like an object without any members
+    if (reader_.null()) {
+        empty_ = true;
+    } else {
+        reader_.expect('{');
+    }
+}
+
+bool JsonReader::Members::next()
+{
+    for (;;) {
+        if (empty_) {
+            return false;
+        }
+
+        const char c = reader_.peek();
+        if (c == '}') {
+            ++reader_.cursor_;
+            empty_ = true;
+            return false;
+        } else if (!first_) {
+            if (c != ',') {
+                reader_.fail("expected ',' or '}'");
+            }
+            ++reader_.cursor_;
+        }
+        first_ = false;
+
+        reader_.skip_whitespace();
+        if (!reader_.superseded(reader_.cursor_)) {
+            break;
+        }
+
+        // only the last member of a repeated key counts
+        reader_.string();
+        reader_.expect(':');
+        reader_.skip();
+    }
+
+    const boost::string_ref key = reader_.string();
+    reader_.expect(':');
+    reader_.key_ = key;
+
+    index_ = -1;
+    for (std::size_t i = 0; i < count_; ++i) {
+        if (key == keys_[i]) {
+            present_ |= std::uint64_t(1) << i;
+            index_ = static_cast<int>(i);
+            break;
+        }
+    }
+    return true;
+}
+
+void JsonReader::Members::exclusive() const
+{
+    if (present_ & (present_ - 1)) {
+        reader_.fail("more than one alternative of choice");
+    }
+}
+
+void JsonReader::Members::require(std::uint64_t mask) const
+{
+    const std::uint64_t missing = mask & ~present_;
+    if (missing) {
+        std::size_t i = 0;
+        while (!(missing & (std::uint64_t(1) << i))) ++i;
+        std::string reason = "missing member \"";
+        reason += keys_[i];
+        reason += '"';
+        reader_.fail(reason.c_str());
+    }
+}
+
+JsonReader::Elements::Elements(JsonReader& reader) :
+    reader_(reader), empty_(false), first_(true)
+{
+    if (reader_.null()) {
+        empty_ = true;
+    } else {
+        reader_.expect('[');
+    }
+}
+
+bool JsonReader::Elements::next()
+{
+    if (empty_) {
+        return false;
+    }
+
+    const char c = reader_.peek();
+    if (c == ']') {
+        ++reader_.cursor_;
+        empty_ = true;
+        return false;
+    } else if (!first_) {
+        if (c != ',') {
+            reader_.fail("expected ',' or ']'");
+        }
+        ++reader_.cursor_;
+    }
+    first_ = false;
+    return true;
+}
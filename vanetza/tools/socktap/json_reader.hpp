@@ -0,0 +1,150 @@
+#ifndef JSON_READER_HPP_M5QX2ZRD
+#define JSON_READER_HPP_M5QX2ZRD
+
+#include <boost/utility/string_ref.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * JsonReadError is thrown by JsonReader for malformed or unexpected JSON input.
+ */
+class JsonReadError : public std::runtime_error
+{
+public:
+    JsonReadError(const std::string& what, std::size_t offset);
+
+    std::size_t offset() const { return offset_; }
+
+private:
+    std::size_t offset_;
+};
+
+/**
+ * JsonReader pulls values from compact or pretty JSON text without building a document tree.
+ *
+ * Callers descend into objects and arrays in the order the values appear in the text.
+ * Conversion rules follow nlohmann::json's get<T>(): numbers accept booleans and integers truncate floats.
+ * Objects and arrays accept null in place of an empty container like the from_json functions do.
+ * Keys occurring more than once in an object resolve to their last member like nlohmann::json does.
+ */
+class JsonReader
+{
+public:
+    JsonReader(const char* data, std::size_t length);
+    explicit JsonReader(const std::string&);
+
+    /**
+     * Consume null if it is the next value
+     * \return true if null has been consumed
+     */
+    bool null();
+    bool boolean();
+    double number();
+    long long integer();
+
+    /**
+     * Read a string value
+     * \note escape sequences are not decoded, the returned view refers to the input text
+     * \return view of string contents
+     */
+    boost::string_ref string();
+
+    /**
+     * Skip next value including any nested objects and arrays
+     */
+    void skip();
+
+    /**
+     * Ensure that nothing but whitespace follows the last value
+     */
+    void finish();
+
+    [[noreturn]] void fail(const char* reason) const;
+
+    /**
+     * Members iterates the members of an object and maps their keys to indices of a key table.
+     * Keys not found in the table yield index -1 and their values have to be skipped by the caller.
+     * Members superseded by a later member with the same key are skipped without being reported.
+     */
+    class Members
+    {
+    public:
+        template<std::size_t N>
+        Members(JsonReader& reader, const char* const (&keys)[N]) :
+            Members(reader, keys, N)
+        {
+            static_assert(N <= 64, "presence mask is limited to 64 keys");
+        }
+
+        /**
+         * Advance to next member and position reader at its value
+         * \return false if end of object has been reached
+         */
+        bool next();
+
+        int index() const { return index_; }
+
+        /**
+         * Ensure that at most one known member is present (CHOICE alternatives)
+         */
+        void exclusive() const;
+
+        /**
+         * Ensure that all members of given mask have been present
+         * \param mask bit i corresponds to keys[i]
+         */
+        void require(std::uint64_t mask) const;
+
+    private:
+        Members(JsonReader&, const char* const* keys, std::size_t count);
+
+        JsonReader& reader_;
+        const char* const* keys_;
+        std::size_t count_;
+        std::uint64_t present_;
+        int index_;
+        bool empty_;
+        bool first_;
+    };
+
+    /**
+     * Elements iterates the values of an array
+     */
+    class Elements
+    {
+    public:
+        explicit Elements(JsonReader& reader);
+
+        /**
+         * Advance to next element and position reader at its value
+         * \return false if end of array has been reached
+         */
+        bool next();
+
+    private:
+        JsonReader& reader_;
+        bool empty_;
+        bool first_;
+    };
+
+private:
+    char peek();
+    void expect(char);
+    bool literal(const char*, std::size_t);
+    boost::string_ref token();
+    void skip_whitespace();
+    void skip_value(unsigned depth);
+    void scan_duplicates();
+    bool superseded(const char* key) const;
+
+    const char* begin_;
+    const char* cursor_;
+    const char* end_;
+    boost::string_ref key_;
+    std::vector<const char*> superseded_; /*< sorted positions of keys occurring again later in their object, empty without duplicates */
+};
+
+#endif /* JSON_READER_HPP_M5QX2ZRD */
@@ -0,0 +1,170 @@
+#include "json_writer.hpp"
+#include <nlohmann/json.hpp>
+#include <cmath>
+#include <cstring>
+
+JsonWriter::JsonWriter(std::string& out) : out_(out), comma_(false)
+{
+}
+
+void JsonWriter::begin_object()
+{
+    separate();
+    out_ += '{';
+    comma_ = false;
+}
+
+void JsonWriter::end_object()
+{
+    out_ += '}';
+    comma_ = true;
+}
+
+void JsonWriter::begin_array()
+{
+    separate();
+    out_ += '[';
+    comma_ = false;
+}
+
+void JsonWriter::end_array()
+{
+    out_ += ']';
+    comma_ = true;
+}
+
+void JsonWriter::key(const char* name, std::size_t length)
+{
+    separate();
+    string(name, length);
+    out_ += ':';
+    // value follows key without separator
+    comma_ = false;
+}
+
+void JsonWriter::null()
+{
+    separate();
+    out_.append("null", 4);
+    comma_ = true;
+}
+
+void JsonWriter::value(bool v)
+{
+    separate();
+    if (v) {
+        out_.append("true", 4);
+    } else {
+        out_.append("false", 5);
+    }
+    comma_ = true;
+}
+
+void JsonWriter::value(double v)
+{
+    if (!std::isfinite(v)) {
+        // nlohmann::json dumps NaN and infinity as null
+        null();
+        return;
+    }
+
+    separate();
+    char buffer[64];
+    const char* end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), v);
+    out_.append(buffer, end - buffer);
+    comma_ = true;
+}
+
+void JsonWriter::value(const char* v)
+{
+    separate();
+    string(v, std::strlen(v));
+    comma_ = true;
+}
+
+void JsonWriter::value(const std::string& v)
+{
+    separate();
+    string(v.data(), v.size());
+    comma_ = true;
+}
+
+void JsonWriter::separate()
+{
+    if (comma_) {
+        out_ += ',';
+    }
+}
+
+void JsonWriter::signed_integer(long long v)
+{
+    separate();
+    if (v < 0) {
+        out_ += '-';
+        // avoid overflow when negating the smallest value
+        digits(0ull - static_cast<unsigned long long>(v));
+    } else {
+        digits(static_cast<unsigned long long>(v));
+    }
+    comma_ = true;
+}
+
+void JsonWriter::unsigned_integer(unsigned long long v)
+{
+    separate();
+    digits(v);
+    comma_ = true;
+}
+
+void JsonWriter::digits(unsigned long long v)
+{
+    char buffer[20];
+    char* begin = buffer + sizeof(buffer);
+    do {
+        *--begin = static_cast<char>('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    out_.append(begin, buffer + sizeof(buffer) - begin);
+}
+
+void JsonWriter::string(const char* str, std::size_t length)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    out_ += '"';
+    for (std::size_t i = 0; i < length; ++i) {
+        const unsigned char c = str[i];
+        switch (c) {
+            case '"':
+                out_.append("\\\"", 2);
+                break;
+            case '\\':
+                out_.append("\\\\", 2);
+                break;
+            case '\b':
+                out_.append("\\b", 2);
+                break;
+            case '\f':
+                out_.append("\\f", 2);
+                break;
+            case '\n':
+                out_.append("\\n", 2);
+                break;
+            case '\r':
+                out_.append("\\r", 2);
+                break;
+            case '\t':
+                out_.append("\\t", 2);
+                break;
+            default:
+                if (c < 0x20) {
+                    const char escaped[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0f] };
+                    out_.append(escaped, sizeof(escaped));
+                } else {
+                    out_ += static_cast<char>(c);
+                }
+                break;
+        }
+    }
+    out_ += '"';
+}
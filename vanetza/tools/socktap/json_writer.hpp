@@ -0,0 +1,58 @@
+#ifndef JSON_WRITER_HPP_T3KD8WQF
+#define JSON_WRITER_HPP_T3KD8WQF
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+/**
+ * JsonWriter appends compact JSON text to a string without building a document tree.
+ *
+ * Separators, number formatting and string escaping match nlohmann::json::dump().
+ * Object keys are written in call order, i.e. callers write them sorted to match nlohmann's output.
+ * Output strings can be reused across messages to avoid heap allocations once their capacity suffices.
+ */
+class JsonWriter
+{
+public:
+    explicit JsonWriter(std::string& out);
+
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    template<std::size_t N>
+    void key(const char (&name)[N]) { key(name, N - 1); }
+    void key(const char* name, std::size_t length);
+
+    void null();
+    void value(bool);
+    void value(double);
+    void value(const char*);
+    void value(const std::string&);
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type value(T v)
+    {
+        signed_integer(v);
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type value(T v)
+    {
+        unsigned_integer(v);
+    }
+
+private:
+    void separate();
+    void signed_integer(long long);
+    void unsigned_integer(unsigned long long);
+    void digits(unsigned long long);
+    void string(const char*, std::size_t);
+
+    std::string& out_;
+    bool comma_;
+};
+
+#endif /* JSON_WRITER_HPP_T3KD8WQF */
@@ -1,5 +1,7 @@
 #include "link_layer.hpp"
+#include "mmsg_socket_link.hpp"
 #include "raw_socket_link.hpp"
+#include "tpacket_ring_link.hpp"
 #include <vanetza/access/ethertype.hpp>
 #include <boost/asio/generic/raw_protocol.hpp>
 
@@ -8,17 +10,21 @@
 #endif
 
 std::unique_ptr<LinkLayer>
-create_link_layer(boost::asio::io_service& io_service, const EthernetDevice& device, const std::string& name)
+create_link_layer(boost::asio::io_service& io_service, const EthernetDevice& device, const std::string& name, std::size_t batch_size)
 {
     std::unique_ptr<LinkLayer> link_layer;
 
-    if (name == "ethernet" || name == "cohda") {
+    if (name == "ethernet" || name == "ethernet-mmsg" || name == "ethernet-ring" || name == "cohda") {
         boost::asio::generic::raw_protocol raw_protocol(AF_PACKET, vanetza::access::ethertype::GeoNetworking.net());
         boost::asio::generic::raw_protocol::socket raw_socket(io_service, raw_protocol);
         raw_socket.bind(device.endpoint(AF_PACKET));
 
         if (name == "ethernet") {
             link_layer.reset(new RawSocketLink { std::move(raw_socket) });
+        } else if (name == "ethernet-mmsg") {
+            link_layer.reset(new MmsgSocketLink { io_service, std::move(raw_socket), batch_size });
+        } else if (name == "ethernet-ring") {
+            link_layer.reset(new TpacketRingLink { io_service, std::move(raw_socket) });
         } else if (name == "cohda") {
 #ifdef SOCKTAP_WITH_COHDA_LLC
             link_layer.reset(new CohdaLink { std::move(raw_socket) });
@@ -6,15 +6,32 @@
 #include <vanetza/net/cohesive_packet.hpp>
 #include <vanetza/net/ethernet_header.hpp>
 #include <boost/asio/io_service.hpp>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
+
+struct LinkLayerFrame
+{
+    vanetza::CohesivePacket packet;
+    vanetza::EthernetHeader header;
+};
 
 class LinkLayerIndication
 {
 public:
     using IndicationCallback = std::function<void(vanetza::CohesivePacket&&, const vanetza::EthernetHeader&)>;
+    using BurstIndicationCallback = std::function<void(std::vector<LinkLayerFrame>&)>;
 
     virtual void indicate(IndicationCallback) = 0;
+
+    /**
+     * Register callback for bursts of received frames
+     *
+     * Link layers receiving frames one by one may ignore this callback.
+     * Frames can be moved out of the passed burst by the callback.
+     */
+    virtual void indicate_burst(BurstIndicationCallback) {}
     virtual ~LinkLayerIndication() = default;
 };
 
@@ -23,7 +40,7 @@ class LinkLayer : public vanetza::access::Interface, public LinkLayerIndication
 };
 
 std::unique_ptr<LinkLayer>
-create_link_layer(boost::asio::io_service&, const EthernetDevice&, const std::string& name);
+create_link_layer(boost::asio::io_service&, const EthernetDevice&, const std::string& name, std::size_t batch_size = 32);
 
 #endif /* LINK_LAYER_HPP_FGEK0QTH */
 
@@ -80,8 +80,8 @@ int main(int argc, const char** argv)
             }
         }
 
-        const std::string link_layer_name = "ethernet";
-        auto link_layer =  create_link_layer(io_service, device, link_layer_name);
+        const std::string link_layer_name = config_s.link_layer;
+        auto link_layer =  create_link_layer(io_service, device, link_layer_name, config_s.link_batch_size);
         if (!link_layer) {
             std::cerr << "No link layer '" << link_layer_name << "' found." << std::endl;
             return 1;
@@ -137,22 +137,40 @@ int main(int argc, const char** argv)
                              .Help("Number of observed packets")
                              .Register(*(metrics_s.registry)));
 
-        metrics_s.latency_counter = &(BuildCounter()
-                             .Name("observed_packets_latency_total")
-                             .Help("Processing latency of observed packets")
+        metrics_s.latency_histogram = &(BuildHistogram()
+                             .Name("observed_packets_latency_seconds")
+                             .Help("End-to-end processing latency of observed packets")
+                             .Register(*(metrics_s.registry)));
+
+        metrics_s.stage_histogram = &(BuildHistogram()
+                             .Name("pipeline_stage_duration_seconds")
+                             .Help("Processing time of observed packets per pipeline stage")
+                             .Register(*(metrics_s.registry)));
+
+        metrics_s.drop_counter = &(BuildCounter()
+                             .Name("dropped_packets_total")
+                             .Help("Number of dropped packets by stage and reason")
+                             .Register(*(metrics_s.registry)));
+
+        metrics_s.certificate_cache_counter = &(BuildCounter()
+                             .Name("certificate_cache_events_total")
+                             .Help("Number of certificate cache signer lookups and evictions by event")
                              .Register(*(metrics_s.registry)));
 
         exposer.RegisterCollectable(metrics_s.registry);
+        set_security_metrics(security.get(), metrics_s);
 
         RouterContext context(mib, trigger, *positioning, security.get(), config_s.ignore_own_messages, config_s.ignore_rsu_messages, io_service);
         context.require_position_fix(vm.count("require-gnss-fix") > 0);
+        context.set_metrics(metrics_s);
         context.set_link_layer(link_layer.get());
+        context.set_deferred_verification(get_deferred_verification(security.get()));
 
         std::map<std::string, std::unique_ptr<Application>> apps;
 
         if (config_s.cam.enabled) {
             std::unique_ptr<CamApplication> cam_app {
-                new CamApplication(*positioning, context.get_dccp().get_trigger().runtime(), mqtt, dds, config_s, metrics_s)
+                new CamApplication(*positioning, trigger.runtime(), mqtt, dds, config_s, metrics_s)
             };
             cam_app->set_interval(std::chrono::milliseconds(config_s.cam.periodicity));
             apps.emplace("cam", std::move(cam_app));
@@ -160,7 +178,7 @@ int main(int argc, const char** argv)
 
         if (config_s.denm.enabled) {
             std::unique_ptr<DenmApplication> denm_app {
-                new DenmApplication(*positioning, context.get_dccp().get_trigger().runtime(), mqtt, dds, config_s, metrics_s)
+                new DenmApplication(*positioning, trigger.runtime(), mqtt, dds, config_s, metrics_s)
             };
             denm_app->set_interval(std::chrono::milliseconds(config_s.denm.periodicity));
             apps.emplace("denm", std::move(denm_app));
@@ -168,7 +186,7 @@ int main(int argc, const char** argv)
 
         if (config_s.cpm.enabled) {
             std::unique_ptr<CpmApplication> cpm_app {
-                    new CpmApplication(*positioning, context.get_dccp().get_trigger().runtime(), mqtt, dds, config_s, metrics_s)
+                    new CpmApplication(*positioning, trigger.runtime(), mqtt, dds, config_s, metrics_s)
             };
             cpm_app->set_interval(std::chrono::milliseconds(config_s.cpm.periodicity));
             apps.emplace("cpm", std::move(cpm_app));
@@ -176,7 +194,7 @@ int main(int argc, const char** argv)
 
         if (config_s.vam.enabled) {
             std::unique_ptr<VamApplication> vam_app {
-                    new VamApplication(*positioning, context.get_dccp().get_trigger().runtime(), mqtt, dds, config_s, metrics_s)
+                    new VamApplication(*positioning, trigger.runtime(), mqtt, dds, config_s, metrics_s)
             };
             vam_app->set_interval(std::chrono::milliseconds(config_s.vam.periodicity));
             apps.emplace("vam", std::move(vam_app));
@@ -184,7 +202,7 @@ int main(int argc, const char** argv)
 
         if (config_s.spatem.enabled) {
             std::unique_ptr<SpatemApplication> spatem_app {
-                    new SpatemApplication(*positioning, context.get_dccp().get_trigger().runtime(), mqtt, dds, config_s, metrics_s)
+                    new SpatemApplication(*positioning, trigger.runtime(), mqtt, dds, config_s, metrics_s)
             };
             spatem_app->set_interval(std::chrono::milliseconds(config_s.spatem.periodicity));
             apps.emplace("spatem", std::move(spatem_app));
@@ -192,7 +210,7 @@ int main(int argc, const char** argv)
 
         if (config_s.mapem.enabled) {
             std::unique_ptr<MapemApplication> mapem_app {
-                    new MapemApplication(*positioning, context.get_dccp().get_trigger().runtime(), mqtt, dds, config_s, metrics_s)
+                    new MapemApplication(*positioning, trigger.runtime(), mqtt, dds, config_s, metrics_s)
             };
             mapem_app->set_interval(std::chrono::milliseconds(config_s.mapem.periodicity));
             apps.emplace("mapem", std::move(mapem_app));
@@ -202,8 +220,10 @@ int main(int argc, const char** argv)
             std::cerr << "Warning: No applications are configured, only GN beacons will be exchanged\n";
         }
 
+        const Application::HeaderFilter header_filter = create_header_filter(config_s);
         for (const auto& app : apps) {
             std::cout << "Enable application '" << app.first << "'...\n";
+            app.second->set_header_filter(header_filter);
             context.enable(app.second.get());
         }
 
@@ -20,8 +20,6 @@ using namespace boost::asio;
 
 prometheus::Counter *mapem_rx_counter;
 prometheus::Counter *mapem_tx_counter;
-prometheus::Counter *mapem_rx_latency;
-prometheus::Counter *mapem_tx_latency;
 
 boost::asio::io_service mapem_io_service_;
 ip::udp::socket mapem_udp_socket(mapem_io_service_);
@@ -37,8 +35,7 @@ MapemApplication::MapemApplication(PositionProvider& positioning, Runtime& rt, M
     
     mapem_rx_counter = &((*metrics_s.packet_counter).Add({{"message", "mapem"}, {"direction", "rx"}}));
     mapem_tx_counter = &((*metrics_s.packet_counter).Add({{"message", "mapem"}, {"direction", "tx"}}));
-    mapem_rx_latency = &((*metrics_s.latency_counter).Add({{"message", "mapem"}, {"direction", "rx"}}));
-    mapem_tx_latency = &((*metrics_s.latency_counter).Add({{"message", "mapem"}, {"direction", "tx"}}));
+    init_metrics(metrics_s, "mapem");
 
     if(config_s.mapem.udp_out_port != 0) {
         mapem_udp_socket.open(ip::udp::v4());
@@ -60,22 +57,18 @@ MapemApplication::PortType MapemApplication::port()
 
 void MapemApplication::indicate(const DataIndication& indication, UpPacketPtr packet)
 {
-    struct indication_visitor : public boost::static_visitor<CohesivePacket>
-    {
-        CohesivePacket operator()(CohesivePacket& packet) {return packet;}
-        CohesivePacket operator()(ChunkPacket& packet) {return CohesivePacket(std::move(ByteBuffer()), OsiLayer::Physical);}
-    } ivis;
-
-    UpPacket* packet_ptr = packet.get();
-    CohesivePacket cp = boost::apply_visitor(ivis, *packet_ptr);
-
-    asn1::PacketVisitor<asn1::Mapem> visitor;
-    std::shared_ptr<const asn1::Mapem> mapem = boost::apply_visitor(visitor, *packet);
+    PipelineStopwatch stopwatch = rx_stopwatch();
+    std::shared_ptr<const asn1::Mapem> mapem = decode<asn1::Mapem>(*packet);
+    if (!mapem) {
+        return;
+    }
+    stopwatch.lap(PipelineStage::UperDecode);
 
     //std::cout << "MAPEM application received a packet with " << (mapem ? "decodable" : "broken") << " content" << std::endl;
 
     MAPEM_t mapem_t = {(*mapem)->header, (*mapem)->map};
-    string mapem_json = buildJSON(mapem_t, cp.time_received, cp.rssi);
+    const string& mapem_json = buildJSON(mapem_t, indication.time_received, indication.rssi);
+    stopwatch.lap(PipelineStage::JsonBuild);
 
     if(config_s.mapem.mqtt_enabled) mqtt->publish(config_s.mapem.topic_out, mapem_json);
     if(config_s.mapem.dds_enabled) dds->publish(config_s.mapem.topic_out, mapem_json);
@@ -85,6 +78,9 @@ void MapemApplication::indicate(const DataIndication& indication, UpPacketPtr pa
     if(config_s.mapem.udp_out_port != 0) {
         mapem_udp_socket.send_to(buffer(mapem_json, mapem_json.length()), mapem_remote_endpoint, 0, mapem_err);
     }
+
+    stopwatch.lap(PipelineStage::Publish);
+    stopwatch.finish();
 }
 
 void MapemApplication::schedule_timer()
@@ -92,67 +88,63 @@ void MapemApplication::schedule_timer()
     runtime_.schedule(mapem_interval_, std::bind(&MapemApplication::on_timer, this, std::placeholders::_1), this);
 }
 
-std::string MapemApplication::buildJSON(MAPEM_t message, double time_reception, int rssi) {
-    ItsPduHeader_t& header = message.header;
-    nlohmann::json j = message;
+const std::string& MapemApplication::buildJSON(const MAPEM_t& message, double time_reception, int rssi) {
+    const ItsPduHeader_t& header = message.header;
+
+    // keys are written in lexicographical order as done by nlohmann::json
+    json_buffer_.clear();
+    JsonWriter w(json_buffer_);
+    w.begin_object();
+    w.key("fields");
+    write_json(w, message);
 
     const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
 
-    nlohmann::json json_payload = {
-            {"timestamp", time_reception},
-            {"newInfo", true},
-            {"rssi", rssi},
-            {"test", {
-                    {"json_timestamp", time_now}
-                },
-            },
-            {"fields", j},
-            {"stationID", (long) header.stationID},
-            {"receiverID", config_s.station_id},
-            {"receiverType", config_s.station_type}
-    };
-
-    mapem_rx_latency->Increment(time_now - time_reception);
-    return json_payload.dump();
+    w.key("newInfo");
+    w.value(true);
+    w.key("receiverID");
+    w.value(config_s.station_id);
+    w.key("receiverType");
+    w.value(config_s.station_type);
+    w.key("rssi");
+    w.value(rssi);
+    w.key("stationID");
+    w.value((long) header.stationID);
+    w.key("test");
+    w.begin_object();
+    w.key("json_timestamp");
+    w.value(time_now);
+    w.end_object();
+    w.key("timestamp");
+    w.value(time_reception);
+    w.end_object();
+
+    return json_buffer_;
 }
 
 void MapemApplication::on_message(string topic, string mqtt_message) {
 
-    const double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
-    MapData_t mapem;
-
-    json payload;
+    PipelineStopwatch stopwatch = tx_stopwatch();
 
-    try {
-        payload = json::parse(mqtt_message);
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON spec\n" << e.what() << std::endl;
-        return;
-    } catch(...) {
-        std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
-        return;
-    }
+    vanetza::asn1::Mapem message;
 
     try {
-        mapem = payload.get<MapData_t>();
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza ETSI Decoding Error --\nCheck that the message format follows ETSI spec\n" << e.what() << std::endl;
+        JsonReader reader(mqtt_message);
+        read_json(reader, message->map);
+        reader.finish();
+    } catch(JsonReadError& e) {
+        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON and ETSI spec\n" << e.what() << std::endl;
         return;
     } catch(...) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
         return;
     }
 
-    vanetza::asn1::Mapem message;
-
     ItsPduHeader_t& header = message->header;
     header.protocolVersion = 2;
     header.messageID = ItsPduHeader__messageID_mapem;
     header.stationID = config_s.station_id;
 
-    message->map = mapem;
-
     DownPacketPtr packet { new DownPacket() };
     packet->layer(OsiLayer::Application) = std::move(message);
 
@@ -162,8 +154,7 @@ void MapemApplication::on_message(string topic, string mqtt_message) {
     request.communication_profile = geonet::CommunicationProfile::ITS_G5;
 
     try {
-        auto confirm = Application::request(request, std::move(packet));
-        if (!confirm.accepted()) {
+        if (!Application::enqueue(request, std::move(packet), stopwatch)) {
             throw std::runtime_error("MAPEM application data request failed");
         }
     } catch(std::runtime_error& e) {
@@ -172,10 +163,7 @@ void MapemApplication::on_message(string topic, string mqtt_message) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't send the requested message but did not throw a runtime error on UPER encode.\nNo other info available\n" << std::endl;
     }
 
-    const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
     mapem_tx_counter->Increment();
-    mapem_tx_latency->Increment(time_now - time_reception);
 }
 
 void MapemApplication::on_timer(Clock::time_point)
@@ -0,0 +1,206 @@
+#include "mmsg_socket_link.hpp"
+#include "raw_socket_link.hpp"
+#include <vanetza/access/data_request.hpp>
+#include <vanetza/access/ethertype.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+
+using namespace vanetza;
+using namespace std::chrono;
+
+constexpr std::size_t MmsgSocketLink::frame_size_;
+
+MmsgSocketLink::MmsgSocketLink(boost::asio::io_service& io_service, boost::asio::generic::raw_protocol::socket&& socket, std::size_t batch_size) :
+    io_service_(io_service), socket_(std::move(socket)), batch_size_(std::max<std::size_t>(batch_size, 1)),
+    receive_pool_(std::make_shared<ByteBufferPool>(frame_size_, 4 * batch_size_)),
+    receive_buffers_(batch_size_), receive_iov_(batch_size_), receive_msgs_(batch_size_),
+    transmit_slots_(batch_size_), transmit_msgs_(batch_size_)
+{
+    // system calls are issued directly, they must not block the io_service thread
+    socket_.non_blocking(true);
+
+    for (std::size_t i = 0; i < batch_size_; ++i) {
+        receive_buffers_[i] = receive_pool_->acquire();
+        prepare_receive(i);
+    }
+    burst_.reserve(batch_size_);
+
+    do_receive();
+}
+
+void MmsgSocketLink::request(const access::DataRequest& request, std::unique_ptr<ChunkPacket> packet)
+{
+    if (transmit_pending_ == batch_size_) {
+        // batch is still waiting for the device queue to drain
+        std::cerr << "Dropped frame because transmit queue is full\n";
+        return;
+    }
+
+    packet->layer(OsiLayer::Link) = create_ethernet_header(request.destination_addr, request.source_addr, request.ether_type);
+
+    TransmitSlot& slot = transmit_slots_[transmit_pending_];
+    packet->serialize(slot.buffer);
+    slot.iov.clear();
+    slot.iov.append(slot.buffer);
+
+    msghdr& hdr = transmit_msgs_[transmit_pending_].msg_hdr;
+    hdr = msghdr {};
+    hdr.msg_iov = const_cast<iovec*>(slot.iov.base());
+    hdr.msg_iovlen = slot.iov.length();
+
+    if (++transmit_pending_ == batch_size_) {
+        flush();
+    } else if (!flush_pending_) {
+        // collect further requests issued by the current handler before sending
+        flush_pending_ = true;
+        io_service_.post(std::bind(&MmsgSocketLink::on_flush, this));
+    }
+}
+
+void MmsgSocketLink::indicate(IndicationCallback callback)
+{
+    callback_ = callback;
+}
+
+void MmsgSocketLink::indicate_burst(BurstIndicationCallback callback)
+{
+    burst_callback_ = callback;
+}
+
+void MmsgSocketLink::do_receive()
+{
+    namespace sph = std::placeholders;
+    socket_.async_wait(boost::asio::generic::raw_protocol::socket::wait_read,
+            std::bind(&MmsgSocketLink::on_readable, this, sph::_1));
+}
+
+void MmsgSocketLink::on_readable(const boost::system::error_code& ec)
+{
+    if (!ec) {
+        receive_batch();
+        do_receive();
+    }
+}
+
+void MmsgSocketLink::receive_batch()
+{
+    const int received = ::recvmmsg(socket_.native_handle(), receive_msgs_.data(), batch_size_, MSG_DONTWAIT, nullptr);
+    if (received <= 0) {
+        if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            std::cerr << "Receiving frames failed: " << std::strerror(errno) << "\n";
+        }
+        return;
+    }
+
+    // frames of one batch have been queued by the kernel already, thus they share a reception time
+    const double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
+
+    burst_.clear();
+    for (int i = 0; i < received; ++i) {
+        const mmsghdr& msg = receive_msgs_[i];
+        if (msg.msg_hdr.msg_flags & MSG_TRUNC) {
+            continue;
+        }
+
+        // hand buffer over to packet and refill slot for next batch
+        ByteBuffer& buffer = receive_buffers_[i];
+        buffer.resize(msg.msg_len);
+        CohesivePacket packet(std::move(buffer), OsiLayer::Physical, receive_pool_);
+        buffer = receive_pool_->acquire();
+        prepare_receive(i);
+
+        boost::optional<EthernetHeader> eth = parse_ethernet_header(packet);
+        if (eth && eth->type == access::ethertype::GeoNetworking) {
+            packet.rssi = lookup_rssi(eth->source);
+            packet.time_received = time_reception;
+            if (burst_callback_) {
+                burst_.push_back(LinkLayerFrame { std::move(packet), *eth });
+            } else if (callback_) {
+                callback_(std::move(packet), *eth);
+            }
+        }
+    }
+
+    if (!burst_.empty()) {
+        burst_callback_(burst_);
+        burst_.clear();
+    }
+}
+
+void MmsgSocketLink::prepare_receive(std::size_t slot)
+{
+    ByteBuffer& buffer = receive_buffers_[slot];
+    receive_iov_[slot].iov_base = buffer.data();
+    receive_iov_[slot].iov_len = buffer.size();
+
+    msghdr& hdr = receive_msgs_[slot].msg_hdr;
+    hdr = msghdr {};
+    hdr.msg_iov = &receive_iov_[slot];
+    hdr.msg_iovlen = 1;
+}
+
+void MmsgSocketLink::on_flush()
+{
+    flush_pending_ = false;
+    flush();
+}
+
+void MmsgSocketLink::on_writable(const boost::system::error_code& ec)
+{
+    write_waiting_ = false;
+    if (!ec) {
+        flush();
+    } else if (ec != boost::asio::error::operation_aborted) {
+        std::cerr << "Dropped " << transmit_pending_ - transmit_sent_ << " frames: " << ec.message() << "\n";
+        transmit_pending_ = 0;
+        transmit_sent_ = 0;
+    }
+}
+
+void MmsgSocketLink::flush()
+{
+    if (write_waiting_) {
+        // on_writable resumes flushing
+        return;
+    }
+
+    while (transmit_sent_ < transmit_pending_) {
+        const int result = ::sendmmsg(socket_.native_handle(), &transmit_msgs_[transmit_sent_],
+                transmit_pending_ - transmit_sent_, MSG_DONTWAIT);
+        if (result > 0) {
+            transmit_sent_ += result;
+        } else if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // keep remaining frames and do not block the io_service thread
+            namespace sph = std::placeholders;
+            write_waiting_ = true;
+            socket_.async_wait(boost::asio::generic::raw_protocol::socket::wait_write,
+                    std::bind(&MmsgSocketLink::on_writable, this, sph::_1));
+            return;
+        } else if (result < 0 && errno == EINTR) {
+            continue;
+        } else {
+            std::cerr << "Dropped " << transmit_pending_ - transmit_sent_ << " frames: " << std::strerror(errno) << "\n";
+            break;
+        }
+    }
+    transmit_pending_ = 0;
+    transmit_sent_ = 0;
+}
+
+boost::optional<EthernetHeader> MmsgSocketLink::parse_ethernet_header(CohesivePacket& packet) const
+{
+    packet.set_boundary(OsiLayer::Physical, 0);
+    if (packet.size(OsiLayer::Link) < EthernetHeader::length_bytes) {
+        std::cerr << "Router dropped invalid packet (too short for Ethernet header)\n";
+    } else {
+        packet.set_boundary(OsiLayer::Link, EthernetHeader::length_bytes);
+        auto link_range = packet[OsiLayer::Link];
+        return decode_ethernet_header(link_range.begin(), link_range.end());
+    }
+
+    return boost::none;
+}
@@ -0,0 +1,73 @@
+#ifndef MMSG_SOCKET_LINK_HPP_H2TQ6WZN
+#define MMSG_SOCKET_LINK_HPP_H2TQ6WZN
+
+#include "link_layer.hpp"
+#include <vanetza/common/byte_buffer_pool.hpp>
+#include <vanetza/net/ethernet_header.hpp>
+#include <vanetza/net/io_vector.hpp>
+#include <boost/asio/generic/raw_protocol.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/optional/optional.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+/**
+ * MmsgSocketLink exchanges frames over a raw socket in batches
+ *
+ * Received frames are fetched by a single recvmmsg call and passed up as a burst.
+ * Transmissions requested while handling one io_service event are sent by a single sendmmsg call.
+ * If the device queue is full, remaining frames are sent once the socket becomes writable again.
+ */
+class MmsgSocketLink : public LinkLayer
+{
+public:
+    /**
+     * \param io_service io_service the socket belongs to
+     * \param socket raw socket bound to network device
+     * \param batch_size maximum number of frames per system call
+     */
+    MmsgSocketLink(boost::asio::io_service&, boost::asio::generic::raw_protocol::socket&&, std::size_t batch_size);
+    void request(const vanetza::access::DataRequest&, std::unique_ptr<vanetza::ChunkPacket>) override;
+    void indicate(IndicationCallback) override;
+    void indicate_burst(BurstIndicationCallback) override;
+
+private:
+    static constexpr std::size_t frame_size_ = 2048;
+
+    struct TransmitSlot
+    {
+        vanetza::ByteBuffer buffer;
+        vanetza::IoVector iov;
+    };
+
+    void do_receive();
+    void on_readable(const boost::system::error_code&);
+    void receive_batch();
+    void prepare_receive(std::size_t slot);
+    void on_flush();
+    void on_writable(const boost::system::error_code&);
+    void flush();
+    boost::optional<vanetza::EthernetHeader> parse_ethernet_header(vanetza::CohesivePacket&) const;
+
+    boost::asio::io_service& io_service_;
+    boost::asio::generic::raw_protocol::socket socket_;
+    const std::size_t batch_size_;
+    IndicationCallback callback_;
+    BurstIndicationCallback burst_callback_;
+    std::shared_ptr<vanetza::ByteBufferPool> receive_pool_;
+    std::vector<vanetza::ByteBuffer> receive_buffers_;
+    std::vector<iovec> receive_iov_;
+    std::vector<mmsghdr> receive_msgs_;
+    std::vector<LinkLayerFrame> burst_;
+    std::vector<TransmitSlot> transmit_slots_;
+    std::vector<mmsghdr> transmit_msgs_;
+    std::size_t transmit_pending_ = 0;
+    std::size_t transmit_sent_ = 0;
+    bool flush_pending_ = false;
+    bool write_waiting_ = false;
+};
+
+#endif /* MMSG_SOCKET_LINK_HPP_H2TQ6WZN */
@@ -48,7 +48,7 @@ Mqtt::~Mqtt() {
     mosqpp::lib_cleanup();
 }
 
-bool Mqtt::publish(string topic, string message)
+bool Mqtt::publish(const string& topic, const string& message)
 {
     /*
      * NULL: pointer to an int.  If not NULL, the function will set this to the message id of this particular message.
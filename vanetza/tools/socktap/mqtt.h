@@ -82,7 +82,7 @@ public:
      * @param message null terminated string of the topic to publish to
      * @return True, if publication was successfully
      */
-    bool publish(string topic, string message);
+    bool publish(const string& topic, const string& message);
 
     /**
      * @brief subscribe to a topic
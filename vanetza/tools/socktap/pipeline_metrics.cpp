@@ -0,0 +1,167 @@
+#include "pipeline_metrics.hpp"
+#include <vanetza/geonet/data_indication.hpp>
+
+using namespace vanetza;
+
+namespace
+{
+
+bool is_transmission(PipelineStage stage)
+{
+    return static_cast<std::size_t>(stage) >= static_cast<std::size_t>(PipelineStage::JsonParse);
+}
+
+double seconds(PipelineMetrics::clock::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+// stages take between a few microseconds and several milliseconds
+const prometheus::Histogram::BucketBoundaries stage_buckets {
+    1e-6, 2.5e-6, 5e-6, 1e-5, 2.5e-5, 5e-5, 1e-4, 2.5e-4, 5e-4, 1e-3, 2.5e-3, 5e-3, 1e-2, 2.5e-2, 5e-2, 1e-1
+};
+
+// end-to-end latency has to stay within the 100 ms budget of CAMs
+const prometheus::Histogram::BucketBoundaries latency_buckets {
+    1e-4, 2.5e-4, 5e-4, 1e-3, 2.5e-3, 5e-3, 1e-2, 2.5e-2, 5e-2, 1e-1, 2.5e-1, 5e-1, 1.0
+};
+
+} // namespace
+
+const char* stringify(PipelineStage stage)
+{
+    switch (stage) {
+        case PipelineStage::SocketRx: return "socket_rx";
+        case PipelineStage::GeonetParse: return "geonet_parse";
+        case PipelineStage::SecurityVerify: return "security_verify";
+        case PipelineStage::BtpDispatch: return "btp_dispatch";
+        case PipelineStage::UperDecode: return "uper_decode";
+        case PipelineStage::JsonBuild: return "json_build";
+        case PipelineStage::Publish: return "publish";
+        case PipelineStage::JsonParse: return "json_parse";
+        case PipelineStage::UperEncode: return "uper_encode";
+        case PipelineStage::IngressQueue: return "ingress_queue";
+        case PipelineStage::GeonetRequest: return "geonet_request";
+        case PipelineStage::SecuritySign: return "security_sign";
+        case PipelineStage::LinkTransmit: return "link_transmit";
+    }
+    return "unknown";
+}
+
+PipelineMetrics::PipelineMetrics(const metrics_t& metrics, const std::string& message, const std::string& direction)
+{
+    stages_.fill(nullptr);
+    const bool transmission = direction == "tx";
+
+    if (metrics.stage_histogram) {
+        for (std::size_t i = 0; i < pipeline_stages; ++i) {
+            const PipelineStage stage = static_cast<PipelineStage>(i);
+            if (is_transmission(stage) == transmission) {
+                stages_[i] = &metrics.stage_histogram->Add(
+                    {{"message", message}, {"direction", direction}, {"stage", stringify(stage)}}, stage_buckets);
+            }
+        }
+    }
+
+    if (metrics.latency_histogram) {
+        latency_ = &metrics.latency_histogram->Add({{"message", message}, {"direction", direction}}, latency_buckets);
+    }
+}
+
+void PipelineMetrics::observe(PipelineStage stage, clock::duration duration)
+{
+    prometheus::Histogram* histogram = stages_[static_cast<std::size_t>(stage)];
+    if (histogram) {
+        histogram->Observe(seconds(duration));
+    }
+}
+
+void PipelineMetrics::observe_latency(clock::duration duration)
+{
+    if (latency_) {
+        latency_->Observe(seconds(duration));
+    }
+}
+
+PipelineStopwatch::PipelineStopwatch(PipelineMetrics* metrics, clock::time_point start) :
+    metrics_(metrics), start_(start), last_(start)
+{
+}
+
+void PipelineStopwatch::lap(PipelineStage stage, clock::time_point at, clock::duration excluded)
+{
+    if (metrics_) {
+        const clock::duration elapsed = at - last_ - excluded;
+        metrics_->observe(stage, elapsed > clock::duration::zero() ? elapsed : clock::duration::zero());
+        last_ = at;
+    }
+}
+
+void PipelineStopwatch::record(PipelineStage stage, clock::duration duration)
+{
+    if (metrics_) {
+        metrics_->observe(stage, duration);
+    }
+}
+
+void PipelineStopwatch::finish()
+{
+    if (metrics_) {
+        metrics_->observe_latency(clock::now() - start_);
+        metrics_ = nullptr;
+    }
+}
+
+TracingSecurityEntity::TracingSecurityEntity(security::SecurityEntity& entity, PacketTrace& trace) :
+    entity_(entity), trace_(trace)
+{
+}
+
+security::EncapConfirm TracingSecurityEntity::encapsulate_packet(security::EncapRequest&& request)
+{
+    const auto start = PacketTrace::clock::now();
+    security::EncapConfirm confirm = entity_.encapsulate_packet(std::move(request));
+    trace_.security += PacketTrace::clock::now() - start;
+    return confirm;
+}
+
+security::DecapConfirm TracingSecurityEntity::decapsulate_packet(security::DecapRequest&& request)
+{
+    const auto start = PacketTrace::clock::now();
+    security::DecapConfirm confirm = entity_.decapsulate_packet(std::move(request));
+    trace_.security += PacketTrace::clock::now() - start;
+    return confirm;
+}
+
+TracingTransport::TracingTransport(geonet::TransportInterface& transport, PacketTrace& trace) :
+    transport_(transport), trace_(trace)
+{
+}
+
+void TracingTransport::indicate(const geonet::DataIndication& indication, std::unique_ptr<geonet::UpPacket> packet)
+{
+    trace_.dispatched = PacketTrace::clock::now();
+    if (!trace_.active) {
+        // packet has been buffered by router, e.g. for contention based forwarding
+        trace_.indicated = trace_.dispatched;
+        trace_.reset();
+    }
+    transport_.indicate(indication, std::move(packet));
+}
+
+TracingAccessInterface::TracingAccessInterface(access::Interface& access, PacketTrace& trace) :
+    access_(access), trace_(trace)
+{
+}
+
+void TracingAccessInterface::request(const access::DataRequest& request, std::unique_ptr<ChunkPacket> packet)
+{
+    const auto start = PacketTrace::clock::now();
+    access_.request(request, std::move(packet));
+    trace_.transmit += PacketTrace::clock::now() - start;
+}
+
+prometheus::Counter* packet_drop_counter(prometheus::Family<prometheus::Counter>* family, const std::string& stage, const std::string& reason)
+{
+    return family ? &family->Add({{"stage", stage}, {"reason", reason}}) : nullptr;
+}
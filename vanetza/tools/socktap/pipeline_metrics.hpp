@@ -0,0 +1,191 @@
+#ifndef PIPELINE_METRICS_HPP_Q8DW3ZKR
+#define PIPELINE_METRICS_HPP_Q8DW3ZKR
+
+#include "config.hpp"
+#include <vanetza/access/interface.hpp>
+#include <vanetza/geonet/transport_interface.hpp>
+#include <vanetza/security/security_entity.hpp>
+#include <prometheus/counter.h>
+#include <prometheus/histogram.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+/**
+ * Processing stages of messages passing socktap
+ */
+enum class PipelineStage
+{
+    // reception
+    SocketRx,       // frame waiting between socket and router
+    GeonetParse,    // GeoNetworking processing without security
+    SecurityVerify, // decapsulation of secured packets
+    BtpDispatch,    // BTP port dispatching
+    UperDecode,     // decoding application layer
+    JsonBuild,      // creating JSON from decoded message
+    Publish,        // handing JSON over to MQTT, DDS and UDP
+
+    // transmission
+    JsonParse,      // creating message from received JSON
+    UperEncode,     // encoding application layer
+    IngressQueue,   // request waiting for router thread
+    GeonetRequest,  // GeoNetworking processing without security and link layer
+    SecuritySign,   // encapsulation of secured packets
+    LinkTransmit,   // passing frame to link layer
+};
+
+constexpr std::size_t pipeline_stages = static_cast<std::size_t>(PipelineStage::LinkTransmit) + 1;
+
+const char* stringify(PipelineStage);
+
+/**
+ * Latency histograms of one message type in one direction
+ */
+class PipelineMetrics
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * Create histograms of all stages belonging to direction
+     * \param metrics metric families, histograms are skipped if families are missing
+     * \param message message label, e.g. "cam"
+     * \param direction either "rx" or "tx"
+     */
+    PipelineMetrics(const metrics_t& metrics, const std::string& message, const std::string& direction);
+
+    void observe(PipelineStage, clock::duration);
+    void observe_latency(clock::duration);
+
+private:
+    std::array<prometheus::Histogram*, pipeline_stages> stages_;
+    prometheus::Histogram* latency_ = nullptr;
+};
+
+/**
+ * Stopwatch observing consecutive stages of a single message
+ *
+ * Default constructed stopwatches observe nothing.
+ */
+class PipelineStopwatch
+{
+public:
+    using clock = PipelineMetrics::clock;
+
+    PipelineStopwatch() = default;
+    PipelineStopwatch(PipelineMetrics*, clock::time_point start);
+
+    /**
+     * Observe time since previous lap (or start) as stage duration
+     * \param stage completed stage
+     * \param at end of stage
+     * \param excluded time spent in nested stages recorded separately
+     */
+    void lap(PipelineStage stage, clock::time_point at = clock::now(), clock::duration excluded = clock::duration::zero());
+
+    /**
+     * Observe duration of a nested stage measured elsewhere
+     */
+    void record(PipelineStage, clock::duration);
+
+    /**
+     * Observe total latency since start
+     */
+    void finish();
+
+private:
+    PipelineMetrics* metrics_ = nullptr;
+    clock::time_point start_;
+    clock::time_point last_;
+};
+
+/**
+ * Timing of the packet currently processed by the router
+ */
+struct PacketTrace
+{
+    using clock = PipelineMetrics::clock;
+
+    clock::time_point indicated;   // router started processing of received packet
+    clock::time_point dispatched;  // router passed packet to transport layer
+    clock::duration socket = clock::duration::zero();   // waiting time before router
+    clock::duration security = clock::duration::zero(); // spent in security entity
+    clock::duration transmit = clock::duration::zero(); // spent in link layer
+    bool active = false;           // set while a received packet is processed
+
+    void reset()
+    {
+        socket = security = transmit = clock::duration::zero();
+    }
+};
+
+/**
+ * Measures time spent in a security entity
+ */
+class TracingSecurityEntity : public vanetza::security::SecurityEntity
+{
+public:
+    TracingSecurityEntity(vanetza::security::SecurityEntity&, PacketTrace&);
+
+    vanetza::security::EncapConfirm encapsulate_packet(vanetza::security::EncapRequest&&) override;
+    vanetza::security::DecapConfirm decapsulate_packet(vanetza::security::DecapRequest&&) override;
+
+private:
+    vanetza::security::SecurityEntity& entity_;
+    PacketTrace& trace_;
+};
+
+/**
+ * Marks the end of GeoNetworking processing of received packets
+ */
+class TracingTransport : public vanetza::geonet::TransportInterface
+{
+public:
+    TracingTransport(vanetza::geonet::TransportInterface&, PacketTrace&);
+
+    void indicate(const vanetza::geonet::DataIndication&, std::unique_ptr<vanetza::geonet::UpPacket>) override;
+
+private:
+    vanetza::geonet::TransportInterface& transport_;
+    PacketTrace& trace_;
+};
+
+/**
+ * Measures time spent in link layer for transmissions
+ */
+class TracingAccessInterface : public vanetza::access::Interface
+{
+public:
+    TracingAccessInterface(vanetza::access::Interface&, PacketTrace&);
+
+    void request(const vanetza::access::DataRequest&, std::unique_ptr<vanetza::ChunkPacket>) override;
+
+private:
+    vanetza::access::Interface& access_;
+    PacketTrace& trace_;
+};
+
+/**
+ * Look up the counter of dropped packets for a stage and reason
+ *
+ * Callers are supposed to keep the returned counter instead of looking it up per drop.
+ * \param family counter family, yields nullptr if nullptr
+ * \param stage stage dropping the packet, e.g. "geonet"
+ * \param reason reason of drop
+ * \return counter or nullptr
+ */
+prometheus::Counter* packet_drop_counter(prometheus::Family<prometheus::Counter>* family, const std::string& stage, const std::string& reason);
+
+/**
+ * Count a dropped packet
+ * \param counter drop counter, nothing is counted if nullptr
+ */
+inline void count_packet_drop(prometheus::Counter* counter)
+{
+    if (counter) {
+        counter->Increment();
+    }
+}
+
+#endif /* PIPELINE_METRICS_HPP_Q8DW3ZKR */
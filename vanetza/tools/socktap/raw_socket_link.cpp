@@ -55,8 +55,24 @@ static void rssi_handler(int port) {
     }
 }
 
+int lookup_rssi(const MacAddress& sender)
+{
+    int rssi = -255;
+    if(rssi_enabled) {
+        std::stringstream stream;
+        stream << sender;
+        std::string result(stream.str());
+        if ((*rssi_map).count(result.substr(result.length() - 4))) {
+            rssi = (*rssi_map)[result.substr(result.length() - 4)];
+        }
+    }
+    return rssi;
+}
+
 RawSocketLink::RawSocketLink(boost::asio::generic::raw_protocol::socket&& socket) :
-    socket_(std::move(socket)), receive_buffer_(2048, 0x00),
+    socket_(std::move(socket)),
+    receive_pool_(std::make_shared<ByteBufferPool>(2048, 128)),
+    receive_buffer_(receive_pool_->acquire()),
     receive_endpoint_(socket_.local_endpoint())
 {   
     if (true) {
@@ -74,14 +90,8 @@ void RawSocketLink::request(const access::DataRequest& request, std::unique_ptr<
 
 std::size_t RawSocketLink::transmit(std::unique_ptr<ChunkPacket> packet)
 {
-    std::array<boost::asio::const_buffer, layers_> const_buffers;
-    for (auto& layer : osi_layer_range<OsiLayer::Physical, OsiLayer::Application>()) {
-        const auto index = distance(OsiLayer::Physical, layer);
-        packet->layer(layer).convert(buffers_[index]);
-        const_buffers[index] = boost::asio::buffer(buffers_[index]);
-    }
-
-    return socket_.send(const_buffers);
+    packet->serialize(transmit_buffer_);
+    return socket_.send(boost::asio::buffer(transmit_buffer_));
 }
 
 void RawSocketLink::indicate(IndicationCallback callback)
@@ -100,22 +110,16 @@ void RawSocketLink::do_receive()
 void RawSocketLink::on_read(const boost::system::error_code& ec, std::size_t read_bytes)
 {
     if (!ec) {
-        ByteBuffer buffer(receive_buffer_.begin(), receive_buffer_.begin() + read_bytes);
-        CohesivePacket packet(std::move(buffer), OsiLayer::Physical);
+        // hand received frame over to packet, its buffer returns to pool once packet is released
+        receive_buffer_.resize(read_bytes);
+        CohesivePacket packet(std::move(receive_buffer_), OsiLayer::Physical, receive_pool_);
+        receive_buffer_ = receive_pool_->acquire();
         boost::optional<EthernetHeader> eth = parse_ethernet_header(packet);
-        if(eth->type == access::ethertype::GeoNetworking) {
+        if(eth && eth->type == access::ethertype::GeoNetworking) {
             double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-            if(rssi_enabled) {
-                std::stringstream stream;
-                stream << eth->source;
-                std::string result(stream.str());
-                if ((*rssi_map).count(result.substr(result.length() - 4))) {
-                    packet.rssi = (*rssi_map)[result.substr(result.length() - 4)];
-                }
-            }
-            else packet.rssi = -255;
+            packet.rssi = lookup_rssi(eth->source);
             packet.time_received = time_reception;
-            if (callback_ && eth) {
+            if (callback_) {
                 callback_(std::move(packet), *eth);
             }
         }
@@ -3,11 +3,13 @@
 
 #include "link_layer.hpp"
 #include <vanetza/access/interface.hpp>
+#include <vanetza/common/byte_buffer_pool.hpp>
 #include <vanetza/net/ethernet_header.hpp>
 #include <boost/asio/generic/raw_protocol.hpp>
 #include <boost/optional/optional.hpp>
 #include <array>
 #include <functional>
+#include <memory>
 
 class RawSocketLink : public LinkLayer
 {
@@ -25,16 +27,22 @@ private:
     void on_read(const boost::system::error_code&, std::size_t);
     void pass_up(vanetza::CohesivePacket&&);
 
-    static constexpr std::size_t layers_ = num_osi_layers(vanetza::OsiLayer::Physical, vanetza::OsiLayer::Application);
-
     boost::asio::generic::raw_protocol::socket socket_;
-    std::array<vanetza::ByteBuffer, layers_> buffers_;
+    vanetza::ByteBuffer transmit_buffer_;
     IndicationCallback callback_;
+    std::shared_ptr<vanetza::ByteBufferPool> receive_pool_;
     vanetza::ByteBuffer receive_buffer_;
     boost::asio::generic::raw_protocol::endpoint receive_endpoint_;
 };
 
 static void rssi_handler(int port);
 
+/**
+ * Look up signal strength reported by RSSI discovery service
+ * \param sender source address of received frame
+ * \return rssi of sender or -255 if unknown
+ */
+int lookup_rssi(const vanetza::MacAddress& sender);
+
 #endif /* RAW_SOCKET_LINK_HPP_VUXH507U */
 
@@ -2,13 +2,19 @@
 #include "dcc_passthrough.hpp"
 #include "ethernet_device.hpp"
 #include "router_context.hpp"
+#include "security.hpp"
 #include "time_trigger.hpp"
 #include <vanetza/access/ethertype.hpp>
 #include <vanetza/dcc/data_request.hpp>
 #include <vanetza/dcc/interface.hpp>
+#include <vanetza/geonet/basic_header.hpp>
+#include <vanetza/geonet/parser.hpp>
 #include <iostream>
 #include <vanetza/common/byte_order.hpp>
+#include <algorithm>
 #include <chrono>
+#include <functional>
+#include <stdexcept>
 
 using namespace vanetza;
 using namespace std::chrono;
@@ -16,17 +22,22 @@ using namespace std::chrono;
 DccPassthrough* dccp = nullptr;
 
 RouterContext::RouterContext(const geonet::MIB& mib, TimeTrigger& trigger, vanetza::PositionProvider& positioning, vanetza::security::SecurityEntity* security_entity, bool ignore_own_messages_, bool ignore_rsu_messages_, boost::asio::io_service& io_context) :
-    mib_(mib), router_(trigger.runtime(), mib_), positioning_(positioning),
-    ignore_own_messages(ignore_own_messages_), ignore_rsu_messages(ignore_rsu_messages_), io_context_(io_context)
+    mib_(mib), trigger_(trigger), router_(trigger.runtime(), mib_), positioning_(positioning),
+    ignore_own_messages(ignore_own_messages_), ignore_rsu_messages(ignore_rsu_messages_), io_context_(io_context),
+    tracing_transport_(dispatcher_, trace_), ingress_(1024), ingress_pending_(false), verification_pending_(false)
 {
     router_.packet_dropped = std::bind(&RouterContext::log_packet_drop, this, std::placeholders::_1);
     router_.set_address(mib_.itsGnLocalGnAddr);
-    router_.set_transport_handler(geonet::UpperProtocol::BTP_B, &dispatcher_);
-    router_.set_security_entity(security_entity);
+    router_.set_transport_handler(geonet::UpperProtocol::BTP_B, &tracing_transport_);
+    if (security_entity) {
+        tracing_security_.reset(new TracingSecurityEntity(*security_entity, trace_));
+    }
+    router_.set_security_entity(tracing_security_.get());
 }
 
 RouterContext::~RouterContext()
 {
+    set_deferred_verification(nullptr);
     for (auto* app : applications_) {
         disable(app);
     }
@@ -36,6 +47,19 @@ void RouterContext::log_packet_drop(geonet::Router::PacketDropReason reason)
 {
     auto reason_string = stringify(reason);
     std::cout << "Router dropped packet because of " << reason_string << " (" << static_cast<int>(reason) << ")\n";
+    const auto index = static_cast<std::size_t>(reason);
+    count_packet_drop(index < geonet_drop_counters_.size() ? geonet_drop_counters_[index] : nullptr);
+}
+
+void RouterContext::set_metrics(const metrics_t& metrics)
+{
+    // counters are resolved once, drops are counted from router and producer threads
+    for (std::size_t i = 0; i < geonet_drop_counters_.size(); ++i) {
+        const auto reason = static_cast<geonet::Router::PacketDropReason>(i);
+        geonet_drop_counters_[i] = packet_drop_counter(metrics.drop_counter, "geonet", stringify(reason));
+    }
+    dcc_drop_counter_ = packet_drop_counter(metrics.drop_counter, "dcc", "packet_flow_suppressed");
+    ingress_drop_counter_ = packet_drop_counter(metrics.drop_counter, "ingress", "queue_full");
 }
 
 void RouterContext::set_link_layer(LinkLayer* link_layer)
@@ -44,34 +68,183 @@ void RouterContext::set_link_layer(LinkLayer* link_layer)
 
     if (link_layer) {
 
-        dccp = new DccPassthrough { *link_layer, io_context_ };
+        tracing_access_.reset(new TracingAccessInterface(*link_layer, trace_));
+        dccp = new DccPassthrough { *tracing_access_, trigger_ };
+        dccp->packet_dropped = [this]() {
+            count_packet_drop(dcc_drop_counter_);
+        };
         update_position_vector();
-        dccp->get_trigger().schedule();
+        trigger_.schedule();
 
         request_interface_.reset(dccp);
         router_.set_access_interface(request_interface_.get());
         link_layer->indicate(std::bind(&RouterContext::indicate, this, dummy::_1, dummy::_2));
+        link_layer->indicate_burst(std::bind(&RouterContext::indicate_burst, this, dummy::_1));
         update_packet_flow(router_.get_local_position_vector());
     } else {
         router_.set_access_interface(nullptr);
         request_interface_.reset();
+        tracing_access_.reset();
+    }
+}
+
+void RouterContext::set_deferred_verification(DeferredVerification* verification)
+{
+    if (deferred_verification_) {
+        deferred_verification_->on_ready(nullptr);
+    }
+
+    deferred_verification_ = verification;
+    if (deferred_verification_) {
+        // wake up router thread unless polling is pending already
+        deferred_verification_->on_ready([this]() {
+            if (!verification_pending_.exchange(true)) {
+                io_context_.post(std::bind(&RouterContext::poll_verification, this));
+            }
+        });
     }
 }
 
+void RouterContext::poll_verification()
+{
+    verification_pending_.store(false);
+    if (deferred_verification_) {
+        trigger_.schedule();
+        deferred_verification_->poll();
+        trigger_.schedule();
+    }
+}
+
+bool RouterContext::defer_frame(CohesivePacket& packet, const EthernetHeader& hdr)
+{
+    if (!deferred_verification_) {
+        return false;
+    }
+
+    // router parses the packet once more when its confirm is available
+    geonet::Parser parser(packet[OsiLayer::Network]);
+    geonet::BasicHeader basic;
+    security::SecuredMessage secured;
+    if (!parser.parse_basic(basic) || basic.next_header != geonet::NextHeaderBasic::Secured || !parser.parse_secured(secured)) {
+        return false;
+    }
+
+    auto frame = std::make_shared<LinkLayerFrame>(LinkLayerFrame { std::move(packet), hdr });
+    deferred_verification_->verify(secured, [this, frame](security::VerifyConfirm&& confirm) {
+        deferred_verification_->stage(std::move(confirm));
+        indicate_frame(std::move(frame->packet), frame->header);
+        deferred_verification_->unstage();
+    });
+    return true;
+}
+
+bool RouterContext::accept(const EthernetHeader& hdr) const
+{
+    return (!ignore_own_messages || hdr.source != mib_.itsGnLocalGnAddr.mid()) && (!ignore_rsu_messages || hdr.source.octets[3] != 1) && hdr.type == access::ethertype::GeoNetworking;
+}
+
 void RouterContext::indicate(CohesivePacket&& packet, const EthernetHeader& hdr)
 {
-    if ((!ignore_own_messages || hdr.source != mib_.itsGnLocalGnAddr.mid()) && (!ignore_rsu_messages || hdr.source.octets[3] != 1) && hdr.type == access::ethertype::GeoNetworking) {
+    if (accept(hdr)) {
         //std::cout << "received packet from " << hdr.source << " (" << packet.size() << " bytes)\n";
-        std::unique_ptr<PacketVariant> up { new PacketVariant(std::move(packet)) };
-        dccp->get_trigger().schedule(); // ensure the clock is up-to-date for the security entity
-        router_.indicate(std::move(up), hdr.source, hdr.destination);
-        dccp->get_trigger().schedule(); // schedule packet forwarding
+        trigger_.schedule(); // ensure the clock is up-to-date for the security entity
+        if (!defer_frame(packet, hdr)) {
+            indicate_frame(std::move(packet), hdr);
+        }
+        trigger_.schedule(); // schedule packet forwarding
     }
 }
 
+void RouterContext::indicate_frame(CohesivePacket&& packet, const EthernetHeader& hdr)
+{
+    trace_.reset();
+    trace_.indicated = PacketTrace::clock::now();
+    trace_.dispatched = trace_.indicated;
+    if (packet.time_received > 0.0) {
+        // reception time stamps are taken from system clock by the link layers
+        const auto received = system_clock::time_point {} + duration_cast<system_clock::duration>(duration<double>(packet.time_received));
+        trace_.socket = std::max(system_clock::now() - received, system_clock::duration::zero());
+    }
+    trace_.active = true;
+
+    std::unique_ptr<PacketVariant> up { new PacketVariant(std::move(packet)) };
+    router_.indicate(std::move(up), hdr.source, hdr.destination);
+    trace_.active = false;
+}
+
+void RouterContext::indicate_burst(std::vector<LinkLayerFrame>& frames)
+{
+    // update clock and timers once per burst instead of once per packet
+    trigger_.schedule();
+    for (LinkLayerFrame& frame : frames) {
+        if (accept(frame.header) && !defer_frame(frame.packet, frame.header)) {
+            indicate_frame(std::move(frame.packet), frame.header);
+        }
+    }
+    trigger_.schedule();
+}
+
+bool RouterContext::submit(Application* app, const btp::DataRequestGeoNetParams& request, geonet::Router::DownPacketPtr packet,
+        PipelineStopwatch stopwatch)
+{
+    IngressRequest ingress;
+    ingress.application = app;
+    ingress.request = request;
+    ingress.packet = std::move(packet);
+    ingress.stopwatch = stopwatch;
+    if (!ingress_.try_push(std::move(ingress))) {
+        std::cout << "Ingress queue is full, dropped application request\n";
+        count_packet_drop(ingress_drop_counter_);
+        return false;
+    }
+
+    // wake up router thread unless a drain is pending already
+    if (!ingress_pending_.exchange(true)) {
+        io_context_.post(std::bind(&RouterContext::drain_ingress, this));
+    }
+    return true;
+}
+
+void RouterContext::drain_ingress()
+{
+    // clear flag before draining: requests queued meanwhile trigger another drain
+    ingress_pending_.store(false);
+
+    IngressRequest ingress;
+    while (ingress_.try_pop(ingress)) {
+        if (!ingress.application) {
+            continue;
+        }
+
+        PipelineStopwatch& stopwatch = ingress.stopwatch;
+        stopwatch.lap(PipelineStage::IngressQueue);
+        trace_.reset();
+
+        try {
+            auto confirm = ingress.application->request(ingress.request, std::move(ingress.packet));
+            if (!confirm.accepted()) {
+                throw std::runtime_error("application data request failed");
+            }
+
+            // security and link layer are nested within the router's request processing
+            stopwatch.record(PipelineStage::SecuritySign, trace_.security);
+            stopwatch.record(PipelineStage::LinkTransmit, trace_.transmit);
+            stopwatch.lap(PipelineStage::GeonetRequest, PipelineStopwatch::clock::now(), trace_.security + trace_.transmit);
+            stopwatch.finish();
+        } catch (std::runtime_error& e) {
+            std::cout << "-- Vanetza Router Error --\n" << e.what() << std::endl;
+        } catch (...) {
+            std::cout << "-- Unexpected Error --\nVanetza couldn't pass the requested message to the router.\nNo other info available\n" << std::endl;
+        }
+    }
+
+    trigger_.schedule();
+}
+
 void RouterContext::enable(Application* app)
 {
     app->router_ = &router_;
+    app->context_ = this;
 
     dispatcher_.add_promiscuous_hook(app->promiscuous_hook());
     if (app->port() != btp::port_type(0)) {
@@ -87,6 +260,7 @@ void RouterContext::disable(Application* app)
     dispatcher_.remove_promiscuous_hook(app->promiscuous_hook());
 
     app->router_ = nullptr;
+    app->context_ = nullptr;
 }
 
 void RouterContext::require_position_fix(bool flag)
@@ -100,8 +274,8 @@ void RouterContext::update_position_vector()
     router_.update_position(positioning_.position_fix());
     vanetza::Runtime::Callback callback = [this](vanetza::Clock::time_point) { this->update_position_vector(); };
     vanetza::Clock::duration next = std::chrono::seconds(1);
-    dccp->get_trigger().runtime().schedule(next, callback);
-    dccp->get_trigger().schedule();
+    trigger_.runtime().schedule(next, callback);
+    trigger_.schedule();
 
     update_packet_flow(router_.get_local_position_vector());
 }
@@ -3,15 +3,21 @@
 
 #include "dcc_passthrough.hpp"
 #include "link_layer.hpp"
+#include "pipeline_metrics.hpp"
+#include <vanetza/btp/data_request.hpp>
 #include <vanetza/btp/port_dispatcher.hpp>
+#include <vanetza/common/mpsc_queue.hpp>
 #include <vanetza/common/position_provider.hpp>
 #include <vanetza/geonet/mib.hpp>
 #include <vanetza/geonet/router.hpp>
 #include <array>
+#include <atomic>
 #include <list>
 #include <memory>
+#include <vector>
 
 class Application;
+class DeferredVerification;
 class TimeTrigger;
 
 class RouterContext
@@ -33,22 +39,81 @@ public:
 
     DccPassthrough& get_dccp();
 
+    /**
+     * Enable pipeline metrics and counting of dropped packets
+     * \param metrics metric families
+     */
+    void set_metrics(const metrics_t& metrics);
+
+    /**
+     * Verify secured packets on worker threads before they are passed to the router
+     * \param verification deferred verification of router's security entity, nullptr to verify synchronously
+     */
+    void set_deferred_verification(DeferredVerification*);
+
+    /**
+     * Get timing of the received packet currently passed to applications
+     */
+    const PacketTrace& trace() const { return trace_; }
+
+    /**
+     * Submit an application request to the router
+     *
+     * Requests are queued and passed to the router by the io_service thread,
+     * i.e. the router is only ever accessed by a single thread.
+     * This method is safe to be called from any thread.
+     *
+     * \param app requesting application
+     * \param request BTP data request parameters
+     * \param packet packet with already encoded application layer
+     * \param stopwatch observes remaining transmission stages
+     * \return false if ingress queue is full and request has been dropped
+     */
+    bool submit(Application* app, const vanetza::btp::DataRequestGeoNetParams& request, vanetza::geonet::Router::DownPacketPtr packet,
+            PipelineStopwatch stopwatch = {});
+
 private:
+    struct IngressRequest
+    {
+        Application* application = nullptr;
+        vanetza::btp::DataRequestGeoNetParams request;
+        vanetza::geonet::Router::DownPacketPtr packet;
+        PipelineStopwatch stopwatch;
+    };
+
+    void drain_ingress();
+    bool accept(const vanetza::EthernetHeader& hdr) const;
     void indicate(vanetza::CohesivePacket&& packet, const vanetza::EthernetHeader& hdr);
+    void indicate_burst(std::vector<LinkLayerFrame>& frames);
+    void indicate_frame(vanetza::CohesivePacket&& packet, const vanetza::EthernetHeader& hdr);
+    bool defer_frame(vanetza::CohesivePacket& packet, const vanetza::EthernetHeader& hdr);
+    void poll_verification();
     void log_packet_drop(vanetza::geonet::Router::PacketDropReason);
     void update_position_vector();
     void update_packet_flow(const vanetza::geonet::LongPositionVector&);
 
     vanetza::geonet::MIB mib_;
+    TimeTrigger& trigger_;
     vanetza::geonet::Router router_;
     boost::asio::io_service& io_context_;
     vanetza::PositionProvider& positioning_;
     vanetza::btp::PortDispatcher dispatcher_;
+    PacketTrace trace_;
+    TracingTransport tracing_transport_;
+    std::unique_ptr<TracingSecurityEntity> tracing_security_;
+    std::unique_ptr<TracingAccessInterface> tracing_access_;
     std::unique_ptr<DccPassthrough> request_interface_;
     std::list<Application*> applications_;
     bool require_position_fix_ = false;
     bool ignore_own_messages = true;
     bool ignore_rsu_messages = false;
+    vanetza::BoundedMpscQueue<IngressRequest> ingress_;
+    std::atomic<bool> ingress_pending_;
+    DeferredVerification* deferred_verification_ = nullptr;
+    std::atomic<bool> verification_pending_;
+    std::array<prometheus::Counter*, static_cast<std::size_t>(vanetza::geonet::Router::PacketDropReason::Security_Entity_Missing) + 1> geonet_drop_counters_ {};
+    prometheus::Counter* dcc_drop_counter_ = nullptr;
+    prometheus::Counter* ingress_drop_counter_ = nullptr;
 };
 
 #endif /* ROUTER_CONTEXT_HPP_KIPUYBY2 */
@@ -3,24 +3,28 @@
 #include <vanetza/security/default_certificate_validator.hpp>
 #include <vanetza/security/delegating_security_entity.hpp>
 #include <vanetza/security/naive_certificate_provider.hpp>
+#include <vanetza/security/nonce_pool.hpp>
 #include <vanetza/security/null_certificate_validator.hpp>
 #include <vanetza/security/persistence.hpp>
 #include <vanetza/security/sign_header_policy.hpp>
 #include <vanetza/security/static_certificate_provider.hpp>
 #include <vanetza/security/trust_store.hpp>
+#include <vanetza/security/verify_worker_pool.hpp>
+#include <boost/optional/optional.hpp>
+#include <mutex>
 #include <stdexcept>
 
 using namespace vanetza;
 namespace po = boost::program_options;
 
-class SecurityContext : public security::SecurityEntity
+class SecurityContext : public security::SecurityEntity, public DeferredVerification
 {
 public:
-    SecurityContext(const Runtime& runtime, PositionProvider& positioning) :
+    SecurityContext(const Runtime& runtime, PositionProvider& positioning, std::size_t cert_cache_size) :
         runtime(runtime), positioning(positioning),
         backend(security::create_backend("default")),
         sign_header_policy(runtime, positioning),
-        cert_cache(runtime),
+        cert_cache(runtime, cert_cache_size),
         cert_validator(*backend, cert_cache, trust_store)
     {
     }
@@ -38,7 +42,63 @@ public:
         if (!entity) {
             throw std::runtime_error("security entity is not ready");
         }
-        return entity->decapsulate_packet(std::move(request));
+        security::DecapConfirm confirm = entity->decapsulate_packet(std::move(request));
+        update_cache_metrics();
+        return confirm;
+    }
+
+    void verify(const security::SecuredMessage& message, security::VerifyCallback callback) override
+    {
+        async_verify(security::VerifyRequest { message }, std::move(callback));
+    }
+
+    std::size_t poll() override
+    {
+        return verify_pool->poll();
+    }
+
+    void on_ready(std::function<void()> handler) override
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex);
+        ready_handler = std::move(handler);
+    }
+
+    void stage(security::VerifyConfirm&& confirm) override
+    {
+        staged_confirm = std::move(confirm);
+    }
+
+    void unstage() override
+    {
+        staged_confirm = boost::none;
+    }
+
+    void set_cache_metrics(prometheus::Family<prometheus::Counter>& family)
+    {
+        cache_hits = &family.Add({{"event", "hit"}});
+        cache_misses = &family.Add({{"event", "miss"}});
+        cache_evictions = &family.Add({{"event", "eviction"}});
+        exported_statistics = cert_cache.statistics();
+    }
+
+    // cache statistics are cumulative, counters are advanced by what happened since last update
+    void update_cache_metrics()
+    {
+        if (!cache_hits) {
+            return;
+        }
+
+        const security::CertificateCache::Statistics& statistics = cert_cache.statistics();
+        if (statistics.hits != exported_statistics.hits) {
+            cache_hits->Increment(statistics.hits - exported_statistics.hits);
+        }
+        if (statistics.misses != exported_statistics.misses) {
+            cache_misses->Increment(statistics.misses - exported_statistics.misses);
+        }
+        if (statistics.evictions != exported_statistics.evictions) {
+            cache_evictions->Increment(statistics.evictions - exported_statistics.evictions);
+        }
+        exported_statistics = statistics;
     }
 
     void build_entity()
@@ -46,9 +106,34 @@ public:
         if (!cert_provider) {
             throw std::runtime_error("certificate provider is missing");
         }
-        security::SignService sign_service = straight_sign_service(*cert_provider, *backend, sign_header_policy);
+        security::SignService sign_service = nonce_pool ?
+            precomputed_sign_service(*cert_provider, *backend, sign_header_policy, *nonce_pool) :
+            straight_sign_service(*cert_provider, *backend, sign_header_policy);
         security::VerifyService verify_service = straight_verify_service(runtime, *cert_provider, cert_validator,
                 *backend, cert_cache, sign_header_policy, positioning);
+
+        if (verify_pool) {
+            async_verify = async_verify_service(runtime, *cert_provider, cert_validator, *verify_pool,
+                    *backend, cert_cache, sign_header_policy, positioning);
+            verify_pool->ready = [this]() {
+                std::lock_guard<std::mutex> lock(ready_mutex);
+                if (ready_handler) {
+                    ready_handler();
+                }
+            };
+
+            // packets verified ahead of the router come with a staged confirm
+            security::VerifyService straight_service = std::move(verify_service);
+            verify_service = [this, straight_service](security::VerifyRequest&& request) {
+                if (staged_confirm) {
+                    security::VerifyConfirm confirm = std::move(*staged_confirm);
+                    staged_confirm = boost::none;
+                    return confirm;
+                }
+                return straight_service(std::move(request));
+            };
+        }
+
         entity.reset(new security::DelegatingSecurityEntity { sign_service, verify_service });
     }
 
@@ -57,10 +142,20 @@ public:
     std::unique_ptr<security::Backend> backend;
     std::unique_ptr<security::SecurityEntity> entity;
     std::unique_ptr<security::CertificateProvider> cert_provider;
+    std::unique_ptr<security::NoncePool> nonce_pool;
+    std::mutex ready_mutex;
+    std::function<void()> ready_handler;
+    std::unique_ptr<security::VerifyWorkerPool> verify_pool; /*< workers are stopped before ready handler is gone */
+    security::AsyncVerifyService async_verify;
+    boost::optional<security::VerifyConfirm> staged_confirm;
     security::DefaultSignHeaderPolicy sign_header_policy;
     security::TrustStore trust_store;
     security::CertificateCache cert_cache;
     security::DefaultCertificateValidator cert_validator;
+    prometheus::Counter* cache_hits = nullptr;
+    prometheus::Counter* cache_misses = nullptr;
+    prometheus::Counter* cache_evictions = nullptr;
+    security::CertificateCache::Statistics exported_statistics;
 };
 
 
@@ -78,7 +173,8 @@ create_security_entity(const po::variables_map& vm, const Runtime& runtime, Posi
                 security::VerificationReport::Success, security::CertificateValidity::valid());
         security.reset(new security::DelegatingSecurityEntity { sign_service, verify_service });
     } else if (name == "certs") {
-        std::unique_ptr<SecurityContext> context { new SecurityContext(runtime, positioning) };
+        std::unique_ptr<SecurityContext> context { new SecurityContext(runtime, positioning,
+                vm["certificate-cache-size"].as<std::size_t>()) };
 
         if (vm.count("certificate") ^ vm.count("certificate-key")) {
             throw std::runtime_error("Either --certificate and --certificate-key must be present or none.");
@@ -118,6 +214,18 @@ create_security_entity(const po::variables_map& vm, const Runtime& runtime, Posi
             }
         }
 
+        const unsigned nonce_workers = vm["sign-precompute-workers"].as<unsigned>();
+        if (nonce_workers > 0) {
+            context->nonce_pool.reset(new security::NoncePool(nonce_workers, vm["sign-precompute-nonces"].as<std::size_t>()));
+            // register own key, so stock is ready when the first message is signed
+            context->nonce_pool->take(context->cert_provider->own_private_key());
+        }
+
+        const unsigned verify_workers = vm["verify-workers"].as<unsigned>();
+        if (verify_workers > 0) {
+            context->verify_pool.reset(new security::VerifyWorkerPool(verify_workers, "default", vm["verify-batch"].as<std::size_t>()));
+        }
+
         context->build_entity();
         security = std::move(context);
     } else {
@@ -127,6 +235,20 @@ create_security_entity(const po::variables_map& vm, const Runtime& runtime, Posi
     return security;
 }
 
+DeferredVerification* get_deferred_verification(security::SecurityEntity* entity)
+{
+    auto context = dynamic_cast<SecurityContext*>(entity);
+    return context && context->verify_pool ? context : nullptr;
+}
+
+void set_security_metrics(security::SecurityEntity* entity, const metrics_t& metrics)
+{
+    auto context = dynamic_cast<SecurityContext*>(entity);
+    if (context && metrics.certificate_cache_counter) {
+        context->set_cache_metrics(*metrics.certificate_cache_counter);
+    }
+}
+
 void add_security_options(po::options_description& options)
 {
     options.add_options()
@@ -135,6 +257,11 @@ void add_security_options(po::options_description& options)
         ("certificate-key", po::value<std::string>(), "Certificate key to use for secured messages.")
         ("certificate-chain", po::value<std::vector<std::string> >()->multitoken(), "Certificate chain to use, use as often as needed.")
         ("trusted-certificate", po::value<std::vector<std::string> >()->multitoken(), "Trusted certificate, use as often as needed. Root certificates in the chain are automatically trusted.")
+        ("certificate-cache-size", po::value<std::size_t>()->default_value(security::CertificateCache::default_capacity), "Maximum number of cached certificates, including verified signers.")
+        ("sign-precompute-workers", po::value<unsigned>()->default_value(0), "Threads precomputing signature nonces in the background, 0 disables precomputation.")
+        ("sign-precompute-nonces", po::value<std::size_t>()->default_value(16), "Number of precomputed signature nonces kept in stock.")
+        ("verify-workers", po::value<unsigned>()->default_value(0), "Threads checking signatures of received packets ahead of the router, 0 lets the router verify synchronously.")
+        ("verify-batch", po::value<std::size_t>()->default_value(32), "Maximum number of signatures checked by a verify worker at once.")
     ;
 }
 
@@ -1,16 +1,74 @@
 #ifndef SECURITY_HPP_FV13ZIYA
 #define SECURITY_HPP_FV13ZIYA
 
+#include "config.hpp"
 #include <vanetza/common/position_provider.hpp>
 #include <vanetza/common/runtime.hpp>
 #include <vanetza/security/security_entity.hpp>
+#include <vanetza/security/verify_service.hpp>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
+#include <cstddef>
+#include <functional>
 #include <memory>
 
+/**
+ * Verification of received packets ahead of the router on worker threads, see --verify-workers
+ *
+ * Once a packet's confirm is available, it is staged and the packet is passed to the router.
+ * The security entity's next decapsulation reports the staged confirm instead of verifying again.
+ */
+class DeferredVerification
+{
+public:
+    /**
+     * Start verification of a secured message
+     * \param message secured message, it is not accessed after this call
+     * \param callback invoked with confirm by poll() or immediately if no signature needs to be checked
+     */
+    virtual void verify(const vanetza::security::SecuredMessage&, vanetza::security::VerifyCallback) = 0;
+
+    /**
+     * Invoke callbacks of completed verifications
+     * \return number of invoked callbacks
+     */
+    virtual std::size_t poll() = 0;
+
+    /**
+     * Set handler invoked by worker threads when callbacks are ready to be polled
+     * \param handler thread-safe handler, nullptr to remove it
+     */
+    virtual void on_ready(std::function<void()>) = 0;
+
+    /**
+     * Stage confirm for the next decapsulation
+     */
+    virtual void stage(vanetza::security::VerifyConfirm&&) = 0;
+
+    /**
+     * Drop staged confirm if it has not been reported by a decapsulation
+     */
+    virtual void unstage() = 0;
+
+    virtual ~DeferredVerification() = default;
+};
+
 std::unique_ptr<vanetza::security::SecurityEntity>
 create_security_entity(const boost::program_options::variables_map&, const vanetza::Runtime&, vanetza::PositionProvider&);
 
+/**
+ * Get deferred verification of a security entity
+ * \return deferred verification or nullptr if entity verifies synchronously
+ */
+DeferredVerification* get_deferred_verification(vanetza::security::SecurityEntity*);
+
+/**
+ * Export certificate cache statistics (signer lookup hits and misses, evictions) as counters
+ * \param entity security entity, only "certs" entities maintain a certificate cache
+ * \param metrics metric families, nothing is exported if certificate cache family is missing
+ */
+void set_security_metrics(vanetza::security::SecurityEntity*, const metrics_t&);
+
 void add_security_options(boost::program_options::options_description&);
 
 #endif /* SECURITY_HPP_FV13ZIYA */
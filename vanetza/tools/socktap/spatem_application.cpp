@@ -20,8 +20,6 @@ using namespace boost::asio;
 
 prometheus::Counter *spatem_rx_counter;
 prometheus::Counter *spatem_tx_counter;
-prometheus::Counter *spatem_rx_latency;
-prometheus::Counter *spatem_tx_latency;
 
 boost::asio::io_service spatem_io_service_;
 ip::udp::socket spatem_udp_socket(spatem_io_service_);
@@ -37,8 +35,7 @@ SpatemApplication::SpatemApplication(PositionProvider& positioning, Runtime& rt,
     
     spatem_rx_counter = &((*metrics_s.packet_counter).Add({{"message", "spatem"}, {"direction", "rx"}}));
     spatem_tx_counter = &((*metrics_s.packet_counter).Add({{"message", "spatem"}, {"direction", "tx"}}));
-    spatem_rx_latency = &((*metrics_s.latency_counter).Add({{"message", "spatem"}, {"direction", "rx"}}));
-    spatem_tx_latency = &((*metrics_s.latency_counter).Add({{"message", "spatem"}, {"direction", "tx"}}));
+    init_metrics(metrics_s, "spatem");
 
     if(config_s.spatem.udp_out_port != 0) {
         spatem_udp_socket.open(ip::udp::v4());
@@ -60,22 +57,18 @@ SpatemApplication::PortType SpatemApplication::port()
 
 void SpatemApplication::indicate(const DataIndication& indication, UpPacketPtr packet)
 {
-    struct indication_visitor : public boost::static_visitor<CohesivePacket>
-    {
-        CohesivePacket operator()(CohesivePacket& packet) {return packet;}
-        CohesivePacket operator()(ChunkPacket& packet) {return CohesivePacket(std::move(ByteBuffer()), OsiLayer::Physical);}
-    } ivis;
-
-    UpPacket* packet_ptr = packet.get();
-    CohesivePacket cp = boost::apply_visitor(ivis, *packet_ptr);
-
-    asn1::PacketVisitor<asn1::Spatem> visitor;
-    std::shared_ptr<const asn1::Spatem> spatem = boost::apply_visitor(visitor, *packet);
+    PipelineStopwatch stopwatch = rx_stopwatch();
+    std::shared_ptr<const asn1::Spatem> spatem = decode<asn1::Spatem>(*packet);
+    if (!spatem) {
+        return;
+    }
+    stopwatch.lap(PipelineStage::UperDecode);
 
     //std::cout << "SPATEM application received a packet with " << (spatem ? "decodable" : "broken") << " content" << std::endl;
 
     SPATEM_t spatem_t = {(*spatem)->header, (*spatem)->spat};
-    string spatem_json = buildJSON(spatem_t, cp.time_received, cp.rssi);
+    const string& spatem_json = buildJSON(spatem_t, indication.time_received, indication.rssi);
+    stopwatch.lap(PipelineStage::JsonBuild);
 
     if(config_s.spatem.mqtt_enabled) mqtt->publish(config_s.spatem.topic_out, spatem_json);
     if(config_s.spatem.dds_enabled) dds->publish(config_s.spatem.topic_out, spatem_json);
@@ -85,6 +78,9 @@ void SpatemApplication::indicate(const DataIndication& indication, UpPacketPtr p
     if(config_s.spatem.udp_out_port != 0) {
         spatem_udp_socket.send_to(buffer(spatem_json, spatem_json.length()), spatem_remote_endpoint, 0, spatem_err);
     }
+
+    stopwatch.lap(PipelineStage::Publish);
+    stopwatch.finish();
 }
 
 void SpatemApplication::schedule_timer()
@@ -92,67 +88,63 @@ void SpatemApplication::schedule_timer()
     runtime_.schedule(spatem_interval_, std::bind(&SpatemApplication::on_timer, this, std::placeholders::_1), this);
 }
 
-std::string SpatemApplication::buildJSON(SPATEM_t message, double time_reception, int rssi) {
-    ItsPduHeader_t& header = message.header;
-    nlohmann::json j = message;
+const std::string& SpatemApplication::buildJSON(const SPATEM_t& message, double time_reception, int rssi) {
+    const ItsPduHeader_t& header = message.header;
+
+    // keys are written in lexicographical order as done by nlohmann::json
+    json_buffer_.clear();
+    JsonWriter w(json_buffer_);
+    w.begin_object();
+    w.key("fields");
+    write_json(w, message);
 
     const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
 
-    nlohmann::json json_payload = {
-            {"timestamp", time_reception},
-            {"newInfo", true},
-            {"rssi", rssi},
-            {"test", {
-                    {"json_timestamp", time_now}
-                },
-            },
-            {"fields", j},
-            {"stationID", (long) header.stationID},
-            {"receiverID", config_s.station_id},
-            {"receiverType", config_s.station_type}
-    };
-
-    spatem_rx_latency->Increment(time_now - time_reception);
-    return json_payload.dump();
+    w.key("newInfo");
+    w.value(true);
+    w.key("receiverID");
+    w.value(config_s.station_id);
+    w.key("receiverType");
+    w.value(config_s.station_type);
+    w.key("rssi");
+    w.value(rssi);
+    w.key("stationID");
+    w.value((long) header.stationID);
+    w.key("test");
+    w.begin_object();
+    w.key("json_timestamp");
+    w.value(time_now);
+    w.end_object();
+    w.key("timestamp");
+    w.value(time_reception);
+    w.end_object();
+
+    return json_buffer_;
 }
 
 void SpatemApplication::on_message(string topic, string mqtt_message) {
 
-    const double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
-    SPAT_t spatem;
-
-    json payload;
+    PipelineStopwatch stopwatch = tx_stopwatch();
 
-    try {
-        payload = json::parse(mqtt_message);
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON spec\n" << e.what() << std::endl;
-        return;
-    } catch(...) {
-        std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
-        return;
-    }
+    vanetza::asn1::Spatem message;
 
     try {
-        spatem = payload.get<SPAT_t>();
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza ETSI Decoding Error --\nCheck that the message format follows ETSI spec\n" << e.what() << std::endl;
+        JsonReader reader(mqtt_message);
+        read_json(reader, message->spat);
+        reader.finish();
+    } catch(JsonReadError& e) {
+        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON and ETSI spec\n" << e.what() << std::endl;
         return;
     } catch(...) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
         return;
     }
 
-    vanetza::asn1::Spatem message;
-
     ItsPduHeader_t& header = message->header;
     header.protocolVersion = 2;
     header.messageID = ItsPduHeader__messageID_spatem;
     header.stationID = config_s.station_id;
 
-    message->spat = spatem;
-
     DownPacketPtr packet { new DownPacket() };
     packet->layer(OsiLayer::Application) = std::move(message);
 
@@ -162,8 +154,7 @@ void SpatemApplication::on_message(string topic, string mqtt_message) {
     request.communication_profile = geonet::CommunicationProfile::ITS_G5;
 
     try {
-        auto confirm = Application::request(request, std::move(packet));
-        if (!confirm.accepted()) {
+        if (!Application::enqueue(request, std::move(packet), stopwatch)) {
             throw std::runtime_error("SPATEM application data request failed");
         }
     } catch(std::runtime_error& e) {
@@ -172,10 +163,7 @@ void SpatemApplication::on_message(string topic, string mqtt_message) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't send the requested message but did not throw a runtime error on UPER encode.\nNo other info available\n" << std::endl;
     }
 
-    const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
     spatem_tx_counter->Increment();
-    spatem_tx_latency->Increment(time_now - time_reception);
 }
 
 void SpatemApplication::on_timer(Clock::time_point)
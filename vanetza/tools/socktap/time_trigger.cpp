@@ -11,6 +11,10 @@ TimeTrigger::TimeTrigger(asio::io_service& io_service) :
     io_service_(io_service), timer_(io_service), runtime_(Clock::at(now()))
 {
     std::cout << "Starting runtime at " << now() <<"\n";
+    // callbacks might get scheduled by other threads: re-arm timer on io_service thread
+    runtime_.wakeup = [this](Clock::time_point) {
+        io_service_.post(std::bind(&TimeTrigger::schedule, this));
+    };
     schedule();
 }
 
@@ -1,7 +1,7 @@
 #ifndef TIME_TRIGGER_HPP_XRPGDYXO
 #define TIME_TRIGGER_HPP_XRPGDYXO
 
-#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/common/timing_wheel_runtime.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/deadline_timer.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -11,6 +11,11 @@ class TimeTrigger
 public:
     TimeTrigger(boost::asio::io_service&);
     vanetza::Runtime& runtime() { return runtime_; }
+
+    /**
+     * Update runtime and re-arm timer for next runtime event
+     * \note has to be called by the io_service thread
+     */
     void schedule();
 
 private:
@@ -20,7 +25,7 @@ private:
 
     boost::asio::io_service& io_service_;
     boost::asio::deadline_timer timer_;
-    vanetza::ManualRuntime runtime_;
+    vanetza::TimingWheelRuntime runtime_;
 };
 
 #endif /* TIME_TRIGGER_HPP_XRPGDYXO */
@@ -0,0 +1,288 @@
+#include "tpacket_ring_link.hpp"
+#include "raw_socket_link.hpp"
+#include <vanetza/access/data_request.hpp>
+#include <vanetza/access/ethertype.hpp>
+#include <vanetza/common/byte_order.hpp>
+#include <vanetza/net/ethernet_header.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <linux/filter.h>
+#include <linux/if_packet.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+using namespace vanetza;
+
+namespace
+{
+
+constexpr std::size_t tx_data_offset = TPACKET_ALIGN(sizeof(tpacket3_hdr));
+constexpr std::chrono::milliseconds tx_backoff { 1 };
+
+std::runtime_error ring_error(const std::string& what)
+{
+    return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+constexpr std::size_t TpacketRingLink::block_size_;
+constexpr std::size_t TpacketRingLink::rx_blocks_;
+constexpr std::size_t TpacketRingLink::tx_blocks_;
+constexpr std::size_t TpacketRingLink::frame_size_;
+
+TpacketRingLink::TpacketRingLink(boost::asio::io_service& io_service, boost::asio::generic::raw_protocol::socket&& socket) :
+    io_service_(io_service), socket_(std::move(socket)), backoff_timer_(io_service),
+    receive_pool_(std::make_shared<ByteBufferPool>(frame_size_, 256))
+{
+    socket_.non_blocking(true);
+    attach_filter();
+    setup_rings();
+    burst_.reserve(block_size_ / frame_size_);
+    do_receive();
+}
+
+TpacketRingLink::~TpacketRingLink()
+{
+    if (ring_) {
+        ::munmap(ring_, ring_size_);
+    }
+}
+
+void TpacketRingLink::attach_filter()
+{
+    // accept GeoNetworking frames except those echoed back from our own transmissions
+    const uint16_t ether_type = access::ethertype::GeoNetworking.host();
+    sock_filter code[] = {
+        BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 12),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ether_type, 0, 3),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_PKTTYPE)),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, PACKET_OUTGOING, 1, 0),
+        BPF_STMT(BPF_RET | BPF_K, 0xffff),
+        BPF_STMT(BPF_RET | BPF_K, 0),
+    };
+
+    sock_fprog program {};
+    program.len = sizeof(code) / sizeof(code[0]);
+    program.filter = code;
+    if (::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_ATTACH_FILTER, &program, sizeof(program)) < 0) {
+        throw ring_error("Attaching GeoNetworking socket filter failed");
+    }
+}
+
+void TpacketRingLink::setup_rings()
+{
+    const int fd = socket_.native_handle();
+
+    int version = TPACKET_V3;
+    if (::setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+        throw ring_error("Selecting TPACKET_V3 failed");
+    }
+
+    tpacket_req3 rx {};
+    rx.tp_block_size = block_size_;
+    rx.tp_block_nr = rx_blocks_;
+    rx.tp_frame_size = frame_size_;
+    rx.tp_frame_nr = block_size_ / frame_size_ * rx_blocks_;
+    rx.tp_retire_blk_tov = 1; // milliseconds until a partially filled block is passed to user space
+    if (::setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &rx, sizeof(rx)) < 0) {
+        throw ring_error("Setting up receive ring failed");
+    }
+
+    tpacket_req3 tx {};
+    tx.tp_block_size = block_size_;
+    tx.tp_block_nr = tx_blocks_;
+    tx.tp_frame_size = frame_size_;
+    tx.tp_frame_nr = block_size_ / frame_size_ * tx_blocks_;
+    if (::setsockopt(fd, SOL_PACKET, PACKET_TX_RING, &tx, sizeof(tx)) < 0) {
+        throw ring_error("Setting up transmit ring failed");
+    }
+
+    // receive ring is followed by transmit ring in mapped memory
+    ring_size_ = block_size_ * (rx_blocks_ + tx_blocks_);
+    void* ring = ::mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ring == MAP_FAILED) {
+        throw ring_error("Mapping packet rings failed");
+    }
+    ring_ = static_cast<std::uint8_t*>(ring);
+}
+
+void TpacketRingLink::request(const access::DataRequest& request, std::unique_ptr<ChunkPacket> packet)
+{
+    packet->layer(OsiLayer::Link) = create_ethernet_header(request.destination_addr, request.source_addr, request.ether_type);
+
+    static const std::size_t tx_frames = block_size_ / frame_size_ * tx_blocks_;
+    std::uint8_t* tx_ring = ring_ + block_size_ * rx_blocks_;
+    auto hdr = reinterpret_cast<tpacket3_hdr*>(tx_ring + tx_frame_ * frame_size_);
+
+    auto available = [hdr]() {
+        const auto status = __atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE);
+        if (status & TP_STATUS_WRONG_FORMAT) {
+            std::cerr << "Kernel rejected malformed frame in transmit ring\n";
+            return true;
+        }
+        return status == TP_STATUS_AVAILABLE;
+    };
+
+    if (!available()) {
+        // all frames are in flight, push them out before giving up on this one
+        flush();
+        if (!available()) {
+            std::cerr << "Dropped frame because transmit ring is full\n";
+            return;
+        }
+    }
+
+    packet->serialize(transmit_buffer_);
+    if (transmit_buffer_.size() > frame_size_ - tx_data_offset) {
+        std::cerr << "Dropped frame because it exceeds transmit ring frame size\n";
+        return;
+    }
+    std::uint8_t* data = reinterpret_cast<std::uint8_t*>(hdr) + tx_data_offset;
+    std::copy(transmit_buffer_.begin(), transmit_buffer_.end(), data);
+
+    hdr->tp_len = transmit_buffer_.size();
+    hdr->tp_next_offset = 0;
+    __atomic_store_n(&hdr->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+    tx_frame_ = (tx_frame_ + 1) % tx_frames;
+    ++transmit_pending_;
+
+    if (!flush_pending_) {
+        // collect further requests issued by the current handler before kicking the kernel
+        flush_pending_ = true;
+        io_service_.post(std::bind(&TpacketRingLink::on_flush, this));
+    }
+}
+
+void TpacketRingLink::indicate(IndicationCallback callback)
+{
+    callback_ = callback;
+}
+
+void TpacketRingLink::indicate_burst(BurstIndicationCallback callback)
+{
+    burst_callback_ = callback;
+}
+
+void TpacketRingLink::do_receive()
+{
+    namespace sph = std::placeholders;
+    socket_.async_wait(boost::asio::generic::raw_protocol::socket::wait_read,
+            std::bind(&TpacketRingLink::on_readable, this, sph::_1));
+}
+
+void TpacketRingLink::on_readable(const boost::system::error_code& ec)
+{
+    if (!ec) {
+        receive_blocks();
+        do_receive();
+    }
+}
+
+void TpacketRingLink::receive_blocks()
+{
+    burst_.clear();
+
+    // visit each block at most once per wake-up so other handlers are not starved
+    for (std::size_t n = 0; n < rx_blocks_; ++n) {
+        auto block = reinterpret_cast<tpacket_block_desc*>(ring_ + rx_block_ * block_size_);
+        if (!(__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER)) {
+            break;
+        }
+
+        const tpacket_hdr_v1& desc = block->hdr.bh1;
+        auto frame = reinterpret_cast<const std::uint8_t*>(block) + desc.offset_to_first_pkt;
+        for (std::uint32_t i = 0; i < desc.num_pkts; ++i) {
+            auto hdr = reinterpret_cast<const tpacket3_hdr*>(frame);
+            const double time_received = hdr->tp_sec + hdr->tp_nsec / 1e9;
+            receive_frame(frame + hdr->tp_mac, hdr->tp_snaplen, time_received);
+            frame += hdr->tp_next_offset;
+        }
+
+        // frames have been copied, block can be reused by kernel right away
+        __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+        rx_block_ = (rx_block_ + 1) % rx_blocks_;
+    }
+
+    if (!burst_.empty()) {
+        burst_callback_(burst_);
+        burst_.clear();
+    }
+}
+
+void TpacketRingLink::receive_frame(const std::uint8_t* frame, std::size_t length, double time_received)
+{
+    if (length < EthernetHeader::length_bytes) {
+        std::cerr << "Router dropped invalid packet (too short for Ethernet header)\n";
+        return;
+    } else if (length > receive_pool_->buffer_size()) {
+        return;
+    }
+
+    // parse header in place
+    EthernetHeader eth;
+    std::copy_n(frame, MacAddress::length_bytes, eth.destination.octets.begin());
+    std::copy_n(frame + MacAddress::length_bytes, MacAddress::length_bytes, eth.source.octets.begin());
+    uint16_t proto = (frame[12] << 8) | frame[13];
+    eth.type = host_cast(proto);
+
+    ByteBuffer buffer = receive_pool_->acquire();
+    buffer.assign(frame, frame + length);
+    CohesivePacket packet(std::move(buffer), OsiLayer::Physical, receive_pool_);
+    packet.set_boundary(OsiLayer::Physical, 0);
+    packet.set_boundary(OsiLayer::Link, EthernetHeader::length_bytes);
+    packet.rssi = lookup_rssi(eth.source);
+    packet.time_received = time_received;
+
+    if (burst_callback_) {
+        burst_.push_back(LinkLayerFrame { std::move(packet), eth });
+    } else if (callback_) {
+        callback_(std::move(packet), eth);
+    }
+}
+
+void TpacketRingLink::on_flush()
+{
+    flush_pending_ = false;
+    flush();
+}
+
+void TpacketRingLink::on_writable(const boost::system::error_code& ec)
+{
+    write_waiting_ = false;
+    if (!ec) {
+        flush();
+    } else if (ec != boost::asio::error::operation_aborted) {
+        std::cerr << "Transmit ring flush failed: " << ec.message() << "\n";
+    }
+}
+
+void TpacketRingLink::flush()
+{
+    namespace sph = std::placeholders;
+
+    while (transmit_pending_ > 0 && !write_waiting_) {
+        // kernel sends all frames marked with TP_STATUS_SEND_REQUEST
+        if (::send(socket_.native_handle(), nullptr, 0, MSG_DONTWAIT) >= 0) {
+            transmit_pending_ = 0;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            write_waiting_ = true;
+            socket_.async_wait(boost::asio::generic::raw_protocol::socket::wait_write,
+                    std::bind(&TpacketRingLink::on_writable, this, sph::_1));
+        } else if (errno == ENOBUFS) {
+            // driver queue is congested although socket may poll writable, retry later
+            write_waiting_ = true;
+            backoff_timer_.expires_from_now(tx_backoff);
+            backoff_timer_.async_wait(std::bind(&TpacketRingLink::on_writable, this, sph::_1));
+        } else if (errno != EINTR) {
+            std::cerr << "Transmit ring flush failed: " << std::strerror(errno) << "\n";
+            transmit_pending_ = 0;
+        }
+    }
+}
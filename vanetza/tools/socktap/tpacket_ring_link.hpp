@@ -0,0 +1,72 @@
+#ifndef TPACKET_RING_LINK_HPP_R5LJ0CUE
+#define TPACKET_RING_LINK_HPP_R5LJ0CUE
+
+#include "link_layer.hpp"
+#include <vanetza/common/byte_buffer_pool.hpp>
+#include <boost/asio/generic/raw_protocol.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * TpacketRingLink exchanges frames through memory-mapped AF_PACKET rings (TPACKET_V3)
+ *
+ * A kernel socket filter restricts received frames to incoming GeoNetworking frames.
+ * Ethernet headers are parsed in place, frames are copied once into pooled buffers
+ * so ring blocks can be handed back to the kernel immediately.
+ * Transmissions requested while handling one io_service event are flushed together.
+ * A flush blocked by the device is resumed asynchronously, never blocking the io_service thread.
+ */
+class TpacketRingLink : public LinkLayer
+{
+public:
+    /**
+     * \param io_service io_service the socket belongs to
+     * \param socket raw AF_PACKET socket bound to network device
+     */
+    TpacketRingLink(boost::asio::io_service&, boost::asio::generic::raw_protocol::socket&&);
+    ~TpacketRingLink();
+
+    TpacketRingLink(const TpacketRingLink&) = delete;
+    TpacketRingLink& operator=(const TpacketRingLink&) = delete;
+
+    void request(const vanetza::access::DataRequest&, std::unique_ptr<vanetza::ChunkPacket>) override;
+    void indicate(IndicationCallback) override;
+    void indicate_burst(BurstIndicationCallback) override;
+
+private:
+    static constexpr std::size_t block_size_ = 1 << 16;
+    static constexpr std::size_t rx_blocks_ = 32;
+    static constexpr std::size_t tx_blocks_ = 8;
+    static constexpr std::size_t frame_size_ = 2048;
+
+    void attach_filter();
+    void setup_rings();
+    void do_receive();
+    void on_readable(const boost::system::error_code&);
+    void receive_blocks();
+    void receive_frame(const std::uint8_t* frame, std::size_t length, double time_received);
+    void on_flush();
+    void on_writable(const boost::system::error_code&);
+    void flush();
+
+    boost::asio::io_service& io_service_;
+    boost::asio::generic::raw_protocol::socket socket_;
+    boost::asio::steady_timer backoff_timer_;
+    IndicationCallback callback_;
+    BurstIndicationCallback burst_callback_;
+    std::shared_ptr<vanetza::ByteBufferPool> receive_pool_;
+    std::vector<LinkLayerFrame> burst_;
+    vanetza::ByteBuffer transmit_buffer_;
+    std::uint8_t* ring_ = nullptr;
+    std::size_t ring_size_ = 0;
+    std::size_t rx_block_ = 0;
+    std::size_t tx_frame_ = 0;
+    std::size_t transmit_pending_ = 0;
+    bool flush_pending_ = false;
+    bool write_waiting_ = false;
+};
+
+#endif /* TPACKET_RING_LINK_HPP_R5LJ0CUE */
@@ -20,8 +20,6 @@ using namespace boost::asio;
 
 prometheus::Counter *vam_rx_counter;
 prometheus::Counter *vam_tx_counter;
-prometheus::Counter *vam_rx_latency;
-prometheus::Counter *vam_tx_latency;
 
 boost::asio::io_service vam_io_service_;
 ip::udp::socket vam_udp_socket(vam_io_service_);
@@ -39,8 +37,7 @@ VamApplication::VamApplication(PositionProvider& positioning, Runtime& rt, Mqtt*
 
     vam_rx_counter = &((*metrics_s.packet_counter).Add({{"message", "vam"}, {"direction", "rx"}}));
     vam_tx_counter = &((*metrics_s.packet_counter).Add({{"message", "vam"}, {"direction", "tx"}}));
-    vam_rx_latency = &((*metrics_s.latency_counter).Add({{"message", "vam"}, {"direction", "rx"}}));
-    vam_tx_latency = &((*metrics_s.latency_counter).Add({{"message", "vam"}, {"direction", "tx"}}));
+    init_metrics(metrics_s, "vam");
 
     if(config_s.vam.udp_out_port != 0) {
         vam_udp_socket.open(ip::udp::v4());
@@ -62,22 +59,18 @@ VamApplication::PortType VamApplication::port()
 
 void VamApplication::indicate(const DataIndication& indication, UpPacketPtr packet)
 {
-    struct indication_visitor : public boost::static_visitor<CohesivePacket>
-    {
-        CohesivePacket operator()(CohesivePacket& packet) {return packet;}
-        CohesivePacket operator()(ChunkPacket& packet) {return CohesivePacket(std::move(ByteBuffer()), OsiLayer::Physical);}
-    } ivis;
-
-    UpPacket* packet_ptr = packet.get();
-    CohesivePacket cp = boost::apply_visitor(ivis, *packet_ptr);
-
-    asn1::PacketVisitor<asn1::Vam> visitor;
-    std::shared_ptr<const asn1::Vam> vam = boost::apply_visitor(visitor, *packet);
+    PipelineStopwatch stopwatch = rx_stopwatch();
+    std::shared_ptr<const asn1::Vam> vam = decode<asn1::Vam>(*packet);
+    if (!vam) {
+        return;
+    }
+    stopwatch.lap(PipelineStage::UperDecode);
 
     //std::cout << "VAM application received a packet with " << (vam ? "decodable" : "broken") << " content" << std::endl;
 
     VAM_t vam_t = {(*vam)->header, (*vam)->vam};
-    string vam_json = buildJSON(vam_t, cp.time_received, cp.rssi);
+    const string& vam_json = buildJSON(vam_t, indication.time_received, indication.rssi);
+    stopwatch.lap(PipelineStage::JsonBuild);
 
     if(config_s.vam.mqtt_enabled) mqtt->publish(config_s.vam.topic_out, vam_json);
     if(config_s.vam.dds_enabled) dds->publish(config_s.vam.topic_out, vam_json);
@@ -85,28 +78,16 @@ void VamApplication::indicate(const DataIndication& indication, UpPacketPtr pack
     vam_rx_counter->Increment();
 
     if(config_s.full_vam_topic_out != "") {
-        const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-        json fields_json = vam_t;
-        json full_json = {
-            {"timestamp", cp.time_received},
-            {"newInfo", true},
-            {"rssi", cp.rssi},
-            {"test", {
-                    {"json_timestamp", time_now}
-                },
-            },
-            {"fields", fields_json},
-            {"stationID", (long) vam_t.header.stationID},
-            {"receiverID", config_s.station_id},
-            {"receiverType", config_s.station_type}
-        };
-        string json_dump = full_json.dump();
-        if(config_s.vam.mqtt_enabled) mqtt->publish(config_s.full_vam_topic_out, json_dump);
-        if(config_s.vam.dds_enabled) dds->publish(config_s.full_vam_topic_out, json_dump);
+        // full VAM shares its layout with the simplified one, i.e. the latter's text can be reused
+        if(config_s.vam.mqtt_enabled) mqtt->publish(config_s.full_vam_topic_out, vam_json);
+        if(config_s.vam.dds_enabled) dds->publish(config_s.full_vam_topic_out, vam_json);
         if(config_s.vam.udp_out_port != 0) {
-            vam_udp_socket.send_to(buffer(json_dump, json_dump.length()), vam_remote_endpoint, 0, vam_err);
+            vam_udp_socket.send_to(buffer(vam_json, vam_json.length()), vam_remote_endpoint, 0, vam_err);
         }
     }
+
+    stopwatch.lap(PipelineStage::Publish);
+    stopwatch.finish();
 }
 
 void VamApplication::schedule_timer()
@@ -114,68 +95,63 @@ void VamApplication::schedule_timer()
     runtime_.schedule(vam_interval_, std::bind(&VamApplication::on_timer, this, std::placeholders::_1), this);
 }
 
-std::string VamApplication::buildJSON(VAM_t message, double time_reception, int rssi) {
-    ItsPduHeader_t& header = message.header;
-    VruAwareness_t& vam = message.vam;
-    nlohmann::json j = message;
+const std::string& VamApplication::buildJSON(const VAM_t& message, double time_reception, int rssi) {
+    const ItsPduHeader_t& header = message.header;
+
+    // keys are written in lexicographical order as done by nlohmann::json
+    json_buffer_.clear();
+    JsonWriter w(json_buffer_);
+    w.begin_object();
+    w.key("fields");
+    write_json(w, message);
 
     const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
 
-    nlohmann::json json_payload = {
-            {"timestamp", time_reception},
-            {"newInfo", true},
-            {"rssi", rssi},
-            {"test", {
-                    {"json_timestamp", time_now}
-                },
-            },
-            {"fields", j},
-            {"stationID", (long) header.stationID},
-            {"receiverID", config_s.station_id},
-            {"receiverType", config_s.station_type}
-    };
-
-    vam_rx_latency->Increment(time_now - time_reception);
-    return json_payload.dump();
+    w.key("newInfo");
+    w.value(true);
+    w.key("receiverID");
+    w.value(config_s.station_id);
+    w.key("receiverType");
+    w.value(config_s.station_type);
+    w.key("rssi");
+    w.value(rssi);
+    w.key("stationID");
+    w.value((long) header.stationID);
+    w.key("test");
+    w.begin_object();
+    w.key("json_timestamp");
+    w.value(time_now);
+    w.end_object();
+    w.key("timestamp");
+    w.value(time_reception);
+    w.end_object();
+
+    return json_buffer_;
 }
 
 void VamApplication::on_message(string topic, string mqtt_message) {
 
-    const double time_reception = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
-    VruAwareness_t vam;
-
-    json payload;
+    PipelineStopwatch stopwatch = tx_stopwatch();
 
-    try {
-        payload = json::parse(mqtt_message);
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON spec\n" << e.what() << std::endl;
-        return;
-    } catch(...) {
-        std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
-        return;
-    }
+    vanetza::asn1::Vam message;
 
     try {
-        vam = payload.get<VruAwareness_t>();
-    } catch(nlohmann::detail::type_error& e) {
-        std::cout << "-- Vanetza ETSI Decoding Error --\nCheck that the message format follows ETSI spec\n" << e.what() << std::endl;
+        JsonReader reader(mqtt_message);
+        read_json(reader, message->vam);
+        reader.finish();
+    } catch(JsonReadError& e) {
+        std::cout << "-- Vanetza JSON Decoding Error --\nCheck that the message format follows JSON and ETSI spec\n" << e.what() << std::endl;
         return;
     } catch(...) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't decode the JSON message.\nNo other info available\n" << std::endl;
         return;
     }
 
-    vanetza::asn1::Vam message;
-
     ItsPduHeader_t& header = message->header;
     header.protocolVersion = 1;
     header.messageID = ItsPduHeader__messageID_vam;
     header.stationID = config_s.station_id;
 
-    message->vam = vam;
-
     DownPacketPtr packet { new DownPacket() };
     packet->layer(OsiLayer::Application) = std::move(message);
 
@@ -185,8 +161,7 @@ void VamApplication::on_message(string topic, string mqtt_message) {
     request.communication_profile = geonet::CommunicationProfile::ITS_G5;
 
     try {
-        auto confirm = Application::request(request, std::move(packet));
-        if (!confirm.accepted()) {
+        if (!Application::enqueue(request, std::move(packet), stopwatch)) {
             throw std::runtime_error("VAM application data request failed");
         }
     } catch(std::runtime_error& e) {
@@ -195,10 +170,7 @@ void VamApplication::on_message(string topic, string mqtt_message) {
         std::cout << "-- Unexpected Error --\nVanetza couldn't send the requested message but did not throw a runtime error on UPER encode.\nNo other info available\n" << std::endl;
     }
 
-    const double time_now = (double) duration_cast< microseconds >(system_clock::now().time_since_epoch()).count() / 1000000.0;
-
     vam_tx_counter->Increment();
-    vam_tx_latency->Increment(time_now - time_reception);
 }
 
 void VamApplication::on_timer(Clock::time_point)
@@ -0,0 +1,128 @@
+#include <vanetza/asn1/arena.hpp>
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace vanetza
+{
+namespace asn1
+{
+namespace
+{
+
+// each allocation is preceded by a header storing its size, required for reallocation
+constexpr std::size_t alignment = alignof(std::max_align_t);
+constexpr std::size_t header_size = (sizeof(std::size_t) + alignment - 1) / alignment * alignment;
+
+std::size_t aligned(std::size_t size)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+std::size_t& allocation_size(void* ptr)
+{
+    return *reinterpret_cast<std::size_t*>(static_cast<unsigned char*>(ptr) - header_size);
+}
+
+void* arena_allocate(void* context, std::size_t size)
+{
+    return static_cast<Arena*>(context)->allocate(size);
+}
+
+void* arena_reallocate(void* context, void* ptr, std::size_t size)
+{
+    return static_cast<Arena*>(context)->reallocate(ptr, size);
+}
+
+void arena_deallocate(void*, void*)
+{
+    // memory is released along with the whole arena
+}
+
+} // namespace
+
+Arena::Scope::Scope(Arena& arena) :
+    m_allocator { &arena_allocate, &arena_reallocate, &arena_deallocate, &arena },
+    m_previous(asn_allocator_swap(&m_allocator))
+{
+}
+
+Arena::Scope::~Scope()
+{
+    asn_allocator_swap(m_previous);
+}
+
+Arena::Arena(std::size_t block_size) :
+    m_block_size(std::max(aligned(block_size), header_size + alignment)),
+    m_cursor(nullptr), m_end(nullptr), m_last(nullptr), m_allocations(0)
+{
+}
+
+void* Arena::allocate(std::size_t size)
+{
+    const std::size_t required = header_size + aligned(size);
+    if (static_cast<std::size_t>(m_end - m_cursor) < required) {
+        grow(required);
+    }
+
+    unsigned char* ptr = m_cursor + header_size;
+    m_cursor += required;
+    m_last = ptr;
+    ++m_allocations;
+
+    allocation_size(ptr) = size;
+    std::memset(ptr, 0, size);
+    return ptr;
+}
+
+void* Arena::reallocate(void* ptr, std::size_t size)
+{
+    if (!ptr) {
+        return allocate(size);
+    }
+
+    std::size_t& previous = allocation_size(ptr);
+    if (size <= previous) {
+        previous = size;
+        return ptr;
+    }
+
+    // most recent allocation can grow in place if its block has enough space left
+    unsigned char* bytes = static_cast<unsigned char*>(ptr);
+    const std::size_t grown = aligned(size) - aligned(previous);
+    if (bytes == m_last && static_cast<std::size_t>(m_end - m_cursor) >= grown) {
+        std::memset(bytes + previous, 0, size - previous);
+        m_cursor += grown;
+        previous = size;
+        return ptr;
+    }
+
+    void* moved = allocate(size);
+    std::memcpy(moved, ptr, previous);
+    return moved;
+}
+
+void Arena::reset()
+{
+    if (!m_blocks.empty()) {
+        m_blocks.erase(m_blocks.begin() + 1, m_blocks.end());
+        m_cursor = m_blocks.front().memory.get();
+        m_end = m_cursor + m_blocks.front().size;
+    }
+    m_last = nullptr;
+    m_allocations = 0;
+}
+
+void Arena::grow(std::size_t size)
+{
+    // oversized allocations get a block of their own
+    Block block;
+    block.size = std::max(size, m_block_size);
+    block.memory.reset(new unsigned char[block.size]);
+    m_cursor = block.memory.get();
+    m_end = m_cursor + block.size;
+    m_blocks.push_back(std::move(block));
+}
+
+} // namespace asn1
+} // namespace vanetza
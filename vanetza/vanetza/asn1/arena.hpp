@@ -0,0 +1,100 @@
+#ifndef ARENA_HPP_P3XK8WQN
+#define ARENA_HPP_P3XK8WQN
+
+#include <vanetza/asn1/support/asn_allocator.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace vanetza
+{
+namespace asn1
+{
+
+/**
+ * Arena is a bump allocator for asn1c structures.
+ *
+ * While an Arena::Scope is active, the asn1c runtime of the calling thread takes all its memory
+ * from the arena's blocks. Freeing single objects is a no-op: all memory is released at once
+ * when the arena is destroyed or reset.
+ */
+class Arena
+{
+public:
+    /**
+     * Installs an arena as the asn1c allocator of the calling thread for the scope's lifetime
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Arena&);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        asn_allocator_t m_allocator;
+        const asn_allocator_t* m_previous;
+    };
+
+    /**
+     * Create arena
+     * \param block_size size of memory blocks requested from heap
+     */
+    explicit Arena(std::size_t block_size = 4096);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * Allocate zero-initialized memory
+     * \param size number of bytes
+     * \return pointer to memory, suitably aligned for any type
+     */
+    void* allocate(std::size_t size);
+
+    /**
+     * Resize previous allocation, its content is preserved
+     * \param ptr previously allocated memory or nullptr
+     * \param size new size in bytes
+     * \return pointer to resized memory
+     */
+    void* reallocate(void* ptr, std::size_t size);
+
+    /**
+     * Release all allocations at once, first memory block is kept for reuse
+     */
+    void reset();
+
+    /**
+     * Get number of allocations served since construction or last reset
+     */
+    std::size_t allocations() const { return m_allocations; }
+
+    /**
+     * Get number of memory blocks requested from heap
+     */
+    std::size_t blocks() const { return m_blocks.size(); }
+
+private:
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> memory;
+        std::size_t size;
+    };
+
+    void grow(std::size_t size);
+
+    const std::size_t m_block_size;
+    std::vector<Block> m_blocks;
+    unsigned char* m_cursor;
+    unsigned char* m_end;
+    unsigned char* m_last;
+    std::size_t m_allocations;
+};
+
+} // namespace asn1
+} // namespace vanetza
+
+#endif /* ARENA_HPP_P3XK8WQN */
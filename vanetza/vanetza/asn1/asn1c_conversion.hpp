@@ -35,6 +35,11 @@ public:
         buffer = m_wrapper->encode();
     }
 
+    void append(ByteBuffer& buffer) const override
+    {
+        m_wrapper->encode(buffer);
+    }
+
     std::unique_ptr<byte_buffer> duplicate() const override
     {
         return std::unique_ptr<byte_buffer> {
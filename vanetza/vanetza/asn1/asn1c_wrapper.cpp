@@ -1,3 +1,4 @@
+#include <vanetza/asn1/support/asn_allocator.h>
 #include <vanetza/asn1/support/asn_application.h>
 #include <vanetza/asn1/support/constraints.h>
 #include <vanetza/asn1/support/uper_decoder.h>
@@ -22,7 +23,8 @@ static int write_buffer(const void* in, std::size_t size, void* out_void)
 {
     assert(out_void != nullptr);
     auto out = static_cast<ByteBuffer*>(out_void);
-    std::copy_n(static_cast<const uint8_t*>(in), size, std::back_inserter(*out));
+    auto bytes = static_cast<const uint8_t*>(in);
+    out->insert(out->end(), bytes, bytes + size);
     return 0;
 }
 
@@ -33,7 +35,7 @@ static int write_null(const void*, std::size_t, void*)
 
 void* allocate(std::size_t length)
 {
-    void* ptr = calloc(1, length);
+    void* ptr = asn_calloc(1, length);
     if (nullptr == ptr) {
         throw std::runtime_error("Bad ASN.1 memory allocation");
     }
@@ -103,6 +105,12 @@ std::size_t size_per(asn_TYPE_descriptor_t& td, const void* t)
 ByteBuffer encode_per(asn_TYPE_descriptor_t& td, const void* t)
 {
     ByteBuffer buffer;
+    encode_per(td, t, buffer);
+    return buffer;
+}
+
+void encode_per(asn_TYPE_descriptor_t& td, const void* t, ByteBuffer& buffer)
+{
     asn_enc_rval_t ec = uper_encode(&td, nullptr, const_cast<void*>(t), write_buffer, &buffer);
     if (ec.encoded == -1) {
         const char* failed_type = ec.failed_type ? ec.failed_type->name : "unknown";
@@ -111,7 +119,6 @@ ByteBuffer encode_per(asn_TYPE_descriptor_t& td, const void* t)
                 % td.name % failed_type;
         throw std::runtime_error(error_msg.str());
     }
-    return buffer;
 }
 
 bool decode_per(asn_TYPE_descriptor_t& td, void** t, const ByteBuffer& buffer)
@@ -126,6 +133,12 @@ bool decode_per(asn_TYPE_descriptor_t& td, void** t, const void* buffer, std::si
     return ec.code == RC_OK;
 }
 
+bool decode_per(asn_TYPE_descriptor_t& td, void** t, const void* buffer, std::size_t size, Arena& arena)
+{
+    Arena::Scope scope(arena);
+    return decode_per(td, t, buffer, size);
+}
+
 std::size_t size_oer(asn_TYPE_descriptor_t& td, const void* t)
 {
     asn_enc_rval_t ec;
@@ -145,6 +158,12 @@ std::size_t size_oer(asn_TYPE_descriptor_t& td, const void* t)
 ByteBuffer encode_oer(asn_TYPE_descriptor_t& td, const void* t)
 {
     ByteBuffer buffer;
+    encode_oer(td, t, buffer);
+    return buffer;
+}
+
+void encode_oer(asn_TYPE_descriptor_t& td, const void* t, ByteBuffer& buffer)
+{
     asn_enc_rval_t ec = oer_encode(&td, const_cast<void*>(t), write_buffer, &buffer);
     if (ec.encoded == -1) {
         const char* failed_type = ec.failed_type ? ec.failed_type->name : "unknown";
@@ -153,7 +172,6 @@ ByteBuffer encode_oer(asn_TYPE_descriptor_t& td, const void* t)
                 % td.name % failed_type;
         throw std::runtime_error(error_msg.str());
     }
-    return buffer;
 }
 
 bool decode_oer(asn_TYPE_descriptor_t& td, void** t, const ByteBuffer& buffer)
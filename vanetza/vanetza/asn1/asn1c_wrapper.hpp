@@ -3,8 +3,11 @@
 
 #include <vanetza/asn1/support/asn_system.h>
 #include <vanetza/asn1/support/constr_TYPE.h>
+#include <vanetza/asn1/arena.hpp>
 #include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/common/byte_buffer_pool.hpp>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -21,9 +24,12 @@ bool validate(asn_TYPE_descriptor_t&, const void*, std::string&);
 std::size_t size_per(asn_TYPE_descriptor_t&, const void*);
 std::size_t size_oer(asn_TYPE_descriptor_t&, const void*);
 ByteBuffer encode_per(asn_TYPE_descriptor_t&, const void*);
+void encode_per(asn_TYPE_descriptor_t&, const void*, ByteBuffer&);
 bool decode_per(asn_TYPE_descriptor_t&, void**, const ByteBuffer&);
 bool decode_per(asn_TYPE_descriptor_t&, void**, const void* buffer, std::size_t size);
+bool decode_per(asn_TYPE_descriptor_t&, void**, const void* buffer, std::size_t size, Arena&);
 ByteBuffer encode_oer(asn_TYPE_descriptor_t&, const void*);
+void encode_oer(asn_TYPE_descriptor_t&, const void*, ByteBuffer&);
 bool decode_oer(asn_TYPE_descriptor_t&, void**, const ByteBuffer&);
 bool decode_oer(asn_TYPE_descriptor_t&, void**, const void* buffer, std::size_t size);
 
@@ -42,7 +48,7 @@ public:
 
     asn1c_wrapper_common(asn_TYPE_descriptor_t& desc) :
         m_struct(vanetza::asn1::allocate<asn1c_type>()), m_type(desc) {}
-    ~asn1c_wrapper_common() { vanetza::asn1::free(m_type, m_struct); }
+    ~asn1c_wrapper_common() { release(); }
 
     // copy semantics
     asn1c_wrapper_common(const asn1c_wrapper_common& other) :
@@ -97,11 +103,56 @@ public:
     {
         std::swap(m_struct, other.m_struct);
         std::swap(m_type, other.m_type);
+        std::swap(m_arena, other.m_arena);
+    }
+
+    /**
+     * Get arena holding ASN.1 struct
+     * \return arena or nullptr if struct is allocated on heap
+     */
+    const std::shared_ptr<Arena>& arena() const
+    {
+        return m_arena;
     }
 
 protected:
+    /**
+     * Replace ASN.1 struct by an empty one located in arena
+     * \param arena memory of struct and its members (shared with other wrappers)
+     */
+    void reset(std::shared_ptr<Arena> arena)
+    {
+        release();
+        m_arena = std::move(arena);
+        m_struct = static_cast<asn1c_type*>(m_arena->allocate(sizeof(asn1c_type)));
+    }
+
+    /**
+     * Replace ASN.1 struct by an empty one located on heap if it is located in an arena
+     *
+     * Heap decoding must not (re-)allocate members of an arena-backed struct.
+     */
+    void reset_heap()
+    {
+        if (m_arena) {
+            release();
+            m_struct = vanetza::asn1::allocate<asn1c_type>();
+        }
+    }
+
+    void release()
+    {
+        // arena memory is released by arena itself
+        if (!m_arena) {
+            vanetza::asn1::free(m_type, m_struct);
+        }
+        m_struct = nullptr;
+        m_arena.reset();
+    }
+
     asn1c_type* m_struct;
     asn_TYPE_descriptor_t& m_type;
+    std::shared_ptr<Arena> m_arena;
 };
 
 template<typename T>
@@ -127,6 +178,28 @@ public:
         return vanetza::asn1::encode_per(base::m_type, base::m_struct);
     }
 
+    /**
+     * Encode ASN.1 struct into a recycled byte buffer
+     * \param pool buffer is acquired from this pool, callers can release it there after use
+     * \return byte buffer containing serialized ASN.1 struct
+     */
+    ByteBuffer encode(ByteBufferPool& pool) const
+    {
+        ByteBuffer buffer = pool.acquire();
+        buffer.clear();
+        vanetza::asn1::encode_per(base::m_type, base::m_struct, buffer);
+        return buffer;
+    }
+
+    /**
+     * Encode ASN.1 struct and append it to byte buffer
+     * \param buffer serialized ASN.1 struct is appended to its present content
+     */
+    void encode(ByteBuffer& buffer) const
+    {
+        vanetza::asn1::encode_per(base::m_type, base::m_struct, buffer);
+    }
+
     /**
      * Try to decode ASN.1 struct from byte buffer
      * \param buffer input data
@@ -134,19 +207,43 @@ public:
      */
     bool decode(const ByteBuffer& buffer)
     {
+        base::reset_heap();
         return vanetza::asn1::decode_per(base::m_type, (void**)&(base::m_struct), buffer);
     }
 
     bool decode(ByteBuffer::const_iterator begin, ByteBuffer::const_iterator end)
     {
+        base::reset_heap();
         return vanetza::asn1::decode_per(base::m_type, (void**)&(base::m_struct), &(*begin), std::distance(begin, end));
     }
 
     bool decode(const void* buffer, std::size_t len)
     {
+        base::reset_heap();
         return vanetza::asn1::decode_per(base::m_type, (void**)&(base::m_struct), buffer, len);
     }
 
+    /**
+     * Try to decode ASN.1 struct from byte buffer into an arena
+     *
+     * All memory of the decoded struct is taken from the arena, i.e. decoding does not allocate
+     * for every node and the struct is released at once along with the arena.
+     * \note Decoded struct shall be read only: members must not be reallocated or freed individually
+     * \param buffer input data
+     * \param arena arena holding decoded struct, kept alive by this wrapper
+     * \return true if decoding has been successful
+     */
+    bool decode(const ByteBuffer& buffer, std::shared_ptr<Arena> arena)
+    {
+        return decode(buffer.data(), buffer.size(), std::move(arena));
+    }
+
+    bool decode(const void* buffer, std::size_t len, std::shared_ptr<Arena> arena)
+    {
+        base::reset(std::move(arena));
+        return vanetza::asn1::decode_per(base::m_type, (void**)&(base::m_struct), buffer, len, *base::m_arena);
+    }
+
     /**
      * Get size of encoded ASN.1 struct
      * \return size in bytes
@@ -177,6 +274,15 @@ public:
         return vanetza::asn1::encode_oer(base::m_type, base::m_struct);
     }
 
+    /**
+     * Encode ASN.1 struct and append it to byte buffer
+     * \param buffer serialized ASN.1 struct is appended to its present content
+     */
+    void encode(ByteBuffer& buffer) const
+    {
+        vanetza::asn1::encode_oer(base::m_type, base::m_struct, buffer);
+    }
+
     /**
      * Try to decode ASN.1 struct from byte buffer
      * \param buffer input data
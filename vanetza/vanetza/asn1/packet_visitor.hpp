@@ -2,12 +2,14 @@
 #define PACKET_VISITOR_HPP_UYSI8HXZ
 
 #include <vanetza/asn1/asn1c_conversion.hpp>
+#include <vanetza/asn1/pdu_peek.hpp>
 #include <vanetza/common/byte_buffer.hpp>
 #include <vanetza/net/chunk_packet.hpp>
 #include <vanetza/net/cohesive_packet.hpp>
 #include <vanetza/net/osi_layer.hpp>
 #include <vanetza/net/packet_variant.hpp>
 #include <boost/variant/static_visitor.hpp>
+#include <functional>
 #include <memory>
 
 namespace vanetza
@@ -22,6 +24,7 @@ namespace asn1
  * ChunkPacket's application layer is simply casted for the sake of speed whenever possible.
  * When casting fails, this helper can fall back to deserialization, see allow_chunk_deserialization.
  * Deserialization is the only option for CohesivePacket's application layer.
+ * An optional header filter can reject messages by their ITS PDU header before they are decoded.
  *
  * \param T is the asn1c_wrapper<> type, e.g. Cam or Denm
  */
@@ -29,10 +32,13 @@ template<typename T>
 class PacketVisitor : public boost::static_visitor<std::shared_ptr<const T>>
 {
     public:
+        using HeaderFilter = std::function<bool(const PduHeader&)>;
+
         std::shared_ptr<const T> operator()(const ChunkPacket& packet)
         {
             using byte_buffer_impl = convertible::byte_buffer_impl<T>;
             auto impl = dynamic_cast<const byte_buffer_impl*>(packet[OsiLayer::Application].ptr());
+            m_filtered = false;
             if (impl) {
                 m_wrapper = impl->wrapper();
             } else if (m_deserialize_chunk) {
@@ -45,12 +51,30 @@ class PacketVisitor : public boost::static_visitor<std::shared_ptr<const T>>
 
         std::shared_ptr<const T> operator()(const CohesivePacket& packet)
         {
+            m_filtered = false;
             deserialize(create_byte_view(packet, m_start_layer, OsiLayer::Application));
             return m_wrapper;
         }
 
         std::shared_ptr<const T> get_shared_wrapper() const { return m_wrapper; }
 
+        /**
+         * Check if the last visited packet has been rejected by the header filter.
+         * \return true if packet has been dropped without decoding
+         */
+        bool filtered() const { return m_filtered; }
+
+        /**
+         * Set filter checking the ITS PDU header peeked from serialized messages.
+         * Messages are only decoded if the filter accepts their header.
+         * Messages cast from a ChunkPacket's application layer are not subject to filtering.
+         * \param filter returns true for acceptable headers, empty filter accepts all
+         */
+        void set_header_filter(HeaderFilter filter)
+        {
+            m_filter = std::move(filter);
+        }
+
         /**
          * Allow deserialization attempt of ChunkPacket when casting failed.
          * \param flag true allows deserialization
@@ -73,12 +97,23 @@ class PacketVisitor : public boost::static_visitor<std::shared_ptr<const T>>
     private:
         void deserialize(const byte_view_range& range)
         {
+            if (m_filter) {
+                auto header = peek_header(range.data(), range.size());
+                if (header && !m_filter(*header)) {
+                    m_filtered = true;
+                    m_wrapper.reset();
+                    return;
+                }
+            }
+
             auto tmp = std::make_shared<T>();
             bool decoded = tmp->decode(range.begin(), range.end());
             m_wrapper = decoded ? tmp : nullptr;
         }
 
         std::shared_ptr<const T> m_wrapper;
+        HeaderFilter m_filter;
+        bool m_filtered = false;
         bool m_deserialize_chunk = true;
         OsiLayer m_start_layer = OsiLayer::Session;
 };
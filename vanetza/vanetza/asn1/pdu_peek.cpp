@@ -0,0 +1,86 @@
+#include <vanetza/asn1/pdu_peek.hpp>
+#include <vanetza/asn1/its/ItsPduHeader.h>
+
+namespace vanetza
+{
+namespace asn1
+{
+namespace
+{
+
+constexpr std::size_t header_bits = 48;
+constexpr std::size_t generation_delta_time_bits = 16;
+// CamParameters: extension bit, two optional containers; BasicContainer: extension bit
+constexpr std::size_t cam_station_type_offset = header_bits + generation_delta_time_bits + 3 + 1;
+
+/**
+ * Read bits from an unaligned position of a big endian bit stream
+ * \param data bit stream
+ * \param offset position of first bit
+ * \param bits number of bits (at most 32)
+ * \return read bits as unsigned integer
+ */
+std::uint32_t read_bits(const std::uint8_t* data, std::size_t offset, unsigned bits)
+{
+    std::uint64_t value = 0;
+    const std::size_t first = offset / 8;
+    const std::size_t last = (offset + bits - 1) / 8;
+    for (std::size_t i = first; i <= last; ++i) {
+        value = (value << 8) | data[i];
+    }
+    const unsigned trailing = 8 * (last + 1) - (offset + bits);
+    value >>= trailing;
+    return static_cast<std::uint32_t>(value & ((UINT64_C(1) << bits) - 1));
+}
+
+bool has_bits(std::size_t size, std::size_t bits)
+{
+    return 8 * size >= bits;
+}
+
+bool is_message(const std::uint8_t* data, long id)
+{
+    return data[1] == id;
+}
+
+} // namespace
+
+boost::optional<PduHeader> peek_header(const std::uint8_t* data, std::size_t size)
+{
+    boost::optional<PduHeader> header;
+    if (data && has_bits(size, header_bits)) {
+        header = PduHeader {};
+        header->protocol_version = data[0];
+        header->message_id = data[1];
+        header->station_id = read_bits(data, 16, 32);
+    }
+    return header;
+}
+
+boost::optional<PduHeader> peek_header(const ByteBuffer& buffer)
+{
+    return peek_header(buffer.data(), buffer.size());
+}
+
+boost::optional<std::uint16_t> peek_generation_delta_time(const std::uint8_t* data, std::size_t size)
+{
+    boost::optional<std::uint16_t> gdt;
+    if (data && has_bits(size, header_bits + generation_delta_time_bits)) {
+        if (is_message(data, ItsPduHeader__messageID_cam) || is_message(data, ItsPduHeader__messageID_cpm)) {
+            gdt = read_bits(data, header_bits, generation_delta_time_bits);
+        }
+    }
+    return gdt;
+}
+
+boost::optional<std::uint8_t> peek_cam_station_type(const std::uint8_t* data, std::size_t size)
+{
+    boost::optional<std::uint8_t> station_type;
+    if (data && has_bits(size, cam_station_type_offset + 8) && is_message(data, ItsPduHeader__messageID_cam)) {
+        station_type = read_bits(data, cam_station_type_offset, 8);
+    }
+    return station_type;
+}
+
+} // namespace asn1
+} // namespace vanetza
@@ -0,0 +1,57 @@
+#ifndef PDU_PEEK_HPP_T5LM3RWC
+#define PDU_PEEK_HPP_T5LM3RWC
+
+#include <vanetza/common/byte_buffer.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace vanetza
+{
+namespace asn1
+{
+
+/**
+ * Fields of an ITS PDU header (ETSI TS 102 894-2) preceding every CAM, DENM, CPM etc.
+ */
+struct PduHeader
+{
+    std::uint8_t protocol_version;
+    std::uint8_t message_id;
+    std::uint32_t station_id;
+};
+
+/**
+ * Extract ITS PDU header from an UPER encoded message without decoding the whole message.
+ * The header occupies the first 48 bits of any ITS message, no memory is allocated.
+ *
+ * \param data UPER encoded message
+ * \param size size of data in bytes
+ * \return header or nothing if data is too short
+ */
+boost::optional<PduHeader> peek_header(const std::uint8_t* data, std::size_t size);
+boost::optional<PduHeader> peek_header(const ByteBuffer&);
+
+/**
+ * Extract generationDeltaTime of an UPER encoded CAM or CPM.
+ * This field directly follows the ITS PDU header in both messages.
+ *
+ * \param data UPER encoded message
+ * \param size size of data in bytes
+ * \return generation delta time or nothing if data is too short or not a CAM or CPM
+ */
+boost::optional<std::uint16_t> peek_generation_delta_time(const std::uint8_t* data, std::size_t size);
+
+/**
+ * Extract station type of an UPER encoded CAM, i.e. the first field of its basic container.
+ *
+ * \param data UPER encoded message
+ * \param size size of data in bytes
+ * \return station type or nothing if data is too short or not a CAM
+ */
+boost::optional<std::uint8_t> peek_cam_station_type(const std::uint8_t* data, std::size_t size);
+
+} // namespace asn1
+} // namespace vanetza
+
+#endif /* PDU_PEEK_HPP_T5LM3RWC */
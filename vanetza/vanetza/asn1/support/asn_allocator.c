@@ -0,0 +1,52 @@
+/*
+ * Pluggable memory allocation for the ASN.1 support code.
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#include "asn_allocator.h"
+#include <stdlib.h>
+
+static _Thread_local const asn_allocator_t *asn_current_allocator;
+
+const asn_allocator_t *
+asn_allocator_swap(const asn_allocator_t *allocator) {
+	const asn_allocator_t *previous = asn_current_allocator;
+	asn_current_allocator = allocator;
+	return previous;
+}
+
+void *
+asn_calloc(size_t nmemb, size_t size) {
+	const asn_allocator_t *allocator = asn_current_allocator;
+	if(allocator) {
+		if(size && nmemb > (size_t)-1 / size)
+			return NULL;
+		return allocator->allocate(allocator->context, nmemb * size);
+	}
+	return calloc(nmemb, size);
+}
+
+void *
+asn_malloc(size_t size) {
+	const asn_allocator_t *allocator = asn_current_allocator;
+	if(allocator)
+		return allocator->allocate(allocator->context, size);
+	return malloc(size);
+}
+
+void *
+asn_realloc(void *ptr, size_t size) {
+	const asn_allocator_t *allocator = asn_current_allocator;
+	if(allocator)
+		return allocator->reallocate(allocator->context, ptr, size);
+	return realloc(ptr, size);
+}
+
+void
+asn_free(void *ptr) {
+	const asn_allocator_t *allocator = asn_current_allocator;
+	if(allocator) {
+		allocator->deallocate(allocator->context, ptr);
+	} else {
+		free(ptr);
+	}
+}
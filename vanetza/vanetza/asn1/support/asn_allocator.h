@@ -0,0 +1,43 @@
+/*
+ * Pluggable memory allocation for the ASN.1 support code.
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef	ASN_ALLOCATOR_H
+#define	ASN_ALLOCATOR_H
+
+#include <stddef.h>	/* for size_t */
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/*
+ * Set of allocation functions replacing the C library's ones.
+ * "allocate" has to return zero-initialized memory like calloc(3).
+ */
+typedef struct asn_allocator_s {
+	void *(*allocate)(void *context, size_t size);
+	void *(*reallocate)(void *context, void *ptr, size_t size);
+	void (*deallocate)(void *context, void *ptr);
+	void *context;
+} asn_allocator_t;
+
+/*
+ * Install allocator for the calling thread, NULL restores the C library allocator.
+ * Returns the previously installed allocator.
+ */
+const asn_allocator_t *asn_allocator_swap(const asn_allocator_t *allocator);
+
+/*
+ * Allocation functions used by CALLOC, MALLOC, REALLOC and FREEMEM macros.
+ */
+void *asn_calloc(size_t nmemb, size_t size);
+void *asn_malloc(size_t size);
+void *asn_realloc(void *ptr, size_t size);
+void asn_free(void *ptr);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* ASN_ALLOCATOR_H */
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <vanetza/asn1/arena.hpp>
+#include <cstdint>
+#include <cstring>
+
+using vanetza::asn1::Arena;
+
+TEST(Arena, allocate) {
+    Arena arena(128);
+    EXPECT_EQ(0, arena.blocks());
+
+    auto a = static_cast<unsigned char*>(arena.allocate(10));
+    auto b = static_cast<unsigned char*>(arena.allocate(3));
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    EXPECT_EQ(2, arena.allocations());
+    EXPECT_EQ(1, arena.blocks());
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(a) % alignof(std::max_align_t));
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(b) % alignof(std::max_align_t));
+    for (unsigned i = 0; i < 10; ++i) {
+        EXPECT_EQ(0, a[i]);
+    }
+    EXPECT_LE(a + 10, b);
+
+    // oversized allocation
+    auto c = static_cast<unsigned char*>(arena.allocate(1000));
+    ASSERT_NE(nullptr, c);
+    EXPECT_EQ(2, arena.blocks());
+    std::memset(c, 0xff, 1000);
+}
+
+TEST(Arena, reallocate) {
+    Arena arena(256);
+    auto a = static_cast<char*>(arena.reallocate(nullptr, 4));
+    std::memcpy(a, "abcd", 4);
+
+    // last allocation grows in place
+    auto b = static_cast<char*>(arena.reallocate(a, 40));
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(0, std::memcmp(b, "abcd", 4));
+    EXPECT_EQ(0, b[39]);
+
+    arena.allocate(8);
+    auto c = static_cast<char*>(arena.reallocate(b, 80));
+    EXPECT_NE(b, c);
+    EXPECT_EQ(0, std::memcmp(c, "abcd", 4));
+    EXPECT_EQ(0, c[79]);
+
+    // shrinking keeps memory
+    EXPECT_EQ(c, arena.reallocate(c, 2));
+}
+
+TEST(Arena, reset) {
+    Arena arena(64);
+    for (unsigned i = 0; i < 10; ++i) {
+        arena.allocate(32);
+    }
+    EXPECT_EQ(10, arena.allocations());
+    EXPECT_LT(1, arena.blocks());
+
+    arena.reset();
+    EXPECT_EQ(0, arena.allocations());
+    EXPECT_EQ(1, arena.blocks());
+    EXPECT_NE(nullptr, arena.allocate(32));
+}
+
+TEST(Arena, scope) {
+    Arena arena;
+    {
+        Arena::Scope scope(arena);
+        void* ptr = asn_calloc(2, 8);
+        EXPECT_NE(nullptr, ptr);
+        EXPECT_EQ(1, arena.allocations());
+        asn_free(ptr);
+
+        {
+            Arena inner;
+            Arena::Scope inner_scope(inner);
+            asn_malloc(4);
+            EXPECT_EQ(1, inner.allocations());
+        }
+
+        asn_free(asn_realloc(nullptr, 16));
+        EXPECT_EQ(2, arena.allocations());
+    }
+
+    void* ptr = asn_malloc(4);
+    EXPECT_EQ(2, arena.allocations());
+    asn_free(ptr);
+}
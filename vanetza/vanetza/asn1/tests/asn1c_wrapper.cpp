@@ -94,3 +94,61 @@ TEST(asn1c_wrapper, decode_range) {
     EXPECT_EQ(4, wrapper->string.size);
     EXPECT_STREQ("1234", (const char*)(wrapper->string.buf));
 }
+
+TEST(asn1c_wrapper, decode_arena) {
+    auto arena = std::make_shared<Arena>();
+    const vanetza::ByteBuffer buffer { 0x04, 0x02, 0x11, 0xA2, 0x80 };
+    {
+        test_wrapper wrapper(asn_DEF_VanetzaTest);
+        ASSERT_TRUE(wrapper.decode(buffer, arena));
+        EXPECT_EQ(arena, wrapper.arena());
+        EXPECT_LT(1, arena->allocations());
+        EXPECT_EQ(8, wrapper->field);
+        ASSERT_EQ(4, wrapper->string.size);
+        EXPECT_STREQ("1234", (const char*)(wrapper->string.buf));
+        EXPECT_EQ(buffer, wrapper.encode());
+
+        // copies are allocated on heap
+        test_wrapper copy = wrapper;
+        EXPECT_FALSE(copy.arena());
+        EXPECT_EQ(8, copy->field);
+    }
+    EXPECT_EQ(1, arena.use_count());
+}
+
+TEST(asn1c_wrapper, decode_heap_after_arena) {
+    auto arena = std::make_shared<Arena>();
+    const vanetza::ByteBuffer buffer { 0x04, 0x02, 0x11, 0xA2, 0x80 };
+    test_wrapper wrapper(asn_DEF_VanetzaTest);
+    ASSERT_TRUE(wrapper.decode(buffer, arena));
+    EXPECT_EQ(arena, wrapper.arena());
+
+    ASSERT_TRUE(wrapper.decode(buffer));
+    EXPECT_FALSE(wrapper.arena());
+    EXPECT_EQ(1, arena.use_count());
+    EXPECT_EQ(8, wrapper->field);
+    ASSERT_EQ(4, wrapper->string.size);
+    EXPECT_STREQ("1234", (const char*)(wrapper->string.buf));
+
+    ASSERT_TRUE(wrapper.decode(buffer.data(), buffer.size(), arena));
+    ASSERT_TRUE(wrapper.decode(buffer.begin(), buffer.end()));
+    EXPECT_FALSE(wrapper.arena());
+    EXPECT_EQ(buffer, wrapper.encode());
+}
+
+TEST(asn1c_wrapper, decode_arena_invalid) {
+    test_wrapper wrapper(asn_DEF_VanetzaTest);
+    const vanetza::ByteBuffer buffer { 0x12 };
+    EXPECT_FALSE(wrapper.decode(buffer, std::make_shared<Arena>()));
+    EXPECT_TRUE(wrapper.arena());
+}
+
+TEST(asn1c_wrapper, encode_pool) {
+    vanetza::ByteBufferPool pool(64, 2);
+    test_wrapper wrapper(asn_DEF_VanetzaTest);
+    OCTET_STRING_fromString(&wrapper->string, "1234");
+    wrapper->field = 8;
+    vanetza::ByteBuffer buf = wrapper.encode(pool);
+    EXPECT_EQ(vanetza::ByteBuffer({ 0x04, 0x02, 0x11, 0xA2, 0x80 }), buf);
+    EXPECT_LE(64, buf.capacity());
+}
@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <vanetza/asn1/asn1c_wrapper.hpp>
+#include <vanetza/asn1/cam.hpp>
 #include <vanetza/asn1/packet_visitor.hpp>
 #include <vanetza/asn1/its/VanetzaTest.h>
 #include <vanetza/net/packet_variant.hpp>
 #include <boost/variant/apply_visitor.hpp>
+#include <vector>
 
 using namespace vanetza;
 
@@ -99,3 +101,35 @@ TEST(PacketVisitor, failed)
     EXPECT_FALSE(result);
     EXPECT_FALSE(visitor.get_shared_wrapper());
 }
+
+TEST(PacketVisitor, header_filter)
+{
+    asn1::Cam cam;
+    cam->header.protocolVersion = 2;
+    cam->header.messageID = ItsPduHeader__messageID_cam;
+    cam->header.stationID = 1337;
+    cam->cam.camParameters.highFrequencyContainer.present = HighFrequencyContainer_PR_rsuContainerHighFrequency;
+    PacketVariant packet { CohesivePacket { cam.encode(), OsiLayer::Application } };
+
+    std::vector<uint32_t> peeked;
+    asn1::PacketVisitor<asn1::Cam> visitor;
+    visitor.set_header_filter([&peeked](const asn1::PduHeader& header) {
+        peeked.push_back(header.station_id);
+        return header.station_id != 1337;
+    });
+    EXPECT_FALSE(boost::apply_visitor(visitor, packet));
+    EXPECT_TRUE(visitor.filtered());
+    ASSERT_EQ(1, peeked.size());
+    EXPECT_EQ(1337, peeked.front());
+
+    visitor.set_header_filter([](const asn1::PduHeader& header) { return header.station_id == 1337; });
+    auto result = boost::apply_visitor(visitor, packet);
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(visitor.filtered());
+    EXPECT_EQ(1337, (*result)->header.stationID);
+
+    // broken messages are not reported as filtered
+    PacketVariant broken { CohesivePacket { ByteBuffer { 0x02, 0x02, 0x00 }, OsiLayer::Application } };
+    EXPECT_FALSE(boost::apply_visitor(visitor, broken));
+    EXPECT_FALSE(visitor.filtered());
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <vanetza/asn1/cam.hpp>
+#include <vanetza/asn1/cpm.hpp>
+#include <vanetza/asn1/pdu_peek.hpp>
+
+using namespace vanetza;
+
+namespace
+{
+
+asn1::Cam create_cam(StationID_t station, long station_type)
+{
+    asn1::Cam message;
+    message->header.protocolVersion = 2;
+    message->header.messageID = ItsPduHeader__messageID_cam;
+    message->header.stationID = station;
+    message->cam.generationDeltaTime = 4711;
+
+    BasicContainer_t& basic = message->cam.camParameters.basicContainer;
+    basic.stationType = station_type;
+    basic.referencePosition.latitude = Latitude_unavailable;
+    basic.referencePosition.longitude = Longitude_unavailable;
+    basic.referencePosition.positionConfidenceEllipse.semiMajorConfidence = SemiAxisLength_unavailable;
+    basic.referencePosition.positionConfidenceEllipse.semiMinorConfidence = SemiAxisLength_unavailable;
+    basic.referencePosition.positionConfidenceEllipse.semiMajorOrientation = HeadingValue_unavailable;
+    basic.referencePosition.altitude.altitudeValue = AltitudeValue_unavailable;
+    basic.referencePosition.altitude.altitudeConfidence = AltitudeConfidence_unavailable;
+
+    message->cam.camParameters.highFrequencyContainer.present = HighFrequencyContainer_PR_basicVehicleContainerHighFrequency;
+    BasicVehicleContainerHighFrequency& bvc = message->cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
+    bvc.heading.headingValue = HeadingValue_unavailable;
+    bvc.heading.headingConfidence = HeadingConfidence_unavailable;
+    bvc.speed.speedValue = SpeedValue_unavailable;
+    bvc.speed.speedConfidence = SpeedConfidence_unavailable;
+    bvc.driveDirection = DriveDirection_unavailable;
+    bvc.vehicleLength.vehicleLengthValue = VehicleLengthValue_unavailable;
+    bvc.vehicleLength.vehicleLengthConfidenceIndication = VehicleLengthConfidenceIndication_unavailable;
+    bvc.vehicleWidth = VehicleWidth_unavailable;
+    bvc.longitudinalAcceleration.longitudinalAccelerationValue = LongitudinalAccelerationValue_unavailable;
+    bvc.longitudinalAcceleration.longitudinalAccelerationConfidence = AccelerationConfidence_unavailable;
+    bvc.curvature.curvatureValue = CurvatureValue_unavailable;
+    bvc.curvature.curvatureConfidence = CurvatureConfidence_unavailable;
+    bvc.curvatureCalculationMode = CurvatureCalculationMode_unavailable;
+    bvc.yawRate.yawRateValue = YawRateValue_unavailable;
+    bvc.yawRate.yawRateConfidence = YawRateConfidence_unavailable;
+    return message;
+}
+
+} // namespace
+
+TEST(PduPeek, header)
+{
+    const ByteBuffer buffer = create_cam(4000000123, StationType_roadSideUnit).encode();
+    auto header = asn1::peek_header(buffer);
+    ASSERT_TRUE(header);
+    EXPECT_EQ(2, header->protocol_version);
+    EXPECT_EQ(ItsPduHeader__messageID_cam, header->message_id);
+    EXPECT_EQ(4000000123, header->station_id);
+}
+
+TEST(PduPeek, header_too_short)
+{
+    const ByteBuffer buffer { 0x02, 0x02, 0x00, 0x00, 0x05 };
+    EXPECT_FALSE(asn1::peek_header(buffer));
+    EXPECT_FALSE(asn1::peek_header(nullptr, 0));
+
+    const ByteBuffer complete { 0x02, 0x02, 0x00, 0x00, 0x05, 0x39 };
+    auto header = asn1::peek_header(complete);
+    ASSERT_TRUE(header);
+    EXPECT_EQ(1337, header->station_id);
+}
+
+TEST(PduPeek, cam_fields)
+{
+    for (long type : { StationType_unknown, StationType_passengerCar, StationType_roadSideUnit }) {
+        asn1::Cam cam = create_cam(1337, type);
+        const ByteBuffer plain = cam.encode();
+        auto gdt = asn1::peek_generation_delta_time(plain.data(), plain.size());
+        ASSERT_TRUE(gdt);
+        EXPECT_EQ(4711, *gdt);
+        auto station_type = asn1::peek_cam_station_type(plain.data(), plain.size());
+        ASSERT_TRUE(station_type);
+        EXPECT_EQ(type, *station_type);
+
+        // presence bits of optional containers precede the basic container
+        cam->cam.camParameters.lowFrequencyContainer = asn1::allocate<LowFrequencyContainer_t>();
+        LowFrequencyContainer_t& lfc = *cam->cam.camParameters.lowFrequencyContainer;
+        lfc.present = LowFrequencyContainer_PR_basicVehicleContainerLowFrequency;
+        BIT_STRING_t& lights = lfc.choice.basicVehicleContainerLowFrequency.exteriorLights;
+        lights.buf = static_cast<uint8_t*>(asn1::allocate(1));
+        lights.size = 1;
+        const ByteBuffer low_frequency = cam.encode();
+        station_type = asn1::peek_cam_station_type(low_frequency.data(), low_frequency.size());
+        ASSERT_TRUE(station_type);
+        EXPECT_EQ(type, *station_type);
+    }
+}
+
+TEST(PduPeek, cpm_fields)
+{
+    // same payload as in Cpm.decode_plain test
+    static const ByteBuffer cpm_uper = {
+        0x01, 0xff, 0x00, 0x00, 0x05, 0x39, 0x00, 0x2a, 0x00, 0x03, 0x49, 0x04,
+        0x84, 0x01, 0xc7, 0x61, 0x26, 0x00, 0x7d, 0x03, 0xe8, 0xe1, 0x36, 0xee,
+        0x87, 0xc0, 0xc0
+    };
+    auto header = asn1::peek_header(cpm_uper);
+    ASSERT_TRUE(header);
+    EXPECT_EQ(1, header->protocol_version);
+    EXPECT_EQ(255, header->message_id);
+    EXPECT_EQ(1337, header->station_id);
+
+    // message ID is not the one of CPM
+    EXPECT_FALSE(asn1::peek_generation_delta_time(cpm_uper.data(), cpm_uper.size()));
+
+    asn1::Cpm cpm;
+    ASSERT_TRUE(cpm.decode(cpm_uper));
+    cpm->header.messageID = ItsPduHeader__messageID_cpm;
+    const ByteBuffer buffer = cpm.encode();
+    auto gdt = asn1::peek_generation_delta_time(buffer.data(), buffer.size());
+    ASSERT_TRUE(gdt);
+    EXPECT_EQ(42, *gdt);
+    EXPECT_FALSE(asn1::peek_cam_station_type(buffer.data(), buffer.size()));
+}
@@ -7,7 +7,8 @@ namespace vanetza
 namespace btp
 {
 
-DataIndication::DataIndication()
+DataIndication::DataIndication() :
+    rssi(-255), time_received(-1.0)
 {
 }
 
@@ -19,7 +20,9 @@ DataIndication::DataIndication(const geonet::DataIndication& ind, const HeaderA&
     permissions(ind.permissions),
     source_position(ind.source_position),
     traffic_class(ind.traffic_class),
-    remaining_packet_lifetime(ind.remaining_packet_lifetime)
+    remaining_packet_lifetime(ind.remaining_packet_lifetime),
+    rssi(ind.rssi),
+    time_received(ind.time_received)
 {
 }
 
@@ -31,7 +34,9 @@ DataIndication::DataIndication(const geonet::DataIndication& ind, const HeaderB&
     permissions(ind.permissions),
     source_position(ind.source_position),
     traffic_class(ind.traffic_class),
-    remaining_packet_lifetime(ind.remaining_packet_lifetime)
+    remaining_packet_lifetime(ind.remaining_packet_lifetime),
+    rssi(ind.rssi),
+    time_received(ind.time_received)
 {
 }
 
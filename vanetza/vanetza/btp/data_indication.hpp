@@ -31,6 +31,8 @@ struct DataIndication
     geonet::ShortPositionVector source_position;
     geonet::TrafficClass traffic_class;
     boost::optional<geonet::Lifetime> remaining_packet_lifetime;
+    decltype(geonet::DataIndication::rssi) rssi;
+    decltype(geonet::DataIndication::time_received) time_received;
 };
 
 } // namespace btp
@@ -19,6 +19,10 @@ struct byte_buffer_impl<btp::HeaderA> : public byte_buffer
         buffer.clear();
         serialize_into_buffer(m_header, buffer);
     }
+    void append(ByteBuffer& buffer) const override
+    {
+        serialize_into_buffer(m_header, buffer);
+    }
     std::size_t size() const override { return btp::HeaderA::length_bytes; }
 
     const btp::HeaderA m_header;
@@ -33,6 +37,10 @@ struct byte_buffer_impl<btp::HeaderB> : public byte_buffer
         buffer.clear();
         serialize_into_buffer(m_header, buffer);
     }
+    void append(ByteBuffer& buffer) const override
+    {
+        serialize_into_buffer(m_header, buffer);
+    }
     std::size_t size() const override { return btp::HeaderB::length_bytes; }
 
     const btp::HeaderB m_header;
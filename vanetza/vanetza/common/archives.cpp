@@ -4,21 +4,31 @@ namespace vanetza
 {
 
 InputArchive::InputArchive(InputStream& is) :
-    m_stream_buffer(is.rdbuf())
+    m_stream_buffer(is.rdbuf()), m_cursor(nullptr), m_end(nullptr)
 {
 }
 
 InputArchive::InputArchive(StreamBuffer& buf) :
-    m_stream_buffer(&buf)
+    m_stream_buffer(&buf), m_cursor(nullptr), m_end(nullptr)
 {
 }
 
-void InputArchive::load_binary(unsigned char* data, std::size_t len)
+InputArchive::InputArchive(const uint8_t* begin, const uint8_t* end) :
+    m_stream_buffer(nullptr), m_cursor(begin), m_end(end)
 {
-    load_binary(reinterpret_cast<char*>(data), len);
 }
 
-void InputArchive::load_binary(char* data, std::size_t len)
+InputArchive::InputArchive(ByteBuffer::const_iterator begin, ByteBuffer::const_iterator end) :
+    InputArchive(begin == end ? nullptr : &*begin, begin == end ? nullptr : &*begin + (end - begin))
+{
+}
+
+InputArchive::InputArchive(const ByteBuffer& buffer) :
+    InputArchive(buffer.data(), buffer.data() + buffer.size())
+{
+}
+
+void InputArchive::load_stream(char* data, std::size_t len)
 {
     std::size_t read_bytes = m_stream_buffer->sgetn(data, len);
     if (read_bytes != len) {
@@ -27,21 +37,26 @@ void InputArchive::load_binary(char* data, std::size_t len)
 }
 
 OutputArchive::OutputArchive(OutputStream& os) :
-    m_stream_buffer(os.rdbuf())
+    m_stream_buffer(os.rdbuf()), m_buffer(nullptr), m_cursor(nullptr), m_end(nullptr)
 {
 }
 
 OutputArchive::OutputArchive(StreamBuffer& buf) :
-    m_stream_buffer(&buf)
+    m_stream_buffer(&buf), m_buffer(nullptr), m_cursor(nullptr), m_end(nullptr)
+{
+}
+
+OutputArchive::OutputArchive(ByteBuffer& buffer) :
+    m_stream_buffer(nullptr), m_buffer(&buffer), m_cursor(nullptr), m_end(nullptr)
 {
 }
 
-void OutputArchive::save_binary(const unsigned char* data, std::size_t len)
+OutputArchive::OutputArchive(uint8_t* begin, uint8_t* end) :
+    m_stream_buffer(nullptr), m_buffer(nullptr), m_cursor(begin), m_end(end)
 {
-    save_binary(reinterpret_cast<const char*>(data), len);
 }
 
-void OutputArchive::save_binary(const char* data, std::size_t len)
+void OutputArchive::save_stream(const char* data, std::size_t len)
 {
     std::size_t written_bytes = m_stream_buffer->sputn(data, len);
     if (written_bytes != len) {
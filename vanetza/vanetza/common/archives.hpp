@@ -1,10 +1,15 @@
 #ifndef ARCHIVES_HPP_TLVURDQK
 #define ARCHIVES_HPP_TLVURDQK
 
+#include <vanetza/common/byte_buffer.hpp>
 #include <vanetza/common/byte_order.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <istream>
 #include <ostream>
+#include <stdexcept>
 #include <streambuf>
 
 namespace vanetza
@@ -12,6 +17,10 @@ namespace vanetza
 
 /**
  * This is a drop-in replacement for boost::archive::binary_iarchive
+ *
+ * Archive reads either from a stream buffer or directly from contiguous memory.
+ * The latter is preferable when all bytes are at hand anyway,
+ * loads are then bounds-checked copies which can be inlined entirely.
  */
 class InputArchive
 {
@@ -25,6 +34,13 @@ public:
     InputArchive(InputStream& is);
     InputArchive(StreamBuffer& buf);
 
+    /**
+     * Read from memory range [begin, end), range has to outlive archive
+     */
+    InputArchive(const uint8_t* begin, const uint8_t* end);
+    InputArchive(ByteBuffer::const_iterator begin, ByteBuffer::const_iterator end);
+    InputArchive(const ByteBuffer& buffer);
+
     template<typename T>
     InputArchive& operator>>(T& t)
     {
@@ -34,15 +50,38 @@ public:
         return *this;
     }
 
-    void load_binary(unsigned char* data, std::size_t len);
-    void load_binary(char* data, std::size_t len);
+    void load_binary(unsigned char* data, std::size_t len)
+    {
+        load_binary(reinterpret_cast<char*>(data), len);
+    }
+
+    void load_binary(char* data, std::size_t len)
+    {
+        if (m_stream_buffer) {
+            load_stream(data, len);
+        } else if (len <= static_cast<std::size_t>(m_end - m_cursor)) {
+            if (len > 0) {
+                std::memcpy(data, m_cursor, len);
+                m_cursor += len;
+            }
+        } else {
+            throw Exception("incomplete read");
+        }
+    }
 
 private:
+    void load_stream(char* data, std::size_t len);
+
     StreamBuffer* m_stream_buffer;
+    const uint8_t* m_cursor;
+    const uint8_t* m_end;
 };
 
 /**
  * This is a drop-in replacement for boost::archive::binary_oarchive
+ *
+ * Archive writes either to a stream buffer or directly to memory:
+ * bytes are appended to a ByteBuffer or written into a fixed memory range.
  */
 class OutputArchive
 {
@@ -56,6 +95,16 @@ public:
     OutputArchive(OutputStream& os);
     OutputArchive(StreamBuffer& buf);
 
+    /**
+     * Append to buffer, i.e. its present content is preserved
+     */
+    OutputArchive(ByteBuffer& buffer);
+
+    /**
+     * Write into memory range [begin, end), writes beyond end fail
+     */
+    OutputArchive(uint8_t* begin, uint8_t* end);
+
     template<typename T>
     OutputArchive& operator<<(const T& t)
     {
@@ -65,11 +114,34 @@ public:
         return *this;
     }
 
-    void save_binary(const unsigned char* data, std::size_t len);
-    void save_binary(const char* data, std::size_t len);
+    void save_binary(const unsigned char* data, std::size_t len)
+    {
+        save_binary(reinterpret_cast<const char*>(data), len);
+    }
+
+    void save_binary(const char* data, std::size_t len)
+    {
+        if (m_stream_buffer) {
+            save_stream(data, len);
+        } else if (m_buffer) {
+            m_buffer->insert(m_buffer->end(), data, data + len);
+        } else if (len <= static_cast<std::size_t>(m_end - m_cursor)) {
+            if (len > 0) {
+                std::memcpy(m_cursor, data, len);
+                m_cursor += len;
+            }
+        } else {
+            throw Exception("incomplete write");
+        }
+    }
 
 private:
+    void save_stream(const char* data, std::size_t len);
+
     StreamBuffer* m_stream_buffer;
+    ByteBuffer* m_buffer;
+    uint8_t* m_cursor;
+    uint8_t* m_end;
 };
 
 } // namespace vanetza
@@ -1,4 +1,5 @@
 #include "byte_buffer_convertible.hpp"
+#include "byte_segment.hpp"
 #include <algorithm>
 #include <iterator>
 
@@ -7,6 +8,13 @@ namespace vanetza
 namespace convertible
 {
 
+void byte_buffer::append(ByteBuffer& buffer) const
+{
+    ByteBuffer tmp;
+    this->convert(tmp);
+    buffer.insert(buffer.end(), tmp.begin(), tmp.end());
+}
+
 std::unique_ptr<byte_buffer> byte_buffer::duplicate() const
 {
     ByteBuffer duplicate;
@@ -17,6 +25,14 @@ std::unique_ptr<byte_buffer> byte_buffer::duplicate() const
     return result;
 }
 
+std::unique_ptr<byte_buffer> byte_buffer_impl<ByteBuffer>::duplicate() const
+{
+    if (!m_shared) {
+        m_shared = std::make_shared<const ByteBuffer>(std::move(m_buffer));
+    }
+    return std::unique_ptr<byte_buffer> { new byte_buffer_impl<ByteSegment>(ByteSegment { m_shared }) };
+}
+
 byte_buffer_impl<std::string>::byte_buffer_impl(const std::string& str) : m_buffer(str) {}
 byte_buffer_impl<std::string>::byte_buffer_impl(std::string&& str) : m_buffer(std::move(str)) {}
 
@@ -26,6 +42,11 @@ void byte_buffer_impl<std::string>::convert(ByteBuffer& buffer) const
     std::copy(m_buffer.begin(), m_buffer.end(), std::back_inserter(buffer));
 }
 
+void byte_buffer_impl<std::string>::append(ByteBuffer& buffer) const
+{
+    buffer.insert(buffer.end(), m_buffer.begin(), m_buffer.end());
+}
+
 std::size_t byte_buffer_impl<std::string>::size() const
 {
     return m_buffer.size();
@@ -39,13 +60,13 @@ std::unique_ptr<byte_buffer> byte_buffer_impl<std::nullptr_t>::duplicate() const
 } // namespace convertible
 
 ByteBufferConvertible::ByteBufferConvertible(const ByteBufferConvertible& other) :
-    m_wrapper(other.m_wrapper->duplicate())
+    m_wrapper(other.m_wrapper ? other.m_wrapper->duplicate() : nullptr)
 {
 }
 
 ByteBufferConvertible& ByteBufferConvertible::operator=(const ByteBufferConvertible& other)
 {
-    m_wrapper = other.m_wrapper->duplicate();
+    m_wrapper = other.m_wrapper ? other.m_wrapper->duplicate() : nullptr;
     return *this;
 }
 
@@ -15,6 +15,11 @@ namespace convertible
 struct byte_buffer
 {
     virtual void convert(ByteBuffer&) const = 0;
+    /**
+     * Append byte representation to buffer, i.e. its present content is preserved.
+     * Default implementation converts into a temporary buffer first.
+     */
+    virtual void append(ByteBuffer&) const;
     virtual std::size_t size() const = 0;
     virtual std::unique_ptr<byte_buffer> duplicate() const;
     virtual ~byte_buffer() {}
@@ -23,14 +28,24 @@ struct byte_buffer
 template<class T>
 struct byte_buffer_impl;
 
+/**
+ * Buffer is moved into shared storage by its first duplication,
+ * thus duplicates refer to the same immutable bytes instead of copying them.
+ */
 template<>
 struct byte_buffer_impl<ByteBuffer> : public byte_buffer
 {
     byte_buffer_impl(ByteBuffer&& buffer) : m_buffer(std::move(buffer)) {}
-    void convert(ByteBuffer& buf) const override { buf = m_buffer; }
-    std::size_t size() const override { return m_buffer.size(); }
+    void convert(ByteBuffer& buf) const override { buf = buffer(); }
+    void append(ByteBuffer& buf) const override { buf.insert(buf.end(), buffer().begin(), buffer().end()); }
+    std::size_t size() const override { return buffer().size(); }
+    std::unique_ptr<byte_buffer> duplicate() const override;
 
-    ByteBuffer m_buffer;
+    const ByteBuffer& buffer() const { return m_shared ? *m_shared : m_buffer; }
+
+private:
+    mutable ByteBuffer m_buffer;
+    mutable std::shared_ptr<const ByteBuffer> m_shared;
 };
 
 template<>
@@ -39,6 +54,7 @@ struct byte_buffer_impl<std::unique_ptr<ByteBuffer>> : public byte_buffer
     byte_buffer_impl(std::unique_ptr<ByteBuffer> buf) :
         m_buffer(std::move(buf)) {}
     void convert(ByteBuffer& buf) const override { buf = *m_buffer; }
+    void append(ByteBuffer& buf) const override { buf.insert(buf.end(), m_buffer->begin(), m_buffer->end()); }
     std::size_t size() const override { return m_buffer->size(); }
 
     std::unique_ptr<ByteBuffer> m_buffer;
@@ -50,6 +66,7 @@ struct byte_buffer_impl<std::string> : public byte_buffer
     byte_buffer_impl(const std::string& str);
     byte_buffer_impl(std::string&& str);
     void convert(ByteBuffer& buffer) const override;
+    void append(ByteBuffer& buffer) const override;
     std::size_t size() const override;
 
     std::string m_buffer;
@@ -59,6 +76,7 @@ template<>
 struct byte_buffer_impl<std::nullptr_t> : public byte_buffer
 {
     void convert(ByteBuffer& buffer) const override { buffer.clear(); }
+    void append(ByteBuffer&) const override {}
     std::size_t size() const override { return 0; }
     std::unique_ptr<byte_buffer> duplicate() const override;
 };
@@ -73,17 +91,19 @@ struct byte_buffer_impl<std::nullptr_t> : public byte_buffer
  * through the convertible::byte_buffer interface.
  * Extending ByteBufferConvertible is possible by providing specializations
  * of convertible::byte_buffer_impl<T> implementing convertible::byte_buffer.
+ *
+ * A default constructed ByteBufferConvertible is empty and does not allocate any wrapper.
  */
 class ByteBufferConvertible
 {
 public:
-    ByteBufferConvertible() :
-        m_wrapper(new convertible::byte_buffer_impl<std::nullptr_t>()) {}
+    ByteBufferConvertible() = default;
 
     ByteBufferConvertible(std::unique_ptr<convertible::byte_buffer> ptr) :
         m_wrapper(std::move(ptr)) {}
 
-    template<class T>
+    template<class T, class = typename std::enable_if<
+        !std::is_same<typename std::decay<T>::type, ByteBufferConvertible>::value>::type>
     ByteBufferConvertible(T&& t) :
         m_wrapper(new convertible::byte_buffer_impl<typename std::decay<T>::type>(std::forward<T>(t))) {}
 
@@ -93,8 +113,27 @@ public:
     ByteBufferConvertible(ByteBufferConvertible&& other) = default;
     ByteBufferConvertible& operator=(ByteBufferConvertible&& other) = default;
 
-    void convert(ByteBuffer& destination) const { m_wrapper->convert(destination); }
-    std::size_t size() const { return m_wrapper->size(); }
+    void convert(ByteBuffer& destination) const
+    {
+        if (m_wrapper) {
+            m_wrapper->convert(destination);
+        } else {
+            destination.clear();
+        }
+    }
+
+    /**
+     * Append byte representation to destination buffer
+     * \param destination buffer, its present content is preserved
+     */
+    void append(ByteBuffer& destination) const
+    {
+        if (m_wrapper) {
+            m_wrapper->append(destination);
+        }
+    }
+
+    std::size_t size() const { return m_wrapper ? m_wrapper->size() : 0; }
 
     const convertible::byte_buffer* ptr() const { return m_wrapper.get(); }
     convertible::byte_buffer* ptr() { return m_wrapper.get(); }
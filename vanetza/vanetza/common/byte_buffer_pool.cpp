@@ -0,0 +1,31 @@
+#include "byte_buffer_pool.hpp"
+#include <utility>
+
+namespace vanetza
+{
+
+ByteBufferPool::ByteBufferPool(std::size_t buffer_size, std::size_t pool_size) :
+    m_buffer_size(buffer_size), m_idle(pool_size)
+{
+}
+
+ByteBuffer ByteBufferPool::acquire()
+{
+    ByteBuffer buffer;
+    if (!m_idle.try_pop(buffer)) {
+        buffer.reserve(m_buffer_size);
+    }
+    buffer.resize(m_buffer_size);
+    return buffer;
+}
+
+void ByteBufferPool::release(ByteBuffer&& buffer)
+{
+    if (buffer.capacity() >= m_buffer_size) {
+        buffer.clear();
+        // buffer is simply freed if pool is exhausted
+        m_idle.try_push(std::move(buffer));
+    }
+}
+
+} // namespace vanetza
@@ -0,0 +1,58 @@
+#ifndef BYTE_BUFFER_POOL_HPP_K7QM2VXD
+#define BYTE_BUFFER_POOL_HPP_K7QM2VXD
+
+#include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/common/mpsc_queue.hpp>
+#include <cstddef>
+
+namespace vanetza
+{
+
+/**
+ * ByteBufferPool recycles byte buffers of a fixed capacity, e.g. receive buffers of a link layer.
+ *
+ * Buffers given back to the pool keep their heap allocation, thus acquiring a recycled
+ * buffer does not allocate memory. Buffers may be released by any thread,
+ * but only a single thread shall acquire buffers at a time.
+ */
+class ByteBufferPool
+{
+public:
+    /**
+     * Create pool
+     * \param buffer_size size of acquired buffers in bytes
+     * \param pool_size maximum number of idle buffers kept by pool
+     */
+    ByteBufferPool(std::size_t buffer_size, std::size_t pool_size);
+
+    ByteBufferPool(const ByteBufferPool&) = delete;
+    ByteBufferPool& operator=(const ByteBufferPool&) = delete;
+
+    /**
+     * Acquire a buffer, recycled if possible or freshly allocated otherwise
+     * \return buffer with buffer_size() bytes
+     */
+    ByteBuffer acquire();
+
+    /**
+     * Give a buffer back to pool (thread-safe)
+     *
+     * Buffer is dropped if pool is full or buffer's capacity is too small.
+     * \param buffer buffer to recycle
+     */
+    void release(ByteBuffer&& buffer);
+
+    /**
+     * Get size of acquired buffers
+     * \return buffer size in bytes
+     */
+    std::size_t buffer_size() const { return m_buffer_size; }
+
+private:
+    const std::size_t m_buffer_size;
+    BoundedMpscQueue<ByteBuffer> m_idle;
+};
+
+} // namespace vanetza
+
+#endif /* BYTE_BUFFER_POOL_HPP_K7QM2VXD */
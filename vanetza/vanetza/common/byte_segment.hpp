@@ -0,0 +1,92 @@
+#ifndef BYTE_SEGMENT_HPP_R7WQ2KXD
+#define BYTE_SEGMENT_HPP_R7WQ2KXD
+
+#include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/common/byte_buffer_convertible.hpp>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+namespace vanetza
+{
+
+/**
+ * ByteSegment refers to an immutable byte range of a reference-counted buffer.
+ *
+ * Copying a segment only increments the buffer's reference count, i.e. several packets
+ * can share one payload. Since the buffer is immutable, no copy is required for modification:
+ * replacing a packet's layer by a new convertible leaves all other sharers untouched.
+ */
+class ByteSegment
+{
+public:
+    /**
+     * Create segment covering a whole buffer
+     * \param buffer shared buffer
+     */
+    explicit ByteSegment(std::shared_ptr<const ByteBuffer> buffer) :
+        m_offset(0), m_length(buffer ? buffer->size() : 0), m_buffer(std::move(buffer)) {}
+
+    /**
+     * Create segment covering a part of a buffer
+     * \param buffer shared buffer
+     * \param offset start of segment within buffer
+     * \param length number of bytes in segment
+     */
+    ByteSegment(std::shared_ptr<const ByteBuffer> buffer, std::size_t offset, std::size_t length) :
+        m_offset(offset), m_length(length), m_buffer(std::move(buffer))
+    {
+        assert(m_length == 0 || (m_buffer && m_offset + m_length <= m_buffer->size()));
+    }
+
+    ByteBuffer::const_iterator begin() const { return m_buffer->begin() + m_offset; }
+    ByteBuffer::const_iterator end() const { return begin() + m_length; }
+    std::size_t size() const { return m_length; }
+    bool empty() const { return m_length == 0; }
+
+    /**
+     * Get underlying buffer shared by all copies of this segment
+     * \return shared buffer
+     */
+    const std::shared_ptr<const ByteBuffer>& buffer() const { return m_buffer; }
+
+private:
+    std::size_t m_offset;
+    std::size_t m_length;
+    std::shared_ptr<const ByteBuffer> m_buffer;
+};
+
+namespace convertible
+{
+
+template<>
+struct byte_buffer_impl<ByteSegment> : public byte_buffer
+{
+    byte_buffer_impl(const ByteSegment& segment) : m_segment(segment) {}
+    void convert(ByteBuffer& buf) const override
+    {
+        if (m_segment.empty()) {
+            buf.clear();
+        } else {
+            buf.assign(m_segment.begin(), m_segment.end());
+        }
+    }
+    void append(ByteBuffer& buf) const override
+    {
+        if (!m_segment.empty()) {
+            buf.insert(buf.end(), m_segment.begin(), m_segment.end());
+        }
+    }
+    std::size_t size() const override { return m_segment.size(); }
+    std::unique_ptr<byte_buffer> duplicate() const override
+    {
+        return std::unique_ptr<byte_buffer> { new byte_buffer_impl<ByteSegment>(m_segment) };
+    }
+
+    const ByteSegment m_segment;
+};
+
+} // namespace convertible
+} // namespace vanetza
+
+#endif /* BYTE_SEGMENT_HPP_R7WQ2KXD */
@@ -67,8 +67,10 @@ private:
             remove();
         }
 
+        // generate value first: no index entry is left behind if generator throws
+        value_type value = m_generator(k);
         m_index.emplace_front(k);
-        entry_type entry = std::make_pair(m_generator(k), m_index.begin());
+        entry_type entry = std::make_pair(std::move(value), m_index.begin());
         auto insertion = m_cache.insert(std::make_pair(k, std::move(entry)));
         assert(insertion.second == true);
         return insertion.first->second.first;
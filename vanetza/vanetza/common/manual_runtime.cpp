@@ -1,17 +1,38 @@
 #include "manual_runtime.hpp"
+#include <algorithm>
 #include <cassert>
-#include <iostream>
+#include <utility>
 
 namespace vanetza
 {
 
+constexpr ManualRuntime::index_type ManualRuntime::npos;
+constexpr std::size_t ManualRuntime::arity;
+
 ManualRuntime::ManualRuntime(Clock::time_point init) : m_now(init)
 {
 }
 
 void ManualRuntime::schedule(Clock::time_point tp, const Callback& cb, const void* scope)
 {
-    m_queue.emplace(queue_type::value_type { tp, cb, scope });
+    const index_type index = allocate();
+    Slot& slot = m_slots[index];
+    slot.callback = cb;
+    slot.scope = scope;
+    slot.scope_prev = npos;
+    slot.scope_next = npos;
+
+    if (scope) {
+        auto inserted = m_scopes.insert(std::make_pair(scope, index));
+        if (!inserted.second) {
+            // prepend to scope's list
+            slot.scope_next = inserted.first->second;
+            m_slots[slot.scope_next].scope_prev = index;
+            inserted.first->second = index;
+        }
+    }
+
+    push(HeapItem { tp, m_sequence++, index, slot.generation });
 }
 
 void ManualRuntime::schedule(Clock::duration d, const Callback& cb, const void* scope)
@@ -22,16 +43,33 @@ void ManualRuntime::schedule(Clock::duration d, const Callback& cb, const void*
 void ManualRuntime::cancel(const void* scope)
 {
     if (scope) {
-        auto scope_match_range = m_queue.get<by_scope>().equal_range(scope);
-        m_queue.get<by_scope>().erase(scope_match_range.first, scope_match_range.second);
+        auto found = m_scopes.find(scope);
+        if (found != m_scopes.end()) {
+            index_type index = found->second;
+            m_scopes.erase(found);
+            while (index != npos) {
+                const index_type next = m_slots[index].scope_next;
+                // unlink from scope list is not necessary, whole list is dropped
+                m_slots[index].scope = nullptr;
+                release(index);
+                ++m_stale;
+                index = next;
+            }
+
+            // heap items of cancelled callbacks are skipped lazily unless they dominate the heap
+            if (m_stale > m_heap.size() / 2) {
+                compact();
+            }
+        }
     }
 }
 
 Clock::time_point ManualRuntime::next() const
 {
     Clock::time_point next_tp = Clock::time_point::max();
-    if (!m_queue.empty()) {
-        next_tp = m_queue.get<by_deadline>().begin()->deadline;
+    purge();
+    if (!m_heap.empty()) {
+        next_tp = m_heap.front().deadline;
     }
     return next_tp;
 }
@@ -58,38 +96,176 @@ void ManualRuntime::trigger(Clock::duration d)
 void ManualRuntime::trigger()
 {
     // process queue elements separately because callback might modify runtime
-    while (!m_queue.empty()) {
-        auto top = m_queue.get<by_deadline>().begin();
-        const auto deadline = top->deadline; // copy of deadline on purpose (erase before callback)
-        if (deadline <= m_now) {
-            if(&top != nullptr && top.get_node() != nullptr && top.get_node()->right() != nullptr && top.get_node()->right() == top.get_node()->right()->left()) {
-                std::cout << "[DEBUG] - Runtime queue corruption was detected and cleared" << std::endl;
-                m_queue.get<by_deadline>().clear();
-            } else {
-                Callback cb = top->callback;
-                m_queue.get<by_deadline>().erase(top);
-                cb(deadline);
-            }
-            // callback invocation has to be last action because it might modify runtime
-        } else {
-            break;
-        }
+    purge();
+    while (!m_heap.empty() && m_heap.front().deadline <= m_now) {
+        const HeapItem top = m_heap.front();
+        pop();
+        Callback cb = std::move(m_slots[top.slot].callback);
+        release(top.slot);
+        // callback invocation has to be last action because it might modify runtime
+        cb(top.deadline);
+        purge();
     }
 }
 
 void ManualRuntime::reset(Clock::time_point tp)
 {
     m_now = tp;
-    queue_type queue;
-    swap(queue, m_queue);
+
+    std::vector<HeapItem> items;
+    items.reserve(m_heap.size() - m_stale);
+    for (const HeapItem& item : m_heap) {
+        if (!stale(item)) {
+            items.push_back(item);
+        }
+    }
+    std::sort(items.begin(), items.end(), &ManualRuntime::earlier);
+
+    std::vector<std::pair<Clock::time_point, Callback>> callbacks;
+    callbacks.reserve(items.size());
+    for (const HeapItem& item : items) {
+        callbacks.emplace_back(item.deadline, std::move(m_slots[item.slot].callback));
+    }
+
+    m_heap.clear();
+    m_stale = 0;
+    m_slots.clear();
+    m_free = npos;
+    m_scopes.clear();
 
     // invoke all callbacks once so they can re-schedule
-    for (auto& item : queue) {
-        const auto& deadline = item.deadline;
-        auto& callback = item.callback;
-        // callback might modify m_queue
-        callback(deadline);
+    for (auto& item : callbacks) {
+        // callback might modify queue
+        item.second(item.first);
+    }
+}
+
+bool ManualRuntime::earlier(const HeapItem& a, const HeapItem& b)
+{
+    return a.deadline < b.deadline || (a.deadline == b.deadline && a.sequence < b.sequence);
+}
+
+bool ManualRuntime::stale(const HeapItem& item) const
+{
+    return m_slots[item.slot].generation != item.generation;
+}
+
+void ManualRuntime::push(const HeapItem& item)
+{
+    m_heap.push_back(item);
+    sift_up(m_heap.size() - 1);
+}
+
+void ManualRuntime::pop() const
+{
+    assert(!m_heap.empty());
+    m_heap.front() = m_heap.back();
+    m_heap.pop_back();
+    if (!m_heap.empty()) {
+        sift_down(0);
     }
 }
 
+void ManualRuntime::sift_up(std::size_t pos) const
+{
+    const HeapItem item = m_heap[pos];
+    while (pos > 0) {
+        const std::size_t parent = (pos - 1) / arity;
+        if (!earlier(item, m_heap[parent])) {
+            break;
+        }
+        m_heap[pos] = m_heap[parent];
+        pos = parent;
+    }
+    m_heap[pos] = item;
+}
+
+void ManualRuntime::sift_down(std::size_t pos) const
+{
+    const std::size_t size = m_heap.size();
+    const HeapItem item = m_heap[pos];
+    while (true) {
+        const std::size_t first = pos * arity + 1;
+        if (first >= size) {
+            break;
+        }
+
+        std::size_t best = first;
+        const std::size_t last = std::min(first + arity, size);
+        for (std::size_t child = first + 1; child < last; ++child) {
+            if (earlier(m_heap[child], m_heap[best])) {
+                best = child;
+            }
+        }
+
+        if (!earlier(m_heap[best], item)) {
+            break;
+        }
+        m_heap[pos] = m_heap[best];
+        pos = best;
+    }
+    m_heap[pos] = item;
+}
+
+void ManualRuntime::purge() const
+{
+    while (!m_heap.empty() && stale(m_heap.front())) {
+        pop();
+        assert(m_stale > 0);
+        --m_stale;
+    }
+}
+
+void ManualRuntime::compact()
+{
+    auto stale_item = [this](const HeapItem& item) { return stale(item); };
+    m_heap.erase(std::remove_if(m_heap.begin(), m_heap.end(), stale_item), m_heap.end());
+    m_stale = 0;
+
+    // restore heap property bottom-up
+    if (m_heap.size() > 1) {
+        for (std::size_t pos = (m_heap.size() - 2) / arity + 1; pos-- > 0;) {
+            sift_down(pos);
+        }
+    }
+}
+
+ManualRuntime::index_type ManualRuntime::allocate()
+{
+    index_type index = m_free;
+    if (index != npos) {
+        m_free = m_slots[index].scope_next;
+    } else {
+        index = static_cast<index_type>(m_slots.size());
+        m_slots.emplace_back();
+        m_slots.back().generation = 0;
+    }
+    return index;
+}
+
+void ManualRuntime::release(index_type index)
+{
+    Slot& slot = m_slots[index];
+    if (slot.scope) {
+        // unlink from scope's list
+        if (slot.scope_prev != npos) {
+            m_slots[slot.scope_prev].scope_next = slot.scope_next;
+        } else if (slot.scope_next != npos) {
+            m_scopes[slot.scope] = slot.scope_next;
+        } else {
+            m_scopes.erase(slot.scope);
+        }
+        if (slot.scope_next != npos) {
+            m_slots[slot.scope_next].scope_prev = slot.scope_prev;
+        }
+    }
+
+    slot.callback = nullptr;
+    slot.scope = nullptr;
+    slot.scope_prev = npos;
+    slot.scope_next = m_free;
+    ++slot.generation;
+    m_free = index;
+}
+
 } // namespace vanetza
@@ -2,10 +2,9 @@
 #define MANUAL_RUNTIME_HPP_IPFSK6ZA
 
 #include <vanetza/common/runtime.hpp>
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace vanetza
 {
@@ -13,6 +12,10 @@ namespace vanetza
 /**
  * ManualRuntime is a manually triggered Runtime implementation.
  * Ensure that time progress is triggered monotonically!
+ *
+ * Scheduled callbacks are kept in a contiguous 4-ary heap ordered by deadline.
+ * Heap items refer to callback slots by generation-tagged handles, thus
+ * cancelled callbacks are only invalidated and skipped lazily.
  */
 class ManualRuntime : public Runtime
 {
@@ -63,37 +66,46 @@ public:
     Clock::time_point now() const override;
 
 private:
-    struct ScheduledCallback
-    {
-        ScheduledCallback(Clock::time_point tp, const Callback& cb, const void* scope) :
-            deadline(tp), callback(cb), scope(scope) {}
-
-        ScheduledCallback(const ScheduledCallback&) = delete;
-        ScheduledCallback& operator=(const ScheduledCallback&) = delete;
+    using index_type = std::uint32_t;
+    static constexpr index_type npos = ~index_type(0);
+    static constexpr std::size_t arity = 4;
 
-        ScheduledCallback(ScheduledCallback&&) = default;
-        ScheduledCallback& operator=(ScheduledCallback&&) = default;
-
-        Clock::time_point deadline;
+    struct Slot
+    {
         Callback callback;
         const void* scope;
+        index_type scope_prev;
+        index_type scope_next; // next free slot if unused
+        std::uint32_t generation;
     };
 
-    struct by_deadline {};
-    using time_index = boost::multi_index::ordered_non_unique<
-        boost::multi_index::tag<by_deadline>,
-        boost::multi_index::member<ScheduledCallback, Clock::time_point, &ScheduledCallback::deadline>>;
-    struct by_scope {};
-    using scope_index = boost::multi_index::hashed_non_unique<
-        boost::multi_index::tag<by_scope>,
-        boost::multi_index::member<ScheduledCallback, const void*, &ScheduledCallback::scope>>;
-    using queue_type = boost::multi_index_container<ScheduledCallback,
-          boost::multi_index::indexed_by<time_index, scope_index>>;
+    struct HeapItem
+    {
+        Clock::time_point deadline;
+        std::uint64_t sequence;
+        index_type slot;
+        std::uint32_t generation;
+    };
 
+    static bool earlier(const HeapItem&, const HeapItem&);
+    bool stale(const HeapItem&) const;
+    void push(const HeapItem&);
+    void pop() const;
+    void sift_up(std::size_t) const;
+    void sift_down(std::size_t) const;
+    void purge() const;
+    void compact();
+    index_type allocate();
+    void release(index_type);
     void trigger();
 
     Clock::time_point m_now;
-    queue_type m_queue;
+    std::uint64_t m_sequence = 0;
+    mutable std::vector<HeapItem> m_heap;
+    mutable std::size_t m_stale = 0;
+    std::vector<Slot> m_slots;
+    index_type m_free = npos;
+    std::unordered_map<const void*, index_type> m_scopes;
 };
 
 } // namespace vanetza
@@ -0,0 +1,131 @@
+#ifndef MPSC_QUEUE_HPP_W3DQ8ZTA
+#define MPSC_QUEUE_HPP_W3DQ8ZTA
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace vanetza
+{
+
+/**
+ * \brief Bounded lock-free multi-producer single-consumer queue
+ *
+ * Ring buffer with per-cell sequence counters (D. Vyukov's bounded queue design).
+ * Any number of threads may push concurrently, but only one thread may pop at a time.
+ * Neither push nor pop allocates memory, cells are allocated once at construction.
+ *
+ * \tparam T element type, has to be default constructible and move assignable
+ */
+template<typename T>
+class BoundedMpscQueue
+{
+public:
+    using value_type = T;
+
+    /**
+     * \param capacity maximum number of queued elements, rounded up to a power of two
+     */
+    explicit BoundedMpscQueue(std::size_t capacity) :
+        m_mask(round_up(capacity) - 1), m_cells(new Cell[m_mask + 1]),
+        m_enqueue_pos(0), m_dequeue_pos(0)
+    {
+        for (std::size_t i = 0; i <= m_mask; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    /**
+     * Enqueue an element (thread-safe for any number of producers)
+     * \param value element moved into queue on success
+     * \return false if queue is full, value is untouched then
+     */
+    bool try_push(value_type&& value)
+    {
+        Cell* cell = nullptr;
+        std::size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // queue is full
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Dequeue oldest element (only a single consumer thread is allowed)
+     * \param value destination of dequeued element
+     * \return false if queue is empty (or oldest element is not yet completely published)
+     */
+    bool try_pop(value_type& value)
+    {
+        const std::size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[pos & m_mask];
+        const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (seq != pos + 1) {
+            return false;
+        }
+
+        value = std::move(cell.data);
+        cell.data = value_type();
+        cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+        m_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Get maximum number of elements
+     * \return capacity
+     */
+    std::size_t capacity() const
+    {
+        return m_mask + 1;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        value_type data;
+    };
+
+    static std::size_t round_up(std::size_t capacity)
+    {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    // padding avoids false sharing between producers and consumer
+    static constexpr std::size_t cache_line = 64;
+
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    char m_pad0[cache_line];
+    std::atomic<std::size_t> m_enqueue_pos;
+    char m_pad1[cache_line];
+    std::atomic<std::size_t> m_dequeue_pos;
+    char m_pad2[cache_line];
+};
+
+} // namespace vanetza
+
+#endif /* MPSC_QUEUE_HPP_W3DQ8ZTA */
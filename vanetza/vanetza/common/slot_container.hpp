@@ -0,0 +1,217 @@
+#ifndef SLOT_CONTAINER_HPP_M4VX7TQE
+#define SLOT_CONTAINER_HPP_M4VX7TQE
+
+#include <vanetza/common/object_container.hpp>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace vanetza
+{
+namespace detail
+{
+
+constexpr std::size_t no_slot = static_cast<std::size_t>(-1);
+
+template<typename T, typename... Ts>
+struct slot_index;
+
+template<typename T>
+struct slot_index<T> : std::integral_constant<std::size_t, no_slot> {};
+
+template<typename T, typename... Ts>
+struct slot_index<T, T, Ts...> : std::integral_constant<std::size_t, 0>
+{
+    static_assert(slot_index<T, Ts...>::value == no_slot, "type is registered more than once");
+};
+
+template<typename T, typename U, typename... Ts>
+struct slot_index<T, U, Ts...> : std::integral_constant<std::size_t,
+    slot_index<T, Ts...>::value == no_slot ? no_slot : 1 + slot_index<T, Ts...>::value> {};
+
+} // namespace detail
+
+/**
+ * SlotContainer stores at most one object per type like ObjectContainer.
+ *
+ * Types listed as template arguments are registered at compile time: each gets a fixed slot index,
+ * thus accessing them is an indexed load without any type_index lookup.
+ * Objects of other types are still accepted and kept in an ObjectContainer.
+ *
+ * \tparam Ts registered types, they may be incomplete where only the slot index is required
+ */
+template<typename... Ts>
+class SlotContainer
+{
+public:
+    static constexpr std::size_t slots = sizeof...(Ts);
+
+    template<typename T>
+    using is_registered = std::integral_constant<bool, detail::slot_index<T, Ts...>::value != detail::no_slot>;
+
+    SlotContainer() = default;
+    ~SlotContainer() { clear(); }
+
+    // no copy
+    SlotContainer(const SlotContainer&) = delete;
+    SlotContainer& operator=(const SlotContainer&) = delete;
+
+    // allow move
+    SlotContainer(SlotContainer&& other) : m_slots(other.m_slots), m_others(std::move(other.m_others))
+    {
+        other.m_slots.fill(Slot {});
+    }
+
+    SlotContainer& operator=(SlotContainer&& other)
+    {
+        if (this != &other) {
+            clear();
+            m_slots = other.m_slots;
+            m_others = std::move(other.m_others);
+            other.m_slots.fill(Slot {});
+        }
+        return *this;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    std::size_t size() const
+    {
+        std::size_t count = m_others.size();
+        for (const Slot& slot : m_slots) {
+            count += slot.object ? 1 : 0;
+        }
+        return count;
+    }
+
+    void clear()
+    {
+        for (Slot& slot : m_slots) {
+            slot.reset();
+        }
+        m_others.clear();
+    }
+
+    template<typename T>
+    void erase()
+    {
+        erase<T>(is_registered<T>());
+    }
+
+    template<typename T>
+    T* find()
+    {
+        return find<T>(is_registered<T>());
+    }
+
+    template<typename T>
+    const T* find() const
+    {
+        return const_cast<SlotContainer*>(this)->find<T>(is_registered<T>());
+    }
+
+    template<typename T>
+    bool insert(std::unique_ptr<T> obj)
+    {
+        static_assert(std::is_object<T>() && !std::is_const<T>(),
+                "Only non-const objects are supported by SlotContainer");
+        return insert(std::move(obj), is_registered<T>());
+    }
+
+    template<typename T>
+    T& get()
+    {
+        static_assert(std::is_default_constructible<T>(),
+                "Only default constructible types are accessible through SlotContainer::get");
+        T* result = find<T>();
+        if (!result) {
+            std::unique_ptr<T> obj { new T() };
+            result = obj.get();
+            if (!insert(std::move(obj)))
+                result = nullptr;
+        }
+        assert(result);
+        return *result;
+    }
+
+private:
+    struct Slot
+    {
+        void* object = nullptr;
+        void (*deleter)(void*) = nullptr;
+
+        void reset()
+        {
+            if (object) {
+                deleter(object);
+                object = nullptr;
+            }
+        }
+    };
+
+    template<typename T>
+    static void destroy(void* object)
+    {
+        std::default_delete<T>()(static_cast<T*>(object));
+    }
+
+    template<typename T>
+    Slot& slot()
+    {
+        return m_slots[detail::slot_index<T, Ts...>::value];
+    }
+
+    template<typename T>
+    T* find(std::true_type)
+    {
+        return static_cast<T*>(slot<T>().object);
+    }
+
+    template<typename T>
+    T* find(std::false_type)
+    {
+        return m_others.find<T>();
+    }
+
+    template<typename T>
+    bool insert(std::unique_ptr<T> obj, std::true_type)
+    {
+        Slot& s = slot<T>();
+        if (s.object) {
+            return false;
+        }
+        s.object = obj.release();
+        s.deleter = &destroy<T>;
+        return true;
+    }
+
+    template<typename T>
+    bool insert(std::unique_ptr<T> obj, std::false_type)
+    {
+        return m_others.insert(std::move(obj));
+    }
+
+    template<typename T>
+    void erase(std::true_type)
+    {
+        slot<T>().reset();
+    }
+
+    template<typename T>
+    void erase(std::false_type)
+    {
+        m_others.erase<T>();
+    }
+
+    std::array<Slot, slots> m_slots;
+    ObjectContainer m_others;
+};
+
+template<typename... Ts>
+constexpr std::size_t SlotContainer<Ts...>::slots;
+
+} // namespace vanetza
+
+#endif /* SLOT_CONTAINER_HPP_M4VX7TQE */
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/archives.hpp>
+#include <vanetza/common/serialization.hpp>
+#include <sstream>
+
+using namespace vanetza;
+
+TEST(Archives, buffer_output) {
+    ByteBuffer buf = { 0xaa };
+    OutputArchive ar(buf);
+    serialize(ar, uint16_t(0x1234));
+    serialize(ar, uint32_t(0x56789abc));
+    EXPECT_EQ((ByteBuffer { 0xaa, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc }), buf);
+}
+
+TEST(Archives, span_output) {
+    ByteBuffer buf(3, 0x00);
+    OutputArchive ar(buf.data(), buf.data() + buf.size());
+    serialize(ar, uint16_t(0x1234));
+    EXPECT_THROW(serialize(ar, uint16_t(0x5678)), OutputArchive::Exception);
+    serialize(ar, uint8_t(0x56));
+    EXPECT_EQ((ByteBuffer { 0x12, 0x34, 0x56 }), buf);
+    EXPECT_THROW(serialize(ar, uint8_t(0x78)), OutputArchive::Exception);
+}
+
+TEST(Archives, memory_input) {
+    const ByteBuffer buf = { 0x12, 0x34, 0x56, 0x78, 0x9a };
+    InputArchive ar(buf);
+    uint32_t value = 0;
+    deserialize(ar, value);
+    EXPECT_EQ(0x12345678, value);
+    uint16_t exceeding = 0;
+    EXPECT_THROW(deserialize(ar, exceeding), InputArchive::Exception);
+    uint8_t last = 0;
+    deserialize(ar, last);
+    EXPECT_EQ(0x9a, last);
+    EXPECT_THROW(deserialize(ar, last), InputArchive::Exception);
+}
+
+TEST(Archives, range_input) {
+    const ByteBuffer buf = { 0x00, 0x12, 0x34, 0x00 };
+    InputArchive ar(buf.begin() + 1, buf.end() - 1);
+    uint16_t value = 0;
+    deserialize(ar, value);
+    EXPECT_EQ(0x1234, value);
+    EXPECT_THROW(deserialize(ar, value), InputArchive::Exception);
+
+    InputArchive empty(buf.end(), buf.end());
+    ByteBuffer nothing;
+    empty.load_binary(nothing.data(), nothing.size());
+    EXPECT_THROW(deserialize(empty, value), InputArchive::Exception);
+}
+
+TEST(Archives, equivalent_to_stream) {
+    std::stringstream stream;
+    OutputArchive stream_ar(stream);
+    ByteBuffer buf;
+    OutputArchive buffer_ar(buf);
+    for (OutputArchive* ar : { &stream_ar, &buffer_ar }) {
+        serialize(*ar, int16_t(-2));
+        serialize(*ar, uint64_t(0x0102030405060708));
+    }
+
+    const std::string str = stream.str();
+    EXPECT_EQ(ByteBuffer(str.begin(), str.end()), buf);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/byte_buffer_pool.hpp>
+#include <thread>
+#include <vector>
+
+using namespace vanetza;
+
+TEST(ByteBufferPool, acquire)
+{
+    ByteBufferPool pool(128, 4);
+    EXPECT_EQ(128, pool.buffer_size());
+
+    ByteBuffer buffer = pool.acquire();
+    EXPECT_EQ(128, buffer.size());
+    EXPECT_GE(buffer.capacity(), 128);
+}
+
+TEST(ByteBufferPool, recycle)
+{
+    ByteBufferPool pool(128, 4);
+    ByteBuffer buffer = pool.acquire();
+    const uint8_t* data = buffer.data();
+    buffer.resize(20);
+    pool.release(std::move(buffer));
+
+    ByteBuffer recycled = pool.acquire();
+    EXPECT_EQ(data, recycled.data());
+    EXPECT_EQ(128, recycled.size());
+}
+
+TEST(ByteBufferPool, reject_small_buffer)
+{
+    ByteBufferPool pool(128, 4);
+    ByteBuffer small(16);
+    const uint8_t* data = small.data();
+    pool.release(std::move(small));
+
+    ByteBuffer buffer = pool.acquire();
+    EXPECT_NE(data, buffer.data());
+    EXPECT_EQ(128, buffer.size());
+}
+
+TEST(ByteBufferPool, exhausted)
+{
+    ByteBufferPool pool(64, 2);
+    std::vector<ByteBuffer> buffers;
+    std::vector<const uint8_t*> released;
+    for (unsigned i = 0; i < 4; ++i) {
+        buffers.push_back(pool.acquire());
+        released.push_back(buffers.back().data());
+    }
+    for (auto& buffer : buffers) {
+        pool.release(std::move(buffer));
+    }
+
+    // only first two buffers are kept by pool
+    ByteBuffer first = pool.acquire();
+    ByteBuffer second = pool.acquire();
+    EXPECT_EQ(released[0], first.data());
+    EXPECT_EQ(released[1], second.data());
+    EXPECT_EQ(64, pool.acquire().size());
+}
+
+TEST(ByteBufferPool, concurrent_release)
+{
+    ByteBufferPool pool(256, 16);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool]() {
+            for (unsigned i = 0; i < 1000; ++i) {
+                pool.release(ByteBuffer(256));
+            }
+        });
+    }
+
+    for (unsigned i = 0; i < 1000; ++i) {
+        ByteBuffer buffer = pool.acquire();
+        ASSERT_EQ(256, buffer.size());
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
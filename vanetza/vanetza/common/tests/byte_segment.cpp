@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/byte_buffer_convertible.hpp>
+#include <vanetza/common/byte_segment.hpp>
+
+using namespace vanetza;
+
+namespace
+{
+
+const ByteSegment* segment(const ByteBufferConvertible& convertible)
+{
+    using segment_impl = convertible::byte_buffer_impl<ByteSegment>;
+    auto impl = dynamic_cast<const segment_impl*>(convertible.ptr());
+    return impl ? &impl->m_segment : nullptr;
+}
+
+} // namespace
+
+TEST(ByteSegment, whole_buffer) {
+    auto buffer = std::make_shared<const ByteBuffer>(ByteBuffer { 1, 2, 3, 4 });
+    ByteSegment seg { buffer };
+    EXPECT_EQ(4, seg.size());
+    EXPECT_FALSE(seg.empty());
+    EXPECT_EQ(*buffer, ByteBuffer(seg.begin(), seg.end()));
+    EXPECT_EQ(buffer, seg.buffer());
+}
+
+TEST(ByteSegment, partial_buffer) {
+    auto buffer = std::make_shared<const ByteBuffer>(ByteBuffer { 1, 2, 3, 4, 5, 6 });
+    ByteSegment seg { buffer, 2, 3 };
+    EXPECT_EQ(3, seg.size());
+    EXPECT_EQ((ByteBuffer { 3, 4, 5 }), ByteBuffer(seg.begin(), seg.end()));
+
+    ByteBufferConvertible convertible { seg };
+    EXPECT_EQ(3, convertible.size());
+    ByteBuffer tmp { 9 };
+    convertible.append(tmp);
+    EXPECT_EQ((ByteBuffer { 9, 3, 4, 5 }), tmp);
+    convertible.convert(tmp);
+    EXPECT_EQ((ByteBuffer { 3, 4, 5 }), tmp);
+
+    ByteSegment empty { buffer, 6, 0 };
+    EXPECT_TRUE(empty.empty());
+    ByteBufferConvertible { empty }.convert(tmp);
+    EXPECT_TRUE(tmp.empty());
+}
+
+TEST(ByteSegment, shared_by_duplicates) {
+    ByteBufferConvertible original { ByteBuffer { 1, 2, 3 } };
+    EXPECT_EQ(nullptr, segment(original));
+
+    ByteBufferConvertible copy1 { original };
+    ByteBufferConvertible copy2 { copy1 };
+    ASSERT_NE(nullptr, segment(copy1));
+    ASSERT_NE(nullptr, segment(copy2));
+    EXPECT_EQ(segment(copy1)->buffer(), segment(copy2)->buffer());
+    EXPECT_EQ(3, segment(copy1)->buffer().use_count());
+
+    // original keeps serving its bytes after they have been moved into shared storage
+    ByteBuffer tmp;
+    original.convert(tmp);
+    EXPECT_EQ((ByteBuffer { 1, 2, 3 }), tmp);
+    EXPECT_EQ(3, original.size());
+
+    // replacing one sharer leaves the others untouched
+    copy1 = ByteBuffer { 7 };
+    copy2.convert(tmp);
+    EXPECT_EQ((ByteBuffer { 1, 2, 3 }), tmp);
+    EXPECT_EQ(2, segment(copy2)->buffer().use_count());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <vanetza/common/lru_cache.hpp>
+#include <stdexcept>
 
 using namespace vanetza;
 
@@ -80,3 +81,22 @@ TEST_F(LruCacheTest, drop_lru)
     EXPECT_EQ(~1, cache[1]);
     EXPECT_EQ(5, generator_calls);
 }
+
+TEST_F(LruCacheTest, throwing_generator)
+{
+    LruCache<int, int> cache([this](int key) {
+        if (key < 0) throw std::domain_error("negative key");
+        ++generator_calls;
+        return ~key;
+    }, 2);
+
+    cache[1];
+    EXPECT_THROW(cache[-1], std::domain_error);
+    cache[2]; // LRU: 1, 2
+    cache[3]; // drop 1, LRU: 2, 3
+    cache[4]; // drop 2, failed key must not occupy capacity
+    EXPECT_EQ(4, generator_calls);
+
+    EXPECT_EQ(~2, cache[2]);
+    EXPECT_EQ(5, generator_calls);
+}
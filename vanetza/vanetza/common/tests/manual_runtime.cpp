@@ -197,3 +197,59 @@ TEST(ManualRuntime, scope)
     r.trigger(minutes(10));
     EXPECT_EQ((std::vector<char> {'e', 'f'}), calls);
 }
+
+TEST(ManualRuntime, same_deadline_order)
+{
+    ManualRuntime r;
+    std::string seq;
+    auto cb = [&seq](char c, Clock::time_point) { seq.push_back(c); };
+
+    namespace ph = std::placeholders;
+    for (char c = 'a'; c <= 'z'; ++c) {
+        r.schedule(minutes(1), std::bind<void>(cb, c, ph::_1));
+    }
+    r.trigger(minutes(1));
+    EXPECT_EQ("abcdefghijklmnopqrstuvwxyz", seq);
+}
+
+TEST(ManualRuntime, cancel_many)
+{
+    ManualRuntime r;
+    unsigned calls = 0;
+    auto cb = [&calls](Clock::time_point) { ++calls; };
+    std::vector<int> scopes(100);
+
+    for (unsigned i = 0; i < 1000; ++i) {
+        r.schedule(seconds(i + 1), cb, &scopes[i % scopes.size()]);
+    }
+    EXPECT_EQ(Clock::time_point { seconds(1) }, r.next());
+
+    // cancel every scope except the last one
+    for (unsigned i = 0; i + 1 < scopes.size(); ++i) {
+        r.cancel(&scopes[i]);
+    }
+    EXPECT_EQ(Clock::time_point { seconds(scopes.size()) }, r.next());
+
+    r.trigger(hours(1));
+    EXPECT_EQ(10, calls);
+    EXPECT_EQ(Clock::time_point::max(), r.next());
+}
+
+TEST(ManualRuntime, cancel_within_callback)
+{
+    ManualRuntime r;
+    std::vector<char> calls;
+    int scope = 0;
+
+    r.schedule(minutes(1), [&](Clock::time_point) {
+        calls.push_back('a');
+        r.cancel(&scope);
+        r.schedule(minutes(1), [&](Clock::time_point) { calls.push_back('c'); }, &scope);
+    });
+    r.schedule(minutes(2), [&](Clock::time_point) { calls.push_back('b'); }, &scope);
+
+    r.trigger(minutes(5));
+    EXPECT_EQ((std::vector<char> {'a'}), calls);
+    r.trigger(minutes(1));
+    EXPECT_EQ((std::vector<char> {'a', 'c'}), calls);
+}
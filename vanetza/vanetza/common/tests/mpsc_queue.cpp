@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/mpsc_queue.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace vanetza;
+
+TEST(BoundedMpscQueue, capacity)
+{
+    BoundedMpscQueue<int> a(1);
+    EXPECT_EQ(2, a.capacity());
+
+    BoundedMpscQueue<int> b(8);
+    EXPECT_EQ(8, b.capacity());
+
+    BoundedMpscQueue<int> c(9);
+    EXPECT_EQ(16, c.capacity());
+}
+
+TEST(BoundedMpscQueue, fifo)
+{
+    BoundedMpscQueue<int> queue(4);
+    int value = 0;
+    EXPECT_FALSE(queue.try_pop(value));
+
+    EXPECT_TRUE(queue.try_push(1));
+    EXPECT_TRUE(queue.try_push(2));
+    EXPECT_TRUE(queue.try_push(3));
+
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(2, value);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(3, value);
+    EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(BoundedMpscQueue, full)
+{
+    BoundedMpscQueue<int> queue(2);
+    EXPECT_TRUE(queue.try_push(1));
+    EXPECT_TRUE(queue.try_push(2));
+    EXPECT_FALSE(queue.try_push(3));
+
+    int value = 0;
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(queue.try_push(3));
+    EXPECT_FALSE(queue.try_push(4));
+}
+
+TEST(BoundedMpscQueue, move_only)
+{
+    BoundedMpscQueue<std::unique_ptr<int>> queue(2);
+    std::unique_ptr<int> in { new int(42) };
+    EXPECT_TRUE(queue.try_push(std::move(in)));
+    EXPECT_FALSE(in);
+
+    std::unique_ptr<int> out;
+    EXPECT_TRUE(queue.try_pop(out));
+    ASSERT_TRUE(out);
+    EXPECT_EQ(42, *out);
+}
+
+TEST(BoundedMpscQueue, concurrent_producers)
+{
+    static const unsigned producers = 4;
+    static const unsigned items = 10000;
+    BoundedMpscQueue<unsigned> queue(64);
+
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (unsigned i = 0; i < items; ++i) {
+                unsigned value = p * items + i;
+                while (!queue.try_push(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // elements of each producer have to arrive in order
+    std::vector<unsigned> next(producers, 0);
+    unsigned received = 0;
+    while (received < producers * items) {
+        unsigned value = 0;
+        if (queue.try_pop(value)) {
+            const unsigned producer = value / items;
+            ASSERT_LT(producer, producers);
+            EXPECT_EQ(next[producer], value % items);
+            next[producer] = value % items + 1;
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    unsigned value = 0;
+    EXPECT_FALSE(queue.try_pop(value));
+}
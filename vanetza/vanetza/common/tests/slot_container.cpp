@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/slot_container.hpp>
+
+using namespace vanetza;
+
+struct ObjectA
+{
+    int a = 1;
+};
+
+struct ObjectB
+{
+    int b = 2;
+};
+
+struct ObjectC
+{
+    int c = 3;
+};
+
+struct Tracked
+{
+    Tracked(int& counter) : instances(counter) { ++instances; }
+    ~Tracked() { --instances; }
+    int& instances;
+};
+
+// ObjectC is not registered, i.e. it is stored in the fallback container
+using Container = SlotContainer<ObjectA, ObjectB, Tracked>;
+
+template<typename T>
+std::unique_ptr<T> create_unique()
+{
+    return std::unique_ptr<T> { new T() };
+}
+
+TEST(SlotContainer, registry)
+{
+    EXPECT_EQ(3, Container::slots);
+    EXPECT_TRUE(Container::is_registered<ObjectA>());
+    EXPECT_TRUE(Container::is_registered<ObjectB>());
+    EXPECT_TRUE(Container::is_registered<Tracked>());
+    EXPECT_FALSE(Container::is_registered<ObjectC>());
+}
+
+TEST(SlotContainer, size)
+{
+    Container c;
+    EXPECT_EQ(0, c.size());
+    EXPECT_TRUE(c.empty());
+
+    c.insert(create_unique<ObjectA>());
+    EXPECT_EQ(1, c.size());
+
+    c.insert(create_unique<ObjectA>());
+    EXPECT_EQ(1, c.size());
+
+    c.insert(create_unique<ObjectB>());
+    EXPECT_EQ(2, c.size());
+
+    c.insert(create_unique<ObjectC>());
+    EXPECT_EQ(3, c.size());
+    EXPECT_FALSE(c.empty());
+
+    c.clear();
+    EXPECT_EQ(0, c.size());
+}
+
+TEST(SlotContainer, insert)
+{
+    Container c;
+    EXPECT_TRUE(c.insert(create_unique<ObjectA>()));
+    EXPECT_FALSE(c.insert(create_unique<ObjectA>()));
+    EXPECT_TRUE(c.insert(create_unique<ObjectB>()));
+    EXPECT_TRUE(c.insert(create_unique<ObjectC>()));
+    EXPECT_FALSE(c.insert(create_unique<ObjectC>()));
+}
+
+TEST(SlotContainer, find)
+{
+    Container c;
+    EXPECT_EQ(nullptr, c.find<ObjectA>());
+    EXPECT_EQ(nullptr, c.find<ObjectC>());
+
+    auto a = create_unique<ObjectA>();
+    ObjectA* pa = a.get();
+    auto b = create_unique<ObjectB>();
+    ObjectB* pb = b.get();
+    auto cc = create_unique<ObjectC>();
+    ObjectC* pc = cc.get();
+
+    c.insert(std::move(a));
+    c.insert(std::move(b));
+    c.insert(std::move(cc));
+    EXPECT_EQ(pa, c.find<ObjectA>());
+    EXPECT_EQ(pb, c.find<ObjectB>());
+    EXPECT_EQ(pc, c.find<ObjectC>());
+
+    const Container& cref = c;
+    EXPECT_EQ(pa, cref.find<ObjectA>());
+    EXPECT_EQ(pc, cref.find<ObjectC>());
+}
+
+TEST(SlotContainer, erase)
+{
+    int instances = 0;
+    Container c;
+    c.insert(std::unique_ptr<Tracked> { new Tracked(instances) });
+    c.insert(create_unique<ObjectA>());
+    ASSERT_EQ(2, c.size());
+    ASSERT_EQ(1, instances);
+    c.erase<ObjectB>();
+    EXPECT_EQ(2, c.size());
+    c.erase<Tracked>();
+    EXPECT_EQ(1, c.size());
+    EXPECT_EQ(0, instances);
+
+    c.insert(create_unique<ObjectB>());
+    c.insert(create_unique<ObjectC>());
+    c.erase<ObjectC>();
+    EXPECT_EQ(2, c.size());
+    EXPECT_NE(nullptr, c.find<ObjectA>());
+    EXPECT_NE(nullptr, c.find<ObjectB>());
+    EXPECT_EQ(nullptr, c.find<ObjectC>());
+}
+
+TEST(SlotContainer, destruction)
+{
+    int instances = 0;
+    {
+        Container c;
+        c.insert(std::unique_ptr<Tracked> { new Tracked(instances) });
+        EXPECT_EQ(1, instances);
+    }
+    EXPECT_EQ(0, instances);
+}
+
+TEST(SlotContainer, move)
+{
+    int instances = 0;
+    Container c1;
+    c1.insert(create_unique<ObjectA>());
+    c1.insert(create_unique<ObjectB>());
+    c1.insert(create_unique<ObjectC>());
+    c1.insert(std::unique_ptr<Tracked> { new Tracked(instances) });
+    ASSERT_EQ(4, c1.size());
+
+    auto* pa = c1.find<ObjectA>();
+    auto* pb = c1.find<ObjectB>();
+    auto* pc = c1.find<ObjectC>();
+
+    Container c2 = std::move(c1);
+    EXPECT_EQ(0, c1.size());
+    EXPECT_EQ(4, c2.size());
+    EXPECT_EQ(pa, c2.find<ObjectA>());
+    EXPECT_EQ(pb, c2.find<ObjectB>());
+    EXPECT_EQ(pc, c2.find<ObjectC>());
+
+    Container c3;
+    c3.insert(create_unique<ObjectA>());
+    c3 = std::move(c2);
+    EXPECT_EQ(0, c2.size());
+    EXPECT_EQ(4, c3.size());
+    EXPECT_EQ(pa, c3.find<ObjectA>());
+    EXPECT_EQ(1, instances);
+    c3.clear();
+    EXPECT_EQ(0, instances);
+}
+
+TEST(SlotContainer, get)
+{
+    Container c;
+    EXPECT_EQ(nullptr, c.find<ObjectA>());
+    ObjectA& a = c.get<ObjectA>();
+    EXPECT_EQ(1, a.a);
+    EXPECT_EQ(&a, c.find<ObjectA>());
+    ObjectC& cc = c.get<ObjectC>();
+    EXPECT_EQ(3, cc.c);
+}
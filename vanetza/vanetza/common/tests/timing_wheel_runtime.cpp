@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/timing_wheel_runtime.hpp>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vanetza;
+using std::chrono::hours;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::minutes;
+using std::chrono::seconds;
+
+TEST(TimingWheelRuntime, default_construction)
+{
+    TimingWheelRuntime r;
+    EXPECT_EQ(std::chrono::milliseconds(0), r.now().time_since_epoch());
+    EXPECT_EQ(Clock::time_point::max(), r.next());
+    EXPECT_EQ(0, r.size());
+}
+
+TEST(TimingWheelRuntime, time_progress)
+{
+    TimingWheelRuntime r;
+
+    const Clock::time_point t1 { hours(27) };
+    r.trigger(t1);
+    EXPECT_EQ(t1, r.now());
+
+    r.trigger(hours(2));
+    EXPECT_EQ(Clock::time_point { hours(29) }, r.now());
+}
+
+TEST(TimingWheelRuntime, next)
+{
+    TimingWheelRuntime r;
+    r.trigger(hours(3));
+    EXPECT_EQ(Clock::time_point::max(), r.next());
+
+    auto cb = [](Clock::time_point) {};
+    r.schedule(milliseconds(20), cb);
+    EXPECT_EQ(Clock::time_point { hours(3) + milliseconds(20) }, r.next());
+
+    // expired callback is due immediately
+    const auto tp = Clock::time_point { hours(2) };
+    r.schedule(tp, cb);
+    EXPECT_EQ(tp, r.next());
+    r.trigger(microseconds(1));
+    EXPECT_EQ(1, r.size());
+
+    // next point is never later than a far deadline
+    r.schedule(hours(2), cb);
+    EXPECT_LE(r.next(), Clock::time_point { hours(3) + milliseconds(20) });
+}
+
+TEST(TimingWheelRuntime, scheduling)
+{
+    TimingWheelRuntime r;
+    r.trigger(hours(5));
+
+    namespace ph = std::placeholders;
+    std::string seq;
+    std::vector<Clock::time_point> deadlines;
+    auto cb = [&seq, &deadlines](const char* str, Clock::time_point deadline) {
+        deadlines.push_back(deadline);
+        seq.append(str);
+    };
+
+    r.schedule(hours(10), std::bind<void>(cb, "1", ph::_1));
+    r.schedule(hours(11), std::bind<void>(cb, "2", ph::_1));
+    r.schedule(hours(11), std::bind<void>(cb, "2", ph::_1));
+    r.schedule(hours(5), std::bind<void>(cb, "3", ph::_1));
+
+    r.trigger(hours(4));
+    EXPECT_EQ("", seq);
+
+    r.trigger(hours(1));
+    EXPECT_EQ("3", seq);
+
+    r.trigger(hours(5));
+    EXPECT_EQ("31", seq);
+
+    // schedule expired callback (immediate invocation at next trigger)
+    r.schedule(Clock::time_point { hours(2) }, std::bind<void>(cb, "4", ph::_1));
+    r.trigger(hours(0));
+    EXPECT_EQ("314", seq);
+
+    r.trigger(hours(5));
+    EXPECT_EQ("31422", seq);
+
+    const std::vector<Clock::time_point> expected_deadlines = {
+        Clock::time_point { hours(10) },
+        Clock::time_point { hours(15) },
+        Clock::time_point { hours(2) },
+        Clock::time_point { hours(16) },
+        Clock::time_point { hours(16) },
+    };
+    EXPECT_EQ(expected_deadlines, deadlines);
+}
+
+TEST(TimingWheelRuntime, sub_tick_precision)
+{
+    TimingWheelRuntime r;
+    std::vector<Clock::time_point> deadlines;
+    auto cb = [&deadlines](Clock::time_point deadline) { deadlines.push_back(deadline); };
+
+    r.schedule(microseconds(1500), cb);
+    r.trigger(microseconds(1200));
+    EXPECT_TRUE(deadlines.empty());
+    EXPECT_EQ(Clock::time_point { microseconds(1500) }, r.next());
+    r.trigger(microseconds(300));
+    ASSERT_EQ(1, deadlines.size());
+    EXPECT_EQ(Clock::time_point { microseconds(1500) }, deadlines.front());
+}
+
+TEST(TimingWheelRuntime, ordering_across_levels)
+{
+    TimingWheelRuntime r;
+    std::vector<int> calls;
+    auto cb = [&calls](int n, Clock::time_point) { calls.push_back(n); };
+
+    namespace ph = std::placeholders;
+    r.schedule(hours(30), std::bind<void>(cb, 6, ph::_1)); // beyond wheel range
+    r.schedule(minutes(20), std::bind<void>(cb, 5, ph::_1));
+    r.schedule(seconds(70), std::bind<void>(cb, 4, ph::_1));
+    r.schedule(milliseconds(4100), std::bind<void>(cb, 3, ph::_1));
+    r.schedule(milliseconds(65), std::bind<void>(cb, 2, ph::_1));
+    r.schedule(milliseconds(3), std::bind<void>(cb, 1, ph::_1));
+    EXPECT_EQ(6, r.size());
+
+    // step in small increments to exercise cascading
+    for (unsigned i = 0; i < 25; ++i) {
+        r.trigger(minutes(1));
+    }
+    EXPECT_EQ((std::vector<int> { 1, 2, 3, 4, 5 }), calls);
+
+    r.trigger(hours(29));
+    EXPECT_EQ((std::vector<int> { 1, 2, 3, 4, 5 }), calls);
+    r.trigger(hours(1));
+    EXPECT_EQ((std::vector<int> { 1, 2, 3, 4, 5, 6 }), calls);
+    EXPECT_EQ(0, r.size());
+}
+
+TEST(TimingWheelRuntime, reschedule_from_callback)
+{
+    TimingWheelRuntime r;
+    unsigned calls = 0;
+    std::function<void(Clock::time_point)> cb = [&](Clock::time_point) {
+        ++calls;
+        r.schedule(milliseconds(100), cb);
+    };
+    r.schedule(milliseconds(100), cb);
+
+    for (unsigned i = 0; i < 100; ++i) {
+        r.trigger(milliseconds(10));
+    }
+    EXPECT_EQ(10, calls);
+    EXPECT_EQ(1, r.size());
+}
+
+TEST(TimingWheelRuntime, cancel)
+{
+    TimingWheelRuntime r;
+    std::vector<char> calls;
+    auto cb = [&calls](char c, Clock::time_point) { calls.push_back(c); };
+
+    // some dummy scopes
+    const int foo = 1;
+    const int bar = 2;
+    const int doe = 3;
+
+    namespace ph = std::placeholders;
+    r.schedule(minutes(3), std::bind<void>(cb, 'a', ph::_1));
+    r.schedule(minutes(4), std::bind<void>(cb, 'b', ph::_1), &foo);
+    r.schedule(minutes(5), std::bind<void>(cb, 'c', ph::_1));
+    r.schedule(minutes(3), std::bind<void>(cb, 'd', ph::_1), &bar);
+    r.schedule(minutes(4), std::bind<void>(cb, 'e', ph::_1));
+    r.schedule(minutes(5), std::bind<void>(cb, 'f', ph::_1), &foo);
+    r.schedule(minutes(6), std::bind<void>(cb, 'g', ph::_1), &doe);
+    r.schedule(minutes(7), std::bind<void>(cb, 'h', ph::_1), nullptr);
+
+    // cancel single callback
+    r.cancel(&bar);
+    r.trigger(minutes(8));
+    EXPECT_EQ((std::vector<char> {'a', 'b', 'e', 'c', 'f', 'g', 'h'}), calls);
+
+    // cancel several callbacks, some of them already due
+    calls.clear();
+    r.schedule(minutes(1), std::bind<void>(cb, 'a', ph::_1), &foo);
+    r.schedule(minutes(1), std::bind<void>(cb, 'b', ph::_1), &bar);
+    r.schedule(minutes(1), std::bind<void>(cb, 'c', ph::_1), &bar);
+    r.schedule(Clock::time_point {}, std::bind<void>(cb, 'd', ph::_1), &foo);
+    r.cancel(&foo);
+    r.cancel(nullptr);
+    r.trigger(minutes(1));
+    EXPECT_EQ((std::vector<char> {'b', 'c'}), calls);
+    EXPECT_EQ(0, r.size());
+}
+
+TEST(TimingWheelRuntime, wakeup_hook)
+{
+    TimingWheelRuntime r;
+    std::vector<Clock::time_point> wakeups;
+    r.wakeup = [&wakeups](Clock::time_point tp) { wakeups.push_back(tp); };
+    auto cb = [](Clock::time_point) {};
+
+    r.schedule(seconds(10), cb);
+    EXPECT_EQ(1, wakeups.size());
+    r.schedule(seconds(20), cb);
+    EXPECT_EQ(1, wakeups.size());
+    r.schedule(seconds(5), cb);
+    EXPECT_EQ(2, wakeups.size());
+
+    r.trigger(seconds(5));
+    r.next();
+    r.schedule(seconds(20), cb);
+    EXPECT_EQ(2, wakeups.size());
+    r.schedule(seconds(1), cb);
+    EXPECT_EQ(3, wakeups.size());
+}
+
+TEST(TimingWheelRuntime, concurrent_scheduling)
+{
+    TimingWheelRuntime r;
+    std::atomic<unsigned> calls { 0 };
+    auto cb = [&calls](Clock::time_point) { ++calls; };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < 4; ++t) {
+        threads.emplace_back([&r, &cb, t]() {
+            int scope = 0;
+            for (unsigned i = 0; i < 1000; ++i) {
+                r.schedule(milliseconds(i % 200 + 1), cb);
+                r.schedule(milliseconds(i % 200 + 1), cb, &scope);
+                r.cancel(&scope);
+            }
+        });
+    }
+
+    for (unsigned i = 0; i < 100; ++i) {
+        r.trigger(microseconds(100));
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    r.trigger(hours(1));
+    EXPECT_EQ(4000, calls);
+    EXPECT_EQ(0, r.size());
+}
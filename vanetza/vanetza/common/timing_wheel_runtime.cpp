@@ -0,0 +1,362 @@
+#include "timing_wheel_runtime.hpp"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <utility>
+
+namespace vanetza
+{
+
+namespace
+{
+
+unsigned highest_bit(std::uint64_t x)
+{
+    assert(x != 0);
+    unsigned bit = 0;
+    while (x >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+
+unsigned lowest_bit(std::uint64_t x)
+{
+    assert(x != 0);
+    unsigned bit = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        ++bit;
+    }
+    return bit;
+}
+
+} // namespace
+
+constexpr TimingWheelRuntime::index_type TimingWheelRuntime::npos;
+constexpr unsigned TimingWheelRuntime::slot_bits;
+constexpr unsigned TimingWheelRuntime::slots;
+constexpr unsigned TimingWheelRuntime::levels;
+constexpr unsigned TimingWheelRuntime::overflow_slot;
+
+TimingWheelRuntime::TimingWheelRuntime(Clock::time_point init, Clock::duration tick) :
+    m_tick_duration(tick), m_now(init), m_tick(0), m_sequence(0), m_pending(0),
+    m_wakeup(Clock::time_point::max()), m_free(npos)
+{
+    assert(m_tick_duration > Clock::duration::zero());
+    m_tick = tick_of(init);
+    m_slots.fill(npos);
+    m_occupied.fill(0);
+}
+
+void TimingWheelRuntime::schedule(Clock::time_point tp, const Callback& cb, const void* scope)
+{
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const index_type index = allocate();
+        Entry& entry = m_entries[index];
+        entry.deadline = tp;
+        entry.tick = tick_of(tp);
+        entry.sequence = m_sequence++;
+        entry.callback = cb;
+        entry.scope = scope;
+        link_scope(index);
+        place(index);
+        ++m_pending;
+
+        if (tp < m_wakeup) {
+            m_wakeup = tp;
+            notify = true;
+        }
+    }
+
+    // invoke hook without lock, it might query the runtime
+    if (notify) {
+        wakeup(tp);
+    }
+}
+
+void TimingWheelRuntime::schedule(Clock::duration d, const Callback& cb, const void* scope)
+{
+    schedule(now() + d, cb, scope);
+}
+
+void TimingWheelRuntime::cancel(const void* scope)
+{
+    if (!scope) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_scopes.find(scope);
+    if (found != m_scopes.end()) {
+        index_type index = found->second;
+        while (index != npos) {
+            const index_type next = m_entries[index].scope_next;
+            if (m_entries[index].location == Location::Wheel) {
+                unlink(index);
+            }
+            // due entries are skipped lazily by their generation
+            release(index);
+            index = next;
+        }
+    }
+}
+
+Clock::time_point TimingWheelRuntime::now() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_now;
+}
+
+std::size_t TimingWheelRuntime::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending;
+}
+
+Clock::time_point TimingWheelRuntime::next() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Clock::time_point next_tp = Clock::time_point::max();
+    if (!m_due.empty()) {
+        // a stale front entry causes an early wake-up only
+        next_tp = m_due.front().deadline;
+    } else {
+        const tick_type tick = next_tick();
+        if (tick != std::numeric_limits<tick_type>::max()) {
+            next_tp = Clock::time_point { m_tick_duration * static_cast<Clock::rep>(tick) };
+        }
+    }
+    m_wakeup = next_tp;
+    return next_tp;
+}
+
+void TimingWheelRuntime::trigger(Clock::time_point tp)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // require monotonic clock
+    assert(tp >= m_now);
+    m_now = tp;
+    advance(tick_of(tp));
+
+    while (!m_due.empty()) {
+        const DueItem top = m_due.front();
+        if (stale(top)) {
+            std::pop_heap(m_due.begin(), m_due.end(), DueOrder());
+            m_due.pop_back();
+        } else if (top.deadline <= m_now) {
+            std::pop_heap(m_due.begin(), m_due.end(), DueOrder());
+            m_due.pop_back();
+            Callback cb = std::move(m_entries[top.index].callback);
+            release(top.index);
+
+            // callback might modify runtime
+            lock.unlock();
+            cb(top.deadline);
+            lock.lock();
+        } else {
+            break;
+        }
+    }
+}
+
+void TimingWheelRuntime::trigger(Clock::duration d)
+{
+    trigger(now() + d);
+}
+
+TimingWheelRuntime::tick_type TimingWheelRuntime::tick_of(Clock::time_point tp) const
+{
+    const Clock::rep count = tp.time_since_epoch().count();
+    return count > 0 ? static_cast<tick_type>(count / m_tick_duration.count()) : 0;
+}
+
+TimingWheelRuntime::tick_type TimingWheelRuntime::next_tick() const
+{
+    tick_type best = std::numeric_limits<tick_type>::max();
+    for (unsigned level = 0; level < levels; ++level) {
+        const unsigned shift = level * slot_bits;
+        const unsigned digit = (m_tick >> shift) & (slots - 1);
+        const std::uint64_t later = digit + 1 < slots ? m_occupied[level] & (~std::uint64_t(0) << (digit + 1)) : 0;
+        if (later) {
+            const tick_type rotation = (m_tick >> (shift + slot_bits)) << (shift + slot_bits);
+            best = std::min(best, rotation | (tick_type(lowest_bit(later)) << shift));
+        }
+    }
+
+    if (m_slots[overflow_slot] != npos) {
+        const tick_type span = tick_type(1) << (levels * slot_bits);
+        best = std::min(best, (m_tick / span + 1) * span);
+    }
+
+    return best;
+}
+
+void TimingWheelRuntime::advance(tick_type target)
+{
+    while (m_tick < target) {
+        const tick_type tick = next_tick();
+        if (tick > target) {
+            m_tick = target;
+        } else {
+            m_tick = tick;
+            cascade();
+        }
+    }
+}
+
+void TimingWheelRuntime::cascade()
+{
+    auto replace = [this](index_type slot) {
+        index_type index = m_slots[slot];
+        m_slots[slot] = npos;
+        if (slot < overflow_slot) {
+            m_occupied[slot / slots] &= ~(std::uint64_t(1) << (slot % slots));
+        }
+        while (index != npos) {
+            const index_type next = m_entries[index].next;
+            place(index);
+            index = next;
+        }
+    };
+
+    const tick_type span = tick_type(1) << (levels * slot_bits);
+    if (m_tick % span == 0 && m_slots[overflow_slot] != npos) {
+        replace(overflow_slot);
+    }
+
+    // redistribute from coarse to fine levels, entries of current tick become due
+    for (unsigned level = levels; level-- > 0;) {
+        const unsigned shift = level * slot_bits;
+        if ((m_tick & ((tick_type(1) << shift) - 1)) == 0) {
+            const unsigned digit = (m_tick >> shift) & (slots - 1);
+            if (m_occupied[level] & (std::uint64_t(1) << digit)) {
+                replace(level * slots + digit);
+            }
+        }
+    }
+}
+
+void TimingWheelRuntime::place(index_type index)
+{
+    Entry& entry = m_entries[index];
+    if (entry.tick <= m_tick) {
+        entry.location = Location::Due;
+        entry.prev = entry.next = npos;
+        m_due.push_back(DueItem { entry.deadline, entry.sequence, index, entry.generation });
+        std::push_heap(m_due.begin(), m_due.end(), DueOrder());
+    } else {
+        // wheel level is determined by the most significant digit differing from current tick
+        const unsigned level = highest_bit(entry.tick ^ m_tick) / slot_bits;
+        if (level < levels) {
+            const unsigned digit = (entry.tick >> (level * slot_bits)) & (slots - 1);
+            link(index, level * slots + digit);
+        } else {
+            link(index, overflow_slot);
+        }
+    }
+}
+
+void TimingWheelRuntime::link(index_type index, index_type slot)
+{
+    Entry& entry = m_entries[index];
+    entry.location = Location::Wheel;
+    entry.slot = slot;
+    entry.prev = npos;
+    entry.next = m_slots[slot];
+    if (entry.next != npos) {
+        m_entries[entry.next].prev = index;
+    }
+    m_slots[slot] = index;
+    if (slot < overflow_slot) {
+        m_occupied[slot / slots] |= std::uint64_t(1) << (slot % slots);
+    }
+}
+
+void TimingWheelRuntime::unlink(index_type index)
+{
+    Entry& entry = m_entries[index];
+    assert(entry.location == Location::Wheel);
+    if (entry.prev != npos) {
+        m_entries[entry.prev].next = entry.next;
+    } else {
+        m_slots[entry.slot] = entry.next;
+        if (entry.next == npos && entry.slot < overflow_slot) {
+            m_occupied[entry.slot / slots] &= ~(std::uint64_t(1) << (entry.slot % slots));
+        }
+    }
+    if (entry.next != npos) {
+        m_entries[entry.next].prev = entry.prev;
+    }
+    entry.prev = entry.next = npos;
+}
+
+void TimingWheelRuntime::link_scope(index_type index)
+{
+    Entry& entry = m_entries[index];
+    entry.scope_prev = entry.scope_next = npos;
+    if (entry.scope) {
+        auto inserted = m_scopes.insert(std::make_pair(entry.scope, index));
+        if (!inserted.second) {
+            entry.scope_next = inserted.first->second;
+            m_entries[entry.scope_next].scope_prev = index;
+            inserted.first->second = index;
+        }
+    }
+}
+
+void TimingWheelRuntime::unlink_scope(index_type index)
+{
+    Entry& entry = m_entries[index];
+    if (!entry.scope) {
+        return;
+    }
+
+    if (entry.scope_prev != npos) {
+        m_entries[entry.scope_prev].scope_next = entry.scope_next;
+    } else if (entry.scope_next != npos) {
+        m_scopes[entry.scope] = entry.scope_next;
+    } else {
+        m_scopes.erase(entry.scope);
+    }
+    if (entry.scope_next != npos) {
+        m_entries[entry.scope_next].scope_prev = entry.scope_prev;
+    }
+    entry.scope_prev = entry.scope_next = npos;
+}
+
+TimingWheelRuntime::index_type TimingWheelRuntime::allocate()
+{
+    index_type index = m_free;
+    if (index != npos) {
+        m_free = m_entries[index].next;
+    } else {
+        index = static_cast<index_type>(m_entries.size());
+        m_entries.emplace_back();
+        m_entries.back().generation = 0;
+    }
+    return index;
+}
+
+void TimingWheelRuntime::release(index_type index)
+{
+    Entry& entry = m_entries[index];
+    assert(entry.location != Location::Free);
+    unlink_scope(index);
+    entry.callback = nullptr;
+    entry.scope = nullptr;
+    entry.location = Location::Free;
+    ++entry.generation;
+    entry.next = m_free;
+    m_free = index;
+    --m_pending;
+}
+
+bool TimingWheelRuntime::stale(const DueItem& item) const
+{
+    return m_entries[item.index].generation != item.generation;
+}
+
+} // namespace vanetza
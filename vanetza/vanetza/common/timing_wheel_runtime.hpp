@@ -0,0 +1,149 @@
+#ifndef TIMING_WHEEL_RUNTIME_HPP_QW7RBN2E
+#define TIMING_WHEEL_RUNTIME_HPP_QW7RBN2E
+
+#include <vanetza/common/hook.hpp>
+#include <vanetza/common/runtime.hpp>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vanetza
+{
+
+/**
+ * TimingWheelRuntime is a Runtime implementation based on a hierarchical timing wheel.
+ *
+ * Scheduling and cancellation take constant time and are safe to be invoked from any thread.
+ * Time progress is triggered externally like ManualRuntime, e.g. by a single asio timer.
+ * Only one thread shall call trigger at a time, callbacks are invoked by this thread.
+ */
+class TimingWheelRuntime : public Runtime
+{
+public:
+    /**
+     * Create runtime
+     * \param init initialization value of internal clock
+     * \param tick granularity of timing wheel slots
+     */
+    explicit TimingWheelRuntime(Clock::time_point init = Clock::time_point {},
+            Clock::duration tick = std::chrono::milliseconds(1));
+
+    TimingWheelRuntime(const TimingWheelRuntime&) = delete;
+    TimingWheelRuntime& operator=(const TimingWheelRuntime&) = delete;
+
+    /**
+     * Trigger absolute time progress
+     *
+     * All expired callbacks will be invoked
+     * \param tp new time point, has to be greater than now
+     */
+    void trigger(Clock::time_point tp);
+
+    /**
+     * Trigger relative time progress
+     *
+     * All expired callbacks will be invoked
+     * \param d advance time by this duration
+     */
+    void trigger(Clock::duration d);
+
+    /**
+     * Get time point when runtime needs to be triggered next
+     * \note time point might be earlier than the next callback's deadline
+     * \return time point of next wheel event or time_point::max if none
+     */
+    Clock::time_point next() const;
+
+    /**
+     * Get number of pending callbacks
+     * \return number of scheduled callbacks
+     */
+    std::size_t size() const;
+
+    /**
+     * Wake-up hook is invoked by the scheduling thread whenever a callback has been
+     * scheduled earlier than the time point returned by the most recent next() call.
+     * Drivers can use it to re-arm their timer, hook callback must be thread-safe.
+     */
+    Hook<Clock::time_point> wakeup;
+
+    // Runtime interface (see header there for details)
+    void schedule(Clock::time_point, const Callback&, const void* = nullptr) override;
+    void schedule(Clock::duration, const Callback&, const void* = nullptr) override;
+    void cancel(const void* scope) override;
+    Clock::time_point now() const override;
+
+private:
+    using index_type = std::uint32_t;
+    using tick_type = std::uint64_t;
+    static constexpr index_type npos = ~index_type(0);
+    static constexpr unsigned slot_bits = 6;
+    static constexpr unsigned slots = 1 << slot_bits;
+    static constexpr unsigned levels = 4;
+    static constexpr unsigned overflow_slot = levels * slots;
+
+    enum class Location : std::uint8_t { Free, Wheel, Due };
+
+    struct Entry
+    {
+        Clock::time_point deadline;
+        tick_type tick;
+        std::uint64_t sequence;
+        Callback callback;
+        const void* scope;
+        index_type slot;
+        index_type prev, next;
+        index_type scope_prev, scope_next;
+        std::uint32_t generation;
+        Location location;
+    };
+
+    struct DueItem
+    {
+        Clock::time_point deadline;
+        std::uint64_t sequence;
+        index_type index;
+        std::uint32_t generation;
+    };
+
+    struct DueOrder
+    {
+        bool operator()(const DueItem& a, const DueItem& b) const
+        {
+            return a.deadline > b.deadline || (a.deadline == b.deadline && a.sequence > b.sequence);
+        }
+    };
+
+    tick_type tick_of(Clock::time_point) const;
+    tick_type next_tick() const;
+    void advance(tick_type target);
+    void cascade();
+    void place(index_type);
+    void link(index_type, index_type slot);
+    void unlink(index_type);
+    void link_scope(index_type);
+    void unlink_scope(index_type);
+    index_type allocate();
+    void release(index_type);
+    bool stale(const DueItem&) const;
+
+    mutable std::mutex m_mutex;
+    const Clock::duration m_tick_duration;
+    Clock::time_point m_now;
+    tick_type m_tick;
+    std::uint64_t m_sequence;
+    std::size_t m_pending;
+    mutable Clock::time_point m_wakeup;
+    std::vector<Entry> m_entries;
+    index_type m_free;
+    std::array<index_type, overflow_slot + 1> m_slots;
+    std::array<std::uint64_t, levels> m_occupied;
+    std::vector<DueItem> m_due;
+    std::unordered_map<const void*, index_type> m_scopes;
+};
+
+} // namespace vanetza
+
+#endif /* TIMING_WHEEL_RUNTIME_HPP_QW7RBN2E */
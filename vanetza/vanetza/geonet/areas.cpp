@@ -1,9 +1,8 @@
 #include "areas.hpp"
+#include "local_tangent_plane.hpp"
 #include <boost/math/constants/constants.hpp>
 #include <boost/units/cmath.hpp>
-#include <GeographicLib/Geocentric.hpp>
 #include <GeographicLib/Geodesic.hpp>
-#include <GeographicLib/LocalCartesian.hpp>
 #include <algorithm>
 #include <cassert>
 #include <limits>
@@ -74,19 +73,7 @@ CartesianPosition local_cartesian(
         const GeodeticPosition& origin,
         const GeodeticPosition& position)
 {
-    namespace si = units::si;
-    using namespace GeographicLib;
-    const Geocentric& earth = Geocentric::WGS84();
-    LocalCartesian proj {
-            origin.latitude / units::degree,
-            origin.longitude / units::degree,
-            0.0, earth
-    };
-    double result_x, result_y, unused_z = 0.0;
-    proj.Forward(position.latitude / units::degree,
-            position.longitude / units::degree, 0.0,
-            result_x, result_y, unused_z);
-    return CartesianPosition(result_x * si::meter, result_y * si::meter);
+    return LocalTangentPlane(origin).project(position);
 }
 
 CartesianPosition canonicalize(const CartesianPosition& point, units::Angle azimuth)
@@ -27,6 +27,8 @@ struct DataIndication
     TrafficClass traffic_class;
     boost::optional<Lifetime> remaining_packet_lifetime;
     boost::optional<unsigned> remaining_hop_limit;
+    int rssi = -255; // received signal strength reported by link layer
+    double time_received = -1.0; // reception time reported by link layer
 };
 
 } // namespace geonet
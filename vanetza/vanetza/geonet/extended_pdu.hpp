@@ -6,9 +6,7 @@
 #include <vanetza/geonet/pdu.hpp>
 #include <vanetza/geonet/serialization.hpp>
 #include <vanetza/common/byte_buffer.hpp>
-#include <vanetza/common/byte_buffer_sink.hpp>
 #include <vanetza/security/secured_message.hpp>
-#include <boost/iostreams/stream.hpp>
 #include <boost/optional/optional.hpp>
 #include <memory>
 
@@ -113,15 +111,11 @@ template<class HEADER>
 ByteBuffer convert_for_signing(const ExtendedPdu<HEADER>& pdu)
 {
     ByteBuffer buf;
-    byte_buffer_sink sink(buf);
-
-    boost::iostreams::stream_buffer<byte_buffer_sink> stream(sink);
-    OutputArchive ar(stream);
+    buf.reserve(CommonHeader::length_bytes + HEADER::length_bytes);
+    OutputArchive ar(buf);
 
     serialize(pdu.common(), ar);
     serialize(pdu.extended(), ar);
-
-    stream.close();
     return buf;
 }
 
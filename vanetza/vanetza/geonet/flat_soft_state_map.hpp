@@ -0,0 +1,402 @@
+#ifndef FLAT_SOFT_STATE_MAP_HPP_H6ZR2NQD
+#define FLAT_SOFT_STATE_MAP_HPP_H6ZR2NQD
+
+#include <vanetza/common/clock.hpp>
+#include <vanetza/common/runtime.hpp>
+#include <vanetza/geonet/soft_state_map.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/range/iterator_range_core.hpp>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vanetza
+{
+namespace geonet
+{
+
+/**
+ * FlatSoftStateMap is a map data structure with expiring entries like SoftStateMap.
+ *
+ * Entries are stored in an open-addressing table with linear probing: keys and expiry stamps
+ * are kept in a compact control array separated from the (larger) values, so lookups touch only
+ * a few cache lines. Expired entries are found by a coarse timing wheel instead of a heap.
+ *
+ * \note Unlike SoftStateMap, references to values are invalidated by insertions and drop_expired()
+ * \tparam KEY key type, std::hash<KEY> is used for hashing
+ * \tparam VALUE mapped type, needs to be move constructible
+ * \tparam CTOR optional creator of values
+ */
+template<typename KEY, typename VALUE, typename CTOR = SoftStateDefaultCreator<VALUE>>
+class FlatSoftStateMap
+{
+public:
+    using key_type = KEY;
+    using mapped_type = VALUE;
+    using value_type = std::pair<const key_type&, mapped_type&>;
+    using creator_type = CTOR;
+
+    static constexpr std::size_t wheel_buckets = 256;
+    static constexpr Clock::duration wheel_granularity = std::chrono::milliseconds(100);
+
+private:
+    struct Control
+    {
+        key_type key;
+        Clock::time_point expiry;
+        bool occupied = false;
+    };
+
+    template<typename MAP, typename REFERENCE>
+    class Iterator : public boost::iterator_facade<Iterator<MAP, REFERENCE>, REFERENCE, boost::forward_traversal_tag, REFERENCE>
+    {
+    public:
+        Iterator() : m_map(nullptr), m_slot(0) {}
+        Iterator(MAP* map, std::size_t slot) : m_map(map), m_slot(slot) { skip(); }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment()
+        {
+            ++m_slot;
+            skip();
+        }
+
+        bool equal(const Iterator& other) const
+        {
+            return m_slot == other.m_slot;
+        }
+
+        REFERENCE dereference() const
+        {
+            return REFERENCE { m_map->m_controls[m_slot].key, *m_map->m_values[m_slot] };
+        }
+
+        // move forward to next occupied and non-expired slot
+        void skip()
+        {
+            const std::size_t end = m_map->m_controls.size();
+            while (m_slot < end && !m_map->is_alive(m_map->m_controls[m_slot])) {
+                ++m_slot;
+            }
+        }
+
+        MAP* m_map;
+        std::size_t m_slot;
+    };
+
+    using iterator = Iterator<FlatSoftStateMap, value_type>;
+
+public:
+    /**
+     * Construct FlatSoftStateMap
+     * \param rt runtime object
+     * \note This constructor is only available if CTOR is default constructible
+     */
+    template<typename T = CTOR>
+    FlatSoftStateMap(const Runtime& rt, typename std::enable_if<std::is_default_constructible<T>::value>::type* = nullptr) :
+        m_runtime(rt), m_lifetime(Clock::duration::zero()), m_size(0), m_shift(0),
+        m_wheel(wheel_buckets), m_wheel_cursor(tick(rt.now()))
+    {
+    }
+
+    /**
+     * Construct FlatSoftStateMap
+     * \param rt runtime object
+     * \param ctor value creator
+     */
+    FlatSoftStateMap(const Runtime& rt, creator_type&& ctor) :
+        m_runtime(rt), m_lifetime(Clock::duration::zero()), m_creator(std::move(ctor)), m_size(0), m_shift(0),
+        m_wheel(wheel_buckets), m_wheel_cursor(tick(rt.now()))
+    {
+    }
+
+    /**
+     * Set lifetime duration used for new and refreshed entries
+     * \param lifetime entry lifetime
+     */
+    void set_lifetime(Clock::duration lifetime)
+    {
+        m_lifetime = lifetime;
+    }
+
+    /**
+     * Get value mapped to key
+     * \param key
+     * \return existing value entry or just created entry
+     */
+    mapped_type& get_value(const key_type& key)
+    {
+        return *m_values[get_slot(key)];
+    }
+
+    /**
+     * Get non-expired value pointer mapped to key
+     * \param key
+     * \return pointer to value or nullptr if not existing
+     */
+    mapped_type* get_value_ptr(const key_type& key)
+    {
+        const std::size_t slot = find(key);
+        return slot != npos && !is_expired(m_controls[slot]) ? &*m_values[slot] : nullptr;
+    }
+
+    /**
+     * Get non-expired value pointer mapped to key
+     * \param key
+     * \return pointer to value or nullptr if not existing
+     */
+    const mapped_type* get_value_ptr(const key_type& key) const
+    {
+        const std::size_t slot = find(key);
+        return slot != npos && !is_expired(m_controls[slot]) ? &*m_values[slot] : nullptr;
+    }
+
+    /**
+     * Check if non-expired value for given key exists
+     * \param key
+     * \return true if entry exists
+     */
+    bool has_value(const key_type& key) const
+    {
+        return get_value_ptr(key) != nullptr;
+    }
+
+    /**
+     * Refresh lifetime of entry associated with given key
+     * \param key
+     * \return associated value (might have been created)
+     */
+    mapped_type& refresh(const key_type& key)
+    {
+        std::size_t slot = find(key);
+        if (slot != npos) {
+            m_controls[slot].expiry = m_runtime.now() + m_lifetime;
+        } else {
+            slot = get_slot(key);
+        }
+        return *m_values[slot];
+    }
+
+    /**
+     * Drop all entries with expired lifetime.
+     * Expired but still stored entries are only hided at retrieval until calling this method.
+     */
+    void drop_expired()
+    {
+        drop_expired([](const key_type&) {});
+    }
+
+    /**
+     * Drop all entries with expired lifetime and report their keys
+     * \param on_drop invoked with key of each dropped entry
+     */
+    template<typename F>
+    void drop_expired(F on_drop)
+    {
+        const std::uint64_t now_tick = tick(m_runtime.now());
+        std::uint64_t first_tick = m_wheel_cursor;
+        if (now_tick < first_tick) {
+            first_tick = now_tick;
+        } else if (now_tick - first_tick >= wheel_buckets) {
+            first_tick = now_tick - wheel_buckets + 1;
+        }
+
+        // Keys stay in the bucket they have been inserted into when their entries are refreshed.
+        // Entries found alive while draining a bucket are moved to the bucket of their current expiry.
+        for (std::uint64_t t = first_tick; t <= now_tick; ++t) {
+            m_drained.clear();
+            m_drained.swap(m_wheel[t % wheel_buckets]);
+            for (const key_type& key : m_drained) {
+                const std::size_t slot = find(key);
+                assert(slot != npos);
+                if (is_expired(m_controls[slot])) {
+                    on_drop(key);
+                    erase(slot);
+                } else {
+                    schedule(key, m_controls[slot].expiry);
+                }
+            }
+        }
+        m_wheel_cursor = now_tick;
+    }
+
+    using map_range = boost::iterator_range<iterator>;
+
+    /**
+     * Create a range of all non-expired entries mimicking STL's map interface
+     */
+    map_range map()
+    {
+        return map_range { iterator { this, 0 }, iterator { this, m_controls.size() } };
+    }
+
+    const map_range map() const
+    {
+        return const_cast<FlatSoftStateMap*>(this)->map();
+    }
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static constexpr std::size_t initial_capacity = 16;
+
+    static std::uint64_t tick(Clock::time_point tp)
+    {
+        return tp.time_since_epoch() / wheel_granularity;
+    }
+
+    std::size_t home_slot(const key_type& key) const
+    {
+        // Fibonacci hashing spreads weak hash values (e.g. identity) over the whole table
+        const std::uint64_t hash = static_cast<std::uint64_t>(std::hash<key_type>()(key));
+        return static_cast<std::size_t>((hash * UINT64_C(0x9E3779B97F4A7C15)) >> m_shift);
+    }
+
+    std::size_t next_slot(std::size_t slot) const
+    {
+        return (slot + 1) & (m_controls.size() - 1);
+    }
+
+    std::size_t find(const key_type& key) const
+    {
+        if (m_size == 0) {
+            return npos;
+        }
+
+        for (std::size_t slot = home_slot(key);; slot = next_slot(slot)) {
+            const Control& control = m_controls[slot];
+            if (!control.occupied) {
+                return npos;
+            } else if (control.key == key) {
+                return slot;
+            }
+        }
+    }
+
+    std::size_t get_slot(const key_type& key)
+    {
+        std::size_t slot = find(key);
+        if (slot == npos) {
+            slot = insert(key, m_creator());
+        } else if (is_expired(m_controls[slot])) {
+            // resurrect this data element, i.e. pretend it has just been created
+            m_controls[slot].expiry = m_runtime.now() + m_lifetime;
+        }
+        return slot;
+    }
+
+    std::size_t insert(const key_type& key, mapped_type&& value)
+    {
+        // keep load factor at or below 3/4
+        if (4 * (m_size + 1) > 3 * m_controls.size()) {
+            grow();
+        }
+
+        std::size_t slot = home_slot(key);
+        while (m_controls[slot].occupied) {
+            slot = next_slot(slot);
+        }
+
+        Control& control = m_controls[slot];
+        control.key = key;
+        control.expiry = m_runtime.now() + m_lifetime;
+        control.occupied = true;
+        m_values[slot].emplace(std::move(value));
+        ++m_size;
+        schedule(key, control.expiry);
+        return slot;
+    }
+
+    void grow()
+    {
+        const std::size_t capacity = m_controls.empty() ? initial_capacity : 2 * m_controls.size();
+        std::vector<Control> controls(capacity);
+        std::vector<boost::optional<mapped_type>> values(capacity);
+        controls.swap(m_controls);
+        values.swap(m_values);
+
+        m_shift = 64;
+        for (std::size_t c = capacity; c > 1; c >>= 1) {
+            --m_shift;
+        }
+
+        for (std::size_t i = 0; i < controls.size(); ++i) {
+            if (controls[i].occupied) {
+                std::size_t slot = home_slot(controls[i].key);
+                while (m_controls[slot].occupied) {
+                    slot = next_slot(slot);
+                }
+                m_controls[slot] = controls[i];
+                m_values[slot].emplace(std::move(*values[i]));
+            }
+        }
+    }
+
+    void erase(std::size_t slot)
+    {
+        // backward shift deletion keeps probe sequences free of tombstones
+        std::size_t hole = slot;
+        for (std::size_t next = next_slot(hole); m_controls[next].occupied; next = next_slot(next)) {
+            const std::size_t home = home_slot(m_controls[next].key);
+            // move entry into hole only if hole lies cyclically within [home, next)
+            const bool movable = hole <= next ? (home <= hole || home > next) : (home <= hole && home > next);
+            if (movable) {
+                m_controls[hole] = m_controls[next];
+                m_values[hole] = boost::none;
+                m_values[hole].emplace(std::move(*m_values[next]));
+                hole = next;
+            }
+        }
+
+        m_controls[hole].occupied = false;
+        m_values[hole] = boost::none;
+        --m_size;
+    }
+
+    void schedule(const key_type& key, Clock::time_point expiry)
+    {
+        m_wheel[tick(expiry) % wheel_buckets].push_back(key);
+    }
+
+    bool is_expired(const Control& control) const
+    {
+        return m_runtime.now() > control.expiry;
+    }
+
+    bool is_alive(const Control& control) const
+    {
+        return control.occupied && !is_expired(control);
+    }
+
+    const Runtime& m_runtime;
+    Clock::duration m_lifetime;
+    creator_type m_creator;
+    std::vector<Control> m_controls;
+    std::vector<boost::optional<mapped_type>> m_values;
+    std::size_t m_size;
+    unsigned m_shift;
+    std::vector<std::vector<key_type>> m_wheel;
+    std::vector<key_type> m_drained;
+    std::uint64_t m_wheel_cursor;
+};
+
+template<typename KEY, typename VALUE, typename CTOR>
+constexpr std::size_t FlatSoftStateMap<KEY, VALUE, CTOR>::wheel_buckets;
+
+template<typename KEY, typename VALUE, typename CTOR>
+constexpr Clock::duration FlatSoftStateMap<KEY, VALUE, CTOR>::wheel_granularity;
+
+template<typename KEY, typename VALUE, typename CTOR>
+constexpr std::size_t FlatSoftStateMap<KEY, VALUE, CTOR>::npos;
+
+} // namespace geonet
+} // namespace vanetza
+
+#endif /* FLAT_SOFT_STATE_MAP_HPP_H6ZR2NQD */
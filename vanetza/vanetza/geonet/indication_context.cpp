@@ -12,6 +12,9 @@ IndicationContextDeserialize::IndicationContextDeserialize(UpPacketPtr packet, C
     m_packet(std::move(packet)), m_cohesive_packet(cohesive),
     m_parser(cohesive[OsiLayer::Network])
 {
+    // pass reception info up without copying the packet
+    m_service_primitive.rssi = cohesive.rssi;
+    m_service_primitive.time_received = cohesive.time_received;
 }
 
 const BasicHeader* IndicationContextDeserialize::parse_basic()
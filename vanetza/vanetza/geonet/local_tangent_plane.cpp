@@ -0,0 +1,91 @@
+#include <vanetza/geonet/local_tangent_plane.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+
+namespace vanetza
+{
+namespace geonet
+{
+namespace
+{
+
+// WGS84 ellipsoid
+const double semi_major_axis = 6378137.0;
+const double flattening = 1.0 / 298.257223563;
+const double eccentricity_squared = flattening * (2.0 - flattening);
+
+double prime_vertical_radius(double sin_latitude)
+{
+    return semi_major_axis / std::sqrt(1.0 - eccentricity_squared * sin_latitude * sin_latitude);
+}
+
+} // namespace
+
+LocalTangentPlane::LocalTangentPlane()
+{
+    reset(GeodeticPosition());
+}
+
+LocalTangentPlane::LocalTangentPlane(const GeodeticPosition& origin)
+{
+    reset(origin);
+}
+
+void LocalTangentPlane::reset(const GeodeticPosition& origin)
+{
+    using boost::math::double_constants::degree;
+    m_origin = origin;
+    const double latitude = origin.latitude / units::degree * degree;
+    m_longitude = origin.longitude / units::degree * degree;
+    m_sin_latitude = std::sin(latitude);
+    m_cos_latitude = std::cos(latitude);
+    const double radius = prime_vertical_radius(m_sin_latitude);
+    m_radius_sin = radius * (1.0 - eccentricity_squared) * m_sin_latitude;
+    m_radius_cos = radius * m_cos_latitude;
+}
+
+CartesianPosition LocalTangentPlane::project(const GeodeticPosition& position) const
+{
+    const double latitude = position.latitude / units::degree;
+    const double longitude = position.longitude / units::degree;
+    double x = 0.0;
+    double y = 0.0;
+    project(1, &latitude, &longitude, &x, &y);
+    return CartesianPosition(x * units::si::meter, y * units::si::meter);
+}
+
+void LocalTangentPlane::project(std::size_t count, const double* latitudes, const double* longitudes, double* xs, double* ys) const
+{
+    using boost::math::double_constants::degree;
+
+    // Geocentric coordinates are rotated about the polar axis by the origin's longitude first,
+    // which keeps the subtraction of nearby large coordinates well conditioned.
+    // Loop body is free of branches and dependencies between iterations.
+    for (std::size_t i = 0; i < count; ++i) {
+        const double latitude = latitudes[i] * degree;
+        const double delta_longitude = longitudes[i] * degree - m_longitude;
+        const double sin_latitude = std::sin(latitude);
+        const double cos_latitude = std::cos(latitude);
+        const double radius = prime_vertical_radius(sin_latitude);
+
+        const double dx = radius * cos_latitude * std::cos(delta_longitude) - m_radius_cos;
+        const double dy = radius * cos_latitude * std::sin(delta_longitude);
+        const double dz = radius * (1.0 - eccentricity_squared) * sin_latitude - m_radius_sin;
+
+        xs[i] = dy;
+        ys[i] = m_cos_latitude * dz - m_sin_latitude * dx;
+    }
+}
+
+units::Length LocalTangentPlane::distance(const GeodeticPosition& lhs, const GeodeticPosition& rhs) const
+{
+    const double latitudes[2] = { lhs.latitude / units::degree, rhs.latitude / units::degree };
+    const double longitudes[2] = { lhs.longitude / units::degree, rhs.longitude / units::degree };
+    double xs[2];
+    double ys[2];
+    project(2, latitudes, longitudes, xs, ys);
+    return std::hypot(xs[0] - xs[1], ys[0] - ys[1]) * units::si::meter;
+}
+
+} // namespace geonet
+} // namespace vanetza
@@ -0,0 +1,70 @@
+#ifndef LOCAL_TANGENT_PLANE_HPP_Q3ZB8MVD
+#define LOCAL_TANGENT_PLANE_HPP_Q3ZB8MVD
+
+#include <vanetza/geonet/areas.hpp>
+#include <vanetza/units/length.hpp>
+#include <cstddef>
+
+namespace vanetza
+{
+namespace geonet
+{
+
+/**
+ * LocalTangentPlane projects WGS84 positions onto the east-north plane touching the ellipsoid at its origin.
+ *
+ * Projection is equivalent to local_cartesian (ENU at zero height), but the origin's
+ * trigonometric terms are computed only once, i.e. when the origin is set.
+ * Planar distances deviate from geodesic distances by less than a millimetre within a few kilometres around origin.
+ */
+class LocalTangentPlane
+{
+public:
+    LocalTangentPlane();
+    explicit LocalTangentPlane(const GeodeticPosition& origin);
+
+    /**
+     * Move plane's origin
+     * \param origin new origin
+     */
+    void reset(const GeodeticPosition& origin);
+
+    const GeodeticPosition& origin() const { return m_origin; }
+
+    /**
+     * Project a single position
+     * \param position WGS84 position
+     * \return cartesian position relative to origin
+     */
+    CartesianPosition project(const GeodeticPosition& position) const;
+
+    /**
+     * Project several positions given as structure of arrays
+     * \param count number of positions
+     * \param latitudes latitudes in degrees
+     * \param longitudes longitudes in degrees
+     * \param xs east coordinates in meters (output)
+     * \param ys north coordinates in meters (output)
+     */
+    void project(std::size_t count, const double* latitudes, const double* longitudes, double* xs, double* ys) const;
+
+    /**
+     * Get planar distance between two positions
+     * \note accurate only if both positions are close to origin
+     * \return distance of projected positions
+     */
+    units::Length distance(const GeodeticPosition& lhs, const GeodeticPosition& rhs) const;
+
+private:
+    GeodeticPosition m_origin;
+    double m_longitude; /*< origin's longitude in radians */
+    double m_sin_latitude;
+    double m_cos_latitude;
+    double m_radius_sin; /*< origin's prime vertical radius times sine of latitude */
+    double m_radius_cos; /*< origin's prime vertical radius times cosine of latitude */
+};
+
+} // namespace geonet
+} // namespace vanetza
+
+#endif /* LOCAL_TANGENT_PLANE_HPP_Q3ZB8MVD */
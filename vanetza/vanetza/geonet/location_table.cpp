@@ -92,18 +92,21 @@ void LocationTableEntry::set_neighbour(bool flag, Clock::duration expiry)
 }
 
 
-LocationTable::LocationTable(const MIB& mib, Runtime& rt) :
+template<template<typename, typename, typename> class MAP>
+BasicLocationTable<MAP>::BasicLocationTable(const MIB& mib, Runtime& rt) :
     m_table(rt, LocationTableEntryCreator(rt))
 {
     m_table.set_lifetime(std::chrono::seconds(mib.itsGnLifetimeLocTE / units::si::seconds));
 }
 
-bool LocationTable::has_entry(const Address& addr) const
+template<template<typename, typename, typename> class MAP>
+bool BasicLocationTable<MAP>::has_entry(const Address& addr) const
 {
     return m_table.has_value(addr.mid());
 }
 
-bool LocationTable::has_neighbours() const
+template<template<typename, typename, typename> class MAP>
+bool BasicLocationTable<MAP>::has_neighbours() const
 {
     bool found_neighbour = false;
     for (const auto& entry : m_table.map()) {
@@ -115,7 +118,8 @@ bool LocationTable::has_neighbours() const
     return found_neighbour;
 }
 
-auto LocationTable::neighbours() const -> neighbour_range
+template<template<typename, typename, typename> class MAP>
+auto BasicLocationTable<MAP>::neighbours() const -> neighbour_range
 {
     const entry_predicate neighbour_predicate =
         [](const MacAddress&, const LocationTableEntry& entry) {
@@ -124,7 +128,8 @@ auto LocationTable::neighbours() const -> neighbour_range
     return filter(neighbour_predicate);
 }
 
-auto LocationTable::filter(const entry_predicate& predicate) const -> entry_range
+template<template<typename, typename, typename> class MAP>
+auto BasicLocationTable<MAP>::filter(const entry_predicate& predicate) const -> entry_range
 {
     using namespace boost::adaptors;
     std::function<bool(const typename table_type::value_type&)> filter_fn =
@@ -134,53 +139,112 @@ auto LocationTable::filter(const entry_predicate& predicate) const -> entry_rang
     return m_table.map() | filtered(filter_fn) | map_values;
 }
 
-void LocationTable::visit(const entry_visitor& visitor) const
+template<template<typename, typename, typename> class MAP>
+void BasicLocationTable<MAP>::visit(const entry_visitor& visitor) const
 {
     for (const auto& entry : m_table.map()) {
         visitor(entry.first, entry.second);
     }
 }
 
-LocationTableEntry& LocationTable::update(const LongPositionVector& lpv)
+template<template<typename, typename, typename> class MAP>
+void BasicLocationTable<MAP>::drop_expired()
 {
-    LocationTableEntry* entry = m_table.get_value_ptr(lpv.gn_addr.mid());
+    m_table.drop_expired([this](const MacAddress& mac) { m_index.remove(mac); });
+}
+
+template<template<typename, typename, typename> class MAP>
+const LocationTableEntry* BasicLocationTable<MAP>::get_neighbour(const MacAddress& mac) const
+{
+    const LocationTableEntry* entry = m_table.get_value_ptr(mac);
+    return entry && entry->is_neighbour() && entry->has_position_vector() ? entry : nullptr;
+}
+
+template<template<typename, typename, typename> class MAP>
+const LocationTableEntry* BasicLocationTable<MAP>::closest_neighbour(const GeodeticPosition& position, units::Length limit) const
+{
+    const LocationTableEntry* closest = nullptr;
+    auto evaluate = [&](const MacAddress& mac) -> boost::optional<units::Length> {
+        boost::optional<units::Length> dist;
+        const LocationTableEntry* entry = get_neighbour(mac);
+        if (entry) {
+            dist = distance(position, entry->get_position_vector().position());
+        }
+        return dist;
+    };
+
+    auto found = m_index.closest(position, limit, evaluate);
+    if (found) {
+        closest = get_neighbour(found->first);
+    }
+    return closest;
+}
+
+template<template<typename, typename, typename> class MAP>
+void BasicLocationTable<MAP>::visit_neighbours(const GeodeticPosition& position, units::Length radius, const entry_visitor& visitor) const
+{
+    m_index.candidates(position, radius, [&](const MacAddress& mac) {
+        const LocationTableEntry* entry = get_neighbour(mac);
+        if (entry && distance(position, entry->get_position_vector().position()) <= radius) {
+            visitor(mac, *entry);
+        }
+    });
+}
+
+template<template<typename, typename, typename> class MAP>
+LocationTableEntry& BasicLocationTable<MAP>::update(const LongPositionVector& lpv)
+{
+    const MacAddress& mac = lpv.gn_addr.mid();
+    LocationTableEntry* entry = m_table.get_value_ptr(mac);
+    bool updated = false;
     if (entry && entry->has_position_vector()) {
         if (entry->update_position_vector(lpv)) {
-            m_table.refresh(lpv.gn_addr.mid());
+            m_table.refresh(mac);
+            updated = true;
         }
     } else {
-        entry = &m_table.refresh(lpv.gn_addr.mid());
-        entry->update_position_vector(lpv);
+        entry = &m_table.refresh(mac);
+        updated = entry->update_position_vector(lpv);
+    }
+
+    if (updated) {
+        m_index.update(mac, entry->get_position_vector().position());
     }
     return *entry;
 }
 
-LocationTableEntry& LocationTable::get_or_create_entry(const Address& addr)
+template<template<typename, typename, typename> class MAP>
+LocationTableEntry& BasicLocationTable<MAP>::get_or_create_entry(const Address& addr)
 {
     return m_table.get_value(addr.mid());
 }
 
-LocationTableEntry& LocationTable::get_or_create_entry(const MacAddress& mac)
+template<template<typename, typename, typename> class MAP>
+LocationTableEntry& BasicLocationTable<MAP>::get_or_create_entry(const MacAddress& mac)
 {
     return m_table.get_value(mac);
 }
 
-const LocationTableEntry* LocationTable::get_entry(const Address& addr) const
+template<template<typename, typename, typename> class MAP>
+const LocationTableEntry* BasicLocationTable<MAP>::get_entry(const Address& addr) const
 {
     return m_table.get_value_ptr(addr.mid());
 }
 
-const LocationTableEntry* LocationTable::get_entry(const MacAddress& mac) const
+template<template<typename, typename, typename> class MAP>
+const LocationTableEntry* BasicLocationTable<MAP>::get_entry(const MacAddress& mac) const
 {
     return m_table.get_value_ptr(mac);
 }
 
-const LongPositionVector* LocationTable::get_position(const Address& addr) const
+template<template<typename, typename, typename> class MAP>
+const LongPositionVector* BasicLocationTable<MAP>::get_position(const Address& addr) const
 {
     return get_position(addr.mid());
 }
 
-const LongPositionVector* LocationTable::get_position(const MacAddress& mac) const
+template<template<typename, typename, typename> class MAP>
+const LongPositionVector* BasicLocationTable<MAP>::get_position(const MacAddress& mac) const
 {
     const LongPositionVector* position = nullptr;
     auto* entry = m_table.get_value_ptr(mac);
@@ -190,6 +254,9 @@ const LongPositionVector* LocationTable::get_position(const MacAddress& mac) con
     return position;
 }
 
+template class BasicLocationTable<SoftStateMap>;
+template class BasicLocationTable<FlatSoftStateMap>;
+
 } // namespace geonet
 } // namespace vanetza
 
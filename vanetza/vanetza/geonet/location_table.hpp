@@ -1,9 +1,11 @@
 #ifndef LOCATION_TABLE_HPP_EMPVZSHQ
 #define LOCATION_TABLE_HPP_EMPVZSHQ
 
-#include <vanetza/common/object_container.hpp>
+#include <vanetza/common/slot_container.hpp>
 #include <vanetza/geonet/address.hpp>
+#include <vanetza/geonet/flat_soft_state_map.hpp>
 #include <vanetza/geonet/mib.hpp>
+#include <vanetza/geonet/neighbour_index.hpp>
 #include <vanetza/geonet/position_vector.hpp>
 #include <vanetza/geonet/soft_state_map.hpp>
 #include <vanetza/geonet/station_type.hpp>
@@ -15,6 +17,14 @@ namespace vanetza
 namespace geonet
 {
 
+class DuplicatePacketList;
+struct LocTEX_G5;
+
+/**
+ * Extensions of location table entries used by Router are registered with fixed slots
+ */
+using LocationTableExtensions = SlotContainer<DuplicatePacketList, LocTEX_G5>;
+
 class LocationTableEntry
 {
 public:
@@ -77,7 +87,7 @@ public:
      */
     void set_neighbour(bool flag, Clock::duration expiry);
 
-    ObjectContainer extensions;
+    LocationTableExtensions extensions;
 
 private:
     /**
@@ -107,11 +117,13 @@ private:
 /**
  * GeoNetworking LocationTable
  * See section 7.1 of EN 302 636-4-1 for details.
+ * \tparam MAP soft-state map storing the entries, i.e. SoftStateMap or FlatSoftStateMap
  */
-class LocationTable
+template<template<typename, typename, typename> class MAP>
+class BasicLocationTable
 {
 public:
-    using table_type = SoftStateMap<MacAddress, LocationTableEntry, LocationTableEntryCreator>;
+    using table_type = MAP<MacAddress, LocationTableEntry, LocationTableEntryCreator>;
     using entry_visitor = std::function<void(const MacAddress&, const LocationTableEntry&)>;
     using entry_predicate = std::function<bool(const MacAddress&, const LocationTableEntry&)>;
     using entry_range =
@@ -121,7 +133,7 @@ public:
                 const typename table_type::map_range>>;
     using neighbour_range = entry_range;
 
-    LocationTable(const MIB&, Runtime&);
+    BasicLocationTable(const MIB&, Runtime&);
     bool has_entry(const Address&) const;
     LocationTableEntry& update(const LongPositionVector&);
     LocationTableEntry& get_or_create_entry(const Address&);
@@ -132,12 +144,44 @@ public:
     const LongPositionVector* get_position(const MacAddress&) const;
     bool has_neighbours() const;
     neighbour_range neighbours() const;
+
+    /**
+     * Find neighbour closest to a position
+     * \param position target position
+     * \param limit only neighbours closer than limit are considered
+     * \return closest neighbour with known position or nullptr
+     */
+    const LocationTableEntry* closest_neighbour(const GeodeticPosition& position, units::Length limit) const;
+
+    /**
+     * Visit all neighbours within radius around a position
+     * \param position center position
+     * \param radius maximum distance of neighbours
+     * \param visitor invoked for each neighbour within radius
+     */
+    void visit_neighbours(const GeodeticPosition& position, units::Length radius, const entry_visitor&) const;
+
     entry_range filter(const entry_predicate&) const;
     void visit(const entry_visitor&) const;
-    void drop_expired() { m_table.drop_expired(); }
+    void drop_expired();
 
 private:
+    const LocationTableEntry* get_neighbour(const MacAddress&) const;
+
     table_type m_table;
+    NeighbourIndex m_index; /*< positions of entries updated by update() */
+};
+
+extern template class BasicLocationTable<SoftStateMap>;
+extern template class BasicLocationTable<FlatSoftStateMap>;
+
+/**
+ * LocationTable used by Router, its entries are kept in a FlatSoftStateMap
+ */
+class LocationTable : public BasicLocationTable<FlatSoftStateMap>
+{
+public:
+    using BasicLocationTable::BasicLocationTable;
 };
 
 } // namespace geonet
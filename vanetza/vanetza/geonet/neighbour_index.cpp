@@ -0,0 +1,319 @@
+#include <vanetza/geonet/neighbour_index.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vanetza
+{
+namespace geonet
+{
+namespace
+{
+
+// stations and queries farther away from reference are not projected
+const double projection_range = 20000.0; // meters
+
+// projection is too inaccurate close to the poles
+const double projection_max_latitude = 80.0; // degrees
+
+// plane folds far positions back into projection range, thus these are rejected beforehand
+const double prefilter_latitude = 1.0; // degrees
+const double prefilter_longitude = 10.0; // degrees
+
+// planar distances within projection range deviate less than this from geodesic distances
+const double projection_tolerance = 0.05;
+const double projection_slack = 1.0; // meters
+
+// stations outside projection range are kept in this cell which is never pruned
+const std::uint64_t unprojected_cell = std::numeric_limits<std::uint64_t>::max();
+
+// rebase reference when at least that many stations cannot be projected
+const std::size_t min_rebase_threshold = 16;
+
+double lower_bound(double planar_distance)
+{
+    return planar_distance * (1.0 - projection_tolerance) - projection_slack;
+}
+
+std::uint64_t make_cell_key(std::int32_t column, std::int32_t row)
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(column)) << 32 | static_cast<std::uint32_t>(row);
+}
+
+std::int32_t cell_column(std::uint64_t key)
+{
+    return static_cast<std::int32_t>(key >> 32);
+}
+
+std::int32_t cell_row(std::uint64_t key)
+{
+    return static_cast<std::int32_t>(key & 0xffffffff);
+}
+
+double to_degree(units::GeoAngle angle)
+{
+    return angle / units::degree;
+}
+
+} // namespace
+
+NeighbourIndex::NeighbourIndex(units::Length cell_size) :
+    m_cell_size(cell_size / units::si::meter), m_has_reference(false),
+    m_rebase_threshold(min_rebase_threshold)
+{
+}
+
+void NeighbourIndex::update(const MacAddress& mac, const GeodeticPosition& position)
+{
+    if (!m_has_reference) {
+        rebase(position);
+    }
+
+    auto found = m_stations.find(mac);
+    if (found != m_stations.end()) {
+        Station& station = found->second;
+        erase(mac, station);
+        station.position = position;
+        insert(mac, station);
+    } else {
+        Station station;
+        station.position = position;
+        found = m_stations.emplace(mac, station).first;
+        insert(mac, found->second);
+    }
+
+    // follow stations if most of them moved away from reference
+    const std::size_t unprojected = unprojected_count();
+    if (unprojected > m_rebase_threshold && 2 * unprojected > m_stations.size()) {
+        if (std::abs(to_degree(position.latitude)) <= projection_max_latitude) {
+            rebase(position);
+            // avoid rebasing over and over again if stations are widely spread
+            m_rebase_threshold = std::max(min_rebase_threshold, 2 * unprojected_count());
+        }
+    }
+}
+
+void NeighbourIndex::remove(const MacAddress& mac)
+{
+    auto found = m_stations.find(mac);
+    if (found != m_stations.end()) {
+        erase(mac, found->second);
+        m_stations.erase(found);
+    }
+}
+
+void NeighbourIndex::clear()
+{
+    m_stations.clear();
+    m_cells.clear();
+    m_has_reference = false;
+    m_rebase_threshold = min_rebase_threshold;
+}
+
+std::size_t NeighbourIndex::unprojected_count() const
+{
+    auto unprojected = m_cells.find(unprojected_cell);
+    return unprojected != m_cells.end() ? unprojected->second.size() : 0;
+}
+
+boost::optional<std::pair<MacAddress, units::Length>>
+NeighbourIndex::closest(const GeodeticPosition& position, units::Length limit, const evaluator& eval) const
+{
+    boost::optional<std::pair<MacAddress, units::Length>> result;
+    units::Length best = limit;
+
+    auto consider = [&](const MacAddress& mac) {
+        boost::optional<units::Length> dist = eval(mac);
+        if (dist && *dist < best) {
+            best = *dist;
+            result = std::make_pair(mac, best);
+        }
+    };
+
+    const boost::optional<Point> point = project(position);
+    if (!point) {
+        for (const auto& station : m_stations) {
+            consider(station.first);
+        }
+    } else {
+        // cells no closer than current best are skipped
+        auto limit = [&best]() { return best / units::si::meter; };
+        visit_cells(*point, limit, [&](const std::vector<MacAddress>& macs) {
+            for (const MacAddress& mac : macs) {
+                consider(mac);
+            }
+        });
+    }
+
+    return result;
+}
+
+void NeighbourIndex::candidates(const GeodeticPosition& position, units::Length radius, const visitor& visit) const
+{
+    const boost::optional<Point> point = project(position);
+    if (!point) {
+        for (const auto& station : m_stations) {
+            visit(station.first);
+        }
+    } else {
+        // cells at exactly radius distance are still visited
+        const double limit = std::nextafter(radius / units::si::meter, std::numeric_limits<double>::infinity());
+        visit_cells(*point, [limit]() { return limit; }, [&](const std::vector<MacAddress>& macs) {
+            for (const MacAddress& mac : macs) {
+                visit(mac);
+            }
+        });
+    }
+}
+
+void NeighbourIndex::rebase(const GeodeticPosition& reference)
+{
+    m_has_reference = true;
+    m_plane.reset(reference);
+
+    m_cells.clear();
+    for (auto& station : m_stations) {
+        insert(station.first, station.second);
+    }
+}
+
+void NeighbourIndex::insert(const MacAddress& mac, Station& station)
+{
+    const boost::optional<Point> point = project(station.position);
+    if (point) {
+        station.point = *point;
+        station.cell = cell_key(*point);
+    } else {
+        station.cell = unprojected_cell;
+    }
+    m_cells[station.cell].push_back(mac);
+}
+
+void NeighbourIndex::erase(const MacAddress& mac, const Station& station)
+{
+    auto cell = m_cells.find(station.cell);
+    if (cell != m_cells.end()) {
+        std::vector<MacAddress>& macs = cell->second;
+        auto it = std::find(macs.begin(), macs.end(), mac);
+        if (it != macs.end()) {
+            *it = macs.back();
+            macs.pop_back();
+        }
+        if (macs.empty()) {
+            m_cells.erase(cell);
+        }
+    }
+}
+
+auto NeighbourIndex::project(const GeodeticPosition& position) const -> boost::optional<Point>
+{
+    boost::optional<Point> point;
+    const GeodeticPosition& reference = m_plane.origin();
+    if (m_has_reference && std::abs(to_degree(reference.latitude)) <= projection_max_latitude) {
+        double delta_lon = to_degree(position.longitude) - to_degree(reference.longitude);
+        // take shortest way around anti-meridian
+        if (delta_lon > 180.0) {
+            delta_lon -= 360.0;
+        } else if (delta_lon < -180.0) {
+            delta_lon += 360.0;
+        }
+        const double delta_lat = to_degree(position.latitude) - to_degree(reference.latitude);
+
+        if (std::abs(delta_lat) <= prefilter_latitude && std::abs(delta_lon) <= prefilter_longitude) {
+            const CartesianPosition projected = m_plane.project(position);
+            const double x = projected.x / units::si::meter;
+            const double y = projected.y / units::si::meter;
+            if (std::abs(x) <= projection_range && std::abs(y) <= projection_range) {
+                point = Point { x, y };
+            }
+        }
+    }
+    return point;
+}
+
+std::uint64_t NeighbourIndex::cell_key(const Point& point) const
+{
+    const auto column = static_cast<std::int32_t>(std::floor(point.x / m_cell_size));
+    const auto row = static_cast<std::int32_t>(std::floor(point.y / m_cell_size));
+    return make_cell_key(column, row);
+}
+
+double NeighbourIndex::cell_distance(const Point& point, std::int32_t column, std::int32_t row) const
+{
+    const double left = column * m_cell_size;
+    const double bottom = row * m_cell_size;
+    const double dx = std::max({ left - point.x, 0.0, point.x - (left + m_cell_size) });
+    const double dy = std::max({ bottom - point.y, 0.0, point.y - (bottom + m_cell_size) });
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+void NeighbourIndex::visit_cells(const Point& point, const std::function<double()>& limit, const cell_visitor& visit) const
+{
+    std::size_t occupied = m_cells.size();
+    auto unprojected = m_cells.find(unprojected_cell);
+    if (unprojected != m_cells.end()) {
+        // no bound is known for these stations
+        visit(unprojected->second);
+        --occupied;
+    }
+
+    const auto column = static_cast<std::int32_t>(std::floor(point.x / m_cell_size));
+    const auto row = static_cast<std::int32_t>(std::floor(point.y / m_cell_size));
+    std::size_t visited = 0;
+
+    auto visit_cell = [&](std::int32_t c, std::int32_t r) {
+        auto cell = m_cells.find(make_cell_key(c, r));
+        if (cell != m_cells.end()) {
+            ++visited;
+            if (lower_bound(cell_distance(point, c, r)) < limit()) {
+                visit(cell->second);
+            }
+        }
+    };
+
+    // rings of cells around query cell in order of increasing distance
+    for (std::int32_t ring = 0; visited < occupied; ++ring) {
+        if (ring > 0) {
+            // distance to the block of inner rings is a lower bound for all cells of this ring
+            const double inner = std::min({
+                point.x - (column - ring + 1) * m_cell_size, (column + ring) * m_cell_size - point.x,
+                point.y - (row - ring + 1) * m_cell_size, (row + ring) * m_cell_size - point.y });
+            if (lower_bound(inner) >= limit()) {
+                break;
+            }
+        }
+
+        const std::size_t ring_cells = ring > 0 ? 8 * static_cast<std::size_t>(ring) : 1;
+        if (ring_cells > occupied) {
+            // sparse grid: checking all occupied cells is cheaper than looking up the ring's cells
+            for (const auto& cell : m_cells) {
+                if (cell.first == unprojected_cell) {
+                    continue;
+                }
+                const std::int32_t c = cell_column(cell.first);
+                const std::int32_t r = cell_row(cell.first);
+                const bool visited_ring = std::abs(c - column) < ring && std::abs(r - row) < ring;
+                if (!visited_ring && lower_bound(cell_distance(point, c, r)) < limit()) {
+                    visit(cell.second);
+                }
+            }
+            break;
+        }
+
+        if (ring == 0) {
+            visit_cell(column, row);
+        } else {
+            for (std::int32_t c = column - ring; c <= column + ring; ++c) {
+                visit_cell(c, row - ring);
+                visit_cell(c, row + ring);
+            }
+            for (std::int32_t r = row - ring + 1; r < row + ring; ++r) {
+                visit_cell(column - ring, r);
+                visit_cell(column + ring, r);
+            }
+        }
+    }
+}
+
+} // namespace geonet
+} // namespace vanetza
@@ -0,0 +1,120 @@
+#ifndef NEIGHBOUR_INDEX_HPP_T7WQ4KXM
+#define NEIGHBOUR_INDEX_HPP_T7WQ4KXM
+
+#include <vanetza/geonet/areas.hpp>
+#include <vanetza/geonet/local_tangent_plane.hpp>
+#include <vanetza/net/mac_address.hpp>
+#include <vanetza/units/length.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace vanetza
+{
+namespace geonet
+{
+
+/**
+ * NeighbourIndex is a uniform grid of station positions for spatial queries.
+ *
+ * Positions are projected onto the local tangent plane at a reference position. Planar distances
+ * only approximate geodesic distances, thus queries yield candidate stations and callers
+ * evaluate their exact distances. The grid only prunes those stations which are out of question.
+ * Far away query positions fall back to evaluating all stations.
+ */
+class NeighbourIndex
+{
+public:
+    /**
+     * Evaluates a candidate station
+     * \return exact distance or none if station is not eligible
+     */
+    using evaluator = std::function<boost::optional<units::Length>(const MacAddress&)>;
+    using visitor = std::function<void(const MacAddress&)>;
+
+    /**
+     * Create empty index
+     * \param cell_size edge length of grid cells
+     */
+    NeighbourIndex(units::Length cell_size = 100.0 * units::si::meter);
+
+    /**
+     * Insert station or move it to its new position
+     * \param station link-layer address of station
+     * \param position current position of station
+     */
+    void update(const MacAddress& station, const GeodeticPosition& position);
+
+    /**
+     * Remove station from index
+     * \param station link-layer address of station
+     */
+    void remove(const MacAddress& station);
+
+    /**
+     * Remove all stations
+     */
+    void clear();
+
+    /**
+     * Number of indexed stations
+     */
+    std::size_t size() const { return m_stations.size(); }
+
+    /**
+     * Find station closest to position
+     * \param position query position
+     * \param limit only stations closer than limit are considered
+     * \param eval evaluator of candidate stations
+     * \return closest eligible station and its distance
+     */
+    boost::optional<std::pair<MacAddress, units::Length>>
+    closest(const GeodeticPosition& position, units::Length limit, const evaluator& eval) const;
+
+    /**
+     * Visit all stations possibly within radius around position
+     * \param position center of query
+     * \param radius query radius
+     * \param visit invoked for each candidate station, might be outside radius
+     */
+    void candidates(const GeodeticPosition& position, units::Length radius, const visitor& visit) const;
+
+private:
+    struct Point
+    {
+        double x; /*< east in meters */
+        double y; /*< north in meters */
+    };
+
+    struct Station
+    {
+        GeodeticPosition position;
+        Point point;
+        std::uint64_t cell;
+    };
+
+    using cell_visitor = std::function<void(const std::vector<MacAddress>&)>;
+
+    void rebase(const GeodeticPosition& reference);
+    void insert(const MacAddress&, Station&);
+    void erase(const MacAddress&, const Station&);
+    std::size_t unprojected_count() const;
+    boost::optional<Point> project(const GeodeticPosition&) const;
+    std::uint64_t cell_key(const Point&) const;
+    double cell_distance(const Point&, std::int32_t column, std::int32_t row) const;
+    void visit_cells(const Point&, const std::function<double()>& limit, const cell_visitor&) const;
+
+    const double m_cell_size;
+    bool m_has_reference;
+    LocalTangentPlane m_plane;
+    std::size_t m_rebase_threshold;
+    std::unordered_map<MacAddress, Station> m_stations;
+    std::unordered_map<std::uint64_t, std::vector<MacAddress>> m_cells;
+};
+
+} // namespace geonet
+} // namespace vanetza
+
+#endif /* NEIGHBOUR_INDEX_HPP_T7WQ4KXM */
@@ -10,9 +10,7 @@ namespace geonet
 {
 
 Parser::Parser(ByteBuffer::const_iterator begin, ByteBuffer::const_iterator end) :
-    m_byte_buffer_source(begin, end),
-    m_stream(m_byte_buffer_source),
-    m_archive(m_stream),
+    m_archive(begin, end),
     m_read_bytes(0)
 {
 }
@@ -1,11 +1,10 @@
 #ifndef PARSER_HPP_IBDRMPKB
 #define PARSER_HPP_IBDRMPKB
 
+#include <vanetza/common/archives.hpp>
 #include <vanetza/common/byte_buffer.hpp>
-#include <vanetza/common/byte_buffer_source.hpp>
 #include <vanetza/geonet/header_type.hpp>
 #include <vanetza/geonet/header_variant.hpp>
-#include <boost/iostreams/stream.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <cstdint>
 
@@ -35,8 +34,6 @@ public:
     std::size_t parsed_bytes() const;
 
 private:
-    byte_buffer_source m_byte_buffer_source;
-    boost::iostreams::stream_buffer<byte_buffer_source> m_stream;
     InputArchive m_archive;
     std::size_t m_read_bytes;
 };
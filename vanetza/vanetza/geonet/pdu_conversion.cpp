@@ -16,6 +16,12 @@ void byte_buffer_impl<PduPtr>::convert(ByteBuffer& dest) const
     geonet::serialize_into_buffer(*m_pdu, dest);
 }
 
+void byte_buffer_impl<PduPtr>::append(ByteBuffer& dest) const
+{
+    assert(m_pdu);
+    geonet::serialize_into_buffer(*m_pdu, dest);
+}
+
 std::size_t byte_buffer_impl<PduPtr>::size() const
 {
     assert(m_pdu);
@@ -18,6 +18,7 @@ struct byte_buffer_impl<std::unique_ptr<vanetza::geonet::Pdu>> : public byte_buf
         m_pdu(std::move(pdu)) {}
 
     void convert(ByteBuffer& dest) const override;
+    void append(ByteBuffer& dest) const override;
     std::size_t size() const override;
     std::unique_ptr<byte_buffer> duplicate() const override;
 
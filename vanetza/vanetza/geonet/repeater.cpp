@@ -8,6 +8,7 @@ namespace vanetza
 namespace geonet
 {
 
+// copying the payload shares its bytes with the original packet, see ByteSegment
 Repeater::Repetition::Repetition(const DataRequestVariant& request, const DownPacket& payload) :
     m_request(request), m_payload(new DownPacket(payload))
 {
@@ -182,6 +182,7 @@ void Router::update_position(const PositionFix& position_fix)
     // see field 5 (PAI) in table 2 (long position vector)
     m_local_position_vector.position_accuracy_indicator =
         position_fix.confidence.semi_major * 2.0 < m_mib.itsGnPaiInterval;
+    m_local_plane.reset(m_local_position_vector.position());
 }
 
 void Router::set_transport_handler(UpperProtocol proto, TransportInterface* ifc)
@@ -771,14 +772,10 @@ NextHop Router::greedy_forwarding(PendingPacketForwarding&& packet)
     units::Length mfr_dist = own;
 
     MacAddress mfr_addr;
-    for (const LocationTableEntry& neighbour : m_location_table.neighbours()) {
-        if (neighbour.has_position_vector()) {
-            const units::Length dist = distance(dest, neighbour.get_position_vector().position());
-            if (dist < mfr_dist) {
-                mfr_addr = neighbour.link_layer_address();
-                mfr_dist = dist;
-            }
-        }
+    const LocationTableEntry* mfr = m_location_table.closest_neighbour(dest, own);
+    if (mfr) {
+        mfr_addr = mfr->link_layer_address();
+        mfr_dist = distance(dest, mfr->get_position_vector().position());
     }
 
     if (mfr_dist < own) {
@@ -883,7 +880,7 @@ units::Duration Router::timeout_cbf(const MacAddress& sender) const
     units::Duration timeout = m_mib.itsGnCbfMaxTime;
     const LongPositionVector* pv_se = m_location_table.get_position(sender);
     if (pv_se && pv_se->position_accuracy_indicator) {
-        units::Length dist = distance(pv_se->position(), m_local_position_vector.position());
+        units::Length dist = m_local_plane.distance(pv_se->position(), m_local_position_vector.position());
         timeout = timeout_cbf(dist);
     }
     return timeout;
@@ -958,11 +955,13 @@ bool Router::outside_sectorial_contention_area(const MacAddress& sender, const M
     // Assumption: if any position is missing, then sectorial area becomes infinite small
     // As a result of this assumption, everything lays outside then
     if (position_sender && position_forwarder) {
-        auto dist_r = distance(position_sender->position(), m_local_position_vector.position());
-        auto dist_f = distance(position_forwarder->position(), position_sender->position());
+        // sender and forwarder are neighbours, hence distances on local tangent plane are sufficiently accurate
+        const GeodeticPosition position_local = m_local_position_vector.position();
+        auto dist_r = m_local_plane.distance(position_sender->position(), position_local);
+        auto dist_f = m_local_plane.distance(position_forwarder->position(), position_sender->position());
         const auto dist_max = m_mib.itsGnDefaultMaxCommunicationRange;
 
-        auto dist_rf = distance(position_forwarder->position(), m_local_position_vector.position());
+        auto dist_rf = m_local_plane.distance(position_forwarder->position(), position_local);
         auto angle_fsr = 0.0 * units::si::radians;
         if (dist_r > 0.0 * meter && dist_f > 0.0 * meter) {
             auto cos_fsr = (dist_rf * dist_rf - dist_r * dist_r - dist_f * dist_f) /
@@ -1199,7 +1198,7 @@ void Router::detect_duplicate_address(const Address& source, const MacAddress& s
 bool Router::detect_duplicate_packet(const Address& addr_so, SequenceNumber sn)
 {
     bool is_duplicate = false;
-    ObjectContainer& so_ext = m_location_table.get_or_create_entry(addr_so).extensions;
+    LocationTableExtensions& so_ext = m_location_table.get_or_create_entry(addr_so).extensions;
     DuplicatePacketList* dpl = so_ext.find<DuplicatePacketList>();
     if (dpl) {
         is_duplicate = dpl->check(sn);
@@ -12,6 +12,7 @@
 #include <vanetza/geonet/gbc_header.hpp>
 #include <vanetza/geonet/gbc_memory.hpp>
 #include <vanetza/geonet/interface.hpp>
+#include <vanetza/geonet/local_tangent_plane.hpp>
 #include <vanetza/geonet/location_table.hpp>
 #include <vanetza/geonet/mib.hpp>
 #include <vanetza/geonet/packet.hpp>
@@ -543,6 +544,7 @@ private:
     PacketBuffer m_uc_forward_buffer;
     CbfPacketBuffer m_cbf_buffer;
     LongPositionVector m_local_position_vector;
+    LocalTangentPlane m_local_plane; /*< tangent plane at local position for distances within communication range */
     SequenceNumber m_local_sequence_number;
     Repeater m_repeater;
     std::mt19937 m_random_gen;
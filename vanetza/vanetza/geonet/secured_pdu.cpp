@@ -39,6 +39,11 @@ void byte_buffer_impl<geonet::SecuredPdu>::convert(ByteBuffer& buffer) const
     geonet::serialize_into_buffer(pdu, buffer);
 }
 
+void byte_buffer_impl<geonet::SecuredPdu>::append(ByteBuffer& buffer) const
+{
+    geonet::serialize_into_buffer(pdu, buffer);
+}
+
 std::size_t byte_buffer_impl<geonet::SecuredPdu>::size() const
 {
     using namespace geonet;
@@ -49,6 +49,7 @@ struct byte_buffer_impl<geonet::SecuredPdu> : public byte_buffer
 {
     byte_buffer_impl(const geonet::SecuredPdu&);
     void convert(ByteBuffer&) const override;
+    void append(ByteBuffer&) const override;
     std::size_t size() const override;
     std::unique_ptr<byte_buffer> duplicate() const override;
 
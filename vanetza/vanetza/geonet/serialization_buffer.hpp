@@ -2,10 +2,7 @@
 #define SERIALIZATION_BUFFER_HPP_8G2XAHRG
 
 #include <vanetza/common/byte_buffer.hpp>
-#include <vanetza/common/byte_buffer_sink.hpp>
-#include <vanetza/common/byte_buffer_source.hpp>
 #include <vanetza/geonet/serialization.hpp>
-#include <boost/iostreams/stream_buffer.hpp>
 
 namespace vanetza
 {
@@ -20,9 +17,7 @@ namespace geonet
 template<typename T>
 void serialize_into_buffer(const T& t, ByteBuffer& buf)
 {
-    byte_buffer_sink sink(buf);
-    boost::iostreams::stream_buffer<byte_buffer_sink> stream(sink);
-    OutputArchive ar(stream);
+    OutputArchive ar(buf);
     serialize(t, ar);
 }
 
@@ -34,9 +29,7 @@ void serialize_into_buffer(const T& t, ByteBuffer& buf)
 template<typename T>
 void deserialize_from_buffer(T& t, const ByteBuffer& buf)
 {
-    byte_buffer_source source(buf);
-    boost::iostreams::stream_buffer<byte_buffer_source> stream(source);
-    InputArchive ar(stream);
+    InputArchive ar(buf);
     deserialize(t, ar);
 }
 
@@ -164,8 +164,19 @@ public:
      * Expired but still stored entries are only hided at retrieval until calling this method.
      */
     void drop_expired()
+    {
+        drop_expired([](const key_type&) {});
+    }
+
+    /**
+     * Drop all entries with expired lifetime and report their keys
+     * \param on_drop invoked with key of each dropped entry
+     */
+    template<typename F>
+    void drop_expired(F on_drop)
     {
         while (!m_heap.empty() && is_expired(m_heap.top())) {
+            on_drop(m_heap.top().key());
             m_map.erase(m_heap.top().key());
             m_heap.pop();
         }
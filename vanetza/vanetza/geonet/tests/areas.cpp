@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <vanetza/geonet/areas.hpp>
+#include <vanetza/geonet/local_tangent_plane.hpp>
 #include <vanetza/units/length.hpp>
+#include <GeographicLib/Geocentric.hpp>
+#include <GeographicLib/LocalCartesian.hpp>
+#include <random>
 
 using namespace vanetza::geonet;
 namespace units = vanetza::units;
@@ -91,6 +95,44 @@ TEST(Areas, inside_or_at_border) {
     EXPECT_TRUE(inside_or_at_border(a, ego));
 }
 
+TEST(Areas, local_tangent_plane) {
+    using namespace GeographicLib;
+    std::mt19937 rng;
+    std::uniform_real_distribution<double> origin_latitude(-80.0, 80.0);
+    std::uniform_real_distribution<double> origin_longitude(-180.0, 180.0);
+    std::uniform_real_distribution<double> offset(-0.05, 0.05);
+
+    for (unsigned i = 0; i < 200; ++i) {
+        const double lat0 = origin_latitude(rng);
+        const double lon0 = origin_longitude(rng);
+        const LocalTangentPlane plane(GeodeticPosition(lat0 * degree, lon0 * degree));
+        const LocalCartesian reference(lat0, lon0, 0.0, Geocentric::WGS84());
+
+        const double lat = lat0 + offset(rng);
+        const double lon = lon0 + offset(rng);
+        double x = 0.0, y = 0.0, z = 0.0;
+        reference.Forward(lat, lon, 0.0, x, y, z);
+        CartesianPosition projected = plane.project(GeodeticPosition(lat * degree, lon * degree));
+        EXPECT_NEAR(projected.x / meter, x, 1e-6);
+        EXPECT_NEAR(projected.y / meter, y, 1e-6);
+    }
+}
+
+TEST(Areas, local_tangent_plane_distance) {
+    GeodeticPosition origin(48.76714 * degree, 11.43263 * degree);
+    LocalTangentPlane plane(origin);
+    EXPECT_DOUBLE_EQ(0.0, plane.distance(origin, origin).value());
+
+    // planar distances stay within a millimetre of geodesic distances near origin
+    std::mt19937 rng;
+    std::uniform_real_distribution<double> offset(-0.02, 0.02);
+    for (unsigned i = 0; i < 200; ++i) {
+        GeodeticPosition a(origin.latitude + offset(rng) * degree, origin.longitude + offset(rng) * degree);
+        GeodeticPosition b(origin.latitude + offset(rng) * degree, origin.longitude + offset(rng) * degree);
+        EXPECT_NEAR(plane.distance(a, b) / meter, distance(a, b) / meter, 0.001);
+    }
+}
+
 TEST(Areas, area_size) {
     Circle c;
     c.r = 18.3 * meter;
@@ -8,6 +8,8 @@
 #include <chrono>
 #include <cmath>
 #include <memory>
+#include <random>
+#include <set>
 #include <unordered_set>
 
 using namespace vanetza::geonet;
@@ -202,6 +204,154 @@ TEST_F(LocationTableTest, visit) {
     EXPECT_EQ(addresses.size(), visited_addresses.size());
 }
 
+LongPositionVector build_position_vector(const vanetza::MacAddress& mac, double lat, double lon)
+{
+    using vanetza::units::degree;
+    LongPositionVector pv;
+    pv.gn_addr.mid(mac);
+    pv.latitude = static_cast<geo_angle_i32t>(lat * degree);
+    pv.longitude = static_cast<geo_angle_i32t>(lon * degree);
+    return pv;
+}
+
+TEST_F(LocationTableTest, closest_neighbour) {
+    using vanetza::units::degree;
+    using vanetza::units::si::meter;
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> jitter(-0.01, 0.01); // about one kilometre
+
+    for (unsigned i = 0; i < 300; ++i) {
+        auto pv = build_position_vector(vanetza::create_mac_address(i + 1), 49.0 + jitter(rng), 11.0 + jitter(rng));
+        loct->update(pv).set_neighbour(i % 3 != 0);
+    }
+
+    const GeodeticPosition destinations[] = {
+        { 49.0 * degree, 11.0 * degree },
+        { 49.005 * degree, 10.997 * degree },
+        { 49.02 * degree, 11.03 * degree },
+        { 49.5 * degree, 11.0 * degree }, // far away, i.e. unprojected
+        { -33.0 * degree, 151.0 * degree }
+    };
+
+    for (const GeodeticPosition& dest : destinations) {
+        const auto limit = 1.0e8 * meter;
+        const LocationTableEntry* expected = nullptr;
+        auto expected_dist = limit;
+        for (const LocationTableEntry& neighbour : loct->neighbours()) {
+            const auto dist = distance(dest, neighbour.get_position_vector().position());
+            if (dist < expected_dist) {
+                expected = &neighbour;
+                expected_dist = dist;
+            }
+        }
+
+        const LocationTableEntry* closest = loct->closest_neighbour(dest, limit);
+        ASSERT_TRUE(closest);
+        EXPECT_EQ(expected, closest);
+        EXPECT_TRUE(closest->is_neighbour());
+
+        // neighbour has to be closer than limit
+        EXPECT_EQ(nullptr, loct->closest_neighbour(dest, expected_dist));
+    }
+}
+
+TEST_F(LocationTableTest, closest_neighbour_clusters) {
+    using vanetza::units::degree;
+    using vanetza::units::si::meter;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> spread(-0.002, 0.002); // about 200 metres
+    std::uniform_real_distribution<double> region(-0.05, 0.05); // several kilometres
+
+    // a few dense clusters within a mostly empty region
+    unsigned stations = 0;
+    for (unsigned cluster = 0; cluster < 4; ++cluster) {
+        const double lat = 50.0 + region(rng);
+        const double lon = 8.0 + region(rng);
+        for (unsigned i = 0; i < 20 * (cluster + 1); ++i) {
+            auto pv = build_position_vector(vanetza::create_mac_address(++stations), lat + spread(rng), lon + spread(rng));
+            loct->update(pv).set_neighbour(true);
+        }
+    }
+
+    for (unsigned query = 0; query < 50; ++query) {
+        const GeodeticPosition dest { (50.0 + region(rng)) * degree, (8.0 + region(rng)) * degree };
+        const LocationTableEntry* expected = nullptr;
+        auto expected_dist = 1.0e8 * meter;
+        for (const LocationTableEntry& neighbour : loct->neighbours()) {
+            const auto dist = distance(dest, neighbour.get_position_vector().position());
+            if (dist < expected_dist) {
+                expected = &neighbour;
+                expected_dist = dist;
+            }
+        }
+        EXPECT_EQ(expected, loct->closest_neighbour(dest, 1.0e8 * meter)) << "query " << query;
+    }
+}
+
+TEST_F(LocationTableTest, closest_neighbour_follows_updates) {
+    using vanetza::units::degree;
+    using vanetza::units::si::meter;
+    const GeodeticPosition dest { 48.0 * degree, 11.0 * degree };
+    const auto limit = 1.0e6 * meter;
+    EXPECT_EQ(nullptr, loct->closest_neighbour(dest, limit));
+
+    auto pv_a = build_position_vector({1, 0, 0, 0, 0, 1}, 48.01, 11.0);
+    auto pv_b = build_position_vector({1, 0, 0, 0, 0, 2}, 48.02, 11.0);
+    loct->update(pv_a).set_neighbour(true);
+    loct->update(pv_b).set_neighbour(true);
+    const LocationTableEntry* closest = loct->closest_neighbour(dest, limit);
+    ASSERT_TRUE(closest);
+    EXPECT_EQ(pv_a, closest->get_position_vector());
+
+    // station B moves towards destination
+    pv_b = build_position_vector(pv_b.gn_addr.mid(), 48.001, 11.0);
+    pv_b.timestamp += 100 * Timestamp::millisecond();
+    loct->update(pv_b);
+    closest = loct->closest_neighbour(dest, limit);
+    ASSERT_TRUE(closest);
+    EXPECT_EQ(pv_b, closest->get_position_vector());
+
+    // station B is no neighbour anymore
+    loct->update(pv_b).set_neighbour(false);
+    closest = loct->closest_neighbour(dest, limit);
+    ASSERT_TRUE(closest);
+    EXPECT_EQ(pv_a, closest->get_position_vector());
+
+    // all entries expire
+    runtime->trigger(std::chrono::seconds(11));
+    loct->drop_expired();
+    EXPECT_EQ(nullptr, loct->closest_neighbour(dest, limit));
+}
+
+TEST_F(LocationTableTest, visit_neighbours) {
+    using vanetza::units::degree;
+    using vanetza::units::si::meter;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> jitter(-0.02, 0.02);
+
+    for (unsigned i = 0; i < 200; ++i) {
+        auto pv = build_position_vector(vanetza::create_mac_address(i + 1), 52.0 + jitter(rng), 10.0 + jitter(rng));
+        loct->update(pv).set_neighbour(i % 4 != 0);
+    }
+
+    const GeodeticPosition center { 52.003 * degree, 10.001 * degree };
+    const auto radius = 800.0 * meter;
+    std::set<vanetza::MacAddress> expected;
+    for (const LocationTableEntry& neighbour : loct->neighbours()) {
+        if (distance(center, neighbour.get_position_vector().position()) <= radius) {
+            expected.insert(neighbour.link_layer_address());
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    std::set<vanetza::MacAddress> visited;
+    loct->visit_neighbours(center, radius, [&visited](const vanetza::MacAddress& mac, const LocationTableEntry& entry) {
+        EXPECT_TRUE(entry.is_neighbour());
+        EXPECT_TRUE(visited.insert(mac).second);
+    });
+    EXPECT_EQ(expected, visited);
+}
+
 TEST(LocationTableEntry, update_position_vector)
 {
     ManualRuntime rt;
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/geonet/flat_soft_state_map.hpp>
+#include <vanetza/geonet/soft_state_map.hpp>
+#include <vanetza/net/mac_address.hpp>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace vanetza;
+using namespace vanetza::geonet;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+template<typename MAP>
+class SoftStateMapTest : public ::testing::Test
+{
+protected:
+    SoftStateMapTest() : runtime(Clock::at("2020-01-01 12:00")), map(runtime)
+    {
+        map.set_lifetime(seconds(5));
+    }
+
+    std::size_t count() const
+    {
+        std::size_t entries = 0;
+        for (const auto& entry : map.map()) {
+            (void) entry;
+            ++entries;
+        }
+        return entries;
+    }
+
+    ManualRuntime runtime;
+    MAP map;
+};
+
+using SoftStateMapTypes = ::testing::Types<
+    SoftStateMap<MacAddress, int>,
+    FlatSoftStateMap<MacAddress, int>>;
+TYPED_TEST_CASE(SoftStateMapTest, SoftStateMapTypes);
+
+TYPED_TEST(SoftStateMapTest, get_value) {
+    const MacAddress a = create_mac_address(1);
+    EXPECT_FALSE(this->map.has_value(a));
+    EXPECT_EQ(nullptr, this->map.get_value_ptr(a));
+
+    this->map.get_value(a) = 42;
+    EXPECT_TRUE(this->map.has_value(a));
+    ASSERT_NE(nullptr, this->map.get_value_ptr(a));
+    EXPECT_EQ(42, *this->map.get_value_ptr(a));
+    EXPECT_EQ(42, this->map.get_value(a));
+}
+
+TYPED_TEST(SoftStateMapTest, expiry) {
+    const MacAddress a = create_mac_address(1);
+    const MacAddress b = create_mac_address(2);
+    this->map.get_value(a) = 1;
+    this->runtime.trigger(seconds(3));
+    this->map.get_value(b) = 2;
+
+    this->runtime.trigger(seconds(2));
+    EXPECT_TRUE(this->map.has_value(a));
+    this->runtime.trigger(milliseconds(1));
+    EXPECT_FALSE(this->map.has_value(a));
+    EXPECT_TRUE(this->map.has_value(b));
+    EXPECT_EQ(1, this->count());
+
+    // expired entries are resurrected by get_value until they are dropped
+    EXPECT_EQ(1, this->map.get_value(a));
+    EXPECT_TRUE(this->map.has_value(a));
+}
+
+TYPED_TEST(SoftStateMapTest, refresh) {
+    const MacAddress a = create_mac_address(1);
+    this->map.refresh(a) = 7;
+    this->runtime.trigger(seconds(4));
+    EXPECT_EQ(7, this->map.refresh(a));
+    this->runtime.trigger(seconds(4));
+    EXPECT_TRUE(this->map.has_value(a));
+
+    this->map.drop_expired();
+    EXPECT_TRUE(this->map.has_value(a));
+    this->runtime.trigger(seconds(2));
+    this->map.drop_expired();
+    EXPECT_FALSE(this->map.has_value(a));
+    EXPECT_EQ(0, this->map.get_value(a));
+}
+
+TYPED_TEST(SoftStateMapTest, drop_expired) {
+    std::unordered_set<MacAddress> dropped;
+    for (unsigned i = 0; i < 100; ++i) {
+        this->map.get_value(create_mac_address(i)) = i;
+        this->runtime.trigger(milliseconds(10));
+    }
+
+    // entries 0 to 49 have expired
+    this->runtime.trigger(seconds(5) - milliseconds(500));
+    this->map.drop_expired([&dropped](const MacAddress& mac) { dropped.insert(mac); });
+    EXPECT_EQ(50, dropped.size());
+    for (unsigned i = 0; i < 100; ++i) {
+        EXPECT_EQ(i < 50, dropped.count(create_mac_address(i)) == 1);
+        EXPECT_EQ(i >= 50, this->map.has_value(create_mac_address(i)));
+    }
+    EXPECT_EQ(50, this->count());
+
+    // dropped entries are created anew
+    EXPECT_EQ(0, this->map.get_value(create_mac_address(3)));
+    EXPECT_EQ(77, this->map.get_value(create_mac_address(77)));
+
+    this->runtime.trigger(seconds(60));
+    dropped.clear();
+    this->map.drop_expired([&dropped](const MacAddress& mac) { dropped.insert(mac); });
+    EXPECT_EQ(51, dropped.size());
+    EXPECT_EQ(0, this->count());
+}
+
+TYPED_TEST(SoftStateMapTest, random_operations) {
+    // compare against a simple model with explicit expiry stamps
+    std::unordered_map<MacAddress, std::pair<Clock::time_point, int>> model;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<unsigned> address(0, 300);
+    std::uniform_int_distribution<unsigned> operation(0, 9);
+
+    for (unsigned step = 0; step < 20000; ++step) {
+        const MacAddress mac = create_mac_address(address(rng));
+        const Clock::time_point now = this->runtime.now();
+        auto found = model.find(mac);
+        const bool alive = found != model.end() && found->second.first >= now;
+
+        switch (operation(rng)) {
+            case 0:
+            case 1:
+            case 2:
+                this->map.refresh(mac) = step;
+                model[mac] = std::make_pair(now + seconds(5), static_cast<int>(step));
+                break;
+            case 3:
+                if (found == model.end()) {
+                    model[mac] = std::make_pair(now + seconds(5), 0);
+                } else if (!alive) {
+                    found->second.first = now + seconds(5);
+                }
+                EXPECT_EQ(model[mac].second, this->map.get_value(mac));
+                break;
+            case 4:
+                this->runtime.trigger(milliseconds(std::uniform_int_distribution<unsigned>(1, 400)(rng)));
+                break;
+            case 5: {
+                std::unordered_set<MacAddress> dropped;
+                this->map.drop_expired([&dropped](const MacAddress& m) { dropped.insert(m); });
+                for (auto it = model.begin(); it != model.end();) {
+                    if (it->second.first < now) {
+                        EXPECT_EQ(1, dropped.count(it->first));
+                        it = model.erase(it);
+                    } else {
+                        EXPECT_EQ(0, dropped.count(it->first));
+                        ++it;
+                    }
+                }
+                break;
+            }
+            default:
+                if (alive) {
+                    ASSERT_NE(nullptr, this->map.get_value_ptr(mac));
+                    EXPECT_EQ(found->second.second, *this->map.get_value_ptr(mac));
+                } else {
+                    EXPECT_EQ(nullptr, this->map.get_value_ptr(mac));
+                }
+                break;
+        }
+    }
+
+    std::size_t alive = 0;
+    for (const auto& entry : model) {
+        alive += entry.second.first >= this->runtime.now() ? 1 : 0;
+    }
+    EXPECT_EQ(alive, this->count());
+}
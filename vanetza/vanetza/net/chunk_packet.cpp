@@ -5,17 +5,18 @@
 namespace vanetza
 {
 
-static const ByteBufferConvertible empty_byte_buffer_convertible;
+static std::size_t layer_index(OsiLayer layer)
+{
+    assert(layer >= min_osi_layer() && layer <= max_osi_layer());
+    return distance(min_osi_layer(), layer);
+}
 
 ChunkPacket::ChunkPacket()
 {
 }
 
-ChunkPacket::ChunkPacket(const ChunkPacket& other)
+ChunkPacket::ChunkPacket(const ChunkPacket& other) : m_layers(other.m_layers)
 {
-    for (auto& layer : other.m_layers) {
-        m_layers.insert(layer);
-    }
 }
 
 ChunkPacket& ChunkPacket::operator=(const ChunkPacket& other)
@@ -27,26 +28,20 @@ ChunkPacket& ChunkPacket::operator=(const ChunkPacket& other)
 
 ByteBufferConvertible& ChunkPacket::layer(OsiLayer layer)
 {
-    return m_layers[layer];
+    return m_layers[layer_index(layer)];
 }
 
 const ByteBufferConvertible& ChunkPacket::layer(OsiLayer layer) const
 {
-    auto found = m_layers.find(layer);
-    if (found != m_layers.end()) {
-        assert(found->first == layer);
-        return found->second;
-    } else {
-        return empty_byte_buffer_convertible;
-    }
+    return m_layers[layer_index(layer)];
 }
 
 std::size_t ChunkPacket::size() const
 {
     std::size_t size = 0;
-    for(auto& it : m_layers)
+    for(auto& layer : m_layers)
     {
-        size += it.second.size();
+        size += layer.size();
     }
 
     return size;
@@ -56,10 +51,8 @@ std::size_t ChunkPacket::size(OsiLayer from, OsiLayer to) const
 {
     assert(from <= to);
     std::size_t size = 0;
-    for (auto& layer : m_layers) {
-        if (layer.first >= from && layer.first <= to) {
-            size += layer.second.size();
-        }
+    for (auto layer : osi_layer_range(from, to)) {
+        size += (*this)[layer].size();
     }
     return size;
 }
@@ -78,10 +71,18 @@ ChunkPacket& ChunkPacket::merge(ChunkPacket& source, OsiLayer from, OsiLayer to)
 {
     for (auto layer : osi_layer_range(from, to)) {
         (*this)[layer] = std::move(source[layer]);
-        source[layer] = empty_byte_buffer_convertible;
+        source[layer] = ByteBufferConvertible();
     }
     return *this;
 }
 
-} // namespace vanetza
+void ChunkPacket::serialize(ByteBuffer& buffer, OsiLayer from, OsiLayer to) const
+{
+    // layers append their bytes in place, e.g. ASN.1 payloads are encoded right behind the BTP header
+    buffer.clear();
+    for (auto layer : osi_layer_range(from, to)) {
+        (*this)[layer].append(buffer);
+    }
+}
 
+} // namespace vanetza
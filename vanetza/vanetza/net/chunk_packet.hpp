@@ -3,8 +3,8 @@
 
 #include <vanetza/common/byte_buffer_convertible.hpp>
 #include <vanetza/net/osi_layer.hpp>
+#include <array>
 #include <cstddef>
-#include <map>
 
 namespace vanetza
 {
@@ -14,6 +14,7 @@ namespace vanetza
  *
  * ChunkPacket is the preferred packet type when it is getting assembled step by step.
  * Each layer can easily add further bytes without caring about other layers at all.
+ * Layers are kept in a fixed array indexed by OsiLayer, thus no per-layer node allocations take place.
  */
 class ChunkPacket
 {
@@ -81,9 +82,19 @@ public:
      */
     ChunkPacket& merge(ChunkPacket& packet, OsiLayer from, OsiLayer to);
 
+    /**
+     * Serialize layers into one contiguous buffer, lowest layer first.
+     * Buffer's capacity is retained, thus reusing a buffer avoids allocations for subsequent packets.
+     * Sizes are not queried upfront because some layers can only tell their size by encoding.
+     * \param buffer destination, previous content is discarded
+     * \param from start at this layer (inclusive)
+     * \param to stop at this layer (inclusive)
+     */
+    void serialize(ByteBuffer& buffer, OsiLayer from = min_osi_layer(), OsiLayer to = max_osi_layer()) const;
+
 private:
-    typedef std::map<OsiLayer, ByteBufferConvertible> map_type;
-    map_type m_layers;
+    typedef std::array<ByteBufferConvertible, num_osi_layers(min_osi_layer(), max_osi_layer())> array_type;
+    array_type m_layers;
 };
 
 } // namespace vanetza
@@ -14,19 +14,32 @@ static_assert(layer_index(min_osi_layer()) == 1, "Lowest OSI layer index broken"
 
 
 CohesivePacket::CohesivePacket(const ByteBuffer& buffer, OsiLayer layer) :
-    m_buffer(buffer), rssi(-255), time_received(-1)
+    rssi(-255), time_received(-1), m_buffer(buffer)
 {
     reset_iterators(layer);
 }
 
 CohesivePacket::CohesivePacket(ByteBuffer&& buffer, OsiLayer layer) :
-    m_buffer(std::move(buffer)), rssi(-255), time_received(-1)
+    rssi(-255), time_received(-1), m_buffer(std::move(buffer))
 {
     reset_iterators(layer);
 }
 
+CohesivePacket::CohesivePacket(ByteBuffer&& buffer, OsiLayer layer, std::shared_ptr<ByteBufferPool> pool) :
+    rssi(-255), time_received(-1), m_buffer(std::move(buffer)), m_pool(std::move(pool))
+{
+    reset_iterators(layer);
+}
+
+CohesivePacket::~CohesivePacket()
+{
+    if (m_pool) {
+        m_pool->release(std::move(m_buffer));
+    }
+}
+
 CohesivePacket::CohesivePacket(const CohesivePacket& other) :
-    m_buffer(other.m_buffer), rssi(other.rssi), time_received(other.time_received)
+    rssi(other.rssi), time_received(other.time_received), m_buffer(other.m_buffer)
 {
     rebuild_iterators(other);
 }
@@ -34,10 +47,28 @@ CohesivePacket::CohesivePacket(const CohesivePacket& other) :
 CohesivePacket& CohesivePacket::operator=(const CohesivePacket& other)
 {
     m_buffer = other.m_buffer;
+    rssi = other.rssi;
+    time_received = other.time_received;
     rebuild_iterators(other);
     return *this;
 }
 
+CohesivePacket& CohesivePacket::operator=(CohesivePacket&& other)
+{
+    if (this != &other) {
+        // give replaced buffer back like destructor does
+        if (m_pool) {
+            m_pool->release(std::move(m_buffer));
+        }
+        rssi = other.rssi;
+        time_received = other.time_received;
+        m_buffer = std::move(other.m_buffer);
+        m_pool = std::move(other.m_pool);
+        m_iterators = other.m_iterators;
+    }
+    return *this;
+}
+
 auto CohesivePacket::operator[](OsiLayer layer) const -> buffer_const_range
 {
     return get(layer_index(layer));
@@ -2,10 +2,12 @@
 #define COHESIVE_PACKET_HPP_VG2XKSCV
 
 #include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/common/byte_buffer_pool.hpp>
 #include <vanetza/net/osi_layer.hpp>
 #include <vanetza/net/ethernet_header.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <array>
+#include <memory>
 
 namespace vanetza
 {
@@ -27,11 +29,21 @@ public:
     CohesivePacket(const ByteBuffer& buffer, OsiLayer layer);
     CohesivePacket(ByteBuffer&& buffer, OsiLayer layer);
 
+    /**
+     * Create packet wrapping a pooled buffer without copying its data
+     * \param buffer buffer acquired from pool, moved into packet
+     * \param layer all bytes belong to this layer (at least at first)
+     * \param pool buffer is given back to this pool when packet is destroyed
+     */
+    CohesivePacket(ByteBuffer&& buffer, OsiLayer layer, std::shared_ptr<ByteBufferPool> pool);
+
+    ~CohesivePacket();
+
     CohesivePacket(const CohesivePacket&);
     CohesivePacket& operator=(const CohesivePacket&);
 
     CohesivePacket(CohesivePacket&&) = default;
-    CohesivePacket& operator=(CohesivePacket&&) = default;
+    CohesivePacket& operator=(CohesivePacket&&);
 
     /**
      * Access a certain sub-range of packet data belonging to a specific layer
@@ -94,6 +106,7 @@ private:
     buffer_range get(unsigned idx);
 
     ByteBuffer m_buffer;
+    std::shared_ptr<ByteBufferPool> m_pool;
     std::array<ByteBuffer::iterator, osi_layers.size() + 1> m_iterators;
 };
 
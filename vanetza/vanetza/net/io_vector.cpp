@@ -17,11 +17,15 @@ void IoVector::append(const void* base, std::size_t length)
     m_vector.push_back(node);
 }
 
+void IoVector::append(const ByteBuffer& buffer)
+{
+    append(buffer.data(), buffer.size());
+}
+
 void IoVector::append(const BufferPacket& packet)
 {
     for (auto& kv : packet) {
-        const ByteBuffer& buffer = kv.second;
-        append(buffer.data(), buffer.size());
+        append(kv.second);
     }
 }
 
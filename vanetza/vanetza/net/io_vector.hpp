@@ -1,6 +1,7 @@
 #ifndef IO_VECTOR_HPP_A3ANMI8B
 #define IO_VECTOR_HPP_A3ANMI8B
 
+#include <vanetza/common/byte_buffer.hpp>
 #include <vector>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -19,6 +20,7 @@ class IoVector
 {
 public:
     void append(const void* base, std::size_t length);
+    void append(const ByteBuffer&);
     void append(const BufferPacket&);
     void clear();
     std::size_t length() const;
@@ -86,11 +86,12 @@ struct hash<vanetza::MacAddress>
 {
     size_t operator()(const vanetza::MacAddress& addr) const
     {
-        size_t tmp = 0;
+        // all 48 bits contribute, XOR of single octets would collapse to 256 distinct values
+        uint64_t tmp = 0;
         for (auto octet : addr.octets) {
-            tmp ^= hash<decltype(octet)>()(octet);
+            tmp = (tmp << 8) | octet;
         }
-        return tmp;
+        return hash<uint64_t>()(tmp);
     }
 };
 
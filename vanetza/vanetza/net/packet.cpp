@@ -1,4 +1,6 @@
+#include <vanetza/common/byte_segment.hpp>
 #include <vanetza/net/packet.hpp>
+#include <iterator>
 
 namespace vanetza
 {
@@ -9,11 +11,17 @@ std::unique_ptr<DownPacket> duplicate(const PacketVariant& packet)
     {
         void operator()(const CohesivePacket& packet)
         {
+            // copy bytes once, all layers share this buffer as segments
+            const auto first = packet[min_osi_layer()].begin();
+            auto buffer = std::make_shared<const ByteBuffer>(first, packet[max_osi_layer()].end());
+
             m_duplicate.reset(new ChunkPacket());
             for (auto layer : osi_layers) {
                 const auto source = packet[layer];
-                auto& dest = m_duplicate->layer(layer);
-                dest = ByteBuffer(source.begin(), source.end());
+                if (!source.empty()) {
+                    const std::size_t offset = std::distance(first, source.begin());
+                    m_duplicate->layer(layer) = ByteSegment { buffer, offset, source.size() };
+                }
             }
         }
 
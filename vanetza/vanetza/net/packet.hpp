@@ -11,6 +11,7 @@ using UpPacket = PacketVariant;
 
 /**
  * Create clone of a packet
+ * Payload bytes are shared by clone and original where possible, see ByteSegment.
  */
 std::unique_ptr<DownPacket> duplicate(const DownPacket&);
 std::unique_ptr<DownPacket> duplicate(const UpPacket&);
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
+#include <vanetza/common/byte_segment.hpp>
 #include <vanetza/net/chunk_packet.hpp>
+#include <vanetza/net/packet.hpp>
 
 using vanetza::ByteBuffer;
 using vanetza::ChunkPacket;
@@ -143,3 +145,74 @@ TEST(ChunkPacket, merge)
     a[OsiLayer::Application].convert(tmp);
     EXPECT_EQ(buffer[5], tmp);
 }
+
+TEST(ChunkPacket, serialize)
+{
+    ChunkPacket packet;
+    packet[OsiLayer::Link] = ByteBuffer { 1, 2 };
+    packet[OsiLayer::Network] = std::string("ab");
+    packet[OsiLayer::Application] = ByteBuffer { 3, 4, 5 };
+
+    ByteBuffer buffer { 9, 9, 9, 9, 9, 9, 9, 9, 9, 9 };
+    packet.serialize(buffer);
+    EXPECT_EQ((ByteBuffer { 1, 2, 'a', 'b', 3, 4, 5 }), buffer);
+    EXPECT_EQ(packet.size(), buffer.size());
+
+    packet.serialize(buffer, OsiLayer::Network, OsiLayer::Session);
+    EXPECT_EQ((ByteBuffer { 'a', 'b' }), buffer);
+}
+
+TEST(ChunkPacket, empty_layers)
+{
+    ChunkPacket packet;
+    const ChunkPacket& cpacket = packet;
+    for (auto layer : vanetza::osi_layers) {
+        EXPECT_EQ(0, cpacket[layer].size());
+        EXPECT_EQ(nullptr, cpacket[layer].ptr());
+    }
+
+    ByteBuffer buffer { 1 };
+    packet[OsiLayer::Transport].append(buffer);
+    EXPECT_EQ(ByteBuffer { 1 }, buffer);
+    packet[OsiLayer::Transport].convert(buffer);
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(ChunkPacket, copy_shares_payload)
+{
+    ChunkPacket original;
+    original[OsiLayer::Application] = ByteBuffer(300, 0x42);
+
+    ChunkPacket copy1 { original };
+    ChunkPacket copy2 { copy1 };
+    auto segment = [](const ChunkPacket& packet) {
+        using segment_impl = vanetza::convertible::byte_buffer_impl<vanetza::ByteSegment>;
+        auto impl = dynamic_cast<const segment_impl*>(packet[OsiLayer::Application].ptr());
+        return impl ? &impl->m_segment : nullptr;
+    };
+    ASSERT_NE(nullptr, segment(copy1));
+    ASSERT_NE(nullptr, segment(copy2));
+    EXPECT_EQ(segment(copy1)->buffer(), segment(copy2)->buffer());
+    EXPECT_EQ(300, original.size());
+    EXPECT_EQ(300, copy2.size());
+}
+
+TEST(ChunkPacket, duplicate_cohesive)
+{
+    vanetza::CohesivePacket cohesive(ByteBuffer { 1, 2, 3, 4, 5, 6 }, OsiLayer::Network);
+    cohesive.set_boundary(OsiLayer::Network, 2);
+    cohesive.set_boundary(OsiLayer::Transport, 1);
+    vanetza::UpPacket up { cohesive };
+
+    std::unique_ptr<ChunkPacket> dup = vanetza::duplicate(up);
+    ASSERT_TRUE(dup);
+    EXPECT_EQ(6, dup->size());
+    ByteBuffer tmp;
+    (*dup)[OsiLayer::Network].convert(tmp);
+    EXPECT_EQ((ByteBuffer { 1, 2 }), tmp);
+    (*dup)[OsiLayer::Transport].convert(tmp);
+    EXPECT_EQ((ByteBuffer { 3 }), tmp);
+    (*dup)[OsiLayer::Session].convert(tmp);
+    EXPECT_EQ((ByteBuffer { 4, 5, 6 }), tmp);
+    EXPECT_EQ(0, (*dup)[OsiLayer::Link].size());
+}
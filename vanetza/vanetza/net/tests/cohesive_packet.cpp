@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 #include <vanetza/net/cohesive_packet.hpp>
 #include <vanetza/common/byte_buffer.hpp>
+#include <vanetza/common/byte_buffer_pool.hpp>
+#include <memory>
 
 using vanetza::ByteBuffer;
+using vanetza::ByteBufferPool;
 using vanetza::CohesivePacket;
 using vanetza::OsiLayer;
 
@@ -98,3 +101,64 @@ TEST(CohesivePacket, trim_advanced_boundaries)
     EXPECT_EQ(8, packet.size(OsiLayer::Session));
     EXPECT_EQ(0, packet.size(OsiLayer::Presentation, OsiLayer::Application));
 }
+
+TEST(CohesivePacket, pooled_buffer)
+{
+    auto pool = std::make_shared<ByteBufferPool>(128, 4);
+    ByteBuffer buffer = pool->acquire();
+    const uint8_t* data = buffer.data();
+    buffer.resize(100);
+
+    {
+        CohesivePacket packet(std::move(buffer), OsiLayer::Link, pool);
+        EXPECT_EQ(100, packet.size());
+        EXPECT_EQ(data, packet.buffer().data());
+
+        // copies own a buffer of their own
+        CohesivePacket copy(packet);
+        EXPECT_NE(data, copy.buffer().data());
+
+        // moved packet hands buffer over
+        CohesivePacket moved(std::move(packet));
+        EXPECT_EQ(data, moved.buffer().data());
+    }
+
+    // buffer is recycled after destruction of packet
+    ByteBuffer recycled = pool->acquire();
+    EXPECT_EQ(data, recycled.data());
+}
+
+TEST(CohesivePacket, pooled_buffer_move_assignment)
+{
+    auto pool = std::make_shared<ByteBufferPool>(128, 4);
+    ByteBuffer buffer = pool->acquire();
+    const uint8_t* data = buffer.data();
+    buffer.resize(100);
+
+    CohesivePacket packet(std::move(buffer), OsiLayer::Link, pool);
+    CohesivePacket other(ByteBuffer(20), OsiLayer::Link);
+    other.rssi = -70;
+    packet = std::move(other);
+    EXPECT_EQ(20, packet.size());
+    EXPECT_EQ(-70, packet.rssi);
+
+    // replaced buffer is given back to pool
+    ByteBuffer recycled = pool->acquire();
+    EXPECT_EQ(data, recycled.data());
+}
+
+TEST(CohesivePacket, copy_reception_info)
+{
+    CohesivePacket packet(ByteBuffer(8), OsiLayer::Link);
+    packet.rssi = -70;
+    packet.time_received = 12.5;
+
+    CohesivePacket copy(packet);
+    EXPECT_EQ(-70, copy.rssi);
+    EXPECT_DOUBLE_EQ(12.5, copy.time_received);
+
+    CohesivePacket assigned(ByteBuffer(), OsiLayer::Link);
+    assigned = packet;
+    EXPECT_EQ(-70, assigned.rssi);
+    EXPECT_DOUBLE_EQ(12.5, assigned.time_received);
+}
@@ -92,5 +92,6 @@ TEST(MacAddress, hash) {
 
     MacAddress d = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 };
     EXPECT_NE(hash_fn(a), hash_fn(d));
+    EXPECT_NE(hash_fn(c), hash_fn(d));
 }
 
@@ -46,6 +46,57 @@ namespace vanetza
 namespace security
 {
 
+EcdsaNonce::EcdsaNonce(EcdsaNonce&& other) :
+    k_inverse(other.k_inverse), r(other.r)
+{
+    other.wipe();
+}
+
+EcdsaNonce& EcdsaNonce::operator=(EcdsaNonce&& other)
+{
+    if (this != &other) {
+        k_inverse = other.k_inverse;
+        r = other.r;
+        other.wipe();
+    }
+    return *this;
+}
+
+EcdsaNonce::~EcdsaNonce()
+{
+    wipe();
+}
+
+void EcdsaNonce::wipe()
+{
+    // writes through volatile pointers are not removed as dead stores
+    auto clear = [](std::array<uint8_t, 32>& values) {
+        volatile uint8_t* byte = values.data();
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            byte[i] = 0;
+        }
+    };
+    clear(k_inverse);
+    clear(r);
+}
+
+boost::optional<EcdsaNonce> Backend::precompute_nonce(const ecdsa256::PrivateKey&)
+{
+    return boost::none;
+}
+
+EcdsaSignature Backend::sign_precomputed(const ecdsa256::PrivateKey& private_key, const Sha256Digest& digest, const EcdsaNonce&)
+{
+    return sign_digest(private_key, digest);
+}
+
+void Backend::verify_batch(std::vector<SignatureCheck>& checks)
+{
+    for (SignatureCheck& check : checks) {
+        check.verified = verify_digest(*check.public_key, *check.digest, *check.signature);
+    }
+}
+
 const Factory<Backend>& builtin_backends()
 {
     return backend_factory;
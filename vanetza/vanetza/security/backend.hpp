@@ -4,16 +4,64 @@
 #include <vanetza/common/byte_buffer.hpp>
 #include <vanetza/common/factory.hpp>
 #include <vanetza/security/ecdsa256.hpp>
+#include <vanetza/security/sha.hpp>
 #include <vanetza/security/signature.hpp>
 #include <boost/optional/optional.hpp>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace vanetza
 {
 namespace security
 {
 
+/**
+ * Single signature check as part of a batch, see Backend::verify_batch
+ *
+ * Referenced public key, digest and signature have to outlive the check.
+ */
+struct SignatureCheck
+{
+    SignatureCheck(const ecdsa256::PublicKey& key, const Sha256Digest& digest, const EcdsaSignature& sig) :
+        public_key(&key), digest(&digest), signature(&sig), verified(false) {}
+
+    const ecdsa256::PublicKey* public_key;
+    const Sha256Digest* digest; /*< SHA256 digest of signed data */
+    const EcdsaSignature* signature;
+    bool verified; /*< result of check */
+};
+
+/**
+ * Precomputed per-signature values of ECDSA, see Backend::precompute_nonce
+ *
+ * Both values are independent of the signed data: r is the x coordinate of k·G (mod n)
+ * and k_inverse is the inverse of the random nonce k. Each nonce must be used for one signature only!
+ */
+struct EcdsaNonce
+{
+    EcdsaNonce() = default;
+    EcdsaNonce(const EcdsaNonce&) = default;
+    EcdsaNonce& operator=(const EcdsaNonce&) = default;
+
+    // moved-from nonces are wiped, i.e. moving does not leave a copy of k_inverse behind
+    EcdsaNonce(EcdsaNonce&&);
+    EcdsaNonce& operator=(EcdsaNonce&&);
+
+    // leaking k_inverse along with its signature reveals the private key
+    ~EcdsaNonce();
+
+    /**
+     * Overwrite both values with zeros in a way not optimised away by the compiler
+     */
+    void wipe();
+
+    std::array<uint8_t, 32> k_inverse;
+    std::array<uint8_t, 32> r;
+};
+
 /**
  * Interface to cryptographic features
  */
@@ -29,6 +77,38 @@ public:
      */
     virtual EcdsaSignature sign_data(const ecdsa256::PrivateKey& private_key, const ByteBuffer& data) = 0;
 
+    /**
+     * \brief calculate signature for data represented by its digest
+     *
+     * \param private_key Secret private key
+     * \param digest SHA256 digest of plaintext data
+     * \return calculated signature
+     */
+    virtual EcdsaSignature sign_digest(const ecdsa256::PrivateKey& private_key, const Sha256Digest& digest) = 0;
+
+    /**
+     * \brief precompute nonce for a later signature
+     *
+     * The expensive scalar multiplication of signing is done here, i.e. sign_precomputed
+     * reduces to a few modular operations. The default implementation does not support precomputation.
+     *
+     * \param private_key key the nonce will be used with
+     * \return nonce or none if not supported by backend
+     */
+    virtual boost::optional<EcdsaNonce> precompute_nonce(const ecdsa256::PrivateKey& private_key);
+
+    /**
+     * \brief calculate signature using a precomputed nonce
+     *
+     * The default implementation ignores the nonce and invokes sign_digest.
+     *
+     * \param private_key Secret private key
+     * \param digest SHA256 digest of plaintext data
+     * \param nonce nonce obtained by precompute_nonce for same private key, it must not be used again
+     * \return calculated signature
+     */
+    virtual EcdsaSignature sign_precomputed(const ecdsa256::PrivateKey& private_key, const Sha256Digest& digest, const EcdsaNonce& nonce);
+
     /**
      * \brief try to verify data using public key and signature
      *
@@ -39,6 +119,26 @@ public:
      */
     virtual bool verify_data(const ecdsa256::PublicKey& public_key, const ByteBuffer& data, const EcdsaSignature& sig) = 0;
 
+    /**
+     * \brief try to verify data represented by its digest using public key and signature
+     *
+     * \param public_key Public key
+     * \param digest SHA256 digest of plaintext
+     * \param sig signature of data
+     * \return true if the data could be verified
+     */
+    virtual bool verify_digest(const ecdsa256::PublicKey& public_key, const Sha256Digest& digest, const EcdsaSignature& sig) = 0;
+
+    /**
+     * \brief verify several signatures at once
+     *
+     * Backends may take advantage of checks sharing a public key, e.g. by preparing each key only once.
+     * The default implementation invokes verify_digest for each check.
+     *
+     * \param checks signature checks, their verified flags are set accordingly
+     */
+    virtual void verify_batch(std::vector<SignatureCheck>& checks);
+
     /**
      * \brief decompress a possibly compressed elliptic curve point
      *
@@ -1,5 +1,6 @@
 #include <vanetza/security/backend_cryptopp.hpp>
 #include <vanetza/security/ecc_point.hpp>
+#include <vanetza/security/public_key.hpp>
 #include <cryptopp/oids.h>
 #include <algorithm>
 #include <cassert>
@@ -47,6 +48,44 @@ EcdsaSignature BackendCryptoPP::sign_data(const PrivateKey& private_key, const B
     return ecdsa_signature;
 }
 
+EcdsaSignature BackendCryptoPP::sign_digest(const ecdsa256::PrivateKey& generic_key, const Sha256Digest& digest)
+{
+    // SHA256 digest and group order of NIST P-256 have equal length, i.e. digest needs no truncation
+    const PrivateKey& private_key = m_private_cache[generic_key];
+    const auto& params = private_key.GetGroupParameters();
+    const CryptoPP::Integer& order = params.GetSubgroupOrder();
+    const CryptoPP::Integer e { digest.data(), digest.size() };
+    const CryptoPP::Integer k { m_prng, CryptoPP::Integer::One(), order - 1 };
+
+    // GDSA's Sign only reduces r, it has to be x(k·G) already like in DL_SignerBase::SignAndRestart
+    CryptoPP::Integer r = params.ConvertElementToInteger(params.ExponentiateBase(k));
+    CryptoPP::Integer s;
+    CryptoPP::DL_Algorithm_ECDSA<CryptoPP::ECP> algorithm;
+    algorithm.Sign(params, private_key.GetPrivateExponent(), k, e, r, s);
+
+    const std::size_t len = field_size(PublicKeyAlgorithm::ECDSA_NISTP256_With_SHA256);
+    EcdsaSignature ecdsa_signature;
+    X_Coordinate_Only coordinate;
+    coordinate.x.resize(len);
+    r.Encode(coordinate.x.data(), coordinate.x.size());
+    ecdsa_signature.R = std::move(coordinate);
+    ecdsa_signature.s.resize(len);
+    s.Encode(ecdsa_signature.s.data(), ecdsa_signature.s.size());
+    return ecdsa_signature;
+}
+
+bool BackendCryptoPP::verify_digest(const ecdsa256::PublicKey& generic_key, const Sha256Digest& digest, const EcdsaSignature& sig)
+{
+    const ByteBuffer r_buffer = convert_for_signing(sig.R);
+    const CryptoPP::Integer r { r_buffer.data(), r_buffer.size() };
+    const CryptoPP::Integer s { sig.s.data(), sig.s.size() };
+    const CryptoPP::Integer e { digest.data(), digest.size() };
+
+    const PublicKey& public_key = m_public_cache[generic_key];
+    CryptoPP::DL_Algorithm_ECDSA<CryptoPP::ECP> algorithm;
+    return algorithm.Verify(public_key.GetGroupParameters(), public_key, e, r, s);
+}
+
 bool BackendCryptoPP::verify_data(const ecdsa256::PublicKey& generic_key, const ByteBuffer& msg, const EcdsaSignature& sig)
 {
     const ByteBuffer sigbuf = extract_signature_buffer(sig);
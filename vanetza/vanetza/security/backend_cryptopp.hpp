@@ -28,9 +28,15 @@ public:
     /// \see Backend::sign_data
     EcdsaSignature sign_data(const ecdsa256::PrivateKey& private_key, const ByteBuffer& data_buffer) override;
 
+    /// \see Backend::sign_digest
+    EcdsaSignature sign_digest(const ecdsa256::PrivateKey& private_key, const Sha256Digest& digest) override;
+
     /// \see Backend::verify_data
     bool verify_data(const ecdsa256::PublicKey& public_key, const ByteBuffer& data, const EcdsaSignature& sig) override;
 
+    /// \see Backend::verify_digest
+    bool verify_digest(const ecdsa256::PublicKey& public_key, const Sha256Digest& digest, const EcdsaSignature& sig) override;
+
     /// \see Backend::decompress_point
     boost::optional<Uncompressed> decompress_point(const EccPoint& ecc_point) override;
 
@@ -14,12 +14,24 @@ EcdsaSignature BackendNull::sign_data(const ecdsa256::PrivateKey&, const ByteBuf
     return fake;
 }
 
+EcdsaSignature BackendNull::sign_digest(const ecdsa256::PrivateKey&, const Sha256Digest&)
+{
+    static const EcdsaSignature fake = fake_signature();
+    return fake;
+}
+
 bool BackendNull::verify_data(const ecdsa256::PublicKey&, const ByteBuffer&, const EcdsaSignature&)
 {
     // accept everything
     return true;
 }
 
+bool BackendNull::verify_digest(const ecdsa256::PublicKey&, const Sha256Digest&, const EcdsaSignature&)
+{
+    // accept everything
+    return true;
+}
+
 boost::optional<Uncompressed> BackendNull::decompress_point(const EccPoint& ecc_point)
 {
     return boost::none;
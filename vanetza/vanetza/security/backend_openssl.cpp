@@ -5,31 +5,64 @@
 #include <openssl/bn.h>
 #include <openssl/ec.h>
 #include <openssl/ecdsa.h>
+#include <openssl/evp.h>
 #include <openssl/obj_mac.h>
-#include <openssl/sha.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#   include <openssl/core_names.h>
+#   include <openssl/param_build.h>
+#endif
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <numeric>
 
 namespace vanetza
 {
 namespace security
 {
 
-BackendOpenSsl::BackendOpenSsl()
+namespace
 {
-#if OPENSSL_API_COMPAT < 0x10100000L
-    ERR_load_crypto_strings();
-#else
-    OPENSSL_init_crypto(OPENSSL_INIT_LOAD_CRYPTO_STRINGS, nullptr);
-#endif
+
+// DER encoded ECDSA-P256 signatures take at most 72 bytes
+constexpr std::size_t max_der_signature = 72;
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+openssl::EvpKey build_key(int selection, const ByteBuffer& public_point, BIGNUM* private_key)
+{
+    std::unique_ptr<OSSL_PARAM_BLD, decltype(&OSSL_PARAM_BLD_free)> builder { OSSL_PARAM_BLD_new(), &OSSL_PARAM_BLD_free };
+    openssl::check(builder != nullptr);
+    openssl::check(OSSL_PARAM_BLD_push_utf8_string(builder.get(), OSSL_PKEY_PARAM_GROUP_NAME, SN_X9_62_prime256v1, 0));
+    openssl::check(OSSL_PARAM_BLD_push_octet_string(builder.get(), OSSL_PKEY_PARAM_PUB_KEY, public_point.data(), public_point.size()));
+    if (private_key) {
+        openssl::check(OSSL_PARAM_BLD_push_BN(builder.get(), OSSL_PKEY_PARAM_PRIV_KEY, private_key));
+    }
+    std::unique_ptr<OSSL_PARAM, decltype(&OSSL_PARAM_free)> params { OSSL_PARAM_BLD_to_param(builder.get()), &OSSL_PARAM_free };
+    openssl::check(params != nullptr);
+
+    std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> ctx { EVP_PKEY_CTX_new_from_name(nullptr, "EC", nullptr), &EVP_PKEY_CTX_free };
+    openssl::check(ctx != nullptr);
+    EVP_PKEY* pkey = nullptr;
+    openssl::check(EVP_PKEY_fromdata_init(ctx.get()) == 1);
+    openssl::check(EVP_PKEY_fromdata(ctx.get(), &pkey, selection, params.get()) == 1);
+    return openssl::EvpKey { pkey };
 }
 
-EcdsaSignature BackendOpenSsl::sign_data(const ecdsa256::PrivateKey& key, const ByteBuffer& data)
+ByteBuffer uncompressed_point(const ecdsa256::PublicKey& key)
 {
-    auto priv_key = internal_private_key(key);
-    auto digest = calculate_digest(data);
+    const auto& x = key.x;
+    const auto& y = key.y;
+    ByteBuffer point;
+    point.reserve(1 + x.size() + y.size());
+    point.push_back(0x04);
+    point.insert(point.end(), x.begin(), x.end());
+    point.insert(point.end(), y.begin(), y.end());
+    return point;
+}
+#endif
 
-    // sign message data represented by the digest
-    openssl::Signature signature { ECDSA_do_sign(digest.data(), digest.size(), priv_key) };
+EcdsaSignature convert_signature(openssl::Signature& signature)
+{
 #if OPENSSL_API_COMPAT < 0x10100000L
     const BIGNUM* sig_r = signature->r;
     const BIGNUM* sig_s = signature->s;
@@ -62,13 +95,158 @@ EcdsaSignature BackendOpenSsl::sign_data(const ecdsa256::PrivateKey& key, const
     return ecdsa_signature;
 }
 
+/// store big number with leading zeros, fails if number does not fit
+bool store(const BIGNUM* bn, std::array<uint8_t, 32>& bin)
+{
+    const auto num_bytes = BN_num_bytes(bn);
+    if (num_bytes < 0 || static_cast<std::size_t>(num_bytes) > bin.size()) {
+        return false;
+    }
+    std::fill(bin.begin(), bin.end() - num_bytes, 0x00);
+    BN_bn2bin(bn, bin.data() + bin.size() - num_bytes);
+    return true;
+}
+
+/**
+ * Prepare context for repeated operations with key, key is validated once
+ * \param pkey key
+ * \param keypair true if key contains private key as well
+ * \param init operation initialisation, e.g. EVP_PKEY_sign_init
+ */
+std::unique_ptr<openssl::KeyContext> prepare_key(openssl::EvpKey& pkey, bool keypair, int (*init)(EVP_PKEY_CTX*))
+{
+    std::unique_ptr<openssl::KeyContext> ctx { new openssl::KeyContext(pkey) };
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    openssl::check((keypair ? EVP_PKEY_check(*ctx) : EVP_PKEY_public_check(*ctx)) == 1);
+#else
+    (void) keypair; // validated by EC_KEY_check_key before
+#endif
+    openssl::check(init(*ctx) == 1);
+    return ctx;
+}
+
+} // namespace
+
+BackendOpenSsl::BackendOpenSsl() :
+    m_private_cache(std::bind(&BackendOpenSsl::internal_private_key, this, std::placeholders::_1), 8),
+    m_public_cache(std::bind(&BackendOpenSsl::internal_public_key, this, std::placeholders::_1), 2048),
+    m_ec_key_cache(std::bind(&BackendOpenSsl::internal_ec_key, this, std::placeholders::_1), 8)
+{
+#if OPENSSL_API_COMPAT < 0x10100000L
+    ERR_load_crypto_strings();
+#else
+    OPENSSL_init_crypto(OPENSSL_INIT_LOAD_CRYPTO_STRINGS, nullptr);
+#endif
+    m_digest.reset(new openssl::Sha256Context());
+}
+
+BackendOpenSsl::~BackendOpenSsl()
+{
+}
+
+EcdsaSignature BackendOpenSsl::sign_data(const ecdsa256::PrivateKey& key, const ByteBuffer& data)
+{
+    return sign_digest(key, calculate_digest(data));
+}
+
+EcdsaSignature BackendOpenSsl::sign_digest(const ecdsa256::PrivateKey& key, const Sha256Digest& digest)
+{
+    openssl::KeyContext& ctx = *m_private_cache[key];
+
+    // sign message data represented by the digest
+    std::array<uint8_t, max_der_signature> der;
+    std::size_t der_length = der.size();
+    openssl::check(EVP_PKEY_sign(ctx, der.data(), &der_length, digest.data(), digest.size()) == 1);
+    const unsigned char* der_ptr = der.data();
+    openssl::Signature signature { d2i_ECDSA_SIG(nullptr, &der_ptr, der_length) };
+    return convert_signature(signature);
+}
+
+boost::optional<EcdsaNonce> BackendOpenSsl::precompute_nonce(const ecdsa256::PrivateKey& key)
+{
+    openssl::Key& ec_key = *m_ec_key_cache[key];
+    BIGNUM* k_inverse = nullptr;
+    BIGNUM* r = nullptr;
+    openssl::check(ECDSA_sign_setup(ec_key, nullptr, &k_inverse, &r) == 1);
+
+    EcdsaNonce nonce;
+    const bool stored = store(k_inverse, nonce.k_inverse) && store(r, nonce.r);
+    BN_clear_free(k_inverse);
+    BN_clear_free(r);
+    openssl::check(stored);
+    return nonce;
+}
+
+EcdsaSignature BackendOpenSsl::sign_precomputed(const ecdsa256::PrivateKey& key, const Sha256Digest& digest, const EcdsaNonce& nonce)
+{
+    openssl::Key& ec_key = *m_ec_key_cache[key];
+
+    openssl::BigNumber k_inverse(nonce.k_inverse);
+    openssl::BigNumber r(nonce.r);
+    openssl::Signature signature { ECDSA_do_sign_ex(digest.data(), digest.size(), k_inverse, r, ec_key) };
+    return convert_signature(signature);
+}
+
 bool BackendOpenSsl::verify_data(const ecdsa256::PublicKey& key, const ByteBuffer& data, const EcdsaSignature& sig)
 {
-    auto digest = calculate_digest(data);
-    auto pub = internal_public_key(key);
+    return verify_digest(key, calculate_digest(data), sig);
+}
+
+bool BackendOpenSsl::verify_digest(const ecdsa256::PublicKey& key, const Sha256Digest& digest, const EcdsaSignature& sig)
+{
+    try {
+        return verify_prepared(*m_public_cache[key], digest, sig);
+    } catch (openssl::Exception&) {
+        // invalid public key
+        return false;
+    }
+}
+
+bool BackendOpenSsl::verify_prepared(openssl::KeyContext& ctx, const Sha256Digest& digest, const EcdsaSignature& sig)
+{
     openssl::Signature signature(sig);
+    std::array<uint8_t, max_der_signature> der;
+    unsigned char* der_ptr = der.data();
+    const int der_length = i2d_ECDSA_SIG(signature, &der_ptr);
+    if (der_length <= 0 || static_cast<std::size_t>(der_length) > der.size()) {
+        return false;
+    }
 
-    return (ECDSA_do_verify(digest.data(), digest.size(), signature, pub) == 1);
+    return EVP_PKEY_verify(ctx, der.data(), der_length, digest.data(), digest.size()) == 1;
+}
+
+void BackendOpenSsl::verify_batch(std::vector<SignatureCheck>& checks)
+{
+    // order checks by public key, thus each distinct key is looked up only once
+    std::vector<std::size_t> order(checks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&checks](std::size_t lhs, std::size_t rhs) {
+        const ecdsa256::PublicKey& a = *checks[lhs].public_key;
+        const ecdsa256::PublicKey& b = *checks[rhs].public_key;
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+
+    auto group_begin = order.begin();
+    while (group_begin != order.end()) {
+        const ecdsa256::PublicKey& key = *checks[*group_begin].public_key;
+        auto group_end = std::find_if(group_begin, order.end(),
+                [&checks, &key](std::size_t i) { return *checks[i].public_key != key; });
+
+        try {
+            openssl::KeyContext& ctx = *m_public_cache[key];
+            for (auto it = group_begin; it != group_end; ++it) {
+                SignatureCheck& check = checks[*it];
+                check.verified = verify_prepared(ctx, *check.digest, *check.signature);
+            }
+        } catch (openssl::Exception&) {
+            // invalid public key fails its checks only instead of the whole batch
+            for (auto it = group_begin; it != group_end; ++it) {
+                checks[*it].verified = false;
+            }
+        }
+
+        group_begin = group_end;
+    }
 }
 
 boost::optional<Uncompressed> BackendOpenSsl::decompress_point(const EccPoint& ecc_point)
@@ -135,44 +313,71 @@ boost::optional<Uncompressed> BackendOpenSsl::decompress_point(const EccPoint& e
     }
 }
 
-std::array<uint8_t, 32> BackendOpenSsl::calculate_digest(const ByteBuffer& data) const
+Sha256Digest BackendOpenSsl::calculate_digest(const ByteBuffer& data)
+{
+    return m_digest->digest(data.data(), data.size());
+}
+
+auto BackendOpenSsl::internal_private_key(const ecdsa256::PrivateKey& generic) const -> KeyContextPtr
 {
-    static_assert(SHA256_DIGEST_LENGTH == 32, "Unexpected length of SHA256 digest");
+    openssl::BigNumber prv(generic.key);
+
+    // OpenSSL requires public key, so we recreate it from private key
+    openssl::BigNumberContext bn_ctx;
+    openssl::Group group(NID_X9_62_prime256v1);
+    openssl::Point pub(group);
+    openssl::check(EC_POINT_mul(group, pub, prv, nullptr, nullptr, bn_ctx));
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    ByteBuffer pub_octets(1 + 2 * field_size(PublicKeyAlgorithm::ECDSA_NISTP256_With_SHA256));
+    openssl::check(EC_POINT_point2oct(group, pub, POINT_CONVERSION_UNCOMPRESSED,
+            pub_octets.data(), pub_octets.size(), bn_ctx) == pub_octets.size());
+    openssl::EvpKey pkey = build_key(EVP_PKEY_KEYPAIR, pub_octets, prv);
+#else
+    KeyPtr key = internal_ec_key(generic);
+    // own key signs repeatedly, multiples of generator speed up signing
+    EC_KEY_precompute_mult(*key, bn_ctx);
+
+    openssl::EvpKey pkey;
+    openssl::check(EVP_PKEY_set1_EC_KEY(pkey, *key));
+#endif
 
-    std::array<uint8_t, 32> digest;
-    SHA256_CTX ctx;
-    SHA256_Init(&ctx);
-    SHA256_Update(&ctx, data.data(), data.size());
-    SHA256_Final(digest.data(), &ctx);
-    return digest;
+    return prepare_key(pkey, true, &EVP_PKEY_sign_init);
 }
 
-openssl::Key BackendOpenSsl::internal_private_key(const ecdsa256::PrivateKey& generic) const
+auto BackendOpenSsl::internal_ec_key(const ecdsa256::PrivateKey& generic) const -> KeyPtr
 {
-    openssl::Key key(NID_X9_62_prime256v1);
+    KeyPtr key { new openssl::Key(NID_X9_62_prime256v1) };
     openssl::BigNumber prv(generic.key);
-    EC_KEY_set_private_key(key, prv);
+    EC_KEY_set_private_key(*key, prv);
 
     // OpenSSL requires public key, so we recreate it from private key
     openssl::BigNumberContext ctx;
-    const EC_GROUP* group = EC_KEY_get0_group(key);
+    const EC_GROUP* group = EC_KEY_get0_group(*key);
     openssl::Point pub(group);
     openssl::check(EC_POINT_mul(group, pub, prv, nullptr, nullptr, ctx));
-    EC_KEY_set_public_key(key, pub);
+    EC_KEY_set_public_key(*key, pub);
 
-    openssl::check(EC_KEY_check_key(key));
+    openssl::check(EC_KEY_check_key(*key));
     return key;
 }
 
-openssl::Key BackendOpenSsl::internal_public_key(const ecdsa256::PublicKey& generic) const
+auto BackendOpenSsl::internal_public_key(const ecdsa256::PublicKey& generic) const -> KeyContextPtr
 {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    openssl::EvpKey pkey = build_key(EVP_PKEY_PUBLIC_KEY, uncompressed_point(generic), nullptr);
+#else
     openssl::Key key(NID_X9_62_prime256v1);
     openssl::BigNumber x(generic.x);
     openssl::BigNumber y(generic.y);
     EC_KEY_set_public_key_affine_coordinates(key, x, y);
-
     openssl::check(EC_KEY_check_key(key));
-    return key;
+
+    openssl::EvpKey pkey;
+    openssl::check(EVP_PKEY_set1_EC_KEY(pkey, key));
+#endif
+
+    return prepare_key(pkey, false, &EVP_PKEY_verify_init);
 }
 
 } // namespace security
@@ -1,9 +1,11 @@
 #ifndef BACKEND_OPENSSL_HPP_CRRV8DCH
 #define BACKEND_OPENSSL_HPP_CRRV8DCH
 
+#include <vanetza/common/lru_cache.hpp>
 #include <vanetza/security/backend.hpp>
 #include <array>
 #include <cstdint>
+#include <memory>
 
 namespace vanetza
 {
@@ -14,11 +16,15 @@ namespace security
 namespace openssl
 {
 class Key;
+class KeyContext;
+class Sha256Context;
 } // namespace openssl
 
 
 /**
  * \brief Backend implementation based on OpenSSL
+ *
+ * Keys are converted and validated once, their prepared signing and verification contexts are cached.
  */
 class BackendOpenSsl : public Backend
 {
@@ -26,25 +32,55 @@ public:
     static constexpr auto backend_name = "OpenSSL";
 
     BackendOpenSsl();
+    ~BackendOpenSsl();
 
     /// \see Backend::sign_data
     EcdsaSignature sign_data(const ecdsa256::PrivateKey& private_key, const ByteBuffer& data_buffer) override;
 
+    /// \see Backend::sign_digest
+    EcdsaSignature sign_digest(const ecdsa256::PrivateKey& private_key, const Sha256Digest& digest) override;
+
+    /// \see Backend::precompute_nonce
+    boost::optional<EcdsaNonce> precompute_nonce(const ecdsa256::PrivateKey& private_key) override;
+
+    /// \see Backend::sign_precomputed
+    EcdsaSignature sign_precomputed(const ecdsa256::PrivateKey& private_key, const Sha256Digest& digest, const EcdsaNonce& nonce) override;
+
     /// \see Backend::verify_data
     bool verify_data(const ecdsa256::PublicKey& public_key, const ByteBuffer& data, const EcdsaSignature& sig) override;
 
+    /// \see Backend::verify_digest
+    bool verify_digest(const ecdsa256::PublicKey& public_key, const Sha256Digest& digest, const EcdsaSignature& sig) override;
+
+    /// \see Backend::verify_batch
+    void verify_batch(std::vector<SignatureCheck>& checks) override;
+
     /// \see Backend::decompress_point
     boost::optional<Uncompressed> decompress_point(const EccPoint& ecc_point) override;
 
 private:
+    using KeyPtr = std::unique_ptr<openssl::Key>;
+    using KeyContextPtr = std::unique_ptr<openssl::KeyContext>;
+
     /// calculate SHA256 digest of data buffer
-    std::array<uint8_t, 32> calculate_digest(const ByteBuffer& data) const;
+    Sha256Digest calculate_digest(const ByteBuffer& data);
+
+    /// verify signature of digest using prepared verification context
+    bool verify_prepared(openssl::KeyContext&, const Sha256Digest& digest, const EcdsaSignature& sig);
+
+    /// convert to internal format of private key, ready for signing
+    KeyContextPtr internal_private_key(const ecdsa256::PrivateKey&) const;
+
+    /// convert to low-level EC key, required for signing with precomputed nonces
+    KeyPtr internal_ec_key(const ecdsa256::PrivateKey&) const;
 
-    /// convert to internal format of private key
-    openssl::Key internal_private_key(const ecdsa256::PrivateKey&) const;
+    /// convert to internal format of public key, ready for verification
+    KeyContextPtr internal_public_key(const ecdsa256::PublicKey&) const;
 
-    /// convert to internal format of public key
-    openssl::Key internal_public_key(const ecdsa256::PublicKey&) const;
+    std::unique_ptr<openssl::Sha256Context> m_digest;
+    LruCache<ecdsa256::PrivateKey, KeyContextPtr> m_private_cache;
+    LruCache<ecdsa256::PublicKey, KeyContextPtr> m_public_cache;
+    LruCache<ecdsa256::PrivateKey, KeyPtr> m_ec_key_cache;
 };
 
 } // namespace security
@@ -1,11 +1,9 @@
-#include <vanetza/common/byte_buffer_sink.hpp>
 #include <vanetza/common/serialization_buffer.hpp>
 #include <vanetza/security/certificate.hpp>
 #include <vanetza/security/length_coding.hpp>
 #include <vanetza/security/sha.hpp>
 #include <vanetza/security/signer_info.hpp>
 #include <vanetza/security/exception.hpp>
-#include <boost/iostreams/stream.hpp>
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/get.hpp>
 #include <boost/variant/static_visitor.hpp>
@@ -65,10 +63,7 @@ size_t deserialize(InputArchive& ar, Certificate& cert)
 ByteBuffer convert_for_signing(const Certificate& cert)
 {
     ByteBuffer buf;
-    byte_buffer_sink sink(buf);
-
-    boost::iostreams::stream_buffer<byte_buffer_sink> stream(sink);
-    OutputArchive ar(stream);
+    OutputArchive ar(buf);
 
     const uint8_t version = cert.version();
     ar << version;
@@ -76,8 +71,6 @@ ByteBuffer convert_for_signing(const Certificate& cert)
     serialize(ar, cert.subject_info);
     serialize(ar, cert.subject_attributes);
     serialize(ar, cert.validity_restriction);
-
-    stream.close();
     return buf;
 }
 
@@ -5,49 +5,84 @@ namespace vanetza
 {
 namespace security
 {
-
-CertificateCache::CertificateCache(const Runtime& rt) : m_runtime(rt)
+namespace
 {
-}
 
-void CertificateCache::insert(const Certificate& certificate)
+Clock::duration cache_lifetime(SubjectType subject_type)
 {
-    const HashedId8 id = calculate_hash(certificate);
-
-    // this may drop expired entries and extend some's lifetime
-    std::list<Certificate> certs = lookup(id, certificate.subject_info.subject_type);
-
-    // TODO: implement equality comparison for Certificate
-    if (certs.size()) {
-        const auto binary_insert = convert_for_signing(certificate);
-        for (auto& cert : certs) {
-            const auto binary_found = convert_for_signing(cert);
-            if (binary_insert == binary_found) {
-                return;
-            }
-        }
-    }
-
     Clock::duration lifetime = Clock::duration::zero();
-    if (certificate.subject_info.subject_type == SubjectType::Authorization_Ticket) {
+    if (subject_type == SubjectType::Authorization_Ticket) {
         // section 7.1 in ETSI TS 103 097 v1.2.1
         // there must be a CAM with the authorization ticket every one second
         // we choose two seconds here to account for one missed message
         lifetime = std::chrono::seconds(2);
-    } else if (certificate.subject_info.subject_type == SubjectType::Authorization_Authority) {
+    } else if (subject_type == SubjectType::Authorization_Authority) {
         // section 7.1 in ETSI TS 103 097 v1.2.1
         // chains are only sent upon request, there will probably only be a few authoritation authorities in use
         // one hour is an arbitrarily choosen cache period for now
         lifetime = std::chrono::seconds(3600);
     }
+    return lifetime;
+}
+
+} // namespace
+
+constexpr std::size_t CertificateCache::default_capacity;
+
+CertificateCache::CertificateCache(const Runtime& rt, std::size_t capacity) :
+    m_runtime(rt), m_capacity(capacity)
+{
+}
+
+void CertificateCache::insert(const Certificate& certificate)
+{
+    store(certificate);
+}
+
+void CertificateCache::insert(const Certificate& certificate, const ecdsa256::PublicKey& public_key)
+{
+    if (certificate.subject_info.subject_type != SubjectType::Authorization_Ticket) {
+        return;
+    }
+
+    map_type::iterator stored = store(certificate);
+    if (stored != m_certificates.end()) {
+        stored->second.public_key = public_key;
+    }
+}
+
+CertificateCache::map_type::iterator CertificateCache::store(const Certificate& certificate)
+{
+    const SubjectType subject_type = certificate.subject_info.subject_type;
+    const Clock::duration lifetime = cache_lifetime(subject_type);
+    if (lifetime == Clock::duration::zero() || m_capacity == 0) {
+        return m_certificates.end();
+    }
+
+    drop_expired();
+
+    const HashedId8 id = calculate_hash(certificate);
+    ByteBuffer binary = convert_for_signing(certificate);
+    map_type::iterator found = find(id, binary, subject_type);
+    if (found != m_certificates.end()) {
+        refresh(found->second);
+        return found;
+    }
 
-    if (lifetime > Clock::duration::zero()) {
-        CachedCertificate entry;
-        entry.certificate = certificate;
-        map_type::iterator stored = m_certificates.emplace(id, entry);
-        heap_type::handle_type& handle = stored->second.handle;
-        handle = m_expiries.push(Expiry { m_runtime.now() + lifetime, stored });
+    if (m_certificates.size() >= m_capacity) {
+        // make room by dropping the entry closest to its expiry
+        m_certificates.erase(m_expiries.top().certificate);
+        m_expiries.pop();
+        ++m_statistics.evictions;
     }
+
+    CachedCertificate entry;
+    entry.certificate = certificate;
+    entry.binary = std::move(binary);
+    map_type::iterator stored = m_certificates.emplace(id, std::move(entry));
+    heap_type::handle_type& handle = stored->second.handle;
+    handle = m_expiries.push(Expiry { m_runtime.now() + lifetime, stored });
+    return stored;
 }
 
 std::list<Certificate> CertificateCache::lookup(const HashedId8& id, SubjectType type)
@@ -69,16 +104,74 @@ std::list<Certificate> CertificateCache::lookup(const HashedId8& id, SubjectType
         matches.push_back(cert);
 
         // renew cached certificate
-        if (subject_type == SubjectType::Authorization_Ticket) {
-            refresh(item->second.handle, std::chrono::seconds(2));
-        } else if (subject_type == SubjectType::Authorization_Authority) {
-            refresh(item->second.handle, std::chrono::seconds(3600));
+        refresh(item->second);
+    }
+
+    return matches;
+}
+
+std::list<CertificateCache::Signer> CertificateCache::lookup_signers(const HashedId8& id)
+{
+    drop_expired();
+
+    std::list<Signer> matches;
+    bool verified = false;
+    auto range = m_certificates.equal_range(id);
+    for (auto item = range.first; item != range.second; ++item) {
+        CachedCertificate& cached = item->second;
+        if (cached.certificate.subject_info.subject_type != SubjectType::Authorization_Ticket) {
+            continue;
         }
+
+        matches.push_back(Signer { cached.certificate, cached.public_key });
+        verified |= cached.public_key.is_initialized();
+        refresh(cached);
+    }
+
+    if (verified) {
+        ++m_statistics.hits;
+    } else {
+        ++m_statistics.misses;
     }
 
     return matches;
 }
 
+boost::optional<ecdsa256::PublicKey> CertificateCache::lookup_verified(const HashedId8& id, const Certificate& certificate)
+{
+    drop_expired();
+
+    boost::optional<ecdsa256::PublicKey> public_key;
+    if (m_certificates.count(id) > 0) {
+        // identical digests are very likely but not guaranteed to belong to the same certificate
+        map_type::iterator found = find(id, convert_for_signing(certificate), SubjectType::Authorization_Ticket);
+        if (found != m_certificates.end() && found->second.public_key) {
+            public_key = found->second.public_key;
+            refresh(found->second);
+        }
+    }
+
+    if (public_key) {
+        ++m_statistics.hits;
+    } else {
+        ++m_statistics.misses;
+    }
+
+    return public_key;
+}
+
+CertificateCache::map_type::iterator CertificateCache::find(const HashedId8& id, const ByteBuffer& binary, SubjectType type)
+{
+    auto range = m_certificates.equal_range(id);
+    for (auto item = range.first; item != range.second; ++item) {
+        const CachedCertificate& cached = item->second;
+        if (cached.certificate.subject_info.subject_type == type && cached.binary == binary) {
+            return item;
+        }
+    }
+    return m_certificates.end();
+}
+
 void CertificateCache::drop_expired()
 {
     while (!m_expiries.empty() && is_expired(m_expiries.top())) {
@@ -92,10 +185,11 @@ bool CertificateCache::is_expired(const Expiry& expiry) const
     return m_runtime.now() > expiry;
 }
 
-void CertificateCache::refresh(heap_type::handle_type& handle, Clock::duration lifetime)
+void CertificateCache::refresh(CachedCertificate& cached)
 {
-    static_cast<Clock::time_point&>(*handle) = m_runtime.now() + lifetime;
-    m_expiries.update(handle);
+    const Clock::duration lifetime = cache_lifetime(cached.certificate.subject_info.subject_type);
+    static_cast<Clock::time_point&>(*cached.handle) = m_runtime.now() + lifetime;
+    m_expiries.update(cached.handle);
 }
 
 CertificateCache::Expiry::Expiry(Clock::time_point expiry, map_type::iterator it) :
@@ -4,7 +4,9 @@
 #include <vanetza/common/clock.hpp>
 #include <vanetza/common/runtime.hpp>
 #include <vanetza/security/certificate.hpp>
+#include <vanetza/security/ecdsa256.hpp>
 #include <boost/heap/binomial_heap.hpp>
+#include <boost/optional/optional.hpp>
 #include <list>
 #include <map>
 
@@ -17,11 +19,40 @@ namespace security
 /**
  * CertificateCache remembers validated certificates for some time.
  * This is necessary for certificate lookup when only its digest is known.
+ *
+ * Authorization tickets can be stored along with their public key, i.e. as verified signers.
+ * Later messages of such a signer require only their signature to be checked.
  */
 class CertificateCache
 {
 public:
-    CertificateCache(const Runtime& rt);
+    static constexpr std::size_t default_capacity = 4096;
+
+    /**
+     * Authorization ticket stored in cache
+     */
+    struct Signer
+    {
+        Certificate certificate;
+        boost::optional<ecdsa256::PublicKey> public_key; /*< present for verified signers */
+    };
+
+    /**
+     * Counters of signer lookups and evictions
+     */
+    struct Statistics
+    {
+        std::size_t hits = 0; /*< signer lookups finding a verified signer */
+        std::size_t misses = 0; /*< signer lookups without verified signer */
+        std::size_t evictions = 0; /*< entries dropped before expiry because cache was full */
+    };
+
+    /**
+     * Create certificate cache
+     * \param rt runtime
+     * \param capacity maximum number of stored certificates
+     */
+    CertificateCache(const Runtime& rt, std::size_t capacity = default_capacity);
 
     /**
      * Puts a (validated) certificate into the cache.
@@ -30,6 +61,14 @@ public:
      */
     void insert(const Certificate& certificate);
 
+    /**
+     * Puts a verified signer's certificate into the cache.
+     *
+     * \param certificate completely validated authorization ticket
+     * \param public_key public key extracted from certificate
+     */
+    void insert(const Certificate& certificate, const ecdsa256::PublicKey& public_key);
+
     /**
      * Lookup certificates based on the passed HashedId8.
      *
@@ -39,12 +78,41 @@ public:
      */
     std::list<Certificate> lookup(const HashedId8& id, SubjectType type);
 
+    /**
+     * Lookup authorization tickets based on the passed HashedId8.
+     *
+     * \param id hash identifier of the certificate
+     * \return all stored authorization tickets matching the passed identifier
+     */
+    std::list<Signer> lookup_signers(const HashedId8& id);
+
+    /**
+     * Lookup public key of a verified signer identical to given certificate.
+     *
+     * \param id hash identifier of the certificate
+     * \param certificate received authorization ticket
+     * \return public key if certificate has been verified before
+     */
+    boost::optional<ecdsa256::PublicKey> lookup_verified(const HashedId8& id, const Certificate& certificate);
+
     /**
      * Number of currently stored certificates
      * \return cache size
      */
     std::size_t size() const { return m_certificates.size(); }
 
+    /**
+     * Maximum number of stored certificates
+     * \return cache capacity
+     */
+    std::size_t capacity() const { return m_capacity; }
+
+    /**
+     * Get signer lookup and eviction counters
+     * \return statistics
+     */
+    const Statistics& statistics() const { return m_statistics; }
+
 private:
     struct CachedCertificate;
     using map_type = std::multimap<HashedId8, CachedCertificate>;
@@ -60,16 +128,22 @@ private:
     struct CachedCertificate
     {
         Certificate certificate;
+        ByteBuffer binary; /*< certificate data covered by its signature */
+        boost::optional<ecdsa256::PublicKey> public_key;
         heap_type::handle_type handle;
     };
 
     const Runtime& m_runtime;
+    const std::size_t m_capacity;
     heap_type m_expiries;
     map_type m_certificates;
+    Statistics m_statistics;
 
+    map_type::iterator store(const Certificate&);
+    map_type::iterator find(const HashedId8&, const ByteBuffer& binary, SubjectType);
     void drop_expired();
     bool is_expired(const Expiry&) const;
-    void refresh(heap_type::handle_type&, Clock::duration);
+    void refresh(CachedCertificate&);
 };
 
 } // namespace security
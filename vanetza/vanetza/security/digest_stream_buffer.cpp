@@ -0,0 +1,59 @@
+#include <vanetza/security/digest_stream_buffer.hpp>
+#include <cstring>
+
+namespace vanetza
+{
+namespace security
+{
+
+DigestStreamBuffer::DigestStreamBuffer()
+{
+    setp(m_block.data(), m_block.data() + m_block.size());
+}
+
+Sha256Digest DigestStreamBuffer::digest()
+{
+    flush();
+    return m_hash.finish();
+}
+
+DigestStreamBuffer::int_type DigestStreamBuffer::overflow(int_type ch)
+{
+    flush();
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize DigestStreamBuffer::xsputn(const char_type* s, std::streamsize n)
+{
+    if (n <= epptr() - pptr()) {
+        std::memcpy(pptr(), s, n);
+        pbump(static_cast<int>(n));
+    } else {
+        // hash large chunks directly instead of copying them blockwise
+        flush();
+        m_hash.update(reinterpret_cast<const uint8_t*>(s), n);
+    }
+    return n;
+}
+
+int DigestStreamBuffer::sync()
+{
+    flush();
+    return 0;
+}
+
+void DigestStreamBuffer::flush()
+{
+    const std::size_t pending = pptr() - pbase();
+    if (pending > 0) {
+        m_hash.update(reinterpret_cast<const uint8_t*>(pbase()), pending);
+        setp(m_block.data(), m_block.data() + m_block.size());
+    }
+}
+
+} // namespace security
+} // namespace vanetza
@@ -0,0 +1,46 @@
+#ifndef DIGEST_STREAM_BUFFER_HPP_W6DKQ3JZ
+#define DIGEST_STREAM_BUFFER_HPP_W6DKQ3JZ
+
+#include <vanetza/security/sha.hpp>
+#include <array>
+#include <streambuf>
+
+namespace vanetza
+{
+namespace security
+{
+
+/**
+ * DigestStreamBuffer feeds all written bytes into a SHA256 hash.
+ *
+ * Serialized data is thus hashed on the fly without materializing it in a buffer.
+ * Small writes are collected in a fixed put area and hashed blockwise.
+ */
+class DigestStreamBuffer : public std::streambuf
+{
+public:
+    DigestStreamBuffer();
+
+    /**
+     * Finish hash calculation of all bytes written so far
+     * \return digest, stream buffer is reset afterwards
+     */
+    Sha256Digest digest();
+
+protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char_type* s, std::streamsize n) override;
+    int sync() override;
+
+private:
+    void flush();
+
+    Sha256 m_hash;
+    std::array<char_type, 256> m_block;
+};
+
+} // namespace security
+} // namespace vanetza
+
+#endif /* DIGEST_STREAM_BUFFER_HPP_W6DKQ3JZ */
+
@@ -0,0 +1,164 @@
+#include <vanetza/security/nonce_pool.hpp>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace vanetza
+{
+namespace security
+{
+
+constexpr std::size_t NoncePool::max_keys;
+
+NoncePool::NoncePool(std::size_t workers, std::size_t capacity, const std::string& backend,
+        const Factory<Backend>& factory) :
+    m_capacity(std::max<std::size_t>(capacity, 1)), m_next_id(0), m_supported(true), m_stop(false)
+{
+    if (workers == 0) {
+        throw std::invalid_argument("nonce pool requires at least one worker");
+    }
+
+    // backends are created upfront, so failures are reported to the pool's creator
+    std::vector<std::shared_ptr<Backend>> backends;
+    for (std::size_t i = 0; i < workers; ++i) {
+        std::shared_ptr<Backend> instance = create_backend(backend, factory);
+        if (!instance) {
+            throw std::invalid_argument("unknown crypto backend: " + backend);
+        }
+        backends.push_back(std::move(instance));
+    }
+
+    for (auto& instance : backends) {
+        m_workers.emplace_back([this, instance]() { work(*instance); });
+    }
+}
+
+NoncePool::~NoncePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+
+    // stocked nonces are wiped on destruction, discard them right after the workers are gone
+    for (Stock& stock : m_stocks) {
+        stock.nonces.clear();
+    }
+    m_stocks.clear();
+}
+
+boost::optional<EcdsaNonce> NoncePool::take(const ecdsa256::PrivateKey& private_key)
+{
+    boost::optional<EcdsaNonce> nonce;
+    bool registered = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = find(private_key);
+        if (found == m_stocks.end()) {
+            if (m_stocks.size() >= max_keys) {
+                m_stocks.back().nonces.clear();
+                m_stocks.pop_back();
+            }
+            m_stocks.push_front(Stock { m_next_id++, private_key, {}, 0 });
+            registered = true;
+        } else {
+            m_stocks.splice(m_stocks.begin(), m_stocks, found);
+            if (!found->nonces.empty()) {
+                nonce = std::move(found->nonces.front());
+                found->nonces.pop_front();
+            }
+        }
+    }
+
+    if (registered) {
+        // a new stock is empty, let all workers fill it concurrently
+        m_condition.notify_all();
+    } else {
+        m_condition.notify_one();
+    }
+    return nonce;
+}
+
+std::size_t NoncePool::available(const ecdsa256::PrivateKey& private_key) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = find(private_key);
+    return found != m_stocks.end() ? found->nonces.size() : 0;
+}
+
+bool NoncePool::supported() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_supported;
+}
+
+auto NoncePool::find(const ecdsa256::PrivateKey& private_key) const -> StockList::iterator
+{
+    return std::find_if(m_stocks.begin(), m_stocks.end(),
+            [&private_key](const Stock& stock) { return stock.private_key == private_key; });
+}
+
+auto NoncePool::find(unsigned long id) -> StockList::iterator
+{
+    return std::find_if(m_stocks.begin(), m_stocks.end(), [id](const Stock& stock) { return stock.id == id; });
+}
+
+auto NoncePool::deficient() -> StockList::iterator
+{
+    return std::find_if(m_stocks.begin(), m_stocks.end(),
+            [this](const Stock& stock) { return stock.nonces.size() + stock.pending < m_capacity; });
+}
+
+void NoncePool::work(Backend& backend)
+{
+    while (true) {
+        unsigned long id = 0;
+        ecdsa256::PrivateKey private_key;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_stop || (m_supported && deficient() != m_stocks.end()); });
+            if (m_stop) {
+                break;
+            }
+
+            auto stock = deficient();
+            id = stock->id;
+            private_key = stock->private_key;
+            ++stock->pending;
+        }
+
+        // expensive part is done without holding the lock
+        boost::optional<EcdsaNonce> nonce;
+        bool invalid_key = false;
+        try {
+            nonce = backend.precompute_nonce(private_key);
+        } catch (std::exception&) {
+            invalid_key = true;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto stock = find(id);
+            if (stock == m_stocks.end()) {
+                // key has been dropped meanwhile
+            } else if (invalid_key) {
+                stock->nonces.clear();
+                m_stocks.erase(stock);
+            } else if (nonce) {
+                --stock->pending;
+                stock->nonces.push_back(std::move(*nonce));
+            } else {
+                --stock->pending;
+                m_supported = false;
+            }
+        }
+    }
+}
+
+} // namespace security
+} // namespace vanetza
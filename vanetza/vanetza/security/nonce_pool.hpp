@@ -0,0 +1,103 @@
+#ifndef NONCE_POOL_HPP_P6HZW3NC
+#define NONCE_POOL_HPP_P6HZW3NC
+
+#include <vanetza/common/factory.hpp>
+#include <vanetza/security/backend.hpp>
+#include <vanetza/security/ecdsa256.hpp>
+#include <boost/optional/optional.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vanetza
+{
+namespace security
+{
+
+/**
+ * NoncePool precomputes ECDSA nonces on worker threads, see Backend::precompute_nonce
+ *
+ * A bounded stock of nonces is kept for each recently used private key. Keys are registered
+ * by their first take() and the least recently used key is dropped when too many are known,
+ * e.g. after pseudonym changes. Workers refill the stocks whenever nonces have been taken,
+ * thus signing on demand only has to do the cheap remainder of the signature calculation.
+ */
+class NoncePool
+{
+public:
+    static constexpr std::size_t max_keys = 4;
+
+    /**
+     * Create pool and start its worker threads
+     * \param workers number of worker threads (at least one)
+     * \param capacity maximum number of nonces stocked per private key (at least one)
+     * \param backend name of crypto backend created for each worker, see create_backend
+     * \param factory factory creating backends
+     */
+    NoncePool(std::size_t workers, std::size_t capacity = 16, const std::string& backend = "default",
+            const Factory<Backend>& factory = builtin_backends());
+    NoncePool(const NoncePool&) = delete;
+    NoncePool& operator=(const NoncePool&) = delete;
+
+    /**
+     * Stop workers, stocked nonces are discarded
+     */
+    ~NoncePool();
+
+    /**
+     * Take a nonce for given private key (thread-safe)
+     *
+     * Each nonce is handed out once only.
+     * \param private_key key the nonce will be used with
+     * \return nonce or none if stock of this key is empty
+     */
+    boost::optional<EcdsaNonce> take(const ecdsa256::PrivateKey& private_key);
+
+    /**
+     * Get number of stocked nonces for a private key
+     * \param private_key key
+     * \return number of nonces ready to be taken
+     */
+    std::size_t available(const ecdsa256::PrivateKey& private_key) const;
+
+    /**
+     * Check if backend supports nonce precomputation
+     * \return false if a worker's backend refused to precompute a nonce
+     */
+    bool supported() const;
+
+private:
+    struct Stock
+    {
+        unsigned long id; /*< distinguishes re-registered keys */
+        ecdsa256::PrivateKey private_key;
+        std::deque<EcdsaNonce> nonces;
+        std::size_t pending; /*< nonces currently calculated by workers */
+    };
+
+    using StockList = std::list<Stock>;
+
+    StockList::iterator find(const ecdsa256::PrivateKey&) const;
+    StockList::iterator find(unsigned long id);
+    StockList::iterator deficient();
+    void work(Backend&);
+
+    const std::size_t m_capacity;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    mutable StockList m_stocks; /*< most recently used key first */
+    unsigned long m_next_id;
+    bool m_supported;
+    bool m_stop;
+    std::vector<std::thread> m_workers;
+};
+
+} // namespace security
+} // namespace vanetza
+
+#endif /* NONCE_POOL_HPP_P6HZW3NC */
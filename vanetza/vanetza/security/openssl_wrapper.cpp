@@ -133,6 +133,87 @@ Key::~Key()
     EC_KEY_free(eckey);
 }
 
+EvpKey::EvpKey() : pkey(EVP_PKEY_new())
+{
+    check(pkey);
+}
+
+EvpKey::EvpKey(EVP_PKEY* key) : pkey(key)
+{
+    check(pkey);
+}
+
+EvpKey::EvpKey(EvpKey&& other) : pkey(nullptr)
+{
+    std::swap(pkey, other.pkey);
+}
+
+EvpKey& EvpKey::operator=(EvpKey&& other)
+{
+    std::swap(pkey, other.pkey);
+    return *this;
+}
+
+EvpKey::~EvpKey()
+{
+    EVP_PKEY_free(pkey);
+}
+
+KeyContext::KeyContext(EVP_PKEY* pkey) : ctx(EVP_PKEY_CTX_new(pkey, nullptr))
+{
+    check(ctx);
+}
+
+KeyContext::KeyContext(KeyContext&& other) : ctx(nullptr)
+{
+    std::swap(ctx, other.ctx);
+}
+
+KeyContext& KeyContext::operator=(KeyContext&& other)
+{
+    std::swap(ctx, other.ctx);
+    return *this;
+}
+
+KeyContext::~KeyContext()
+{
+    EVP_PKEY_CTX_free(ctx);
+}
+
+Sha256Context::Sha256Context() : ctx(EVP_MD_CTX_create()), md(nullptr)
+{
+    check(ctx);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    // explicit fetch avoids implicit provider lookup at every initialisation
+    md = EVP_MD_fetch(nullptr, "SHA256", nullptr);
+    check(md);
+#endif
+}
+
+Sha256Context::~Sha256Context()
+{
+    EVP_MD_CTX_destroy(ctx);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    EVP_MD_free(md);
+#endif
+}
+
+std::array<uint8_t, 32> Sha256Context::digest(const uint8_t* data, std::size_t length)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    const EVP_MD* type = md;
+#else
+    const EVP_MD* type = EVP_sha256();
+#endif
+    std::array<uint8_t, 32> result;
+    unsigned int result_length = 0;
+    check(EVP_DigestInit_ex(ctx, type, nullptr) == 1);
+    check(EVP_DigestUpdate(ctx, data, length) == 1);
+    check(EVP_DigestFinal_ex(ctx, result.data(), &result_length) == 1);
+    assert(result_length == result.size());
+    return result;
+}
+
 } // namespace openssl
 } // namespace security
 } // namespace vanetza
@@ -6,6 +6,7 @@
 #include <openssl/bn.h>
 #include <openssl/ecdsa.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
 #include <array>
 #include <cstdint>
 #include <stdexcept>
@@ -140,6 +141,65 @@ private:
     EC_KEY* eckey;
 };
 
+
+class EvpKey
+{
+public:
+    EvpKey();
+    explicit EvpKey(EVP_PKEY* pkey);
+    // non-copyable
+    EvpKey(const EvpKey&) = delete;
+    EvpKey& operator=(const EvpKey&) = delete;
+    // but movable
+    EvpKey(EvpKey&&);
+    EvpKey& operator=(EvpKey&&);
+    ~EvpKey();
+
+    operator EVP_PKEY*() { return pkey; }
+
+private:
+    EVP_PKEY* pkey;
+};
+
+
+/**
+ * Context of a public key operation, keeps a reference to its key
+ */
+class KeyContext
+{
+public:
+    explicit KeyContext(EVP_PKEY* pkey);
+    // non-copyable
+    KeyContext(const KeyContext&) = delete;
+    KeyContext& operator=(const KeyContext&) = delete;
+    // but movable
+    KeyContext(KeyContext&&);
+    KeyContext& operator=(KeyContext&&);
+    ~KeyContext();
+
+    operator EVP_PKEY_CTX*() { return ctx; }
+
+private:
+    EVP_PKEY_CTX* ctx;
+};
+
+
+/**
+ * Reusable context for SHA256 digests, algorithm is looked up only once
+ */
+class Sha256Context : private boost::noncopyable
+{
+public:
+    Sha256Context();
+    ~Sha256Context();
+
+    std::array<uint8_t, 32> digest(const uint8_t* data, std::size_t length);
+
+private:
+    EVP_MD_CTX* ctx;
+    EVP_MD* md;
+};
+
 } // namespace openssl
 } // namespace security
 } // namespace vanetza
@@ -1,9 +1,8 @@
 #include <vanetza/common/byte_buffer.hpp>
-#include <vanetza/common/byte_buffer_sink.hpp>
+#include <vanetza/security/digest_stream_buffer.hpp>
 #include <vanetza/security/exception.hpp>
 #include <vanetza/security/secured_message.hpp>
 #include <vanetza/security/serialization.hpp>
-#include <boost/iostreams/stream.hpp>
 
 namespace vanetza
 {
@@ -95,14 +94,11 @@ size_t deserialize(InputArchive& ar, SecuredMessage& message)
     return length;
 }
 
-ByteBuffer convert_for_signing(const SecuredMessage& message, const std::list<TrailerField>& trailer_fields)
+namespace
 {
-    ByteBuffer buf;
-    byte_buffer_sink sink(buf);
-
-    boost::iostreams::stream_buffer<byte_buffer_sink> stream(sink);
-    OutputArchive ar(stream);
 
+void serialize_for_signing(OutputArchive& ar, const SecuredMessage& message, const std::list<TrailerField>& trailer_fields)
+{
     const uint8_t protocol_version = message.protocol_version();
     ar << protocol_version;
     serialize(ar, message.header_fields);
@@ -120,10 +116,25 @@ ByteBuffer convert_for_signing(const SecuredMessage& message, const std::list<Tr
             serialize(ar, elem);
         }
     }
+}
+
+} // namespace
 
-    stream.close();
+ByteBuffer convert_for_signing(const SecuredMessage& message, const std::list<TrailerField>& trailer_fields)
+{
+    ByteBuffer buf;
+    OutputArchive ar(buf);
+    serialize_for_signing(ar, message, trailer_fields);
     return buf;
 }
 
+Sha256Digest calculate_signing_digest(const SecuredMessage& message, const std::list<TrailerField>& trailer_fields)
+{
+    DigestStreamBuffer stream;
+    OutputArchive ar(stream);
+    serialize_for_signing(ar, message, trailer_fields);
+    return stream.digest();
+}
+
 } // namespace security
 } // namespace vanetza
@@ -4,6 +4,7 @@
 #include <vanetza/security/header_field.hpp>
 #include <vanetza/security/trailer_field.hpp>
 #include <vanetza/security/payload.hpp>
+#include <vanetza/security/sha.hpp>
 #include <cstdint>
 #include <list>
 
@@ -113,6 +114,17 @@ size_t deserialize(InputArchive& ar, SecuredMessage& message);
  */
 ByteBuffer convert_for_signing(const SecuredMessage& message, const std::list<TrailerField>& trailer_fields);
 
+/**
+ * \brief Calculate SHA256 digest of SecuredMessage's data fields relevant for signature creation
+ *
+ * Digest covers the same data as convert_for_signing, but data is hashed while being serialized.
+ *
+ * \param message
+ * \param trailer_fields only trailer fields up to signature will be included in digest
+ * \return digest of data fields relevant for signature creation
+ */
+Sha256Digest calculate_signing_digest(const SecuredMessage& message, const std::list<TrailerField>& trailer_fields);
+
 } // namespace security
 } // namespace vanetza
 
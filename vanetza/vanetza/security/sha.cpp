@@ -30,5 +30,44 @@ Sha256Digest calculate_sha256_digest(uint8_t* data, std::size_t len)
     return digest;
 }
 
+#if defined VANETZA_WITH_OPENSSL
+struct Sha256::State
+{
+    State() { SHA256_Init(&ctx); }
+    void update(const uint8_t* data, std::size_t len) { SHA256_Update(&ctx, data, len); }
+    void finish(Sha256Digest& digest) { SHA256_Final(digest.data(), &ctx); SHA256_Init(&ctx); }
+
+    SHA256_CTX ctx;
+};
+#elif defined VANETZA_WITH_CRYPTOPP
+struct Sha256::State
+{
+    void update(const uint8_t* data, std::size_t len) { hash.Update(data, len); }
+    void finish(Sha256Digest& digest) { hash.Final(digest.data()); }
+
+    CryptoPP::SHA256 hash;
+};
+#endif
+
+Sha256::Sha256() : m_state(new State())
+{
+}
+
+Sha256::~Sha256()
+{
+}
+
+void Sha256::update(const uint8_t* data, std::size_t len)
+{
+    m_state->update(data, len);
+}
+
+Sha256Digest Sha256::finish()
+{
+    Sha256Digest digest;
+    m_state->finish(digest);
+    return digest;
+}
+
 } // namespace security
 } // namespace vanetza
@@ -3,6 +3,7 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 
 namespace vanetza
 {
@@ -13,6 +14,35 @@ using Sha256Digest = std::array<uint8_t, 32>;
 
 Sha256Digest calculate_sha256_digest(uint8_t* data, std::size_t len);
 
+/**
+ * Incremental SHA256 calculation, i.e. data can be fed piecewise
+ */
+class Sha256
+{
+public:
+    Sha256();
+    ~Sha256();
+    Sha256(const Sha256&) = delete;
+    Sha256& operator=(const Sha256&) = delete;
+
+    /**
+     * Feed further data into hash
+     * \param data begin of data
+     * \param len length of data
+     */
+    void update(const uint8_t* data, std::size_t len);
+
+    /**
+     * Finish hash calculation, hash is reset afterwards
+     * \return digest of all data fed since construction or last finish
+     */
+    Sha256Digest finish();
+
+private:
+    struct State;
+    std::unique_ptr<State> m_state;
+};
+
 } // namespace security
 } // namespace vanetza
 
@@ -2,6 +2,7 @@
 #include <vanetza/common/runtime.hpp>
 #include <vanetza/security/backend.hpp>
 #include <vanetza/security/certificate_provider.hpp>
+#include <vanetza/security/nonce_pool.hpp>
 #include <vanetza/security/sign_header_policy.hpp>
 #include <vanetza/security/sign_service.hpp>
 #include <cassert>
@@ -44,8 +45,8 @@ SignService straight_sign_service(CertificateProvider& certificate_provider, Bac
         static const Signature placeholder = signature_placeholder();
         static const std::list<TrailerField> trailer_fields = { placeholder };
 
-        ByteBuffer data_buffer = convert_for_signing(confirm.secured_message, trailer_fields);
-        TrailerField trailer_field = backend.sign_data(private_key, data_buffer);
+        const Sha256Digest digest = calculate_signing_digest(confirm.secured_message, trailer_fields);
+        TrailerField trailer_field = backend.sign_digest(private_key, digest);
         confirm.secured_message.trailer_fields.push_back(trailer_field);
         return confirm;
     };
@@ -66,8 +67,8 @@ SignService deferred_sign_service(CertificateProvider& certificate_provider, Bac
 
         const SecuredMessage& secured_message = confirm.secured_message;
         auto future = std::async(std::launch::deferred, [&backend, secured_message, private_key]() {
-            ByteBuffer data = convert_for_signing(secured_message, trailer_fields);
-            return backend.sign_data(private_key, data);
+            const Sha256Digest digest = calculate_signing_digest(secured_message, trailer_fields);
+            return backend.sign_digest(private_key, digest);
         });
         EcdsaSignatureFuture signature(future.share(), signature_size);
         confirm.secured_message.trailer_fields.push_back(signature);
@@ -75,6 +76,29 @@ SignService deferred_sign_service(CertificateProvider& certificate_provider, Bac
     };
 }
 
+SignService precomputed_sign_service(CertificateProvider& certificate_provider, Backend& backend, SignHeaderPolicy& sign_header_policy, NoncePool& pool)
+{
+    return [&](SignRequest&& request) -> SignConfirm {
+        SignConfirm confirm;
+        confirm.secured_message.payload.type = PayloadType::Signed;
+        confirm.secured_message.payload.data = std::move(request.plain_message);
+        confirm.secured_message.header_fields = sign_header_policy.prepare_header(request, certificate_provider);
+
+        const auto& private_key = certificate_provider.own_private_key();
+        static const Signature placeholder = signature_placeholder();
+        static const std::list<TrailerField> trailer_fields = { placeholder };
+
+        // take nonce early, so workers can refill stock while message is serialized
+        boost::optional<EcdsaNonce> nonce = pool.take(private_key);
+        const Sha256Digest digest = calculate_signing_digest(confirm.secured_message, trailer_fields);
+        TrailerField trailer_field = nonce ?
+            backend.sign_precomputed(private_key, digest, *nonce) :
+            backend.sign_digest(private_key, digest);
+        confirm.secured_message.trailer_fields.push_back(trailer_field);
+        return confirm;
+    };
+}
+
 SignService dummy_sign_service(const Runtime& rt, const SignerInfo& signer_info)
 {
     return [&rt, signer_info](SignRequest&& request) -> SignConfirm {
@@ -22,6 +22,7 @@ namespace security
 // forward declarations
 class Backend;
 class CertificateProvider;
+class NoncePool;
 class SignHeaderPolicy;
 
 // mandatory SN-SIGN.request parameters
@@ -63,6 +64,18 @@ SignService straight_sign_service(CertificateProvider&, Backend&, SignHeaderPoli
  */
 SignService deferred_sign_service(CertificateProvider&, Backend&, SignHeaderPolicy&);
 
+/**
+ * SignService immediately signing the message using nonces precomputed by a pool
+ *
+ * Signing falls back to a complete signature calculation when the pool's stock is exhausted.
+ * \param cert certificate provider
+ * \param backend cryptographic backend
+ * \param sign_header_policy sign header policy
+ * \param pool nonce pool, should use the same kind of backend
+ * \return callable sign service
+ */
+SignService precomputed_sign_service(CertificateProvider&, Backend&, SignHeaderPolicy&, NoncePool&);
+
 /**
  * SignService without real cryptography but dummy signature
  * \param rt runtime for appropriate generation time
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <vanetza/security/backend.hpp>
+#include <vanetza/security/backend_cryptopp.hpp>
+#include <vanetza/security/sha.hpp>
+#include <memory>
+
+using namespace vanetza::security;
+using namespace vanetza;
+
+class BackendTest : public ::testing::TestWithParam<const char*>
+{
+protected:
+    std::unique_ptr<Backend> backend;
+    BackendCryptoPP reference;
+    ecdsa256::KeyPair key_pair;
+    ecdsa256::KeyPair other_key_pair;
+    ByteBuffer data { 0xC0, 0xFF, 0xEE, 0x42 };
+    Sha256Digest digest;
+
+    void SetUp() override
+    {
+        digest = calculate_sha256_digest(data.data(), data.size());
+        backend = create_backend(GetParam());
+        ASSERT_TRUE(backend);
+        key_pair = reference.generate_key_pair();
+        other_key_pair = reference.generate_key_pair();
+    }
+};
+
+
+TEST_P(BackendTest, sign_and_verify)
+{
+    EcdsaSignature sig = backend->sign_data(key_pair.private_key, data);
+    EXPECT_TRUE(backend->verify_data(key_pair.public_key, data, sig));
+
+    ByteBuffer modified = data;
+    modified.back() ^= 0x01;
+    EXPECT_FALSE(backend->verify_data(key_pair.public_key, modified, sig));
+    EXPECT_FALSE(backend->verify_data(other_key_pair.public_key, data, sig));
+}
+
+TEST_P(BackendTest, interoperability)
+{
+    EcdsaSignature own = backend->sign_data(key_pair.private_key, data);
+    EXPECT_TRUE(reference.verify_data(key_pair.public_key, data, own));
+
+    EcdsaSignature foreign = reference.sign_data(key_pair.private_key, data);
+    EXPECT_TRUE(backend->verify_data(key_pair.public_key, data, foreign));
+}
+
+TEST_P(BackendTest, sign_and_verify_digest)
+{
+    EcdsaSignature sig = backend->sign_digest(key_pair.private_key, digest);
+    EXPECT_TRUE(backend->verify_digest(key_pair.public_key, digest, sig));
+    EXPECT_TRUE(backend->verify_data(key_pair.public_key, data, sig));
+    EXPECT_TRUE(reference.verify_data(key_pair.public_key, data, sig));
+
+    Sha256Digest modified = digest;
+    modified.back() ^= 0x01;
+    EXPECT_FALSE(backend->verify_digest(key_pair.public_key, modified, sig));
+    EXPECT_FALSE(backend->verify_digest(other_key_pair.public_key, digest, sig));
+
+    EcdsaSignature foreign = reference.sign_data(key_pair.private_key, data);
+    EXPECT_TRUE(backend->verify_digest(key_pair.public_key, digest, foreign));
+}
+
+TEST_P(BackendTest, sign_precomputed)
+{
+    // backends without precomputation fall back to regular signing
+    EcdsaNonce nonce = backend->precompute_nonce(key_pair.private_key).value_or(EcdsaNonce {});
+    EcdsaSignature sig = backend->sign_precomputed(key_pair.private_key, digest, nonce);
+    EXPECT_TRUE(backend->verify_data(key_pair.public_key, data, sig));
+    EXPECT_TRUE(reference.verify_data(key_pair.public_key, data, sig));
+}
+
+TEST_P(BackendTest, alternating_keys)
+{
+    // keys may be cached by backends, results must not be mixed up
+    for (unsigned i = 0; i < 4; ++i) {
+        const ecdsa256::KeyPair& signer = i % 2 ? other_key_pair : key_pair;
+        const ecdsa256::KeyPair& other = i % 2 ? key_pair : other_key_pair;
+        EcdsaSignature sig = backend->sign_data(signer.private_key, data);
+        EXPECT_TRUE(backend->verify_data(signer.public_key, data, sig));
+        EXPECT_FALSE(backend->verify_data(other.public_key, data, sig));
+    }
+}
+
+TEST_P(BackendTest, verify_batch)
+{
+    const Sha256Digest modified {};
+    EcdsaSignature sig = backend->sign_data(key_pair.private_key, data);
+    EcdsaSignature other_sig = backend->sign_data(other_key_pair.private_key, data);
+
+    std::vector<SignatureCheck> checks;
+    checks.emplace_back(key_pair.public_key, digest, sig);
+    checks.emplace_back(other_key_pair.public_key, digest, other_sig);
+    checks.emplace_back(key_pair.public_key, modified, sig);
+    checks.emplace_back(other_key_pair.public_key, digest, sig);
+    checks.emplace_back(key_pair.public_key, digest, sig);
+    backend->verify_batch(checks);
+
+    EXPECT_TRUE(checks[0].verified);
+    EXPECT_TRUE(checks[1].verified);
+    EXPECT_FALSE(checks[2].verified);
+    EXPECT_FALSE(checks[3].verified);
+    EXPECT_TRUE(checks[4].verified);
+}
+
+#ifdef VANETZA_WITH_OPENSSL
+TEST(BackendOpenSsl, invalid_public_key)
+{
+    auto backend = create_backend("OpenSSL");
+    ASSERT_TRUE(backend);
+
+    // point is not on curve
+    ecdsa256::PublicKey key;
+    key.x.fill(0x01);
+    key.y.fill(0x02);
+    EcdsaSignature sig;
+    sig.R = X_Coordinate_Only { ByteBuffer(32, 0x03) };
+    sig.s = ByteBuffer(32, 0x04);
+    EXPECT_FALSE(backend->verify_data(key, { 0x01 }, sig));
+    EXPECT_FALSE(backend->verify_data(key, { 0x01 }, sig));
+}
+#endif
+
+auto values = ::testing::Values(
+#ifdef VANETZA_WITH_OPENSSL
+    "OpenSSL",
+#endif
+    "CryptoPP"
+);
+
+INSTANTIATE_TEST_SUITE_P(Backend, BackendTest, values);
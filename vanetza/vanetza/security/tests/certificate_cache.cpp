@@ -132,3 +132,69 @@ TEST_F(CertificateCacheTest, insert_extends_lifetime)
     cache.lookup(id, SubjectType::Authorization_Ticket);
     EXPECT_EQ(1, cache.size());
 }
+
+TEST_F(CertificateCacheTest, lookup_verified)
+{
+    const Certificate cert = build_certificate(SubjectType::Authorization_Ticket);
+    const HashedId8 id = calculate_hash(cert);
+    ecdsa256::PublicKey key;
+    key.x.fill(0x12);
+    key.y.fill(0x34);
+
+    // certificate inserted without public key is not a verified signer
+    cache.insert(cert);
+    EXPECT_FALSE(cache.lookup_verified(id, cert));
+    EXPECT_EQ(0, cache.statistics().hits);
+    EXPECT_EQ(1, cache.statistics().misses);
+
+    cache.insert(cert, key);
+    EXPECT_EQ(1, cache.size());
+    auto verified = cache.lookup_verified(id, cert);
+    ASSERT_TRUE(verified);
+    EXPECT_EQ(key, *verified);
+    EXPECT_EQ(1, cache.statistics().hits);
+
+    // different certificate with same digest is no hit
+    Certificate other = build_certificate(SubjectType::Authorization_Ticket, 1);
+    EXPECT_FALSE(cache.lookup_verified(id, other));
+    EXPECT_EQ(2, cache.statistics().misses);
+
+    auto signers = cache.lookup_signers(id);
+    ASSERT_EQ(1, signers.size());
+    ASSERT_TRUE(signers.front().public_key);
+    EXPECT_EQ(key, *signers.front().public_key);
+    EXPECT_EQ(2, cache.statistics().hits);
+
+    runtime.trigger(std::chrono::seconds(3));
+    EXPECT_FALSE(cache.lookup_verified(id, cert));
+    EXPECT_EQ(0, cache.lookup_signers(id).size());
+    EXPECT_EQ(4, cache.statistics().misses);
+}
+
+TEST_F(CertificateCacheTest, verified_signer_is_authorization_ticket)
+{
+    const Certificate cert = build_certificate(SubjectType::Authorization_Authority);
+    cache.insert(cert, ecdsa256::PublicKey {});
+    EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(CertificateCacheTest, capacity)
+{
+    CertificateCache small_cache(runtime, 2);
+    EXPECT_EQ(2, small_cache.capacity());
+
+    const Certificate cert1 = build_certificate(SubjectType::Authorization_Authority, 1);
+    const Certificate cert2 = build_certificate(SubjectType::Authorization_Ticket, 2);
+    const Certificate cert3 = build_certificate(SubjectType::Authorization_Ticket, 3);
+    small_cache.insert(cert1);
+    small_cache.insert(cert2);
+    EXPECT_EQ(2, small_cache.size());
+
+    // authorization ticket expires first, thus it is evicted
+    small_cache.insert(cert3);
+    EXPECT_EQ(2, small_cache.size());
+    EXPECT_EQ(1, small_cache.statistics().evictions);
+    EXPECT_EQ(0, small_cache.lookup(calculate_hash(cert2), SubjectType::Authorization_Ticket).size());
+    EXPECT_EQ(1, small_cache.lookup(calculate_hash(cert3), SubjectType::Authorization_Ticket).size());
+    EXPECT_EQ(1, small_cache.lookup(calculate_hash(cert1), SubjectType::Authorization_Authority).size());
+}
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <vanetza/security/nonce_pool.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace vanetza;
+using namespace vanetza::security;
+
+namespace
+{
+
+std::atomic<unsigned> nonce_counter;
+
+// hands out numbered nonces, first byte of private key marks invalid keys
+class FakeBackend : public Backend
+{
+public:
+    EcdsaSignature sign_data(const ecdsa256::PrivateKey&, const ByteBuffer&) override
+    {
+        return EcdsaSignature();
+    }
+
+    EcdsaSignature sign_digest(const ecdsa256::PrivateKey&, const Sha256Digest&) override
+    {
+        return EcdsaSignature();
+    }
+
+    boost::optional<EcdsaNonce> precompute_nonce(const ecdsa256::PrivateKey& key) override
+    {
+        if (key.key[0] == 0xff) {
+            throw std::runtime_error("invalid private key");
+        }
+        EcdsaNonce nonce;
+        nonce.k_inverse.fill(0x00);
+        nonce.r.fill(key.key[0]);
+        const unsigned count = ++nonce_counter;
+        std::memcpy(nonce.k_inverse.data(), &count, sizeof(count));
+        return nonce;
+    }
+
+    bool verify_data(const ecdsa256::PublicKey&, const ByteBuffer&, const EcdsaSignature&) override
+    {
+        return false;
+    }
+
+    bool verify_digest(const ecdsa256::PublicKey&, const Sha256Digest&, const EcdsaSignature&) override
+    {
+        return false;
+    }
+
+    boost::optional<Uncompressed> decompress_point(const EccPoint&) override
+    {
+        return boost::none;
+    }
+};
+
+class UnsupportingBackend : public FakeBackend
+{
+public:
+    boost::optional<EcdsaNonce> precompute_nonce(const ecdsa256::PrivateKey&) override
+    {
+        return boost::none;
+    }
+};
+
+// records which threads precompute nonces, each calculation takes a while
+class SlowBackend : public FakeBackend
+{
+public:
+    static std::mutex mutex;
+    static std::set<std::thread::id> threads;
+
+    boost::optional<EcdsaNonce> precompute_nonce(const ecdsa256::PrivateKey& key) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return FakeBackend::precompute_nonce(key);
+    }
+};
+
+std::mutex SlowBackend::mutex;
+std::set<std::thread::id> SlowBackend::threads;
+
+class NoncePoolTest : public ::testing::Test
+{
+protected:
+    NoncePoolTest()
+    {
+        factory.add("Fake", []() { return std::unique_ptr<Backend> { new FakeBackend() }; });
+        factory.add("Unsupporting", []() { return std::unique_ptr<Backend> { new UnsupportingBackend() }; });
+        factory.add("Slow", []() { return std::unique_ptr<Backend> { new SlowBackend() }; });
+    }
+
+    ecdsa256::PrivateKey make_key(uint8_t id)
+    {
+        ecdsa256::PrivateKey key;
+        key.key.fill(id);
+        return key;
+    }
+
+    bool wait_for(std::function<bool()> condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return condition();
+    }
+
+    Factory<Backend> factory;
+};
+
+} // namespace
+
+TEST_F(NoncePoolTest, invalid_arguments)
+{
+    EXPECT_THROW(NoncePool(1, 8, "Unknown", factory), std::invalid_argument);
+    EXPECT_THROW(NoncePool(0, 8, "Fake", factory), std::invalid_argument);
+}
+
+TEST_F(NoncePoolTest, refill)
+{
+    NoncePool pool(2, 4, "Fake", factory);
+    const auto key = make_key(1);
+
+    // first take registers key
+    EXPECT_FALSE(pool.take(key));
+    ASSERT_TRUE(wait_for([&]() { return pool.available(key) == 4; }));
+
+    std::set<unsigned> seen;
+    for (unsigned i = 0; i < 4; ++i) {
+        auto nonce = pool.take(key);
+        ASSERT_TRUE(nonce);
+        EXPECT_EQ(1, nonce->r[0]);
+        unsigned count = 0;
+        std::memcpy(&count, nonce->k_inverse.data(), sizeof(count));
+        EXPECT_TRUE(seen.insert(count).second) << "nonce handed out twice";
+    }
+
+    ASSERT_TRUE(wait_for([&]() { return pool.available(key) == 4; }));
+    EXPECT_TRUE(pool.supported());
+}
+
+TEST_F(NoncePoolTest, cold_start_uses_all_workers)
+{
+    SlowBackend::threads.clear();
+    NoncePool pool(4, 16, "Slow", factory);
+    const auto key = make_key(1);
+    // let workers park before the key is registered
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_FALSE(pool.take(key));
+    ASSERT_TRUE(wait_for([&]() { return pool.available(key) == 16; }));
+
+    std::lock_guard<std::mutex> lock(SlowBackend::mutex);
+    EXPECT_LT(1, SlowBackend::threads.size());
+}
+
+TEST_F(NoncePoolTest, separate_keys)
+{
+    NoncePool pool(1, 2, "Fake", factory);
+    const auto key1 = make_key(1);
+    const auto key2 = make_key(2);
+
+    pool.take(key1);
+    pool.take(key2);
+    ASSERT_TRUE(wait_for([&]() { return pool.available(key1) == 2 && pool.available(key2) == 2; }));
+
+    auto nonce = pool.take(key2);
+    ASSERT_TRUE(nonce);
+    EXPECT_EQ(2, nonce->r[0]);
+}
+
+TEST_F(NoncePoolTest, drop_least_recently_used_key)
+{
+    NoncePool pool(1, 1, "Fake", factory);
+    for (uint8_t i = 1; i <= NoncePool::max_keys; ++i) {
+        pool.take(make_key(i));
+    }
+    ASSERT_TRUE(wait_for([&]() {
+        for (uint8_t i = 1; i <= NoncePool::max_keys; ++i) {
+            if (pool.available(make_key(i)) != 1) return false;
+        }
+        return true;
+    }));
+
+    EXPECT_TRUE(pool.take(make_key(1))); // key 2 becomes least recently used
+    pool.take(make_key(NoncePool::max_keys + 1));
+    EXPECT_EQ(0, pool.available(make_key(2)));
+    EXPECT_TRUE(wait_for([&]() { return pool.available(make_key(1)) == 1; }));
+}
+
+TEST_F(NoncePoolTest, invalid_key)
+{
+    NoncePool pool(1, 2, "Fake", factory);
+    const auto invalid = make_key(0xff);
+    const auto valid = make_key(1);
+
+    pool.take(invalid);
+    pool.take(valid);
+    ASSERT_TRUE(wait_for([&]() { return pool.available(valid) == 2; }));
+    EXPECT_EQ(0, pool.available(invalid));
+    EXPECT_TRUE(pool.supported());
+}
+
+TEST_F(NoncePoolTest, unsupported)
+{
+    NoncePool pool(1, 2, "Unsupporting", factory);
+    const auto key = make_key(1);
+
+    pool.take(key);
+    ASSERT_TRUE(wait_for([&]() { return !pool.supported(); }));
+    EXPECT_FALSE(pool.take(key));
+    EXPECT_EQ(0, pool.available(key));
+}
+
+TEST(EcdsaNonce, move_wipes_source)
+{
+    EcdsaNonce source;
+    source.k_inverse.fill(0x5a);
+    source.r.fill(0xa5);
+
+    EcdsaNonce moved(std::move(source));
+    EXPECT_EQ(0x5a, moved.k_inverse.front());
+    EXPECT_EQ(0xa5, moved.r.back());
+    for (std::size_t i = 0; i < source.k_inverse.size(); ++i) {
+        EXPECT_EQ(0, source.k_inverse[i]);
+        EXPECT_EQ(0, source.r[i]);
+    }
+
+    EcdsaNonce assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(0x5a, assigned.k_inverse.back());
+    for (uint8_t byte : moved.k_inverse) {
+        EXPECT_EQ(0, byte);
+    }
+
+    assigned.wipe();
+    for (uint8_t byte : assigned.k_inverse) {
+        EXPECT_EQ(0, byte);
+    }
+}
@@ -132,3 +132,25 @@ TEST(SecuredMessage, WebValidator_Serialize_SecuredMessageV2_3)
     check(m, serialize_roundtrip(m));
 }
 
+
+TEST(SecuredMessage, signing_digest)
+{
+    SecuredMessage m;
+    m.header_fields.push_back(Time64 { 0x4711 });
+    m.header_fields.push_back(IntX { 36 });
+    std::list<TrailerField> trailer_fields;
+    trailer_fields.push_back(Signature { create_random_ecdsa_signature(44) });
+
+    // small payload is collected in stream buffer, large one is hashed directly
+    for (std::size_t length : { 5, 1000 }) {
+        ByteBuffer payload(length);
+        for (std::size_t i = 0; i < payload.size(); ++i) {
+            payload[i] = i & 0xff;
+        }
+        m.payload = { PayloadType::Signed, CohesivePacket(std::move(payload), OsiLayer::Application) };
+
+        ByteBuffer signing_input = convert_for_signing(m, trailer_fields);
+        EXPECT_EQ(calculate_sha256_digest(signing_input.data(), signing_input.size()),
+                calculate_signing_digest(m, trailer_fields));
+    }
+}
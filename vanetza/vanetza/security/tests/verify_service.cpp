@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <vanetza/common/its_aid.hpp>
+#include <vanetza/common/manual_runtime.hpp>
+#include <vanetza/common/stored_position_provider.hpp>
+#include <vanetza/security/backend.hpp>
+#include <vanetza/security/certificate_cache.hpp>
+#include <vanetza/security/default_certificate_validator.hpp>
+#include <vanetza/security/naive_certificate_provider.hpp>
+#include <vanetza/security/sign_header_policy.hpp>
+#include <vanetza/security/sign_service.hpp>
+#include <vanetza/security/trust_store.hpp>
+#include <vanetza/security/verify_service.hpp>
+#include <vanetza/security/verify_worker_pool.hpp>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+using namespace vanetza;
+using namespace vanetza::security;
+
+namespace
+{
+
+// delegates to a real backend and counts batched signature checks
+class CountingBackend : public Backend
+{
+public:
+    CountingBackend(Backend& backend) : backend(backend) {}
+
+    EcdsaSignature sign_data(const ecdsa256::PrivateKey& key, const ByteBuffer& data) override
+    {
+        return backend.sign_data(key, data);
+    }
+
+    EcdsaSignature sign_digest(const ecdsa256::PrivateKey& key, const Sha256Digest& digest) override
+    {
+        return backend.sign_digest(key, digest);
+    }
+
+    bool verify_data(const ecdsa256::PublicKey& key, const ByteBuffer& data, const EcdsaSignature& sig) override
+    {
+        return backend.verify_data(key, data, sig);
+    }
+
+    bool verify_digest(const ecdsa256::PublicKey& key, const Sha256Digest& digest, const EcdsaSignature& sig) override
+    {
+        ++single_checks;
+        return backend.verify_digest(key, digest, sig);
+    }
+
+    void verify_batch(std::vector<SignatureCheck>& checks) override
+    {
+        ++batches;
+        batched_checks += checks.size();
+        backend.verify_batch(checks);
+    }
+
+    boost::optional<Uncompressed> decompress_point(const EccPoint& point) override
+    {
+        return backend.decompress_point(point);
+    }
+
+    Backend& backend;
+    unsigned batches = 0;
+    unsigned batched_checks = 0;
+    unsigned single_checks = 0;
+};
+
+class VerifyServiceTest : public ::testing::Test
+{
+protected:
+    VerifyServiceTest() :
+        runtime(Clock::at("2016-03-7 08:23")),
+        crypto_backend(create_backend("default")),
+        counting_backend(*crypto_backend),
+        certificate_provider(runtime),
+        cert_cache(runtime),
+        certificate_validator(*crypto_backend, cert_cache, trust_store),
+        sign_header_policy(runtime, position_provider),
+        sign_service(straight_sign_service(certificate_provider, *crypto_backend, sign_header_policy))
+    {
+        trust_store.insert(certificate_provider.root_certificate());
+        for (auto cert : certificate_provider.own_chain()) {
+            cert_cache.insert(cert);
+        }
+
+        PositionFix position_fix;
+        position_fix.latitude = 49.014420 * units::degree;
+        position_fix.longitude = 8.404417 * units::degree;
+        position_fix.confidence.semi_major = 25.0 * units::si::meter;
+        position_fix.confidence.semi_minor = 25.0 * units::si::meter;
+        position_provider.position_fix(position_fix);
+    }
+
+    // DENM signatures always carry the signer's certificate
+    SecuredMessage create_secured_message()
+    {
+        SignRequest request;
+        request.plain_message[OsiLayer::Transport] = ByteBuffer { 89, 27, 1, 4, 18, 85 };
+        request.its_aid = aid::DEN;
+        return sign_service(std::move(request)).secured_message;
+    }
+
+    SecuredMessage create_false_signature()
+    {
+        SecuredMessage message = create_secured_message();
+        message.payload.data = CohesivePacket({ 42, 42, 42 }, OsiLayer::Session);
+        return message;
+    }
+
+    SecuredMessage create_truncated_signature()
+    {
+        SecuredMessage message = create_secured_message();
+        Signature* signature = message.trailer_field<TrailerFieldType::Signature>();
+        boost::get<EcdsaSignature>(*signature).s = { 8, 15, 23 };
+        return message;
+    }
+
+    VerifyService straight_service()
+    {
+        return straight_verify_service(runtime, certificate_provider, certificate_validator, counting_backend,
+                cert_cache, sign_header_policy, position_provider);
+    }
+
+    ManualRuntime runtime;
+    StoredPositionProvider position_provider;
+    std::unique_ptr<Backend> crypto_backend;
+    CountingBackend counting_backend;
+    NaiveCertificateProvider certificate_provider;
+    TrustStore trust_store;
+    CertificateCache cert_cache;
+    DefaultCertificateValidator certificate_validator;
+    DefaultSignHeaderPolicy sign_header_policy;
+    SignService sign_service;
+};
+
+} // namespace
+
+TEST_F(VerifyServiceTest, batch_single_flush)
+{
+    std::vector<SecuredMessage> messages;
+    for (unsigned i = 0; i < 8; ++i) {
+        messages.push_back(create_secured_message());
+    }
+
+    BatchVerifyService verify = straight_batch_verify_service(runtime, certificate_provider, certificate_validator,
+            counting_backend, cert_cache, sign_header_policy, position_provider);
+    std::vector<VerifyRequest> requests(messages.begin(), messages.end());
+    std::vector<VerifyConfirm> confirms = verify(std::move(requests));
+
+    ASSERT_EQ(messages.size(), confirms.size());
+    for (const VerifyConfirm& confirm : confirms) {
+        EXPECT_EQ(VerificationReport::Success, confirm.report);
+        EXPECT_EQ(aid::DEN, confirm.its_aid);
+    }
+
+    // each message has a single candidate, hence all signatures are checked by one batch
+    EXPECT_EQ(1, counting_backend.batches);
+    EXPECT_EQ(messages.size(), counting_backend.batched_checks);
+    EXPECT_EQ(0, counting_backend.single_checks);
+}
+
+TEST_F(VerifyServiceTest, batch_mixed_signatures)
+{
+    std::vector<SecuredMessage> messages;
+    messages.push_back(create_secured_message());
+    messages.push_back(create_false_signature());
+    messages.push_back(create_truncated_signature());
+    messages.push_back(create_secured_message());
+    messages.push_back(create_false_signature());
+
+    BatchVerifyService verify = straight_batch_verify_service(runtime, certificate_provider, certificate_validator,
+            counting_backend, cert_cache, sign_header_policy, position_provider);
+    std::vector<VerifyRequest> requests(messages.begin(), messages.end());
+    std::vector<VerifyConfirm> confirms = verify(std::move(requests));
+
+    // confirms are in order of requests and match those of the straight verify service
+    ASSERT_EQ(messages.size(), confirms.size());
+    VerifyService straight = straight_service();
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        VerifyConfirm expected = straight(VerifyRequest { messages[i] });
+        EXPECT_EQ(expected.report, confirms[i].report) << "message " << i;
+        EXPECT_TRUE(expected.certificate_id == confirms[i].certificate_id) << "message " << i;
+    }
+    EXPECT_EQ(VerificationReport::Success, confirms[0].report);
+    EXPECT_EQ(VerificationReport::False_Signature, confirms[1].report);
+    EXPECT_EQ(VerificationReport::False_Signature, confirms[2].report);
+    EXPECT_EQ(VerificationReport::Success, confirms[3].report);
+    EXPECT_EQ(VerificationReport::False_Signature, confirms[4].report);
+
+    // truncated signature is rejected before any signature check
+    EXPECT_EQ(1, counting_backend.batches);
+    EXPECT_EQ(4, counting_backend.batched_checks);
+}
+
+TEST_F(VerifyServiceTest, batch_empty)
+{
+    BatchVerifyService verify = straight_batch_verify_service(runtime, certificate_provider, certificate_validator,
+            counting_backend, cert_cache, sign_header_policy, position_provider);
+    EXPECT_TRUE(verify({}).empty());
+    EXPECT_EQ(0, counting_backend.batches);
+}
+
+TEST_F(VerifyServiceTest, async_mixed_signatures)
+{
+    VerifyWorkerPool pool(2);
+    AsyncVerifyService verify = async_verify_service(runtime, certificate_provider, certificate_validator, pool,
+            *crypto_backend, cert_cache, sign_header_policy, position_provider);
+
+    std::vector<SecuredMessage> messages;
+    for (unsigned i = 0; i < 10; ++i) {
+        messages.push_back(i % 3 == 1 ? create_false_signature() : create_secured_message());
+    }
+
+    std::vector<boost::optional<VerificationReport>> reports(messages.size());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        verify(VerifyRequest { messages[i] }, [&reports, i](VerifyConfirm&& confirm) {
+            reports[i] = confirm.report;
+        });
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.outstanding() > 0 && std::chrono::steady_clock::now() < deadline) {
+        pool.poll();
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(0, pool.outstanding());
+
+    VerifyService straight = straight_service();
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        ASSERT_TRUE(reports[i]) << "no confirm for message " << i;
+        EXPECT_EQ(straight(VerifyRequest { messages[i] }).report, *reports[i]) << "message " << i;
+        EXPECT_EQ(i % 3 == 1 ? VerificationReport::False_Signature : VerificationReport::Success, *reports[i]);
+    }
+}
+
+TEST_F(VerifyServiceTest, async_callback_ordering)
+{
+    // a single worker completes checks in order of submission
+    VerifyWorkerPool pool(1);
+    AsyncVerifyService verify = async_verify_service(runtime, certificate_provider, certificate_validator, pool,
+            *crypto_backend, cert_cache, sign_header_policy, position_provider);
+
+    std::vector<SecuredMessage> messages;
+    messages.push_back(create_secured_message());
+    messages.push_back(create_truncated_signature());
+    messages.push_back(create_false_signature());
+    messages.push_back(create_secured_message());
+
+    const std::thread::id owner = std::this_thread::get_id();
+    std::vector<std::pair<std::size_t, VerificationReport>> order;
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        verify(VerifyRequest { messages[i] }, [&order, owner, i](VerifyConfirm&& confirm) {
+            EXPECT_EQ(owner, std::this_thread::get_id());
+            order.emplace_back(i, confirm.report);
+        });
+    }
+
+    // failure before signature check is confirmed immediately, all others only by poll
+    ASSERT_EQ(1, order.size());
+    EXPECT_EQ(1, order[0].first);
+    EXPECT_EQ(VerificationReport::False_Signature, order[0].second);
+    EXPECT_EQ(3, pool.outstanding());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.outstanding() > 0 && std::chrono::steady_clock::now() < deadline) {
+        pool.poll();
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(4, order.size());
+    EXPECT_EQ(0, order[1].first);
+    EXPECT_EQ(VerificationReport::Success, order[1].second);
+    EXPECT_EQ(2, order[2].first);
+    EXPECT_EQ(VerificationReport::False_Signature, order[2].second);
+    EXPECT_EQ(3, order[3].first);
+    EXPECT_EQ(VerificationReport::Success, order[3].second);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <vanetza/security/verify_worker_pool.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace vanetza;
+using namespace vanetza::security;
+
+namespace
+{
+
+// accepts signatures of digests starting with 0x01
+class FakeBackend : public Backend
+{
+public:
+    EcdsaSignature sign_data(const ecdsa256::PrivateKey&, const ByteBuffer&) override
+    {
+        return EcdsaSignature();
+    }
+
+    EcdsaSignature sign_digest(const ecdsa256::PrivateKey&, const Sha256Digest&) override
+    {
+        return EcdsaSignature();
+    }
+
+    bool verify_data(const ecdsa256::PublicKey&, const ByteBuffer&, const EcdsaSignature&) override
+    {
+        return false;
+    }
+
+    bool verify_digest(const ecdsa256::PublicKey&, const Sha256Digest& digest, const EcdsaSignature&) override
+    {
+        return digest.front() == 0x01;
+    }
+
+    boost::optional<Uncompressed> decompress_point(const EccPoint&) override
+    {
+        return boost::none;
+    }
+};
+
+class VerifyWorkerPoolTest : public ::testing::Test
+{
+protected:
+    VerifyWorkerPoolTest()
+    {
+        factory.add("Fake", []() { return std::unique_ptr<Backend> { new FakeBackend() }; });
+    }
+
+    void wait_for(VerifyWorkerPool& pool, std::size_t expected)
+    {
+        std::size_t polled = 0;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (polled < expected && std::chrono::steady_clock::now() < deadline) {
+            polled += pool.poll();
+            std::this_thread::yield();
+        }
+        ASSERT_EQ(expected, polled);
+    }
+
+    static Sha256Digest make_digest(uint8_t first)
+    {
+        Sha256Digest digest;
+        digest.fill(0x42);
+        digest.front() = first;
+        return digest;
+    }
+
+    Factory<Backend> factory;
+    ecdsa256::PublicKey key;
+    EcdsaSignature signature;
+};
+
+} // namespace
+
+TEST_F(VerifyWorkerPoolTest, unknown_backend)
+{
+    EXPECT_THROW(VerifyWorkerPool(1, "Unknown", 8, factory), std::invalid_argument);
+    EXPECT_THROW(VerifyWorkerPool(0, "Fake", 8, factory), std::invalid_argument);
+}
+
+TEST_F(VerifyWorkerPoolTest, results)
+{
+    VerifyWorkerPool pool(3, "Fake", 4, factory);
+    std::atomic<unsigned> ready_calls { 0 };
+    pool.ready = [&ready_calls]() { ++ready_calls; };
+
+    const std::size_t count = 100;
+    std::vector<int> results(count, -1);
+    for (std::size_t i = 0; i < count; ++i) {
+        pool.submit(key, make_digest(i % 2), signature, [&results, i](bool verified) { results[i] = verified; });
+    }
+
+    wait_for(pool, count);
+    EXPECT_EQ(0, pool.outstanding());
+    EXPECT_LT(0, ready_calls.load());
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(i % 2, results[i]) << "check " << i;
+    }
+}
+
+TEST_F(VerifyWorkerPoolTest, submit_from_callback)
+{
+    VerifyWorkerPool pool(1, "Fake", 32, factory);
+    bool second = false;
+    pool.submit(key, make_digest(0x00), signature, [&](bool verified) {
+        EXPECT_FALSE(verified);
+        pool.submit(key, make_digest(0x01), signature, [&](bool verified) { second = verified; });
+    });
+
+    wait_for(pool, 2);
+    EXPECT_TRUE(second);
+    EXPECT_EQ(0, pool.poll());
+}
+
+TEST_F(VerifyWorkerPoolTest, outstanding_until_polled)
+{
+    VerifyWorkerPool pool(2, "Fake", 32, factory);
+    pool.submit(key, make_digest(0x01), signature, nullptr);
+    pool.submit(key, make_digest(0x01), signature, nullptr);
+    EXPECT_EQ(2, pool.outstanding());
+    wait_for(pool, 2);
+    EXPECT_EQ(0, pool.outstanding());
+}
@@ -7,8 +7,11 @@
 #include <vanetza/security/sign_header_policy.hpp>
 #include <vanetza/security/sign_service.hpp>
 #include <vanetza/security/verify_service.hpp>
+#include <vanetza/security/verify_worker_pool.hpp>
 #include <boost/optional.hpp>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 namespace vanetza
 {
@@ -47,14 +50,12 @@ bool check_generation_time(const SecuredMessageV2& message, Clock::time_point no
     return valid;
 }
 
-bool check_generation_location(const SecuredMessageV2& message, const Certificate& cert)
+bool check_generation_location(const IntX* its_aid, const ThreeDLocation* generation_location, const Certificate& cert)
 {
-    const IntX* its_aid = message.header_field<HeaderFieldType::Its_Aid>();
     if (its_aid && aid::CA == *its_aid) {
         return true; // no check required for CAMs, field not even allowed
     }
 
-    const ThreeDLocation* generation_location = message.header_field<HeaderFieldType::Generation_Location>();
     if (generation_location) {
         auto region = cert.get_restriction<ValidityRestrictionType::Region>();
 
@@ -120,24 +121,58 @@ bool assign_permissions(const Certificate& certificate, VerifyConfirm& confirm)
     return false;
 }
 
-} // namespace
-
-VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& cert_provider, CertificateValidator& certs, Backend& backend, CertificateCache& cert_cache, SignHeaderPolicy& sign_policy, PositionProvider& positioning)
+/**
+ * State of a verification between its preparation and the signature checks' completion
+ */
+struct PendingVerification
 {
-    return [&](VerifyRequest&& request) -> VerifyConfirm {
+    VerifyConfirm confirm;
+    std::vector<Certificate> candidates; /*< authorization tickets possibly signing the message */
+    std::vector<ecdsa256::PublicKey> public_keys; /*< public key of each candidate */
+    boost::optional<VerifyConfirm> fallback; /*< confirm if none of the candidates signed the message */
+    Sha256Digest digest; /*< digest of signed message fields */
+    EcdsaSignature signature;
+    HashedId8 signer_hash;
+    bool candidates_from_cache = false;
+    bool signed_by_digest = false;
+    boost::optional<IntX> its_aid;
+    boost::optional<ThreeDLocation> generation_location;
+};
+
+/**
+ * StraightVerifier splits the straight verify service into the checks before and after signature verification.
+ * This allows signature checks of several messages to be batched or deferred to worker threads.
+ */
+class StraightVerifier
+{
+public:
+    StraightVerifier(const Runtime& rt, CertificateProvider& cert_provider, CertificateValidator& certs, Backend& backend,
+            CertificateCache& cert_cache, SignHeaderPolicy& sign_policy, PositionProvider& positioning) :
+        rt(rt), cert_provider(cert_provider), certs(certs), backend(backend),
+        cert_cache(cert_cache), sign_policy(sign_policy), positioning(positioning)
+    {
+    }
+
+    /**
+     * Run all checks preceding the signature verification
+     * \param secured_message message to verify
+     * \param pending verification state, its confirm is final if false is returned
+     * \return true if signature of at least one candidate needs to be verified
+     */
+    bool prepare(const SecuredMessage& secured_message, PendingVerification& pending) const
+    {
         // TODO check if certificates in chain have been revoked for all CA certificates, ATs are never revoked
 
-        VerifyConfirm confirm;
-        const SecuredMessage& secured_message = request.secured_message;
+        VerifyConfirm& confirm = pending.confirm;
 
         if (PayloadType::Signed != secured_message.payload.type) {
             confirm.report = VerificationReport::Unsigned_Message;
-            return confirm;
+            return false;
         }
 
         if (2 != secured_message.protocol_version()) {
             confirm.report = VerificationReport::Incompatible_Protocol;
-            return confirm;
+            return false;
         }
 
         const std::list<HashedId3>* requested_certs = secured_message.header_field<HeaderFieldType::Request_Unrecognized_Certificate>();
@@ -159,47 +194,53 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
         if (!its_aid) {
             // ITS-AID is required to be present, report as incompatible protocol, as that's the closest match
             confirm.report = VerificationReport::Incompatible_Protocol;
-            return confirm;
+            return false;
         }
         confirm.its_aid = its_aid->get();
 
         const SignerInfo* signer_info = secured_message.header_field<HeaderFieldType::Signer_Info>();
-        std::list<Certificate> possible_certificates;
-        bool possible_certificates_from_cache = false;
+        std::list<CertificateCache::Signer> possible_certificates;
 
         // use a dummy hash for initialization
-        HashedId8 signer_hash;
+        HashedId8& signer_hash = pending.signer_hash;
         signer_hash.fill(0x00);
 
         if (signer_info) {
             switch (get_type(*signer_info)) {
                 case SignerInfoType::Certificate:
-                    possible_certificates.push_back(boost::get<Certificate>(*signer_info));
-                    signer_hash = calculate_hash(boost::get<Certificate>(*signer_info));
+                {
+                    const Certificate& cert = boost::get<Certificate>(*signer_info);
+                    signer_hash = calculate_hash(cert);
 
-                    if (confirm.its_aid == aid::CA && cert_cache.lookup(signer_hash, SubjectType::Authorization_Ticket).size() == 0) {
+                    // a verified signer's certificate needs no further validation
+                    boost::optional<ecdsa256::PublicKey> verified_key = cert_cache.lookup_verified(signer_hash, cert);
+                    pending.candidates_from_cache = verified_key.is_initialized();
+                    possible_certificates.push_back(CertificateCache::Signer { cert, verified_key });
+
+                    if (!verified_key && confirm.its_aid == aid::CA && cert_cache.lookup(signer_hash, SubjectType::Authorization_Ticket).size() == 0) {
                         // Previously unknown certificate, send own certificate in next CAM
                         // See TS 103 097 v1.2.1, section 7.1, 1st bullet, 3rd dash
                         sign_policy.request_certificate();
                     }
-
+                }
                     break;
                 case SignerInfoType::Certificate_Digest_With_SHA256:
                     signer_hash = boost::get<HashedId8>(*signer_info);
-                    possible_certificates.splice(possible_certificates.end(), cert_cache.lookup(signer_hash, SubjectType::Authorization_Ticket));
-                    possible_certificates_from_cache = true;
+                    possible_certificates.splice(possible_certificates.end(), cert_cache.lookup_signers(signer_hash));
+                    pending.candidates_from_cache = true;
+                    pending.signed_by_digest = true;
                     break;
                 case SignerInfoType::Certificate_Chain:
                 {
                     std::list<Certificate> chain = boost::get<std::list<Certificate>>(*signer_info);
                     if (chain.size() == 0) {
                         confirm.report = VerificationReport::Signer_Certificate_Not_Found;
-                        return confirm;
+                        return false;
                     } else if (chain.size() > 3) {
                         // prevent DoS by sending very long chains, maximum length is three certificates, because:
                         // AT → AA → Root and no other signatures are allowed, sending the Root is optional
                         confirm.report = VerificationReport::Invalid_Certificate;
-                        return confirm;
+                        return false;
                     }
                     // pre-check chain certificates, otherwise they're not available for the ticket check
                     for (auto& cert : chain) {
@@ -212,7 +253,7 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
                             if (!validity) {
                                 confirm.report = VerificationReport::Invalid_Certificate;
                                 confirm.certificate_validity = validity;
-                                return confirm;
+                                return false;
                             }
 
                             // We won't cache outdated or premature certificates in the cache and abort early.
@@ -220,7 +261,7 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
                             // but it's an optimization and saves us from polluting the cache with such certificates.
                             if (!check_certificate_time(cert, rt.now()) || !check_certificate_region(cert, positioning.position_fix())) {
                                 confirm.report = VerificationReport::Invalid_Certificate;
-                                return confirm;
+                                return false;
                             }
 
                             cert_cache.insert(cert);
@@ -228,12 +269,12 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
                     }
                     // last certificate must be the authorization ticket
                     signer_hash = calculate_hash(chain.back());
-                    possible_certificates.push_back(chain.back());
+                    possible_certificates.push_back(CertificateCache::Signer { chain.back(), boost::none });
                 }
                     break;
                 default:
                     confirm.report = VerificationReport::Unsupported_Signer_Identifier_Type;
-                    return confirm;
+                    return false;
                     break;
             }
         }
@@ -242,12 +283,12 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
             confirm.report = VerificationReport::Signer_Certificate_Not_Found;
             confirm.certificate_id = signer_hash;
             sign_policy.request_unrecognized_certificate(signer_hash);
-            return confirm;
+            return false;
         }
 
         if (!check_generation_time(secured_message, rt.now())) {
             confirm.report = VerificationReport::Invalid_Timestamp;
-            return confirm;
+            return false;
         }
 
         // TODO check Duplicate_Message, Invalid_Mobility_Data, Unencrypted_Message, Decryption_Error
@@ -258,12 +299,12 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
 
         if (!signature) {
             confirm.report = VerificationReport::Unsigned_Message;
-            return confirm;
+            return false;
         }
 
         if (PublicKeyAlgorithm::ECDSA_NISTP256_With_SHA256 != get_type(*signature)) {
             confirm.report = VerificationReport::False_Signature;
-            return confirm;
+            return false;
         }
 
         // check the size of signature.R and siganture.s
@@ -271,40 +312,77 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
         const auto field_len = field_size(PublicKeyAlgorithm::ECDSA_NISTP256_With_SHA256);
         if (!ecdsa || ecdsa->s.size() != field_len) {
             confirm.report = VerificationReport::False_Signature;
-            return confirm;
+            return false;
         }
 
-        // verify payload signature with given signature
-        ByteBuffer payload = convert_for_signing(secured_message, secured_message.trailer_fields);
-        boost::optional<Certificate> signer;
-
-        for (const auto& cert : possible_certificates) {
+        // Candidates are tried in order until one has signed the message. An unsuitable candidate
+        // ends this search, i.e. its report applies only if all candidates before have been tried in vain.
+        for (const auto& candidate : possible_certificates) {
+            const Certificate& cert = candidate.certificate;
             SubjectType subject_type = cert.subject_info.subject_type;
             if (subject_type != SubjectType::Authorization_Ticket) {
-                confirm.report = VerificationReport::Invalid_Certificate;
-                confirm.certificate_validity = CertificateInvalidReason::Invalid_Signer;
-                return confirm;
+                pending.fallback = confirm;
+                pending.fallback->report = VerificationReport::Invalid_Certificate;
+                pending.fallback->certificate_validity = CertificateInvalidReason::Invalid_Signer;
+                break;
             }
 
-            boost::optional<ecdsa256::PublicKey> public_key = get_public_key(cert, backend);
-
-            // public key could not be extracted
+            // verified signers come with their public key, saving the point decompression
+            boost::optional<ecdsa256::PublicKey> public_key = candidate.public_key;
             if (!public_key) {
-                confirm.report = VerificationReport::Invalid_Certificate;
-                confirm.certificate_validity = CertificateInvalidReason::Missing_Public_Key;
-                return confirm;
+                public_key = get_public_key(cert, backend);
             }
 
-            if (backend.verify_data(public_key.get(), payload, *ecdsa)) {
-                signer = cert;
+            // public key could not be extracted
+            if (!public_key) {
+                pending.fallback = confirm;
+                pending.fallback->report = VerificationReport::Invalid_Certificate;
+                pending.fallback->certificate_validity = CertificateInvalidReason::Missing_Public_Key;
                 break;
             }
+
+            pending.candidates.push_back(cert);
+            pending.public_keys.push_back(*public_key);
         }
 
-        if (!signer) {
+        if (pending.candidates.empty()) {
+            confirm = *pending.fallback;
+            return false;
+        }
+
+        // verify payload signature with given signature
+        pending.digest = calculate_signing_digest(secured_message, secured_message.trailer_fields);
+        pending.signature = std::move(*ecdsa);
+
+        // keep header fields required after signature verification, message might be gone by then
+        pending.its_aid = *its_aid;
+        const ThreeDLocation* generation_location = secured_message.header_field<HeaderFieldType::Generation_Location>();
+        if (generation_location) {
+            pending.generation_location = *generation_location;
+        }
+
+        return true;
+    }
+
+    /**
+     * Run all checks following the signature verification
+     * \param pending prepared verification
+     * \param signer index of candidate whose signature matched, none if no candidate matched
+     * \return final confirm
+     */
+    VerifyConfirm complete(PendingVerification& pending, boost::optional<std::size_t> signer_index) const
+    {
+        VerifyConfirm& confirm = pending.confirm;
+        const HashedId8& signer_hash = pending.signer_hash;
+
+        if (!signer_index) {
+            if (pending.fallback) {
+                return std::move(*pending.fallback);
+            }
+
             // HashedId8 of authorization tickets is not guaranteed to be globally unique.
             // The collision probability is rather low, but it might happen.
-            if (signer_info && get_type(*signer_info) == SignerInfoType::Certificate_Digest_With_SHA256) {
+            if (pending.signed_by_digest) {
                 // assume a hash collision since we got only a digest with message
                 confirm.report = VerificationReport::Signer_Certificate_Not_Found;
             } else {
@@ -314,19 +392,21 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
 
             confirm.certificate_id = signer_hash;
             sign_policy.request_unrecognized_certificate(signer_hash);
-            return confirm;
+            return std::move(confirm);
         }
 
+        const Certificate& signer = pending.candidates.at(*signer_index);
+
         // we can only check the generation location after we have identified the correct certificate
-        if (!check_generation_location(secured_message, *signer)) {
+        if (!check_generation_location(pending.its_aid.get_ptr(), pending.generation_location.get_ptr(), signer)) {
             confirm.report = VerificationReport::Invalid_Certificate;
             confirm.certificate_validity = CertificateInvalidReason::Off_Region;
-            return confirm;
+            return std::move(confirm);
         }
 
         CertificateValidity cert_validity = CertificateValidity::valid();
-        if (!possible_certificates_from_cache) { // certificates from cache are already verified as trusted
-            cert_validity = certs.check_certificate(*signer);
+        if (!pending.candidates_from_cache) { // certificates from cache are already verified as trusted
+            cert_validity = certs.check_certificate(signer);
         }
 
         confirm.certificate_validity = cert_validity;
@@ -336,42 +416,163 @@ VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& ce
             confirm.report = VerificationReport::Invalid_Certificate;
 
             if (cert_validity.reason() == CertificateInvalidReason::Unknown_Signer) {
-                if (get_type(signer->signer_info) == SignerInfoType::Certificate_Digest_With_SHA256) {
-                    auto signer_hash = boost::get<HashedId8>(signer->signer_info);
+                if (get_type(signer.signer_info) == SignerInfoType::Certificate_Digest_With_SHA256) {
+                    auto signer_hash = boost::get<HashedId8>(signer.signer_info);
                     confirm.certificate_id = signer_hash;
                     sign_policy.request_unrecognized_certificate(signer_hash);
                 }
             }
 
-            return confirm;
+            return std::move(confirm);
         }
 
-        if (!check_certificate_time(*signer, rt.now())) {
+        if (!check_certificate_time(signer, rt.now())) {
             confirm.report = VerificationReport::Invalid_Certificate;
             confirm.certificate_validity = CertificateInvalidReason::Off_Time_Period;
-            return confirm;
+            return std::move(confirm);
         }
 
-        if (!check_certificate_region(*signer, positioning.position_fix())) {
+        if (!check_certificate_region(signer, positioning.position_fix())) {
             confirm.report = VerificationReport::Invalid_Certificate;
             confirm.certificate_validity = CertificateInvalidReason::Off_Region;
-            return confirm;
+            return std::move(confirm);
         }
 
         // Assign permissions from the certificate based on the message AID already present in the confirm
         // and reject the certificate if no permissions are present for the claimed AID.
-        if (!assign_permissions(*signer, confirm)) {
+        if (!assign_permissions(signer, confirm)) {
             // This might seem weird, because the certificate itself is valid, but not for the received message.
             confirm.report = VerificationReport::Invalid_Certificate;
             confirm.certificate_validity = CertificateInvalidReason::Insufficient_ITS_AID;
-            return confirm;
+            return std::move(confirm);
         }
 
         // cache only certificates that are useful, one that mismatches its restrictions isn't
-        cert_cache.insert(*signer);
+        cert_cache.insert(signer, pending.public_keys.at(*signer_index));
 
         confirm.report = VerificationReport::Success;
-        return confirm;
+        return std::move(confirm);
+    }
+
+    /**
+     * Verify signature of pending verification's candidates one after another
+     * \param pending prepared verification
+     * \return index of signing candidate if any
+     */
+    boost::optional<std::size_t> verify(const PendingVerification& pending) const
+    {
+        for (std::size_t i = 0; i < pending.candidates.size(); ++i) {
+            if (backend.verify_digest(pending.public_keys[i], pending.digest, pending.signature)) {
+                return i;
+            }
+        }
+        return boost::none;
+    }
+
+    Backend& crypto_backend() const { return backend; }
+
+private:
+    const Runtime& rt;
+    CertificateProvider& cert_provider;
+    CertificateValidator& certs;
+    Backend& backend;
+    CertificateCache& cert_cache;
+    SignHeaderPolicy& sign_policy;
+    PositionProvider& positioning;
+};
+
+void submit_candidate(const StraightVerifier& verifier, VerifyWorkerPool& pool,
+        std::shared_ptr<PendingVerification> pending, std::size_t index, VerifyCallback callback)
+{
+    const ecdsa256::PublicKey& public_key = pending->public_keys[index];
+    EcdsaSignature signature = pending->signature;
+    pool.submit(public_key, pending->digest, std::move(signature),
+        [verifier, &pool, pending, index, callback](bool verified) {
+            if (verified) {
+                callback(verifier.complete(*pending, index));
+            } else if (index + 1 < pending->candidates.size()) {
+                submit_candidate(verifier, pool, pending, index + 1, callback);
+            } else {
+                callback(verifier.complete(*pending, boost::none));
+            }
+        });
+}
+
+} // namespace
+
+VerifyService straight_verify_service(const Runtime& rt, CertificateProvider& cert_provider, CertificateValidator& certs, Backend& backend, CertificateCache& cert_cache, SignHeaderPolicy& sign_policy, PositionProvider& positioning)
+{
+    const StraightVerifier verifier(rt, cert_provider, certs, backend, cert_cache, sign_policy, positioning);
+    return [verifier](VerifyRequest&& request) -> VerifyConfirm {
+        PendingVerification pending;
+        if (!verifier.prepare(request.secured_message, pending)) {
+            return std::move(pending.confirm);
+        }
+        return verifier.complete(pending, verifier.verify(pending));
+    };
+}
+
+BatchVerifyService straight_batch_verify_service(const Runtime& rt, CertificateProvider& cert_provider, CertificateValidator& certs, Backend& backend, CertificateCache& cert_cache, SignHeaderPolicy& sign_policy, PositionProvider& positioning)
+{
+    const StraightVerifier verifier(rt, cert_provider, certs, backend, cert_cache, sign_policy, positioning);
+    return [verifier](std::vector<VerifyRequest>&& requests) -> std::vector<VerifyConfirm> {
+        std::vector<PendingVerification> pendings(requests.size());
+        std::vector<bool> prepared(requests.size());
+        std::vector<boost::optional<std::size_t>> signers(requests.size());
+
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            prepared[i] = verifier.prepare(requests[i].secured_message, pendings[i]);
+        }
+
+        // n-th round checks n-th candidate of each message not yet attributed to a signer
+        std::vector<SignatureCheck> checks;
+        std::vector<std::size_t> owners;
+        for (std::size_t round = 0;; ++round) {
+            checks.clear();
+            owners.clear();
+            for (std::size_t i = 0; i < pendings.size(); ++i) {
+                const PendingVerification& pending = pendings[i];
+                if (prepared[i] && !signers[i] && round < pending.candidates.size()) {
+                    checks.emplace_back(pending.public_keys[round], pending.digest, pending.signature);
+                    owners.push_back(i);
+                }
+            }
+
+            if (checks.empty()) {
+                break;
+            }
+
+            verifier.crypto_backend().verify_batch(checks);
+            for (std::size_t c = 0; c < checks.size(); ++c) {
+                if (checks[c].verified) {
+                    signers[owners[c]] = round;
+                }
+            }
+        }
+
+        std::vector<VerifyConfirm> confirms;
+        confirms.reserve(requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            if (prepared[i]) {
+                confirms.push_back(verifier.complete(pendings[i], signers[i]));
+            } else {
+                confirms.push_back(std::move(pendings[i].confirm));
+            }
+        }
+        return confirms;
+    };
+}
+
+AsyncVerifyService async_verify_service(const Runtime& rt, CertificateProvider& cert_provider, CertificateValidator& certs, VerifyWorkerPool& pool, Backend& backend, CertificateCache& cert_cache, SignHeaderPolicy& sign_policy, PositionProvider& positioning)
+{
+    const StraightVerifier verifier(rt, cert_provider, certs, backend, cert_cache, sign_policy, positioning);
+    return [verifier, &pool](VerifyRequest&& request, VerifyCallback callback) {
+        auto pending = std::make_shared<PendingVerification>();
+        if (!verifier.prepare(request.secured_message, *pending)) {
+            callback(std::move(pending->confirm));
+        } else {
+            submit_candidate(verifier, pool, pending, 0, std::move(callback));
+        }
     };
 }
 
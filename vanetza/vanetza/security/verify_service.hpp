@@ -8,6 +8,7 @@
 #include <vanetza/security/int_x.hpp>
 #include <vanetza/security/secured_message.hpp>
 #include <functional>
+#include <vector>
 
 namespace vanetza
 {
@@ -25,6 +26,7 @@ class CertificateCache;
 class CertificateProvider;
 class CertificateValidator;
 class SignHeaderPolicy;
+class VerifyWorkerPool;
 
 enum class VerificationReport
 {
@@ -64,6 +66,21 @@ struct VerifyConfirm
  */
 using VerifyService = std::function<VerifyConfirm(VerifyRequest&&)>;
 
+/**
+ * Verify service processing several requests at once, confirms are returned in order of requests
+ */
+using BatchVerifyService = std::function<std::vector<VerifyConfirm>(std::vector<VerifyRequest>&&)>;
+
+/**
+ * Callback receiving confirm of an asynchronous verification
+ */
+using VerifyCallback = std::function<void(VerifyConfirm&&)>;
+
+/**
+ * Verify service deferring signature checks, confirm is passed to callback
+ */
+using AsyncVerifyService = std::function<void(VerifyRequest&&, VerifyCallback)>;
+
 /**
  * Get verify service with basic certificate and signature checks
  * \param rt runtime
@@ -76,6 +93,39 @@ using VerifyService = std::function<VerifyConfirm(VerifyRequest&&)>;
  */
 VerifyService straight_verify_service(const Runtime&, CertificateProvider&, CertificateValidator&, Backend&, CertificateCache&, SignHeaderPolicy&, PositionProvider&);
 
+/**
+ * Get batch verify service with same checks as straight verify service
+ *
+ * Signatures of all requests are passed at once to Backend::verify_batch.
+ *
+ * \param rt runtime
+ * \param certificate_provider certificate provider
+ * \param certificate_validator certificate validator
+ * \param backend crypto backend
+ * \param certificate_cache certificate cache
+ * \param sign_header_policy sign header policy to report unknown certificates
+ * \return callable batch verify service
+ */
+BatchVerifyService straight_batch_verify_service(const Runtime&, CertificateProvider&, CertificateValidator&, Backend&, CertificateCache&, SignHeaderPolicy&, PositionProvider&);
+
+/**
+ * Get asynchronous verify service with same checks as straight verify service
+ *
+ * Certificate checks take place immediately, signature checks are run by the worker pool.
+ * Callback is invoked immediately if verification fails before signature checks,
+ * otherwise it is invoked by VerifyWorkerPool::poll.
+ *
+ * \param rt runtime
+ * \param certificate_provider certificate provider
+ * \param certificate_validator certificate validator
+ * \param pool worker pool checking signatures
+ * \param backend crypto backend used for extracting public keys
+ * \param certificate_cache certificate cache
+ * \param sign_header_policy sign header policy to report unknown certificates
+ * \return callable asynchronous verify service
+ */
+AsyncVerifyService async_verify_service(const Runtime&, CertificateProvider&, CertificateValidator&, VerifyWorkerPool&, Backend&, CertificateCache&, SignHeaderPolicy&, PositionProvider&);
+
 /**
  * Get insecure dummy verify service without any checks
  * \param report confirm report result
@@ -0,0 +1,117 @@
+#include <vanetza/security/verify_worker_pool.hpp>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+namespace vanetza
+{
+namespace security
+{
+
+VerifyWorkerPool::VerifyWorkerPool(std::size_t workers, const std::string& backend, std::size_t batch,
+        const Factory<Backend>& factory) :
+    m_batch(std::max<std::size_t>(batch, 1)), m_outstanding(0), m_stop(false)
+{
+    if (workers == 0) {
+        throw std::invalid_argument("verify worker pool requires at least one worker");
+    }
+
+    // backends are created upfront, so failures are reported to the pool's creator
+    std::vector<std::shared_ptr<Backend>> backends;
+    for (std::size_t i = 0; i < workers; ++i) {
+        std::shared_ptr<Backend> instance = create_backend(backend, factory);
+        if (!instance) {
+            throw std::invalid_argument("unknown crypto backend: " + backend);
+        }
+        backends.push_back(std::move(instance));
+    }
+
+    for (auto& instance : backends) {
+        m_workers.emplace_back([this, instance]() { work(*instance); });
+    }
+}
+
+VerifyWorkerPool::~VerifyWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void VerifyWorkerPool::submit(const ecdsa256::PublicKey& public_key, const Sha256Digest& digest, EcdsaSignature signature, Callback callback)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(Job { public_key, digest, std::move(signature), std::move(callback), false });
+        ++m_outstanding;
+    }
+    m_condition.notify_one();
+}
+
+std::size_t VerifyWorkerPool::poll()
+{
+    std::vector<Job> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        completed.swap(m_completed);
+        m_outstanding -= completed.size();
+    }
+
+    // callbacks may submit further checks, hence they are invoked without holding the lock
+    for (Job& job : completed) {
+        if (job.callback) {
+            job.callback(job.verified);
+        }
+    }
+    return completed.size();
+}
+
+std::size_t VerifyWorkerPool::outstanding() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_outstanding;
+}
+
+void VerifyWorkerPool::work(Backend& backend)
+{
+    std::vector<Job> jobs;
+    std::vector<SignatureCheck> checks;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_stop) {
+                break;
+            }
+
+            const std::size_t count = std::min(m_batch, m_queue.size());
+            std::move(m_queue.begin(), m_queue.begin() + count, std::back_inserter(jobs));
+            m_queue.erase(m_queue.begin(), m_queue.begin() + count);
+        }
+
+        checks.clear();
+        for (const Job& job : jobs) {
+            checks.emplace_back(job.public_key, job.digest, job.signature);
+        }
+        backend.verify_batch(checks);
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            jobs[i].verified = checks[i].verified;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::move(jobs.begin(), jobs.end(), std::back_inserter(m_completed));
+        }
+        jobs.clear();
+        ready();
+    }
+}
+
+} // namespace security
+} // namespace vanetza
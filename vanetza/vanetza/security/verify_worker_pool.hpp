@@ -0,0 +1,106 @@
+#ifndef VERIFY_WORKER_POOL_HPP_K2TQ8VNE
+#define VERIFY_WORKER_POOL_HPP_K2TQ8VNE
+
+#include <vanetza/common/factory.hpp>
+#include <vanetza/common/hook.hpp>
+#include <vanetza/security/backend.hpp>
+#include <vanetza/security/ecdsa256.hpp>
+#include <vanetza/security/sha.hpp>
+#include <vanetza/security/signature.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vanetza
+{
+namespace security
+{
+
+/**
+ * VerifyWorkerPool checks ECDSA signatures on a set of worker threads.
+ *
+ * Each worker owns its crypto backend and passes up to a batch of queued checks at once
+ * to Backend::verify_batch, i.e. checks of the same signer share their key preparation.
+ * Results are collected and handed back by poll() on the thread owning the pool,
+ * thus result callbacks need not be thread-safe.
+ */
+class VerifyWorkerPool
+{
+public:
+    using Callback = std::function<void(bool verified)>;
+
+    /**
+     * Create pool and start its worker threads
+     * \param workers number of worker threads (at least one)
+     * \param backend name of crypto backend created for each worker, see create_backend
+     * \param batch maximum number of checks passed to backend at once
+     * \param factory factory creating backends
+     */
+    VerifyWorkerPool(std::size_t workers, const std::string& backend = "default", std::size_t batch = 32,
+            const Factory<Backend>& factory = builtin_backends());
+    VerifyWorkerPool(const VerifyWorkerPool&) = delete;
+    VerifyWorkerPool& operator=(const VerifyWorkerPool&) = delete;
+
+    /**
+     * Stop workers, queued checks are discarded without invoking their callbacks
+     */
+    ~VerifyWorkerPool();
+
+    /**
+     * Queue a signature check (thread-safe)
+     * \param public_key signer's public key
+     * \param digest SHA256 digest of signed data
+     * \param signature signature of data
+     * \param callback invoked with check result by poll()
+     */
+    void submit(const ecdsa256::PublicKey& public_key, const Sha256Digest& digest, EcdsaSignature signature, Callback callback);
+
+    /**
+     * Invoke callbacks of all completed checks
+     * \return number of invoked callbacks
+     */
+    std::size_t poll();
+
+    /**
+     * Get number of submitted checks whose callbacks have not been invoked yet
+     * \return number of outstanding checks
+     */
+    std::size_t outstanding() const;
+
+    /**
+     * Ready hook is invoked by a worker thread whenever new results are available for poll().
+     * Owners can use it to wake up their thread, hook callback must be thread-safe.
+     */
+    Hook<> ready;
+
+private:
+    struct Job
+    {
+        ecdsa256::PublicKey public_key;
+        Sha256Digest digest;
+        EcdsaSignature signature;
+        Callback callback;
+        bool verified;
+    };
+
+    void work(Backend&);
+
+    const std::size_t m_batch;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<Job> m_queue;
+    std::vector<Job> m_completed;
+    std::size_t m_outstanding;
+    bool m_stop;
+    std::vector<std::thread> m_workers;
+};
+
+} // namespace security
+} // namespace vanetza
+
+#endif /* VERIFY_WORKER_POOL_HPP_K2TQ8VNE */